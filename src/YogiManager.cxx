@@ -2,263 +2,482 @@
 #include <algorithm>
 #include <iterator>
 #include <cstring>
+#include <cstddef>
 #include <string>
 #include <sstream>
 #include <cstdlib>
 #include <iostream>
 #include <dlfcn.h>
 #include <fstream>
+#include <cstdint>
+#include <iomanip>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#if defined(OPEN_MPI) && MPI_VERSION < 4
+#include <mpi-ext.h>
+#endif
+
+/* Persistent collectives for YogiX plans: MPI 4's, or the same calls as
+   an Open MPI extension before that. */
+#if MPI_VERSION >= 4
+#define YOGI_ALLREDUCE_INIT MPI_Allreduce_init
+#define YOGI_ALLTOALLV_INIT MPI_Alltoallv_init
+#elif defined(OMPI_HAVE_MPI_EXT_PCOLLREQ)
+#define YOGI_ALLREDUCE_INIT MPIX_Allreduce_init
+#define YOGI_ALLTOALLV_INIT MPIX_Alltoallv_init
+#endif
+
+/* statusToMPI and statusesToMPI hand MPI the caller's YogiMPI_Status
+   storage when it is aligned.  configure checks the size too, before
+   anything is built. */
+static_assert(sizeof(MPI_Status) <= sizeof(int) * MAX_STATUS_SIZE,
+              "MPI_Status does not fit in YogiMPI_Status; raise "
+              "MAX_STATUS_SIZE in yogimpi.h.in");
+#if YogiMPI_STATUS_ALIGNED
+// The aligned layout exists so that no status takes the copies below.
+static_assert(alignof(MPI_Status) <= alignof(YogiMPI_Status) &&
+              offsetof(YogiMPI_Status, realStatus) % alignof(MPI_Status) == 0,
+              "MPI_Status needs more alignment than YogiMPI_Status has");
+#endif
 
-const int YogiManager::defaultPoolSize = 100;
+/* Where MPI's statuses go when the caller's storage is not aligned for
+   them: one for statuses MPI writes, one for those it only reads, and one
+   array. */
+static thread_local MPI_Status alignedStatus;
+static thread_local MPI_Status alignedInputStatus;
+static thread_local std::vector<MPI_Status> alignedStatuses;
+
+// Whether status storage can be handed to MPI as it is.
+static bool statusAligned(const YogiMPI_Status *status) {
+    return (std::uintptr_t) status->realStatus % alignof(MPI_Status) == 0;
+}
+
+// Whether MPI can write an array's statuses packed at its start.
+static bool statusesAligned(const YogiMPI_Status *statuses) {
+    return (std::uintptr_t) statuses % alignof(MPI_Status) == 0;
+}
+
+const int YogiManager::defaultPoolSize = 128;
+const int YogiManager::lookupEmpty = -1;
+const int YogiManager::lookupDeleted = -2;
 
 YogiManager* YogiManager::_instance = 0;
 
-YogiManager* YogiManager::getInstance() {
+thread_local int YogiManager::callDepth = 0;
+thread_local YogiMPI_Op YogiManager::currentOp = -1;
+
+const int YogiManager::errhandlerOffset;
+const int YogiManager::commOffset;
+const int YogiManager::requestOffset;
+const int YogiManager::winOffset;
+const int YogiManager::opOffset;
+const int YogiManager::datatypeOffset;
+const int YogiManager::infoOffset;
+const int YogiManager::groupOffset;
+const int YogiManager::fileOffset;
+const int YogiManager::messageOffset;
+
+MPI_Errhandler YogiManager::predefinedErrhandlers[errhandlerOffset];
+MPI_Comm YogiManager::predefinedComms[commOffset];
+MPI_Op YogiManager::predefinedOps[opOffset];
+MPI_Datatype YogiManager::predefinedDatatypes[datatypeOffset];
+MPI_Group YogiManager::predefinedGroups[groupOffset];
+
+YogiManager* YogiManager::createInstance() {
     if (_instance == 0) {
         _instance = new YogiManager;
     }
     return _instance;
 }
 
+const int YogiConstTable::denseLimit = 4096;
+
+/* Build the table for one direction of translation.  When two pairs share a
+   key, the later pair wins. */
+void YogiConstTable::build(const YogiConstPair *pairs, int count,
+                           bool toYogi) {
+    bool haveDense = false;
+    int high = 0;
+    low = 0;
+    for (int i = 0; i < count; i++) {
+        int key = toYogi ? pairs[i].mpi : pairs[i].yogi;
+        if (key <= -denseLimit || key >= denseLimit) continue;
+        if (!haveDense || key < low) low = key;
+        if (!haveDense || key > high) high = key;
+        haveDense = true;
+    }
+    values.assign(haveDense ? high - low + 1 : 0, 0);
+    known.assign(values.size(), 0);
+    overflow.clear();
+    for (int i = 0; i < count; i++) {
+        int key = toYogi ? pairs[i].mpi : pairs[i].yogi;
+        int value = toYogi ? pairs[i].yogi : pairs[i].mpi;
+        if (key <= -denseLimit || key >= denseLimit) {
+            overflow[key] = value;
+        }
+        else {
+            values[key - low] = value;
+            known[key - low] = 1;
+        }
+    }
+}
+
+int YogiConstTable::findOverflow(int key, int fallback) const {
+    std::map<int, int>::const_iterator it = overflow.find(key);
+    if (it != overflow.end()) return it->second;
+    return fallback;
+}
+
+#define YOGI_ARRAY_LENGTH(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+/* Pairs of {Yogi value, MPI value} for the integer constants translated by
+   the YogiConstTable members. */
+static const YogiConstPair errorPairs[] = {
+    {YogiMPI_SUCCESS,                   MPI_SUCCESS},
+    {YogiMPI_ERR_BUFFER,                MPI_ERR_BUFFER},
+    {YogiMPI_ERR_COUNT,                 MPI_ERR_COUNT},
+    {YogiMPI_ERR_TYPE,                  MPI_ERR_TYPE},
+    {YogiMPI_ERR_TAG,                   MPI_ERR_TAG},
+    {YogiMPI_ERR_COMM,                  MPI_ERR_COMM},
+    {YogiMPI_ERR_RANK,                  MPI_ERR_RANK},
+    {YogiMPI_ERR_REQUEST,               MPI_ERR_REQUEST},
+    {YogiMPI_ERR_ROOT,                  MPI_ERR_ROOT},
+    {YogiMPI_ERR_GROUP,                 MPI_ERR_GROUP},
+    {YogiMPI_ERR_OP,                    MPI_ERR_OP},
+    {YogiMPI_ERR_TOPOLOGY,              MPI_ERR_TOPOLOGY},
+    {YogiMPI_ERR_DIMS,                  MPI_ERR_DIMS},
+    {YogiMPI_ERR_ARG,                   MPI_ERR_ARG},
+    {YogiMPI_ERR_UNKNOWN,               MPI_ERR_UNKNOWN},
+    {YogiMPI_ERR_TRUNCATE,              MPI_ERR_TRUNCATE},
+    {YogiMPI_ERR_OTHER,                 MPI_ERR_OTHER},
+    {YogiMPI_ERR_INTERN,                MPI_ERR_INTERN},
+    {YogiMPI_ERR_PENDING,               MPI_ERR_PENDING},
+    {YogiMPI_ERR_IN_STATUS,             MPI_ERR_IN_STATUS},
+    {YogiMPI_ERR_FILE,                  MPI_ERR_FILE},
+    {YogiMPI_ERR_NOT_SAME,              MPI_ERR_NOT_SAME},
+    {YogiMPI_ERR_AMODE,                 MPI_ERR_AMODE},
+    {YogiMPI_ERR_UNSUPPORTED_DATAREP,   MPI_ERR_UNSUPPORTED_DATAREP},
+    {YogiMPI_ERR_UNSUPPORTED_OPERATION, MPI_ERR_UNSUPPORTED_OPERATION},
+    {YogiMPI_ERR_NO_SUCH_FILE,          MPI_ERR_NO_SUCH_FILE},
+    {YogiMPI_ERR_FILE_EXISTS,           MPI_ERR_FILE_EXISTS},
+    {YogiMPI_ERR_BAD_FILE,              MPI_ERR_BAD_FILE},
+    {YogiMPI_ERR_ACCESS,                MPI_ERR_ACCESS},
+    {YogiMPI_ERR_NO_SPACE,              MPI_ERR_NO_SPACE},
+    {YogiMPI_ERR_QUOTA,                 MPI_ERR_QUOTA},
+    {YogiMPI_ERR_READ_ONLY,             MPI_ERR_READ_ONLY},
+    {YogiMPI_ERR_FILE_IN_USE,           MPI_ERR_FILE_IN_USE},
+    {YogiMPI_ERR_DUP_DATAREP,           MPI_ERR_DUP_DATAREP},
+    {YogiMPI_ERR_CONVERSION,            MPI_ERR_CONVERSION},
+    {YogiMPI_ERR_IO,                    MPI_ERR_IO},
+    {YogiMPI_ERR_INFO,                  MPI_ERR_INFO},
+    {YogiMPI_ERR_INFO_KEY,              MPI_ERR_INFO_KEY},
+    {YogiMPI_ERR_INFO_VALUE,            MPI_ERR_INFO_VALUE},
+    {YogiMPI_ERR_INFO_NOKEY,            MPI_ERR_INFO_NOKEY},
+    {YogiMPI_ERR_NAME,                  MPI_ERR_NAME},
+    {YogiMPI_ERR_NO_MEM,                MPI_ERR_NO_MEM},
+    {YogiMPI_ERR_PORT,                  MPI_ERR_PORT},
+    {YogiMPI_ERR_SERVICE,               MPI_ERR_SERVICE},
+    {YogiMPI_ERR_SPAWN,                 MPI_ERR_SPAWN},
+    {YogiMPI_ERR_WIN,                   MPI_ERR_WIN},
+    {YogiMPI_ERR_KEYVAL,                MPI_ERR_KEYVAL},
+    {YogiMPI_ERR_BASE,                  MPI_ERR_BASE},
+    {YogiMPI_ERR_LOCKTYPE,              MPI_ERR_LOCKTYPE},
+    {YogiMPI_ERR_RMA_CONFLICT,          MPI_ERR_RMA_CONFLICT},
+    {YogiMPI_ERR_RMA_SYNC,              MPI_ERR_RMA_SYNC},
+    {YogiMPI_ERR_SIZE,                  MPI_ERR_SIZE},
+    {YogiMPI_ERR_DISP,                  MPI_ERR_DISP},
+    {YogiMPI_ERR_ASSERT,                MPI_ERR_ASSERT},
+    {YogiMPI_ERR_LASTCODE,              MPI_ERR_LASTCODE},
+};
+
+static const YogiConstPair comparisonPairs[] = {
+    {YogiMPI_IDENT,     MPI_IDENT},
+    {YogiMPI_CONGRUENT, MPI_CONGRUENT},
+    {YogiMPI_SIMILAR,   MPI_SIMILAR},
+    {YogiMPI_UNEQUAL,   MPI_UNEQUAL},
+};
+
+static const YogiConstPair combinerPairs[] = {
+    {YogiMPI_COMBINER_NAMED,            MPI_COMBINER_NAMED},
+    {YogiMPI_COMBINER_DUP,              MPI_COMBINER_DUP},
+    {YogiMPI_COMBINER_CONTIGUOUS,       MPI_COMBINER_CONTIGUOUS},
+    {YogiMPI_COMBINER_VECTOR,           MPI_COMBINER_VECTOR},
+    {YogiMPI_COMBINER_HVECTOR_INTEGER,  MPI_COMBINER_HVECTOR_INTEGER},
+    {YogiMPI_COMBINER_HVECTOR,          MPI_COMBINER_HVECTOR},
+    {YogiMPI_COMBINER_INDEXED,          MPI_COMBINER_INDEXED},
+    {YogiMPI_COMBINER_HINDEXED_INTEGER, MPI_COMBINER_HINDEXED_INTEGER},
+    {YogiMPI_COMBINER_HINDEXED,         MPI_COMBINER_HINDEXED},
+    {YogiMPI_COMBINER_INDEXED_BLOCK,    MPI_COMBINER_INDEXED_BLOCK},
+    {YogiMPI_COMBINER_STRUCT_INTEGER,   MPI_COMBINER_STRUCT_INTEGER},
+    {YogiMPI_COMBINER_STRUCT,           MPI_COMBINER_STRUCT},
+    {YogiMPI_COMBINER_SUBARRAY,         MPI_COMBINER_SUBARRAY},
+    {YogiMPI_COMBINER_DARRAY,           MPI_COMBINER_DARRAY},
+    {YogiMPI_COMBINER_F90_REAL,         MPI_COMBINER_F90_REAL},
+    {YogiMPI_COMBINER_F90_COMPLEX,      MPI_COMBINER_F90_COMPLEX},
+    {YogiMPI_COMBINER_F90_INTEGER,      MPI_COMBINER_F90_INTEGER},
+    {YogiMPI_COMBINER_RESIZED,          MPI_COMBINER_RESIZED},
+};
+
+static const YogiConstPair topoPairs[] = {
+    {YogiMPI_GRAPH,      MPI_GRAPH},
+    {YogiMPI_CART,       MPI_CART},
+#if YogiMPI_VERSION == 3 || YogiMPI_SUBVERSION > 1
+    {YogiMPI_DIST_GRAPH, MPI_DIST_GRAPH},
+#endif
+    {YogiMPI_UNDEFINED,  MPI_UNDEFINED},
+};
+
+static const YogiConstPair threadPairs[] = {
+    {YogiMPI_THREAD_SINGLE,     MPI_THREAD_SINGLE},
+    {YogiMPI_THREAD_FUNNELED,   MPI_THREAD_FUNNELED},
+    {YogiMPI_THREAD_SERIALIZED, MPI_THREAD_SERIALIZED},
+    {YogiMPI_THREAD_MULTIPLE,   MPI_THREAD_MULTIPLE},
+};
+
+static const YogiConstPair commattrPairs[] = {
+    {YogiMPI_TAG_UB,          MPI_TAG_UB},
+    {YogiMPI_IO,              MPI_IO},
+    {YogiMPI_HOST,            MPI_HOST},
+    {YogiMPI_WTIME_IS_GLOBAL, MPI_WTIME_IS_GLOBAL},
+    {YogiMPI_APPNUM,          MPI_APPNUM},
+};
+
+static const YogiConstPair winattrPairs[] = {
+    {YogiMPI_WIN_BASE,      MPI_WIN_BASE},
+    {YogiMPI_WIN_DISP_UNIT, MPI_WIN_DISP_UNIT},
+    {YogiMPI_WIN_SIZE,      MPI_WIN_SIZE},
+};
+
+static const YogiConstPair locktypePairs[] = {
+    {YogiMPI_LOCK_EXCLUSIVE, MPI_LOCK_EXCLUSIVE},
+    {YogiMPI_LOCK_SHARED,    MPI_LOCK_SHARED},
+};
+
+static const YogiConstPair typeclassPairs[] = {
+    {YogiMPI_TYPECLASS_REAL,    MPI_TYPECLASS_REAL},
+    {YogiMPI_TYPECLASS_INTEGER, MPI_TYPECLASS_INTEGER},
+    {YogiMPI_TYPECLASS_COMPLEX, MPI_TYPECLASS_COMPLEX},
+};
+
+static const YogiConstPair whencePairs[] = {
+    {YogiMPI_SEEK_SET, MPI_SEEK_SET},
+    {YogiMPI_SEEK_CUR, MPI_SEEK_CUR},
+    {YogiMPI_SEEK_END, MPI_SEEK_END},
+};
+
+/* The Yogi datatype a user-op trampoline last passed on, for one slot and
+   thread.  MPI calls a reduction's op once per chunk, with the same type. */
+struct YogiOpTypeCache
+{
+    YogiOpTypeCache() : valid(false) {}
+    bool valid;
+    MPI_Datatype mpi;
+    YogiMPI_Datatype yogi;
+    unsigned long epoch;
+};
+
+template <int Slot>
+void YogiManager::opTrampoline(void *invec, void *inoutvec, int *len,
+                               MPI_Datatype *datatype) {
+    static thread_local YogiOpTypeCache typeCache;
+    YogiManager &yogi = instance();
+    unsigned long epoch = yogi.datatypeEpoch;
+    if (!typeCache.valid || typeCache.mpi != *datatype ||
+        typeCache.epoch != epoch) {
+        typeCache.yogi = yogi.datatypeToYogiFindOnly(*datatype);
+        typeCache.mpi = *datatype;
+        typeCache.epoch = epoch;
+        typeCache.valid = true;
+    }
+    YogiMPI_Datatype revert_datatype = typeCache.yogi;
+    YogiMPI_User_function *fn =
+        yogi.opSlots[Slot].fn.load(std::memory_order_acquire);
+    fn(invec, inoutvec, len, &revert_datatype);
+}
+
+/* Fills a table with the trampolines for slots 0 to Count - 1. */
+template <int Count>
+struct YogiOpTrampolines
+{
+    static void fill(MPI_User_function **table) {
+        YogiOpTrampolines<Count - 1>::fill(table);
+        table[Count - 1] = YogiManager::opTrampoline<Count - 1>;
+    }
+};
+
+template <>
+struct YogiOpTrampolines<0>
+{
+    static void fill(MPI_User_function **) {}
+};
+
 YogiManager::YogiManager() {
-    callDepth = 0;
-    currentOp = -1;
-    errPool.resize(defaultPoolSize, MPI_ERRHANDLER_NULL);
-    numErrs = errOffset = 3;
-    commPool.resize(defaultPoolSize, MPI_COMM_NULL);
-    numComms = commOffset = 3;
-    requestPool.resize(defaultPoolSize, MPI_REQUEST_NULL);
-    numRequests = requestOffset = 1;
-    winPool.resize(defaultPoolSize, MPI_WIN_NULL);
-    numWins = winOffset = 1;
-    opPool.resize(defaultPoolSize, MPI_OP_NULL);
-    numOps = opOffset = 15;
-    datatypePool.resize(defaultPoolSize, MPI_DATATYPE_NULL);
-    numDatatypes = datatypeOffset = 57;
-    infoPool.resize(defaultPoolSize, MPI_INFO_NULL);
-    numInfos = infoOffset = 1;
-    groupPool.resize(defaultPoolSize, MPI_GROUP_NULL);
-    numGroups = groupOffset = 2;
-    filePool.resize(defaultPoolSize, MPI_FILE_NULL);
-    numFiles = fileOffset = 1;
+    threadMultiple = false;
+    datatypeEpoch = 0;
+    persistentEpoch = 0;
+    persistentCount = 0;
+    poolStartTime = YogiProfiler::now();
+    char *setting = std::getenv("YOGI_HIERARCHICAL");
+    hierarchical = setting != NULL && std::string(setting) == "1";
+    setting = std::getenv("YOGI_HIERARCHICAL_MAX_BYTES");
+    hierarchicalMaxBytes = setting ? std::atol(setting) : 65536;
+    setting = std::getenv("YOGI_HIERARCHICAL_MIN_RANKS");
+    hierarchicalMinRanks = setting ? std::atoi(setting) : 4;
+    setting = std::getenv("YOGI_HIERARCHICAL_NODE_RANKS");
+    hierarchicalNodeRanks = setting ? std::atoi(setting) : 0;
+#if YogiMPI_VERSION != 3
+    // The node split needs MPI_Comm_split_type and shared windows.
+    hierarchical = false;
+#endif
+    YogiOpTrampolines<numOpSlots>::fill(opTrampolines);
+    initPool(errPool, MPI_ERRHANDLER_NULL, errhandlerOffset);
+    initPool(commPool, MPI_COMM_NULL, commOffset);
+    initPool(requestPool, MPI_REQUEST_NULL, requestOffset, false);
+    initPool(winPool, MPI_WIN_NULL, winOffset);
+    initPool(opPool, MPI_OP_NULL, opOffset);
+    initPool(datatypePool, MPI_DATATYPE_NULL, datatypeOffset);
+    initPool(infoPool, MPI_INFO_NULL, infoOffset);
+    initPool(groupPool, MPI_GROUP_NULL, groupOffset);
+    initPool(filePool, MPI_FILE_NULL, fileOffset);
 #if YogiMPI_VERSION == 3
-    messagePool.resize(defaultPoolSize, MPI_MESSAGE_NULL);
-    numMessages = messageOffset = 3;
+    initPool(messagePool, MPI_MESSAGE_NULL, messageOffset, false);
 #endif
 
-    mpiErrors[YogiMPI_SUCCESS]         = MPI_SUCCESS;
-    mpiErrors[YogiMPI_ERR_BUFFER]      = MPI_ERR_BUFFER;
-    mpiErrors[YogiMPI_ERR_COUNT]       = MPI_ERR_COUNT;
-    mpiErrors[YogiMPI_ERR_TYPE]        = MPI_ERR_TYPE;
-    mpiErrors[YogiMPI_ERR_TAG]         = MPI_ERR_TAG;
-    mpiErrors[YogiMPI_ERR_COMM]        = MPI_ERR_COMM;
-    mpiErrors[YogiMPI_ERR_RANK]        = MPI_ERR_RANK;
-    mpiErrors[YogiMPI_ERR_REQUEST]     = MPI_ERR_REQUEST;
-    mpiErrors[YogiMPI_ERR_ROOT]        = MPI_ERR_ROOT;
-    mpiErrors[YogiMPI_ERR_GROUP]       = MPI_ERR_GROUP;
-    mpiErrors[YogiMPI_ERR_OP]          = MPI_ERR_OP;
-    mpiErrors[YogiMPI_ERR_TOPOLOGY]    = MPI_ERR_TOPOLOGY;
-    mpiErrors[YogiMPI_ERR_DIMS]        = MPI_ERR_DIMS;
-    mpiErrors[YogiMPI_ERR_ARG]         = MPI_ERR_ARG;
-    mpiErrors[YogiMPI_ERR_UNKNOWN]     = MPI_ERR_UNKNOWN;
-    mpiErrors[YogiMPI_ERR_TRUNCATE]    = MPI_ERR_TRUNCATE;
-    mpiErrors[YogiMPI_ERR_OTHER]       = MPI_ERR_OTHER;
-    mpiErrors[YogiMPI_ERR_INTERN]      = MPI_ERR_INTERN;
-    mpiErrors[YogiMPI_ERR_PENDING]     = MPI_ERR_PENDING;
-    mpiErrors[YogiMPI_ERR_IN_STATUS]   = MPI_ERR_IN_STATUS;
-    mpiErrors[YogiMPI_ERR_FILE]        = MPI_ERR_FILE;
-    mpiErrors[YogiMPI_ERR_NOT_SAME]    = MPI_ERR_NOT_SAME;
-    mpiErrors[YogiMPI_ERR_AMODE]       = MPI_ERR_AMODE;
-    mpiErrors[YogiMPI_ERR_UNSUPPORTED_DATAREP]
-                                        = MPI_ERR_UNSUPPORTED_DATAREP;
-    mpiErrors[YogiMPI_ERR_UNSUPPORTED_OPERATION]
-                                        = MPI_ERR_UNSUPPORTED_OPERATION;
-    mpiErrors[YogiMPI_ERR_NO_SUCH_FILE] = MPI_ERR_NO_SUCH_FILE;
-    mpiErrors[YogiMPI_ERR_FILE_EXISTS]  = MPI_ERR_FILE_EXISTS;
-    mpiErrors[YogiMPI_ERR_BAD_FILE]     = MPI_ERR_BAD_FILE;
-    mpiErrors[YogiMPI_ERR_ACCESS]       = MPI_ERR_ACCESS;
-    mpiErrors[YogiMPI_ERR_NO_SPACE]     = MPI_ERR_NO_SPACE;
-    mpiErrors[YogiMPI_ERR_QUOTA]        = MPI_ERR_QUOTA;
-    mpiErrors[YogiMPI_ERR_READ_ONLY]    = MPI_ERR_READ_ONLY;
-    mpiErrors[YogiMPI_ERR_FILE_IN_USE]  = MPI_ERR_FILE_IN_USE;
-    mpiErrors[YogiMPI_ERR_DUP_DATAREP]  = MPI_ERR_DUP_DATAREP;
-    mpiErrors[YogiMPI_ERR_CONVERSION]   = MPI_ERR_CONVERSION;
-    mpiErrors[YogiMPI_ERR_IO]           = MPI_ERR_IO;
-    mpiErrors[YogiMPI_ERR_INFO]         = MPI_ERR_INFO;
-    mpiErrors[YogiMPI_ERR_INFO_KEY]     = MPI_ERR_INFO_KEY;
-    mpiErrors[YogiMPI_ERR_INFO_VALUE]   = MPI_ERR_INFO_VALUE;
-    mpiErrors[YogiMPI_ERR_INFO_NOKEY]   = MPI_ERR_INFO_NOKEY;
-    mpiErrors[YogiMPI_ERR_NAME]         = MPI_ERR_NAME;
-    mpiErrors[YogiMPI_ERR_NO_MEM]       = MPI_ERR_NO_MEM;
-    mpiErrors[YogiMPI_ERR_PORT]         = MPI_ERR_PORT;
-    mpiErrors[YogiMPI_ERR_SERVICE]      = MPI_ERR_SERVICE;
-    mpiErrors[YogiMPI_ERR_SPAWN]        = MPI_ERR_SPAWN;
-    mpiErrors[YogiMPI_ERR_WIN]          = MPI_ERR_WIN;
-    mpiErrors[YogiMPI_ERR_KEYVAL]       = MPI_ERR_KEYVAL;
-    mpiErrors[YogiMPI_ERR_BASE]         = MPI_ERR_BASE;
-    mpiErrors[YogiMPI_ERR_LOCKTYPE]     = MPI_ERR_LOCKTYPE;
-    mpiErrors[YogiMPI_ERR_RMA_CONFLICT] = MPI_ERR_RMA_CONFLICT;
-    mpiErrors[YogiMPI_ERR_RMA_SYNC]     = MPI_ERR_RMA_SYNC;
-    mpiErrors[YogiMPI_ERR_SIZE]         = MPI_ERR_SIZE;
-    mpiErrors[YogiMPI_ERR_DISP]         = MPI_ERR_DISP;
-    mpiErrors[YogiMPI_ERR_ASSERT]       = MPI_ERR_ASSERT;
-    mpiErrors[YogiMPI_ERR_LASTCODE]     = MPI_ERR_LASTCODE;
-
-    yogiErrors[MPI_SUCCESS]         = YogiMPI_SUCCESS;
-    yogiErrors[MPI_ERR_BUFFER]      = YogiMPI_ERR_BUFFER;
-    yogiErrors[MPI_ERR_COUNT]       = YogiMPI_ERR_COUNT;
-    yogiErrors[MPI_ERR_TYPE]        = YogiMPI_ERR_TYPE;
-    yogiErrors[MPI_ERR_TAG]         = YogiMPI_ERR_TAG;
-    yogiErrors[MPI_ERR_COMM]        = YogiMPI_ERR_COMM;
-    yogiErrors[MPI_ERR_RANK]        = YogiMPI_ERR_RANK;
-    yogiErrors[MPI_ERR_REQUEST]     = YogiMPI_ERR_REQUEST;
-    yogiErrors[MPI_ERR_ROOT]        = YogiMPI_ERR_ROOT;
-    yogiErrors[MPI_ERR_GROUP]       = YogiMPI_ERR_GROUP;
-    yogiErrors[MPI_ERR_OP]          = YogiMPI_ERR_OP;
-    yogiErrors[MPI_ERR_TOPOLOGY]    = YogiMPI_ERR_TOPOLOGY;
-    yogiErrors[MPI_ERR_DIMS]        = YogiMPI_ERR_DIMS;
-    yogiErrors[MPI_ERR_ARG]         = YogiMPI_ERR_ARG;
-    yogiErrors[MPI_ERR_UNKNOWN]     = YogiMPI_ERR_UNKNOWN;
-    yogiErrors[MPI_ERR_TRUNCATE]    = YogiMPI_ERR_TRUNCATE;
-    yogiErrors[MPI_ERR_OTHER]       = YogiMPI_ERR_OTHER;
-    yogiErrors[MPI_ERR_INTERN]      = YogiMPI_ERR_INTERN;
-    yogiErrors[MPI_ERR_PENDING]     = YogiMPI_ERR_PENDING;
-    yogiErrors[MPI_ERR_IN_STATUS]   = YogiMPI_ERR_IN_STATUS;
-    yogiErrors[MPI_ERR_FILE]        = YogiMPI_ERR_FILE;
-    yogiErrors[MPI_ERR_NOT_SAME]    = YogiMPI_ERR_NOT_SAME;
-    yogiErrors[MPI_ERR_AMODE]       = YogiMPI_ERR_AMODE;
-    yogiErrors[MPI_ERR_UNSUPPORTED_DATAREP]
-                                       = YogiMPI_ERR_UNSUPPORTED_DATAREP;
-    yogiErrors[MPI_ERR_UNSUPPORTED_OPERATION]
-                                         = YogiMPI_ERR_UNSUPPORTED_OPERATION;
-    yogiErrors[MPI_ERR_NO_SUCH_FILE] = YogiMPI_ERR_NO_SUCH_FILE;
-    yogiErrors[MPI_ERR_FILE_EXISTS]  = YogiMPI_ERR_FILE_EXISTS;
-    yogiErrors[MPI_ERR_BAD_FILE]     = YogiMPI_ERR_BAD_FILE;
-    yogiErrors[MPI_ERR_ACCESS]       = YogiMPI_ERR_ACCESS;
-    yogiErrors[MPI_ERR_NO_SPACE]     = YogiMPI_ERR_NO_SPACE;
-    yogiErrors[MPI_ERR_QUOTA]        = YogiMPI_ERR_QUOTA;
-    yogiErrors[MPI_ERR_READ_ONLY]    = YogiMPI_ERR_READ_ONLY;
-    yogiErrors[MPI_ERR_FILE_IN_USE]  = YogiMPI_ERR_FILE_IN_USE;
-    yogiErrors[MPI_ERR_DUP_DATAREP]  = YogiMPI_ERR_DUP_DATAREP;
-    yogiErrors[MPI_ERR_CONVERSION]   = YogiMPI_ERR_CONVERSION;
-    yogiErrors[MPI_ERR_IO]           = YogiMPI_ERR_IO;
-    yogiErrors[MPI_ERR_INFO]         = YogiMPI_ERR_INFO;
-    yogiErrors[MPI_ERR_INFO_KEY]     = YogiMPI_ERR_INFO_KEY;
-    yogiErrors[MPI_ERR_INFO_VALUE]   = YogiMPI_ERR_INFO_VALUE;
-    yogiErrors[MPI_ERR_INFO_NOKEY]   = YogiMPI_ERR_INFO_NOKEY;
-    yogiErrors[MPI_ERR_NAME]         = YogiMPI_ERR_NAME;
-    yogiErrors[MPI_ERR_NO_MEM]       = YogiMPI_ERR_NO_MEM;
-    yogiErrors[MPI_ERR_PORT]         = YogiMPI_ERR_PORT;
-    yogiErrors[MPI_ERR_SERVICE]      = YogiMPI_ERR_SERVICE;
-    yogiErrors[MPI_ERR_SPAWN]        = YogiMPI_ERR_SPAWN;
-    yogiErrors[MPI_ERR_WIN]          = YogiMPI_ERR_WIN;
-    yogiErrors[MPI_ERR_KEYVAL]       = YogiMPI_ERR_KEYVAL;
-    yogiErrors[MPI_ERR_BASE]         = YogiMPI_ERR_BASE;
-    yogiErrors[MPI_ERR_LOCKTYPE]     = YogiMPI_ERR_LOCKTYPE;
-    yogiErrors[MPI_ERR_RMA_CONFLICT] = YogiMPI_ERR_RMA_CONFLICT;
-    yogiErrors[MPI_ERR_RMA_SYNC]     = YogiMPI_ERR_RMA_SYNC;
-    yogiErrors[MPI_ERR_SIZE]         = YogiMPI_ERR_SIZE;
-    yogiErrors[MPI_ERR_DISP]         = YogiMPI_ERR_DISP;
-    yogiErrors[MPI_ERR_ASSERT]       = YogiMPI_ERR_ASSERT;
-    yogiErrors[MPI_ERR_LASTCODE]     = YogiMPI_ERR_LASTCODE;
-
-    yogiComps[MPI_IDENT] = YogiMPI_IDENT;
-    yogiComps[MPI_CONGRUENT] = YogiMPI_CONGRUENT;
-    yogiComps[MPI_SIMILAR] = YogiMPI_SIMILAR;
-    yogiComps[MPI_UNEQUAL] = YogiMPI_UNEQUAL;
+    mpiErrors.build(errorPairs, YOGI_ARRAY_LENGTH(errorPairs), false);
+    yogiErrors.build(errorPairs, YOGI_ARRAY_LENGTH(errorPairs), true);
+    yogiComps.build(comparisonPairs, YOGI_ARRAY_LENGTH(comparisonPairs), true);
+    yogiCombiners.build(combinerPairs, YOGI_ARRAY_LENGTH(combinerPairs), true);
+    yogiTopos.build(topoPairs, YOGI_ARRAY_LENGTH(topoPairs), true);
+    yogiThreadModels.build(threadPairs, YOGI_ARRAY_LENGTH(threadPairs), true);
+    mpiThreadModels.build(threadPairs, YOGI_ARRAY_LENGTH(threadPairs), false);
+    mpiCommAttrs.build(commattrPairs, YOGI_ARRAY_LENGTH(commattrPairs), false);
+    mpiWinAttrs.build(winattrPairs, YOGI_ARRAY_LENGTH(winattrPairs), false);
+    mpiLockTypes.build(locktypePairs, YOGI_ARRAY_LENGTH(locktypePairs), false);
+    mpiTypeclasses.build(typeclassPairs, YOGI_ARRAY_LENGTH(typeclassPairs),
+                         false);
+    mpiWhence.build(whencePairs, YOGI_ARRAY_LENGTH(whencePairs), false);
 
     // Set group pool constants
-    groupPool.at(YogiMPI_GROUP_EMPTY) = MPI_GROUP_EMPTY;
+    groupPool.slot(YogiMPI_GROUP_EMPTY) = MPI_GROUP_EMPTY;
 
     // Set comm pool constants
-    commPool.at(YogiMPI_COMM_WORLD) = MPI_COMM_WORLD;
-    commPool.at(YogiMPI_COMM_SELF) = MPI_COMM_SELF;
+    commPool.slot(YogiMPI_COMM_WORLD) = MPI_COMM_WORLD;
+    commPool.slot(YogiMPI_COMM_SELF) = MPI_COMM_SELF;
 
     // Set op pool constants
-    opPool.at(YogiMPI_MAX)    = MPI_MAX;
-    opPool.at(YogiMPI_MIN)    = MPI_MIN;
-    opPool.at(YogiMPI_SUM)    = MPI_SUM;
-    opPool.at(YogiMPI_PROD)   = MPI_PROD;
-    opPool.at(YogiMPI_MAXLOC) = MPI_MAXLOC;
-    opPool.at(YogiMPI_MINLOC) = MPI_MINLOC;
-    opPool.at(YogiMPI_BAND)   = MPI_BAND;
-    opPool.at(YogiMPI_BOR)    = MPI_BOR;
-    opPool.at(YogiMPI_BXOR)   = MPI_BXOR;
-    opPool.at(YogiMPI_LAND)   = MPI_LAND;
-    opPool.at(YogiMPI_LOR)    = MPI_LOR;
-    opPool.at(YogiMPI_LXOR)   = MPI_LXOR;
-    opPool.at(YogiMPI_REPLACE) = MPI_REPLACE;
+    opPool.slot(YogiMPI_MAX)    = MPI_MAX;
+    opPool.slot(YogiMPI_MIN)    = MPI_MIN;
+    opPool.slot(YogiMPI_SUM)    = MPI_SUM;
+    opPool.slot(YogiMPI_PROD)   = MPI_PROD;
+    opPool.slot(YogiMPI_MAXLOC) = MPI_MAXLOC;
+    opPool.slot(YogiMPI_MINLOC) = MPI_MINLOC;
+    opPool.slot(YogiMPI_BAND)   = MPI_BAND;
+    opPool.slot(YogiMPI_BOR)    = MPI_BOR;
+    opPool.slot(YogiMPI_BXOR)   = MPI_BXOR;
+    opPool.slot(YogiMPI_LAND)   = MPI_LAND;
+    opPool.slot(YogiMPI_LOR)    = MPI_LOR;
+    opPool.slot(YogiMPI_LXOR)   = MPI_LXOR;
+    opPool.slot(YogiMPI_REPLACE) = MPI_REPLACE;
 #if YogiMPI_VERSION == 3
-    opPool.at(YogiMPI_NO_OP) = MPI_NO_OP;
+    opPool.slot(YogiMPI_NO_OP) = MPI_NO_OP;
 #endif
 
     // Set errhandler pool constants
-    errPool.at(YogiMPI_ERRORS_ARE_FATAL) = MPI_ERRORS_ARE_FATAL;
-    errPool.at(YogiMPI_ERRORS_RETURN)    = MPI_ERRORS_RETURN;
+    errPool.slot(YogiMPI_ERRORS_ARE_FATAL) = MPI_ERRORS_ARE_FATAL;
+    errPool.slot(YogiMPI_ERRORS_RETURN)    = MPI_ERRORS_RETURN;
 
     // Set datatype pool constants
-    datatypePool.at(YogiMPI_CHAR)              = MPI_CHAR;
-    datatypePool.at(YogiMPI_SHORT)             = MPI_SHORT;
-    datatypePool.at(YogiMPI_INT)               = MPI_INT;
-    datatypePool.at(YogiMPI_LONG)              = MPI_LONG;
-    datatypePool.at(YogiMPI_UNSIGNED_CHAR)     = MPI_UNSIGNED_CHAR;
-    datatypePool.at(YogiMPI_UNSIGNED_SHORT)    = MPI_UNSIGNED_SHORT;
-    datatypePool.at(YogiMPI_UNSIGNED)          = MPI_UNSIGNED;
-    datatypePool.at(YogiMPI_UNSIGNED_LONG)     = MPI_UNSIGNED_LONG;
-    datatypePool.at(YogiMPI_FLOAT)             = MPI_FLOAT;
-    datatypePool.at(YogiMPI_DOUBLE)            = MPI_DOUBLE;
-    datatypePool.at(YogiMPI_LONG_DOUBLE)       = MPI_LONG_DOUBLE;
-    datatypePool.at(YogiMPI_BYTE)              = MPI_BYTE;
-    datatypePool.at(YogiMPI_PACKED)            = MPI_PACKED;
-    datatypePool.at(YogiMPI_FLOAT_INT)         = MPI_FLOAT_INT;
-    datatypePool.at(YogiMPI_DOUBLE_INT)        = MPI_DOUBLE_INT;
-    datatypePool.at(YogiMPI_LONG_INT)          = MPI_LONG_INT;
-    datatypePool.at(YogiMPI_2INT)              = MPI_2INT;
-    datatypePool.at(YogiMPI_SHORT_INT)         = MPI_SHORT_INT;
-    datatypePool.at(YogiMPI_LONG_DOUBLE_INT)   = MPI_LONG_DOUBLE_INT;
-    datatypePool.at(YogiMPI_LONG_LONG_INT)     = MPI_LONG_LONG_INT;
-    datatypePool.at(YogiMPI_INT8_T)            = MPI_INT8_T;
-    datatypePool.at(YogiMPI_INT16_T)           = MPI_INT16_T;
-    datatypePool.at(YogiMPI_INT32_T)           = MPI_INT32_T;
-    datatypePool.at(YogiMPI_INT64_T)           = MPI_INT64_T;
-    datatypePool.at(YogiMPI_UINT8_T)           = MPI_UINT8_T;
-    datatypePool.at(YogiMPI_UINT16_T)          = MPI_UINT16_T;
-    datatypePool.at(YogiMPI_UINT32_T)          = MPI_UINT32_T;
-    datatypePool.at(YogiMPI_UINT64_T)          = MPI_UINT64_T;
-    datatypePool.at(YogiMPI_COMPLEX)           = MPI_COMPLEX;
-    datatypePool.at(YogiMPI_DOUBLE_COMPLEX)    = MPI_DOUBLE_COMPLEX;
-    datatypePool.at(YogiMPI_LOGICAL)           = MPI_LOGICAL;
-    datatypePool.at(YogiMPI_2REAL)             = MPI_2REAL;
-    datatypePool.at(YogiMPI_2DOUBLE_PRECISION) = MPI_2DOUBLE_PRECISION;
-    datatypePool.at(YogiMPI_2INTEGER)          = MPI_2INTEGER;
-    datatypePool.at(YogiMPI_INTEGER1)          = MPI_INTEGER1;
-    datatypePool.at(YogiMPI_INTEGER2)          = MPI_INTEGER2;
-    datatypePool.at(YogiMPI_INTEGER4)          = MPI_INTEGER4;
-    datatypePool.at(YogiMPI_INTEGER8)          = MPI_INTEGER8;
-    datatypePool.at(YogiMPI_REAL4)             = MPI_REAL4;
-    datatypePool.at(YogiMPI_REAL8)             = MPI_REAL8;
-    datatypePool.at(YogiMPI_UNSIGNED_LONG_LONG) = MPI_UNSIGNED_LONG_LONG;
-    datatypePool.at(YogiMPI_LB)                = MPI_LB;
-    datatypePool.at(YogiMPI_UB)                = MPI_UB;
-    datatypePool.at(YogiMPI_SIGNED_CHAR)       = MPI_SIGNED_CHAR;
-    datatypePool.at(YogiMPI_WCHAR)             = MPI_WCHAR;
-    datatypePool.at(YogiMPI_C_BOOL)            = MPI_C_BOOL;
-    datatypePool.at(YogiMPI_C_FLOAT_COMPLEX)   = MPI_C_FLOAT_COMPLEX;
-    datatypePool.at(YogiMPI_C_COMPLEX)         = MPI_C_COMPLEX;
-    datatypePool.at(YogiMPI_C_DOUBLE_COMPLEX)  = MPI_C_DOUBLE_COMPLEX;
-    datatypePool.at(YogiMPI_C_LONG_DOUBLE_COMPLEX) = MPI_C_LONG_DOUBLE_COMPLEX;
-    datatypePool.at(YogiMPI_AINT)              = MPI_AINT;
-    datatypePool.at(YogiMPI_OFFSET)            = MPI_OFFSET;
+    datatypePool.slot(YogiMPI_CHAR)              = MPI_CHAR;
+    datatypePool.slot(YogiMPI_SHORT)             = MPI_SHORT;
+    datatypePool.slot(YogiMPI_INT)               = MPI_INT;
+    datatypePool.slot(YogiMPI_LONG)              = MPI_LONG;
+    datatypePool.slot(YogiMPI_UNSIGNED_CHAR)     = MPI_UNSIGNED_CHAR;
+    datatypePool.slot(YogiMPI_UNSIGNED_SHORT)    = MPI_UNSIGNED_SHORT;
+    datatypePool.slot(YogiMPI_UNSIGNED)          = MPI_UNSIGNED;
+    datatypePool.slot(YogiMPI_UNSIGNED_LONG)     = MPI_UNSIGNED_LONG;
+    datatypePool.slot(YogiMPI_FLOAT)             = MPI_FLOAT;
+    datatypePool.slot(YogiMPI_DOUBLE)            = MPI_DOUBLE;
+    datatypePool.slot(YogiMPI_LONG_DOUBLE)       = MPI_LONG_DOUBLE;
+    datatypePool.slot(YogiMPI_BYTE)              = MPI_BYTE;
+    datatypePool.slot(YogiMPI_PACKED)            = MPI_PACKED;
+    datatypePool.slot(YogiMPI_FLOAT_INT)         = MPI_FLOAT_INT;
+    datatypePool.slot(YogiMPI_DOUBLE_INT)        = MPI_DOUBLE_INT;
+    datatypePool.slot(YogiMPI_LONG_INT)          = MPI_LONG_INT;
+    datatypePool.slot(YogiMPI_2INT)              = MPI_2INT;
+    datatypePool.slot(YogiMPI_SHORT_INT)         = MPI_SHORT_INT;
+    datatypePool.slot(YogiMPI_LONG_DOUBLE_INT)   = MPI_LONG_DOUBLE_INT;
+    datatypePool.slot(YogiMPI_LONG_LONG_INT)     = MPI_LONG_LONG_INT;
+    datatypePool.slot(YogiMPI_INT8_T)            = MPI_INT8_T;
+    datatypePool.slot(YogiMPI_INT16_T)           = MPI_INT16_T;
+    datatypePool.slot(YogiMPI_INT32_T)           = MPI_INT32_T;
+    datatypePool.slot(YogiMPI_INT64_T)           = MPI_INT64_T;
+    datatypePool.slot(YogiMPI_UINT8_T)           = MPI_UINT8_T;
+    datatypePool.slot(YogiMPI_UINT16_T)          = MPI_UINT16_T;
+    datatypePool.slot(YogiMPI_UINT32_T)          = MPI_UINT32_T;
+    datatypePool.slot(YogiMPI_UINT64_T)          = MPI_UINT64_T;
+    datatypePool.slot(YogiMPI_COMPLEX)           = MPI_COMPLEX;
+    datatypePool.slot(YogiMPI_DOUBLE_COMPLEX)    = MPI_DOUBLE_COMPLEX;
+    datatypePool.slot(YogiMPI_LOGICAL)           = MPI_LOGICAL;
+    datatypePool.slot(YogiMPI_2REAL)             = MPI_2REAL;
+    datatypePool.slot(YogiMPI_2DOUBLE_PRECISION) = MPI_2DOUBLE_PRECISION;
+    datatypePool.slot(YogiMPI_2INTEGER)          = MPI_2INTEGER;
+    datatypePool.slot(YogiMPI_INTEGER1)          = MPI_INTEGER1;
+    datatypePool.slot(YogiMPI_INTEGER2)          = MPI_INTEGER2;
+    datatypePool.slot(YogiMPI_INTEGER4)          = MPI_INTEGER4;
+    datatypePool.slot(YogiMPI_INTEGER8)          = MPI_INTEGER8;
+    datatypePool.slot(YogiMPI_REAL4)             = MPI_REAL4;
+    datatypePool.slot(YogiMPI_REAL8)             = MPI_REAL8;
+    datatypePool.slot(YogiMPI_UNSIGNED_LONG_LONG) = MPI_UNSIGNED_LONG_LONG;
+    datatypePool.slot(YogiMPI_LB)                = MPI_LB;
+    datatypePool.slot(YogiMPI_UB)                = MPI_UB;
+    datatypePool.slot(YogiMPI_SIGNED_CHAR)       = MPI_SIGNED_CHAR;
+    datatypePool.slot(YogiMPI_WCHAR)             = MPI_WCHAR;
+    datatypePool.slot(YogiMPI_C_BOOL)            = MPI_C_BOOL;
+    datatypePool.slot(YogiMPI_C_FLOAT_COMPLEX)   = MPI_C_FLOAT_COMPLEX;
+    datatypePool.slot(YogiMPI_C_COMPLEX)         = MPI_C_COMPLEX;
+    datatypePool.slot(YogiMPI_C_DOUBLE_COMPLEX)  = MPI_C_DOUBLE_COMPLEX;
+    datatypePool.slot(YogiMPI_C_LONG_DOUBLE_COMPLEX) = MPI_C_LONG_DOUBLE_COMPLEX;
+    datatypePool.slot(YogiMPI_AINT)              = MPI_AINT;
+    datatypePool.slot(YogiMPI_OFFSET)            = MPI_OFFSET;
 #if YogiMPI_VERSION == 3
-    datatypePool.at(YogiMPI_COUNT)             = MPI_COUNT;
+    datatypePool.slot(YogiMPI_COUNT)             = MPI_COUNT;
 #endif
 
 #if YogiMPI_VERSION == 3
-    datatypePool.at(YogiMPI_CXX_BOOL)            = MPI_CXX_BOOL;
-    datatypePool.at(YogiMPI_CXX_FLOAT_COMPLEX)   = MPI_CXX_FLOAT_COMPLEX;
-    datatypePool.at(YogiMPI_CXX_DOUBLE_COMPLEX)  = MPI_CXX_DOUBLE_COMPLEX;
-    datatypePool.at(YogiMPI_CXX_LONG_DOUBLE_COMPLEX) = MPI_CXX_LONG_DOUBLE_COMPLEX;
-    messagePool.at(YogiMPI_MESSAGE_NO_PROC) = MPI_MESSAGE_NO_PROC;
+    datatypePool.slot(YogiMPI_CXX_BOOL)            = MPI_CXX_BOOL;
+    datatypePool.slot(YogiMPI_CXX_FLOAT_COMPLEX)   = MPI_CXX_FLOAT_COMPLEX;
+    datatypePool.slot(YogiMPI_CXX_DOUBLE_COMPLEX)  = MPI_CXX_DOUBLE_COMPLEX;
+    datatypePool.slot(YogiMPI_CXX_LONG_DOUBLE_COMPLEX) = MPI_CXX_LONG_DOUBLE_COMPLEX;
+    messagePool.slot(YogiMPI_MESSAGE_NO_PROC) = MPI_MESSAGE_NO_PROC;
+#endif
+
+    /* Keep copies of the constants for the inline conversions. */
+    for (int i = 0; i < errhandlerOffset; i++) {
+        predefinedErrhandlers[i] = errPool.slot(i);
+    }
+    for (int i = 0; i < commOffset; i++) predefinedComms[i] = commPool.slot(i);
+    for (int i = 0; i < opOffset; i++) predefinedOps[i] = opPool.slot(i);
+    for (int i = 0; i < datatypeOffset; i++) {
+        predefinedDatatypes[i] = datatypePool.slot(i);
+    }
+    for (int i = 0; i < groupOffset; i++) {
+        predefinedGroups[i] = groupPool.slot(i);
+    }
+
+    /* Index the constants now that they are all in place. */
+    rebuildLookup(errPool, 2 * defaultPoolSize);
+    rebuildLookup(commPool, 2 * defaultPoolSize);
+    rebuildLookup(requestPool, 2 * defaultPoolSize);
+    rebuildLookup(winPool, 2 * defaultPoolSize);
+    rebuildLookup(opPool, 2 * defaultPoolSize);
+    rebuildLookup(datatypePool, 2 * defaultPoolSize);
+    rebuildLookup(infoPool, 2 * defaultPoolSize);
+    rebuildLookup(groupPool, 2 * defaultPoolSize);
+    rebuildLookup(filePool, 2 * defaultPoolSize);
+#if YogiMPI_VERSION == 3
+    rebuildLookup(messagePool, 2 * defaultPoolSize);
 #endif
 
     /* In the case of preloading a library (see below), keep a zero'd pointer
@@ -270,24 +489,945 @@ void YogiManager::setGlobalRank(int rank) {
     globalRank = rank;
 }
 
-void YogiManager::openDebugLog() {
-    // Filename is yogimpi.log.<globalRank>
-    std::string logFileName = "yogimpi.log.";
-    /* Would rather do this the C++11 way, but some old systems have issues
-    with the to_string function, even with C++11 enabled in the compiler. */
-    std::ostringstream oss;
-    oss << globalRank;
-    logFileName += oss.str();
-    debugLogFile.open(logFileName.c_str());
+/* The cache entry for comm.  Call with commCacheMutex held. */
+YogiCommCache & YogiManager::commCacheFor(YogiMPI_Comm comm) {
+#ifdef YOGI_PASSTHROUGH
+    return commCache[comm];
+#else
+    if (comm >= (int) commCache.size()) commCache.resize(comm + 1);
+    return commCache.at(comm);
+#endif
+}
+
+YogiCommInfo YogiManager::commInfo(YogiMPI_Comm comm) {
+    YogiLockGuard guard(commCacheMutex, threadMultiple);
+    YogiCommCache &cache = commCacheFor(comm);
+    if (cache.valid) return cache.info;
+
+    YogiCommInfo &info = cache.info;
+    std::memset(&info, 0, sizeof(info));
+    MPI_Comm mpiComm = commToMPI(comm);
+    if (mpiComm == MPI_COMM_NULL) return info;
+    MPI_Comm_size(mpiComm, &info.size);
+    MPI_Comm_rank(mpiComm, &info.rank);
+    MPI_Comm_test_inter(mpiComm, &info.isInter);
+    info.remoteSize = info.size;
+    if (info.isInter) {
+        MPI_Comm_remote_size(mpiComm, &info.remoteSize);
+    }
+    else {
+        int topology;
+        MPI_Topo_test(mpiComm, &topology);
+        if (topology == MPI_CART) {
+            int ndims;
+            MPI_Cartdim_get(mpiComm, &ndims);
+            info.indegree = info.outdegree = 2 * ndims;
+        }
+        else if (topology == MPI_GRAPH) {
+            MPI_Graph_neighbors_count(mpiComm, info.rank, &info.indegree);
+            info.outdegree = info.indegree;
+        }
+#if YogiMPI_VERSION == 3 || YogiMPI_SUBVERSION > 1
+        else if (topology == MPI_DIST_GRAPH) {
+            int weighted;
+            MPI_Dist_graph_neighbors_count(mpiComm, &info.indegree,
+                                           &info.outdegree, &weighted);
+        }
+#endif
+    }
+    cache.valid = true;
+    return info;
+}
+
+MPI_Datatype * YogiManager::datatypeToMPICached(YogiMPI_Comm comm, int side,
+                                          const YogiMPI_Datatype *in_data,
+                                          int count,
+                                          YogiScratch<MPI_Datatype> &scratch) {
+    if (threadMultiple || in_data == NULL || count <= 0) {
+        MPI_Datatype *converted = scratch.get(count);
+        if (in_data != NULL) datatypeToMPI(in_data, converted, count);
+        return converted;
+    }
+    YogiCommCache &cache = commCacheFor(comm);
+    std::vector<YogiMPI_Datatype> &seen = cache.yogiTypes[side];
+    std::vector<MPI_Datatype> &converted = cache.mpiTypes[side];
+    if (cache.typeEpoch[side] != datatypeEpoch ||
+        (int) seen.size() != count ||
+        !std::equal(in_data, in_data + count, seen.begin())) {
+        seen.assign(in_data, in_data + count);
+        converted.resize(count);
+        datatypeToMPI(in_data, &converted[0], count);
+        cache.typeEpoch[side] = datatypeEpoch;
+    }
+    return &converted[0];
+}
+
+/* Marks are kept in every build and at every thread level, since
+   completion queues check them too. */
+void YogiManager::markPersistent(YogiMPI_Request request) {
+    YogiLockGuard guard(persistentMutex, threadMultiple);
+    if (persistentRequests.insert(request).second) persistentCount++;
+}
+
+bool YogiManager::isPersistent(YogiMPI_Request request) {
+    if (persistentCount.load(std::memory_order_relaxed) == 0) return false;
+    YogiLockGuard guard(persistentMutex, threadMultiple);
+    return persistentRequests.count(request) != 0;
+}
+
+MPI_Request * YogiManager::requestToMPICached(const YogiMPI_Request *in_requests,
+                                              int count,
+                                              YogiScratch<MPI_Request> &scratch) {
+    if (YogiPassthrough<MPI_Request>::enabled || threadMultiple ||
+        in_requests == NULL || count <= 0 || persistentRequests.empty()) {
+        MPI_Request *converted = scratch.get(count);
+        if (in_requests != NULL) requestToMPI(in_requests, converted, count);
+        return converted;
+    }
+    std::size_t hash = (std::size_t) in_requests / sizeof(YogiMPI_Request);
+    YogiPersistentSet &set = persistentSets[hash % numPersistentSets];
+    if (set.array == in_requests && set.epoch == persistentEpoch &&
+        (int) set.yogiRequests.size() == count &&
+        std::equal(in_requests, in_requests + count,
+                   set.yogiRequests.begin())) {
+        return &set.mpiRequests[0];
+    }
+    for (int i = 0; i < count; i++) {
+        if (persistentRequests.count(in_requests[i]) == 0) {
+            MPI_Request *converted = scratch.get(count);
+            requestToMPI(in_requests, converted, count);
+            return converted;
+        }
+    }
+    set.array = in_requests;
+    set.epoch = persistentEpoch;
+    set.yogiRequests.assign(in_requests, in_requests + count);
+    set.mpiRequests.resize(count);
+    requestToMPI(in_requests, &set.mpiRequests[0], count);
+    return &set.mpiRequests[0];
+}
+
+int YogiManager::createCompletionQueue() {
+    YogiLockGuard guard(completionQueueMutex, threadMultiple);
+    std::size_t handle = 0;
+    while (handle < completionQueues.size() && completionQueues[handle]) {
+        handle++;
+    }
+    if (handle == completionQueues.size()) completionQueues.push_back(NULL);
+    completionQueues[handle].reset(new YogiCompletionQueue());
+    return (int) handle;
+}
+
+YogiCompletionQueue * YogiManager::completionQueue(int handle) {
+    YogiLockGuard guard(completionQueueMutex, threadMultiple);
+    if (handle < 0 || handle >= (int) completionQueues.size()) return NULL;
+    return completionQueues[handle].get();
+}
+
+int YogiManager::freeCompletionQueue(int handle) {
+    YogiLockGuard guard(completionQueueMutex, threadMultiple);
+    if (handle < 0 || handle >= (int) completionQueues.size() ||
+        !completionQueues[handle]) {
+        return YogiMPI_ERR_ARG;
+    }
+    YogiCompletionQueue &queue = *completionQueues[handle];
+    if (!queue.requests.empty() || !queue.ready.empty()) {
+        return YogiMPI_ERR_PENDING;
+    }
+    completionQueues[handle].reset();
+    return YogiMPI_SUCCESS;
+}
+
+int YogiManager::addToCompletionQueue(YogiCompletionQueue &queue, int count,
+                                      YogiMPI_Request *requests,
+                                      const int *ids) {
+    /* A persistent request would stay allocated in MPI after completing,
+       with nothing left to free it. */
+    for (int i = 0; i < count; i++) {
+        if (requests[i] == YogiMPI_REQUEST_NULL ||
+            isPersistent(requests[i])) {
+            return YogiMPI_ERR_REQUEST;
+        }
+    }
+    YogiLockGuard guard(queue.mutex, threadMultiple);
+    for (int i = 0; i < count; i++) {
+        queue.requests.push_back(requestToMPI(requests[i]));
+        queue.ids.push_back(ids[i]);
+        requests[i] = unmapRequest(requests[i]);
+    }
+    return YogiMPI_SUCCESS;
+}
+
+int YogiManager::pollCompletionQueue(YogiCompletionQueue &queue, bool wait,
+                                     int maxcount, int *outcount, int *ids,
+                                     YogiMPI_Status *statuses) {
+    YogiLockGuard guard(queue.mutex, threadMultiple);
+    if (queue.ready.empty() && !queue.requests.empty()) {
+        int active = (int) queue.requests.size();
+        int done = 0;
+        queue.indices.resize(active);
+        queue.statuses.resize(active);
+        int mpiError;
+        if (wait) {
+            if (!scheduler.waitsome(active, &queue.requests[0], &done,
+                                    &queue.indices[0], &queue.statuses[0],
+                                    &mpiError)) {
+                mpiError = MPI_Waitsome(active, &queue.requests[0], &done,
+                                        &queue.indices[0],
+                                        &queue.statuses[0]);
+            }
+        }
+        else {
+            scheduler.progress();
+            mpiError = MPI_Testsome(active, &queue.requests[0], &done,
+                                    &queue.indices[0], &queue.statuses[0]);
+        }
+        if (mpiError != MPI_SUCCESS && mpiError != MPI_ERR_IN_STATUS) {
+            return errorToYogi(mpiError);
+        }
+        if (done == MPI_UNDEFINED) done = 0;
+        for (int k = 0; k < done; k++) {
+            YogiCompletion finished;
+            finished.id = queue.ids[queue.indices[k]];
+            finished.status = queue.statuses[k];
+            // MPI only fills in MPI_ERROR when it reports MPI_ERR_IN_STATUS.
+            if (mpiError == MPI_SUCCESS) finished.status.MPI_ERROR = MPI_SUCCESS;
+            queue.ready.push_back(finished);
+        }
+        /* Fill each finished slot from the end, highest index first, so
+           the requests still pending stay packed at the front.  MPI need
+           not report the indices in order, and a lower slot filled first
+           could take a finished request from the end. */
+        std::sort(queue.indices.begin(), queue.indices.begin() + done);
+        for (int k = done - 1; k >= 0; k--) {
+            int slot = queue.indices[k];
+            queue.requests[slot] = queue.requests.back();
+            queue.ids[slot] = queue.ids.back();
+            queue.requests.pop_back();
+            queue.ids.pop_back();
+        }
+    }
+    if (queue.ready.empty()) {
+        *outcount = queue.requests.empty() ? YogiMPI_UNDEFINED : 0;
+        return YogiMPI_SUCCESS;
+    }
+    int error = YogiMPI_SUCCESS;
+    int handed = 0;
+    while (handed < maxcount && !queue.ready.empty()) {
+        YogiCompletion &finished = queue.ready.front();
+        ids[handed] = finished.id;
+        if (finished.status.MPI_ERROR != MPI_SUCCESS) {
+            error = YogiMPI_ERR_IN_STATUS;
+        }
+        if (statuses != YogiMPI_STATUSES_IGNORE) {
+            statuses[handed] = statusToYogi(finished.status, false);
+        }
+        queue.ready.pop_front();
+        handed++;
+    }
+    *outcount = handed;
+    return error;
+}
+
+int YogiManager::completionQueuePending(YogiCompletionQueue &queue) {
+    YogiLockGuard guard(queue.mutex, threadMultiple);
+    return (int) (queue.requests.size() + queue.ready.size());
+}
+
+/* Whether a plan made with info should be persistent in MPI: always,
+   unless the key yogimpi_persistent is false. */
+static bool wantPersistent(MPI_Info info) {
+    if (info == MPI_INFO_NULL) return true;
+    char value[16];
+    int flag = 0;
+    MPI_Info_get(info, (char *) "yogimpi_persistent", sizeof(value) - 1,
+                 value, &flag);
+    return !flag || std::strcmp(value, "false") != 0;
+}
+
+int YogiManager::createPlan(std::unique_ptr<YogiPlan> made, MPI_Info info,
+                            int *handle) {
+    int mpi_error = MPI_SUCCESS;
+#ifdef YOGI_ALLREDUCE_INIT
+    /* MPI has no persistent form of YogiMPI's own collectives, so a plan
+       made while they are in use replays through them. */
+    if (wantPersistent(info) && !scheduler.emulating) {
+        YogiPlan &p = *made;
+        if (p.kind == YogiPlan::allreduce) {
+            mpi_error = YOGI_ALLREDUCE_INIT(p.sendbuf, p.recvbuf, p.count,
+                                            p.sendtype, p.mpiOp, p.mpiComm,
+                                            info, &p.persistent);
+        }
+        else {
+            mpi_error = YOGI_ALLTOALLV_INIT(p.sendbuf, p.sendcounts.data(),
+                                            p.sdispls.data(), p.sendtype,
+                                            p.recvbuf, p.recvcounts.data(),
+                                            p.rdispls.data(), p.recvtype,
+                                            p.mpiComm, info, &p.persistent);
+        }
+        if (mpi_error != MPI_SUCCESS) return errorToYogi(mpi_error);
+        p.request = requestToYogi(p.persistent);
+        markPersistent(p.request);
+    }
+#else
+    (void) info;
+#endif
+    YogiLockGuard guard(planMutex, threadMultiple);
+    std::size_t slot = 0;
+    while (slot < plans.size() && plans[slot]) slot++;
+    if (slot == plans.size()) plans.push_back(NULL);
+    plans[slot] = std::move(made);
+    *handle = (int) slot;
+    return YogiMPI_SUCCESS;
+}
+
+YogiPlan * YogiManager::plan(int handle) {
+    YogiLockGuard guard(planMutex, threadMultiple);
+    if (handle < 0 || handle >= (int) plans.size()) return NULL;
+    return plans[handle].get();
+}
+
+int YogiManager::startPlan(YogiPlan &plan, YogiMPI_Request *request) {
+    int mpi_error;
+    currentOp = plan.op;
+    if (plan.persistent != MPI_REQUEST_NULL) {
+        mpi_error = MPI_Start(&plan.persistent);
+        if (mpi_error == MPI_SUCCESS && request != NULL) {
+            *request = plan.request;
+        }
+        else if (mpi_error == MPI_SUCCESS) {
+            mpi_error = MPI_Wait(&plan.persistent, MPI_STATUS_IGNORE);
+        }
+        return errorToYogi(mpi_error);
+    }
+    bool isAllreduce = plan.kind == YogiPlan::allreduce;
+    if (request == NULL) {
+        if (!isAllreduce) {
+            mpi_error = MPI_Alltoallv((void *) plan.sendbuf,
+                                      plan.sendcounts.data(),
+                                      plan.sdispls.data(), plan.sendtype,
+                                      plan.recvbuf, plan.recvcounts.data(),
+                                      plan.rdispls.data(), plan.recvtype,
+                                      plan.mpiComm);
+        }
+        else if (!hierarchicalAllreduce(plan.sendbuf, plan.recvbuf,
+                                        plan.count, plan.datatype,
+                                        plan.sendtype, plan.op, plan.mpiOp,
+                                        plan.comm, plan.mpiComm,
+                                        &mpi_error)) {
+            mpi_error = MPI_Allreduce((void *) plan.sendbuf, plan.recvbuf,
+                                      plan.count, plan.sendtype, plan.mpiOp,
+                                      plan.mpiComm);
+        }
+        return errorToYogi(mpi_error);
+    }
+    MPI_Request mpiRequest = MPI_REQUEST_NULL;
+    bool emulate = true;
+#if YogiMPI_VERSION == 3
+    emulate = scheduler.emulating;
+    if (!emulate && isAllreduce) {
+        mpi_error = MPI_Iallreduce(plan.sendbuf, plan.recvbuf, plan.count,
+                                   plan.sendtype, plan.mpiOp, plan.mpiComm,
+                                   &mpiRequest);
+    }
+    else if (!emulate) {
+        mpi_error = MPI_Ialltoallv(plan.sendbuf, plan.sendcounts.data(),
+                                   plan.sdispls.data(), plan.sendtype,
+                                   plan.recvbuf, plan.recvcounts.data(),
+                                   plan.rdispls.data(), plan.recvtype,
+                                   plan.mpiComm, &mpiRequest);
+    }
+#endif
+    if (emulate && isAllreduce) {
+        mpi_error = scheduler.reduce(plan.sendbuf, plan.recvbuf, plan.count,
+                                     plan.datatype, plan.sendtype, plan.op,
+                                     plan.mpiOp, 0, true, plan.comm,
+                                     plan.mpiComm, &mpiRequest);
+    }
+    else if (emulate) {
+        mpi_error = scheduler.alltoall(plan.sendbuf, 0, plan.sendcounts.data(),
+                                       plan.sdispls.data(), plan.sendtype,
+                                       plan.recvbuf, 0, plan.recvcounts.data(),
+                                       plan.rdispls.data(), plan.recvtype,
+                                       plan.comm, plan.mpiComm, &mpiRequest);
+    }
+    if (mpi_error == MPI_SUCCESS) *request = requestToYogi(mpiRequest);
+    return errorToYogi(mpi_error);
+}
+
+int YogiManager::freePlan(int handle) {
+    std::unique_ptr<YogiPlan> freed;
+    {
+        YogiLockGuard guard(planMutex, threadMultiple);
+        if (handle < 0 || handle >= (int) plans.size() || !plans[handle]) {
+            return YogiMPI_ERR_ARG;
+        }
+        freed = std::move(plans[handle]);
+    }
+    int mpi_error = MPI_SUCCESS;
+    if (freed->persistent != MPI_REQUEST_NULL) {
+        mpi_error = MPI_Request_free(&freed->persistent);
+        unmapRequest(freed->request);
+    }
+    return errorToYogi(mpi_error);
+}
+
+/* The element layout of a datatype, as far as the hierarchical
+   collectives care: its size, and whether count elements of it are one
+   block of count * size bytes with nothing in between. */
+static bool isContiguous(MPI_Datatype datatype, int *size) {
+    MPI_Aint lb, extent, trueLb, trueExtent;
+    MPI_Type_size(datatype, size);
+    MPI_Type_get_extent(datatype, &lb, &extent);
+    MPI_Type_get_true_extent(datatype, &trueLb, &trueExtent);
+    return lb == 0 && trueLb == 0 && extent == *size && trueExtent == *size;
+}
+
+/* Orders the shared window's memory around a barrier of the node. */
+static int nodeBarrier(YogiNodeComms &nodeComms) {
+#if YogiMPI_VERSION == 3
+    MPI_Win_sync(nodeComms.window);
+    int mpiError = MPI_Barrier(nodeComms.node);
+    MPI_Win_sync(nodeComms.window);
+    return mpiError;
+#else
+    return MPI_Barrier(nodeComms.node);
+#endif
+}
+
+static void freeNodeComms(YogiNodeComms &nodeComms) {
+#if YogiMPI_VERSION == 3
+    if (nodeComms.window != MPI_WIN_NULL) {
+        MPI_Win_unlock_all(nodeComms.window);
+        MPI_Win_free(&nodeComms.window);
+    }
+#endif
+    if (nodeComms.leaders != MPI_COMM_NULL) MPI_Comm_free(&nodeComms.leaders);
+    if (nodeComms.node != MPI_COMM_NULL) MPI_Comm_free(&nodeComms.node);
+}
+
+YogiNodeComms * YogiManager::nodeCommsFor(YogiMPI_Comm comm, MPI_Comm mpiComm,
+                                          long long bytes) {
+    if (bytes <= 0 || bytes > hierarchicalMaxBytes) return NULL;
+    YogiCommInfo info = commInfo(comm);
+    if (info.isInter || info.size < hierarchicalMinRanks) return NULL;
+    {
+        YogiLockGuard guard(commCacheMutex, threadMultiple);
+        YogiNodeComms *known = commCacheFor(comm).nodeComms.get();
+        if (known) return known->usable ? known : NULL;
+    }
+
+    /* First qualifying call on comm: every rank gets here together.  The
+       lock is not held, since other threads may be in collectives on other
+       communicators meanwhile. */
+    std::shared_ptr<YogiNodeComms> built(new YogiNodeComms());
+#if YogiMPI_VERSION == 3
+    YogiNodeComms &split = *built;
+    split.rank = info.rank;
+    MPI_Comm_split_type(mpiComm, MPI_COMM_TYPE_SHARED, info.rank,
+                        MPI_INFO_NULL, &split.node);
+    MPI_Comm_rank(split.node, &split.nodeRank);
+    if (hierarchicalNodeRanks > 0) {
+        // Smaller groups than the node, e.g. one per socket.
+        MPI_Comm whole = split.node;
+        MPI_Comm_split(whole, split.nodeRank / hierarchicalNodeRanks,
+                       split.nodeRank, &split.node);
+        MPI_Comm_free(&whole);
+        MPI_Comm_rank(split.node, &split.nodeRank);
+    }
+    MPI_Comm_size(split.node, &split.nodeSize);
+    MPI_Comm_split(mpiComm, split.nodeRank == 0 ? 0 : MPI_UNDEFINED,
+                   info.rank, &split.leaders);
+    int leader = -1;
+    if (split.leaders != MPI_COMM_NULL) {
+        MPI_Comm_rank(split.leaders, &leader);
+        MPI_Comm_size(split.leaders, &split.numNodes);
+    }
+    int shared[2] = {leader, split.numNodes};
+    MPI_Bcast(shared, 2, MPI_INT, 0, split.node);
+    split.numNodes = shared[1];
+    split.leaderOf.resize(info.size);
+    MPI_Allgather(&shared[0], 1, MPI_INT, &split.leaderOf[0], 1, MPI_INT,
+                  mpiComm);
+    split.usable = split.numNodes < info.size;
+    if (split.usable) {
+        split.slotBytes = 2 * hierarchicalMaxBytes;
+        void *mine;
+        MPI_Win_allocate_shared(split.slotBytes, 1, MPI_INFO_NULL,
+                                split.node, &mine, &split.window);
+        MPI_Aint firstSize;
+        int firstUnit;
+        void *first;
+        MPI_Win_shared_query(split.window, 0, &firstSize, &firstUnit, &first);
+        split.base = (char *) first;
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, split.window);
+    }
+    else {
+        freeNodeComms(split);
+    }
+#endif
+
+    YogiLockGuard guard(commCacheMutex, threadMultiple);
+    commCacheFor(comm).nodeComms = built;
+    if (built->usable) nodeCommsBuilt.push_back(built);
+    return built->usable ? built.get() : NULL;
+}
+
+bool YogiManager::allreduceByNode(const void *sendbuf, void *recvbuf,
+                                  int count, YogiMPI_Datatype datatype,
+                                  MPI_Datatype mpiDatatype, YogiMPI_Op op,
+                                  MPI_Op mpiOp, YogiMPI_Comm comm,
+                                  MPI_Comm mpiComm, int *mpi_error) {
+    // User ops may not commute, and the node split reorders the ranks.
+    if (op < YogiMPI_MAX || op > YogiMPI_LXOR) return false;
+    int typeSize;
+    if (!isContiguous(mpiDatatype, &typeSize)) return false;
+    long long bytes = (long long) count * typeSize;
+    YogiNodeComms *split = nodeCommsFor(comm, mpiComm, bytes);
+    if (split == NULL) return false;
+
+    MPI_Aint buffer = (split->calls++ & 1) * hierarchicalMaxBytes;
+    char *result = split->base + buffer;
+    char *mine = split->base + split->nodeRank * split->slotBytes + buffer;
+    std::memcpy(mine, sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf, bytes);
+    int mpiError = nodeBarrier(*split);
+
+    /* Every node rank folds its share of the elements of all slots into
+       slot 0, which then holds the node's result. */
+    int first = (int) ((long long) count * split->nodeRank / split->nodeSize);
+    int last = (int) ((long long) count * (split->nodeRank + 1) /
+                      split->nodeSize);
+    YogiReduceKernel kernel = yogiReduceKernel(op, datatype);
+    for (int r = 1; r < split->nodeSize && last > first; r++) {
+        char *slot = split->base + r * split->slotBytes + buffer;
+        char *in = slot + (MPI_Aint) first * typeSize;
+        char *inout = result + (MPI_Aint) first * typeSize;
+        if (kernel) {
+            kernel(in, inout, last - first);
+            continue;
+        }
+        int reduceError = MPI_Reduce_local(in, inout, last - first,
+                                           mpiDatatype, mpiOp);
+        if (mpiError == MPI_SUCCESS) mpiError = reduceError;
+    }
+    int barrierError = nodeBarrier(*split);
+    if (mpiError == MPI_SUCCESS) mpiError = barrierError;
+
+    if (split->numNodes > 1) {
+        if (split->leaders != MPI_COMM_NULL && mpiError == MPI_SUCCESS) {
+            mpiError = MPI_Allreduce(MPI_IN_PLACE, result, count, mpiDatatype,
+                                     mpiOp, split->leaders);
+        }
+        barrierError = nodeBarrier(*split);
+        if (mpiError == MPI_SUCCESS) mpiError = barrierError;
+    }
+    std::memcpy(recvbuf, result, bytes);
+    *mpi_error = mpiError;
+    return true;
+}
+
+bool YogiManager::bcastByNode(void *buffer, int count, MPI_Datatype datatype,
+                              int root, YogiMPI_Comm comm, MPI_Comm mpiComm,
+                              int *mpi_error) {
+    int typeSize;
+    bool contiguous = isContiguous(datatype, &typeSize);
+    long long bytes = (long long) count * typeSize;
+    YogiNodeComms *split = nodeCommsFor(comm, mpiComm, bytes);
+    if (split == NULL) return false;
+    if (root < 0 || root >= (int) split->leaderOf.size()) return false;
+
+    /* The root's node gets the data through the window, the other nodes
+       through their leaders.  Either way, each node has one barrier. */
+    char *shared = split->base + (split->calls++ & 1) * hierarchicalMaxBytes;
+    int rootLeader = split->leaderOf[root];
+    int mpiError = MPI_SUCCESS;
+    if (split->leaderOf[split->rank] == rootLeader) {
+        if (split->rank == root) {
+            if (contiguous) {
+                std::memcpy(shared, buffer, bytes);
+            }
+            else {
+                int position = 0;
+                mpiError = MPI_Pack(buffer, count, datatype, shared,
+                                    (int) bytes, &position, split->node);
+            }
+        }
+        int barrierError = nodeBarrier(*split);
+        if (mpiError == MPI_SUCCESS) mpiError = barrierError;
+        if (split->leaders != MPI_COMM_NULL && split->numNodes > 1) {
+            int leaderError = MPI_Bcast(shared, (int) bytes, MPI_BYTE,
+                                        rootLeader, split->leaders);
+            if (mpiError == MPI_SUCCESS) mpiError = leaderError;
+        }
+    }
+    else {
+        if (split->leaders != MPI_COMM_NULL) {
+            mpiError = MPI_Bcast(shared, (int) bytes, MPI_BYTE, rootLeader,
+                                 split->leaders);
+        }
+        int barrierError = nodeBarrier(*split);
+        if (mpiError == MPI_SUCCESS) mpiError = barrierError;
+    }
+    if (split->rank != root && mpiError == MPI_SUCCESS) {
+        if (contiguous) {
+            std::memcpy(buffer, shared, bytes);
+        }
+        else {
+            int position = 0;
+            mpiError = MPI_Unpack(shared, (int) bytes, &position, buffer,
+                                  count, datatype, split->node);
+        }
+    }
+    *mpi_error = mpiError;
+    return true;
+}
+
+void YogiManager::releaseNodeComms() {
+    std::vector<std::shared_ptr<YogiNodeComms> > built;
+    {
+        YogiLockGuard guard(commCacheMutex, threadMultiple);
+        built.swap(nodeCommsBuilt);
+    }
+    for (std::size_t i = 0; i < built.size(); i++) {
+        freeNodeComms(*built[i]);
+    }
+}
+
+void YogiManager::setThreadMultiple(bool multiple) {
+    threadMultiple = multiple;
+    scheduler.setThreadMultiple(multiple);
+}
+
+/* Small per-thread number for the trace, handed out on a thread's first
+   traced call. */
+static std::atomic<int> traceThreads(0);
+static thread_local int traceThread = -1;
+
+YogiTracer::YogiTracer() : active(false), ring(NULL), head(0), tail(0),
+                           stopping(false), file(NULL), origin(0) {}
+
+YogiTracer::~YogiTracer() {
+    stop();
+    delete[] ring;
+}
+
+void YogiTracer::start(int rank, const char * const *functionNames,
+                       int count) {
+    std::ostringstream fileName;
+    fileName << "yogimpi.trace." << rank;
+    file = std::fopen(fileName.str().c_str(), "wb");
+    if (file == NULL) return;
+
+    /* Header: magic, format version, rank, record size, then the function
+       names as a count followed by NUL-terminated strings. */
+    const char magic[8] = { 'Y', 'O', 'G', 'I', 'T', 'R', 'C', '\0' };
+    int header[4] = { 1, rank, (int) sizeof(YogiTraceRecord), count };
+    std::fwrite(magic, 1, sizeof(magic), file);
+    std::fwrite(header, sizeof(int), 4, file);
+    for (int i = 0; i < count; i++) {
+        std::fwrite(functionNames[i], 1, std::strlen(functionNames[i]) + 1,
+                    file);
+    }
+
+    ring = new Slot[ringSize];
+    for (int i = 0; i < ringSize; i++) ring[i].sequence.store(i);
+    head.store(0);
+    tail = 0;
+    stopping.store(false);
+    origin = YogiProfiler::now();
+    writer = std::thread(&YogiTracer::drain, this);
+    active = true;
+}
+
+void YogiTracer::enter(int function, int peer, int tag, int comm) {
+    if (!active) return;
+    YogiTraceRecord record;
+    record.bytes = 0;
+    record.function = function;
+    record.event = enterEvent;
+    record.peer = peer;
+    record.tag = tag;
+    record.comm = comm;
+    record.error = 0;
+    push(record);
+}
+
+void YogiTracer::exit(int function, long long bytes, int error) {
+    if (!active) return;
+    YogiTraceRecord record;
+    record.bytes = bytes;
+    record.function = function;
+    record.event = exitEvent;
+    record.peer = -1;
+    record.tag = -1;
+    record.comm = -1;
+    record.error = error;
+    push(record);
+}
+
+/* Claim the next position, wait for the writer to have emptied that slot
+   on its previous pass round the ring, fill it, then publish it by
+   advancing its sequence number. */
+void YogiTracer::push(YogiTraceRecord &record) {
+    if (traceThread < 0) traceThread = traceThreads.fetch_add(1);
+    record.thread = traceThread;
+    record.callDepth = YogiManager::callDepth;
+    record.timestamp = YogiProfiler::now() - origin;
+
+    unsigned long long position = head.fetch_add(1);
+    Slot &slot = ring[position % ringSize];
+    while (slot.sequence.load(std::memory_order_acquire) != position) {
+        std::this_thread::yield();
+    }
+    slot.record = record;
+    slot.sequence.store(position + 1, std::memory_order_release);
+}
+
+/* Writer thread.  Records are copied out of the ring into a block that is
+   written once full.  A partial block is also written when the ring runs
+   dry, so the trace of a hung run stays current on disk. */
+void YogiTracer::drain() {
+    std::vector<YogiTraceRecord> block;
+    block.reserve(blockRecords);
+    while (true) {
+        bool finishing = stopping.load(std::memory_order_acquire);
+        bool took = false;
+        while (true) {
+            Slot &slot = ring[tail % ringSize];
+            if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+                break;
+            }
+            block.push_back(slot.record);
+            slot.sequence.store(tail + ringSize, std::memory_order_release);
+            tail++;
+            took = true;
+            if ((int) block.size() == blockRecords) {
+                std::fwrite(&block[0], sizeof(YogiTraceRecord), block.size(),
+                            file);
+                block.clear();
+            }
+        }
+        if (!took || finishing) {
+            if (!block.empty()) {
+                std::fwrite(&block[0], sizeof(YogiTraceRecord), block.size(),
+                            file);
+                block.clear();
+            }
+            std::fflush(file);
+            if (finishing) return;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+}
+
+void YogiTracer::stop() {
+    if (!active) return;
+    active = false;
+    stopping.store(true, std::memory_order_release);
+    writer.join();
+    std::fclose(file);
+    file = NULL;
+}
+
+static long longSetting(const char *name, long fallback) {
+    char *setting = std::getenv(name);
+    if (setting == NULL || *setting == '\0') return fallback;
+    long value = std::atol(setting);
+    return value < 0 ? fallback : value;
+}
+
+YogiProgress::YogiProgress() : active(false), stopping(false) {
+    char *setting = std::getenv("YOGI_PROGRESS_THREAD");
+    enabled = setting != NULL && std::string(setting) == "1";
+    interval = longSetting("YOGI_PROGRESS_INTERVAL", 10);
+    maxInterval = longSetting("YOGI_PROGRESS_MAX_INTERVAL", 1000);
+    if (maxInterval < interval) maxInterval = interval;
+    cpu = (int) longSetting("YOGI_PROGRESS_CPU", -1);
+}
+
+YogiProgress::~YogiProgress() {
+    stop();
+}
+
+void YogiProgress::start(bool threadMultiple) {
+    if (!enabled || active) return;
+    if (!threadMultiple) {
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        if (rank == 0) {
+            std::cerr << "YogiMPI: MPI does not provide MPI_THREAD_MULTIPLE, "
+                      << "so there is no progress thread." << std::endl;
+        }
+        return;
+    }
+    stopping.store(false);
+    worker = std::thread(&YogiProgress::run, this);
+    active = true;
+    YogiManager::instance().scheduler.setDriven(true);
+}
+
+void YogiProgress::stop() {
+    if (!active) return;
+    active = false;
+    YogiManager::instance().scheduler.setDriven(false);
+    stopping.store(true, std::memory_order_release);
+    worker.join();
+}
+
+void YogiProgress::run() {
+#ifdef __linux__
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+    YogiManager &yogi = YogiManager::instance();
+    long pause = interval;
+    while (!stopping.load(std::memory_order_acquire)) {
+        if (yogi.scheduler.busy() || yogi.requestsLive()) {
+            yogi.scheduler.progress();
+            /* Probing never takes a message, and every MPI runs its
+               progress engine while doing it. */
+            int flag;
+            MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_SELF, &flag,
+                       MPI_STATUS_IGNORE);
+            pause = interval;
+        }
+        else {
+            pause = std::min(pause * 2 + 1, maxInterval);
+        }
+        if (pause == 0) std::this_thread::yield();
+        else std::this_thread::sleep_for(std::chrono::microseconds(pause));
+    }
+}
+
+long long YogiManager::messageBytes(int mpiError, int count,
+                                    MPI_Datatype datatype) {
+    if (mpiError != MPI_SUCCESS || count <= 0) return 0;
+    if (datatype == MPI_DATATYPE_NULL) return 0;
+    int typeSize = 0;
+    MPI_Type_size(datatype, &typeSize);
+    return (long long) count * typeSize;
 }
 
-void YogiManager::closeDebugLog() {
-    debugLogFile.close();
+int YogiProfiler::bucketFor(long long elapsed) {
+    if (elapsed < 2) return 0;
+    int bucket = 63 - __builtin_clzll((unsigned long long) elapsed);
+    if (bucket >= YogiProfileEntry::numBuckets) {
+        return YogiProfileEntry::numBuckets - 1;
+    }
+    return bucket;
 }
 
-void YogiManager::writeToDebugLog(const char * toWrite) {
-    for (int i = 0; i < 2*callDepth; ++i) debugLogFile << " ";
-    debugLogFile << toWrite << std::endl;
+void YogiProfiler::start(const char * const *functionNames, int count) {
+    char *setting = std::getenv("YOGI_PROFILE");
+    if (setting == NULL || *setting == '\0' || std::strcmp(setting, "0") == 0) {
+        return;
+    }
+    names = functionNames;
+    numFunctions = count;
+    delete[] entries;
+    entries = new YogiProfileEntry[count];
+    for (int i = 0; i < count; i++) {
+        entries[i].calls.store(0);
+        entries[i].bytes.store(0);
+        entries[i].nanoseconds.store(0);
+        for (int b = 0; b < YogiProfileEntry::numBuckets; b++) {
+            entries[i].buckets[b].store(0);
+        }
+    }
+    enabled = true;
+}
+
+void YogiProfiler::record(int function, long long startTime,
+                          long long bytes) {
+    long long elapsed = now() - startTime;
+    YogiProfileEntry &current = entries[function];
+    current.calls.fetch_add(1, std::memory_order_relaxed);
+    current.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    current.nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+    current.buckets[bucketFor(elapsed)].fetch_add(1,
+                                                  std::memory_order_relaxed);
+}
+
+void YogiProfiler::report() {
+    if (!enabled) return;
+    enabled = false;
+
+    /* Per function: calls, bytes, nanoseconds, then the histogram. */
+    const int fields = 3 + YogiProfileEntry::numBuckets;
+    int length = numFunctions * fields;
+    std::vector<unsigned long long> local(length), total(length);
+    std::vector<unsigned long long> rankTime(numFunctions),
+                                    maxTime(numFunctions);
+    for (int i = 0; i < numFunctions; i++) {
+        unsigned long long *row = &local[i * fields];
+        row[0] = entries[i].calls.load();
+        row[1] = entries[i].bytes.load();
+        row[2] = entries[i].nanoseconds.load();
+        for (int b = 0; b < YogiProfileEntry::numBuckets; b++) {
+            row[3 + b] = entries[i].buckets[b].load();
+        }
+        rankTime[i] = row[2];
+    }
+
+    int rank = 0, size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Reduce(&local[0], &total[0], length, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+               0, MPI_COMM_WORLD);
+    MPI_Reduce(&rankTime[0], &maxTime[0], numFunctions,
+               MPI_UNSIGNED_LONG_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (rank != 0) return;
+
+    std::vector<int> called;
+    unsigned long long allTime = 0;
+    for (int i = 0; i < numFunctions; i++) {
+        if (total[i * fields] == 0) continue;
+        called.push_back(i);
+        allTime += total[i * fields + 2];
+    }
+    std::sort(called.begin(), called.end(), [&](int a, int b) {
+        return total[a * fields + 2] > total[b * fields + 2];
+    });
+
+    std::ostringstream fileName;
+    fileName << "yogimpi." << size << ".profile";
+    std::ofstream out(fileName.str().c_str());
+    out << "@ YogiMPI profile, " << size << " ranks" << std::endl;
+    out << "@ Time and bytes are summed over ranks; max rank is the largest"
+        << " single-rank time." << std::endl;
+    out << "@ Histogram bucket b counts calls taking 2^b to 2^(b+1) ns."
+        << std::endl << std::endl;
+    out << std::left << std::setw(28) << "Function" << std::right
+        << std::setw(12) << "Calls" << std::setw(14) << "Time (ms)"
+        << std::setw(14) << "Max rank (ms)" << std::setw(12) << "Avg (us)"
+        << std::setw(8) << "MPI%" << std::setw(16) << "Bytes" << std::endl;
+    out << std::fixed;
+    for (std::size_t n = 0; n < called.size(); n++) {
+        const unsigned long long *row = &total[called[n] * fields];
+        double share = allTime ? 100.0 * row[2] / allTime : 0.0;
+        out << std::left << std::setw(28) << names[called[n]] << std::right
+            << std::setw(12) << row[0]
+            << std::setprecision(3) << std::setw(14) << row[2] / 1e6
+            << std::setw(14) << maxTime[called[n]] / 1e6
+            << std::setw(12) << row[2] / 1e3 / row[0]
+            << std::setprecision(1) << std::setw(8) << share
+            << std::setw(16) << row[1] << std::endl;
+    }
+    out << std::endl << std::left << std::setw(28) << "Function"
+        << "Latency histogram (bucket:calls)" << std::endl;
+    for (std::size_t n = 0; n < called.size(); n++) {
+        const unsigned long long *row = &total[called[n] * fields];
+        out << std::left << std::setw(28) << names[called[n]];
+        for (int b = 0; b < YogiProfileEntry::numBuckets; b++) {
+            if (row[3 + b] != 0) out << " " << b << ":" << row[3 + b];
+        }
+        out << std::endl;
+    }
+    std::cerr << "YogiMPI profile written to " << fileName.str() << std::endl;
 }
 
 /* Some MPI libraries (ahem, ahem, OpenMPI and CRAY) have problems starting
@@ -306,250 +1446,105 @@ void YogiManager::loadMPILibrary() {
     }
 }
 
+#ifdef YOGI_DISPATCH
+std::atomic<void *> yogiSymbols[YOGI_NUM_SYMBOLS];
+
+/* Opens the MPI library named by YMPI_LOADLIBRARY for the dispatch table.
+   Without it, symbols come from whatever MPI the process already has. */
+static void * openDispatchLibrary() {
+    char *libraryName = std::getenv("YMPI_LOADLIBRARY");
+    if (libraryName == NULL) return RTLD_DEFAULT;
+    void *library = dlopen(libraryName, RTLD_NOW | RTLD_GLOBAL);
+    if (library == NULL) {
+        std::cerr << "YogiMPI: cannot load " << libraryName << ": "
+                  << dlerror() << std::endl;
+        std::abort();
+    }
+    return library;
+}
+
+void * yogiResolveSymbol(int id, const char *name) {
+    static void *library = openDispatchLibrary();
+    void *fn = dlsym(library, name);
+    if (fn == NULL) {
+        std::cerr << "YogiMPI: the MPI library has no " << name << std::endl;
+        std::abort();
+    }
+    yogiSymbols[id].store(fn, std::memory_order_release);
+    return fn;
+}
+#endif
+
 int YogiManager::combinerToYogi(int in_combiner) {
-    switch (in_combiner) {
-        case MPI_COMBINER_NAMED:
-            return YogiMPI_COMBINER_NAMED;
-            break;
-        case MPI_COMBINER_DUP:
-            return YogiMPI_COMBINER_DUP;
-            break;
-        case MPI_COMBINER_CONTIGUOUS:
-            return YogiMPI_COMBINER_CONTIGUOUS;
-            break;
-        case MPI_COMBINER_VECTOR:
-            return YogiMPI_COMBINER_VECTOR;
-            break;
-        case MPI_COMBINER_HVECTOR_INTEGER:
-            return YogiMPI_COMBINER_HVECTOR_INTEGER;
-            break;
-        case MPI_COMBINER_HVECTOR:
-            return YogiMPI_COMBINER_HVECTOR;
-            break;
-        case MPI_COMBINER_INDEXED:
-            return YogiMPI_COMBINER_INDEXED;
-            break;
-        case MPI_COMBINER_HINDEXED_INTEGER:
-            return YogiMPI_COMBINER_HINDEXED_INTEGER;
-            break;
-        case MPI_COMBINER_HINDEXED:
-            return YogiMPI_COMBINER_HINDEXED;
-            break;
-        case MPI_COMBINER_INDEXED_BLOCK:
-            return YogiMPI_COMBINER_INDEXED_BLOCK;
-            break;
-        case MPI_COMBINER_STRUCT_INTEGER:
-            return YogiMPI_COMBINER_STRUCT_INTEGER;
-            break;
-        case MPI_COMBINER_STRUCT:
-            return YogiMPI_COMBINER_STRUCT;
-            break;
-        case MPI_COMBINER_SUBARRAY:
-            return YogiMPI_COMBINER_SUBARRAY;
-            break;
-        case MPI_COMBINER_DARRAY:
-            return YogiMPI_COMBINER_DARRAY;
-            break;
-        case MPI_COMBINER_F90_REAL:
-            return YogiMPI_COMBINER_F90_REAL;
-            break;
-        case MPI_COMBINER_F90_COMPLEX:
-            return YogiMPI_COMBINER_F90_COMPLEX;
-            break;
-        case MPI_COMBINER_F90_INTEGER:
-            return YogiMPI_COMBINER_F90_INTEGER;
-            break;
-        case MPI_COMBINER_RESIZED:
-            return YogiMPI_COMBINER_RESIZED;
-            break;
-        default:
-            return in_combiner;
-            break;
-    }
-}
-
-int YogiManager::errorToYogi(int mpiError) {
-    std::map<int,int>::iterator it = yogiErrors.find(mpiError);
-    if (it != yogiErrors.end()) return it->second;
-    return YogiMPI_ERR_INTERN;
+    return yogiCombiners.find(in_combiner, in_combiner);
 }
 
 int YogiManager::errorToMPI(int yogiMPIError) {
-    std::map<int,int>::iterator it = mpiErrors.find(yogiMPIError);
-    if (it != mpiErrors.end()) return it->second;
-    return MPI_ERR_INTERN;
+    if (yogiMPIError == YogiMPI_SUCCESS) return MPI_SUCCESS;
+    return mpiErrors.find(yogiMPIError, MPI_ERR_INTERN);
 }
 
 int YogiManager::commattrToMPI(int comm_attr) {
-    switch(comm_attr) {
-      case YogiMPI_TAG_UB:
-          return MPI_TAG_UB;
-          break;
-      case YogiMPI_IO:
-          return MPI_IO;
-          break;
-      case YogiMPI_HOST:
-          return MPI_HOST;
-          break;
-      case YogiMPI_WTIME_IS_GLOBAL:
-          return MPI_WTIME_IS_GLOBAL;
-          break;
-      case YogiMPI_APPNUM:
-          return MPI_APPNUM;
-          break;
-      default:
-          return comm_attr;
-    }
+    return mpiCommAttrs.find(comm_attr, comm_attr);
 }
 
 int YogiManager::winattrToMPI(int win_attr) {
-    switch(win_attr) {
-      case YogiMPI_WIN_BASE:
-          return MPI_WIN_BASE;
-          break;
-      case YogiMPI_WIN_DISP_UNIT:
-          return MPI_WIN_DISP_UNIT;
-          break;
-      case YogiMPI_WIN_SIZE:
-          return MPI_WIN_SIZE;
-          break;
-      default:
-          return win_attr;
-    }
+    return mpiWinAttrs.find(win_attr, win_attr);
 }
 
+/* The one-sided assertions are bit flags and may be combined. */
 int YogiManager::onesidedToMPI(int onesided) {
-    switch(onesided) {
-      case YogiMPI_MODE_NOCHECK:
-          return MPI_MODE_NOCHECK;
-          break;
-      case YogiMPI_MODE_NOSTORE:
-          return MPI_MODE_NOSTORE;
-          break;
-      case YogiMPI_MODE_NOPUT:
-          return MPI_MODE_NOPUT;
-          break;
-      case YogiMPI_MODE_NOPRECEDE:
-          return MPI_MODE_NOPRECEDE;
-          break;
-      case YogiMPI_MODE_NOSUCCEED:
-          return MPI_MODE_NOSUCCEED;
-          break;
-      default:
-          return onesided;
+    int onesidedMPI = 0;
+
+    if ((onesided & YogiMPI_MODE_NOCHECK) != 0) {
+        onesidedMPI = onesidedMPI | MPI_MODE_NOCHECK;
+    }
+
+    if ((onesided & YogiMPI_MODE_NOSTORE) != 0) {
+        onesidedMPI = onesidedMPI | MPI_MODE_NOSTORE;
+    }
+
+    if ((onesided & YogiMPI_MODE_NOPUT) != 0) {
+        onesidedMPI = onesidedMPI | MPI_MODE_NOPUT;
     }
 
+    if ((onesided & YogiMPI_MODE_NOPRECEDE) != 0) {
+        onesidedMPI = onesidedMPI | MPI_MODE_NOPRECEDE;
+    }
+
+    if ((onesided & YogiMPI_MODE_NOSUCCEED) != 0) {
+        onesidedMPI = onesidedMPI | MPI_MODE_NOSUCCEED;
+    }
+
+    return onesidedMPI;
 }
 
 int YogiManager::locktypeToMPI(int lock_type) {
-    switch(lock_type) {
-      case YogiMPI_LOCK_EXCLUSIVE:
-          return MPI_LOCK_EXCLUSIVE;
-          break;
-      case YogiMPI_LOCK_SHARED:
-          return MPI_LOCK_SHARED;
-          break;
-      default:
-          return lock_type;
-    }
+    return mpiLockTypes.find(lock_type, lock_type);
 }
 
 int YogiManager::topoToYogi(int in_topo) {
-    switch(in_topo) {
-      case MPI_GRAPH:
-          return YogiMPI_GRAPH;
-          break;
-      case MPI_CART:
-          return YogiMPI_CART;
-          break;
-#if YogiMPI_VERSION == 3 || YogiMPI_SUBVERSION > 1
-      case MPI_DIST_GRAPH:
-          return YogiMPI_DIST_GRAPH;
-          break;
-#endif
-      case MPI_UNDEFINED:
-          return YogiMPI_UNDEFINED;
-          break;
-      default:
-          return in_topo;
-    }
+    return yogiTopos.find(in_topo, in_topo);
 }
 
-int YogiManager::comparisonToYogi(int mpiComp)
-{
-    std::map<int,int>::iterator it = yogiComps.find(mpiComp);
-    if (it != yogiComps.end()) return it->second;
-    return YogiMPI_UNEQUAL;
+int YogiManager::comparisonToYogi(int mpiComp) {
+    return yogiComps.find(mpiComp, YogiMPI_UNEQUAL);
 }
 
 int YogiManager::threadmodelToMPI(int threadmodel) {
-    switch(threadmodel) {
-      case YogiMPI_THREAD_SINGLE:
-          return MPI_THREAD_SINGLE;
-          break;
-      case YogiMPI_THREAD_FUNNELED:
-          return MPI_THREAD_FUNNELED;
-          break;
-      case YogiMPI_THREAD_SERIALIZED:
-          return MPI_THREAD_SERIALIZED;
-          break;
-      case YogiMPI_THREAD_MULTIPLE:
-          return MPI_THREAD_MULTIPLE;
-          break;
-      default:
-          return threadmodel;
-    }
+    return mpiThreadModels.find(threadmodel, threadmodel);
 }
 
 int YogiManager::typeclassToMPI(int typeclass) {
-    switch(typeclass) {
-      case YogiMPI_TYPECLASS_REAL:
-          return MPI_TYPECLASS_REAL;
-          break;
-      case YogiMPI_TYPECLASS_INTEGER:
-          return MPI_TYPECLASS_INTEGER;
-          break;
-      case YogiMPI_TYPECLASS_COMPLEX:
-          return MPI_TYPECLASS_COMPLEX;
-          break;
-      default:
-          return typeclass;
-    }
+    return mpiTypeclasses.find(typeclass, typeclass);
 }
 
 int YogiManager::whenceToMPI(int whence) {
-    switch(whence) {
-      case YogiMPI_SEEK_SET:
-          return MPI_SEEK_SET;
-          break;
-      case YogiMPI_SEEK_CUR:
-          return MPI_SEEK_CUR;
-          break;
-      case YogiMPI_SEEK_END:
-          return MPI_SEEK_END;
-          break;
-      default:
-          return whence;
-    }
+    return mpiWhence.find(whence, whence);
 }
 
 int YogiManager::providedToYogi(int provided) {
-    switch(provided) {
-      case MPI_THREAD_SINGLE:
-          return YogiMPI_THREAD_SINGLE;
-          break;
-      case MPI_THREAD_FUNNELED:
-          return YogiMPI_THREAD_FUNNELED;
-          break;
-      case MPI_THREAD_SERIALIZED:
-          return YogiMPI_THREAD_SERIALIZED;
-          break;
-      case MPI_THREAD_MULTIPLE:
-          return YogiMPI_THREAD_MULTIPLE;
-          break;
-      default:
-          return provided;
-    }
+    return yogiThreadModels.find(provided, provided);
 }
 
 int YogiManager::amodeToYogi(int amode) {
@@ -636,81 +1631,245 @@ int YogiManager::rootToMPI(int root) {
     return root;
 }
 
+template <typename T, typename V>
+void YogiManager::initPool(YogiPool<T> &pool, V marker_in, int offset,
+                           bool indexAll) {
+    /* Cast the marker to the type in the pool */
+    pool.marker = static_cast<T>(marker_in);
+    pool.offset = offset;
+    pool.indexAll = indexAll;
+    pool.count = offset;
+    pool.highWater = 0;
+    pool.inserts = 0;
+    pool.removes = 0;
+    pool.chunks.clear();
+    pool.chunkLive.clear();
+    pool.freeSlots.clear();
+    while (pool.capacity() < defaultPoolSize) growPool(pool);
+    /* The constants occupy the start of the first chunk. */
+    pool.chunkLive[0] = offset;
+    pool.freeSlots.erase(std::remove_if(pool.freeSlots.begin(),
+                                        pool.freeSlots.end(),
+                                        [offset](int i) { return i < offset; }),
+                         pool.freeSlots.end());
+    rebuildLookup(pool, 2 * defaultPoolSize);
+}
+
+/* Adds one chunk of free slots. */
+template <typename T>
+void YogiManager::growPool(YogiPool<T> &pool) {
+    int oldSize = pool.capacity();
+    int newSize = oldSize + YogiPool<T>::chunkSize;
+    std::unique_ptr<T[]> chunk(new T[YogiPool<T>::chunkSize]);
+    std::fill(chunk.get(), chunk.get() + YogiPool<T>::chunkSize, pool.marker);
+    pool.chunks.push_back(std::move(chunk));
+    pool.chunkLive.push_back(0);
+    /* Push in reverse so the lowest free index is handed out first. */
+    for (int i = newSize - 1; i >= oldSize; i--) {
+        pool.freeSlots.push_back(i);
+    }
+}
+
+/* Releases trailing chunks while the last two are both empty, keeping one
+   empty chunk so a pool hovering at a chunk boundary does not thrash. */
 template <typename T>
-int YogiManager::findInPool(std::vector<T> &pool, T item, int counter) {
-    typename std::vector<T>::iterator it = pool.begin();
-    it = std::find(pool.begin(), pool.begin() + counter, item);
-    return it - pool.begin();
+void YogiManager::shrinkPool(YogiPool<T> &pool) {
+    int minChunks = defaultPoolSize / YogiPool<T>::chunkSize;
+    std::size_t chunks = pool.chunks.size();
+    while ((int) chunks > minChunks && chunks >= 2 &&
+           pool.chunkLive[chunks - 1] == 0 && pool.chunkLive[chunks - 2] == 0) {
+        chunks--;
+    }
+    if (chunks == pool.chunks.size()) return;
+    pool.chunks.resize(chunks);
+    pool.chunkLive.resize(chunks);
+    int newSize = pool.capacity();
+    pool.freeSlots.erase(std::remove_if(pool.freeSlots.begin(),
+                                        pool.freeSlots.end(),
+                                        [newSize](int i) {
+                                            return i >= newSize;
+                                        }),
+                         pool.freeSlots.end());
+    /* Let a lookup table sized for the burst shrink with it. */
+    if (pool.indexAll && pool.lookup.size() > 16 * (std::size_t) pool.count &&
+        pool.lookup.size() > 2 * (std::size_t) defaultPoolSize) {
+        rebuildLookup(pool, 2 * defaultPoolSize);
+    }
 }
 
-template <typename T, typename V>
-int YogiManager::insertIntoPool(std::vector<T> &pool, T newItem, V marker_in,
-                                int offset, int &counter) {
+/* Mix the bits of an opaque MPI handle (an integer or a pointer, depending
+   on the distribution) into a hash value. */
+template <typename T>
+std::size_t YogiManager::hashHandle(T item) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &item, sizeof(T) < sizeof(bits) ? sizeof(T)
+                                                         : sizeof(bits));
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    return (std::size_t)bits;
+}
 
-    /* Cast the marker to the type in the pool */
-    T marker = std::move(static_cast<T>(marker_in));
-
-    /* First see if this already exists as a constant. If it does, just
-       return the equivalent Yogi constant value.
-     */
-    typename std::vector<T>::iterator it = pool.begin();
-    it = std::find(pool.begin(), pool.begin() + offset, newItem);
-    if (it != pool.begin() + offset) {
-        return it - pool.begin();
-    }
-    int delta;
-
-    /* Then see if the current counter exceeds the size of the vector.
-       If it does, double it. */
-    if (counter >= pool.capacity() - 1) {
-        pool.resize(pool.capacity() * 2, marker);
-    }
-    // After the offset, find first instance of marker, replace with newItem.
-    it = pool.begin();
-    std::advance(it, offset);
-    if (std::find(it, pool.end(), marker) != pool.end()) {
-        delta = std::distance(pool.begin(), std::find(it, pool.end(), marker));
-        pool.at(delta) = newItem;
+/* Returns the position of item in the lookup table, or -1 if absent. */
+template <typename T>
+long YogiManager::lookupPosition(YogiPool<T> &pool, T item) {
+    std::size_t mask = pool.lookup.size() - 1;
+    std::size_t pos = hashHandle(item) & mask;
+    while (pool.lookup[pos] != lookupEmpty) {
+        int entry = pool.lookup[pos];
+        if (entry >= 0 && pool.slot(entry) == item) return pos;
+        pos = (pos + 1) & mask;
     }
-    else {
-        return -1;
+    return -1;
+}
+
+/* Index the slot at index.  Other slots may hold the same handle, since
+   MPI hands out some objects again; each slot has its own entry. */
+template <typename T>
+void YogiManager::addToLookup(YogiPool<T> &pool, int index) {
+    /* Keep the table at most half full, counting deleted entries. A
+       rebuild picks up the new slot along with the rest. */
+    if ((pool.lookupFilled + 1) * 2 > (int)pool.lookup.size()) {
+        rebuildLookup(pool, 0);
+        return;
+    }
+    std::size_t mask = pool.lookup.size() - 1;
+    std::size_t pos = hashHandle(pool.slot(index)) & mask;
+    while (pool.lookup[pos] >= 0) {
+        pos = (pos + 1) & mask;
     }
-    // Bump up the counter and return the index.
-    counter++;
-    return delta;
+    if (pool.lookup[pos] == lookupEmpty) pool.lookupFilled++;
+    pool.lookup[pos] = index;
 }
 
-template <typename T, typename V>
-void YogiManager::removeFromPool(std::vector<T> &pool, int index, V marker_in,
-                                int offset, int &counter) {
+/* Drops the entry of the slot at index, leaving any other slot that holds
+   the same handle indexed. */
+template <typename T>
+void YogiManager::removeFromLookup(YogiPool<T> &pool, int index) {
+    std::size_t mask = pool.lookup.size() - 1;
+    std::size_t pos = hashHandle(pool.slot(index)) & mask;
+    while (pool.lookup[pos] != lookupEmpty) {
+        if (pool.lookup[pos] == index) {
+            pool.lookup[pos] = lookupDeleted;
+            return;
+        }
+        pos = (pos + 1) & mask;
+    }
+}
 
-    /* Cast the marker to the type in the pool */
-    T marker = std::move(static_cast<T>(marker_in));
+/* Rebuild the lookup table from the slots, dropping deleted entries and
+   sizing it for the live handles. Slot 0 holds the null marker, so the
+   null handle always translates back to the Yogi null handle. Pools that
+   don't index everything only index their constants. */
+template <typename T>
+void YogiManager::rebuildLookup(YogiPool<T> &pool, std::size_t minSize) {
+    std::size_t newSize = 16;
+    while (newSize < minSize || newSize < 4 * (std::size_t)pool.count) {
+        newSize *= 2;
+    }
+    pool.lookup.assign(newSize, lookupEmpty);
+    pool.lookupFilled = 0;
+    int indexed = pool.indexAll ? pool.capacity() : pool.offset;
+    for (int i = 0; i < indexed; i++) {
+        if (i > 0 && pool.slot(i) == pool.marker) continue;
+        // If two constants share an MPI handle, the first one wins.
+        if (i < pool.offset && lookupPosition(pool, pool.slot(i)) >= 0) {
+            continue;
+        }
+        std::size_t mask = pool.lookup.size() - 1;
+        std::size_t pos = hashHandle(pool.slot(i)) & mask;
+        while (pool.lookup[pos] != lookupEmpty) {
+            pos = (pos + 1) & mask;
+        }
+        pool.lookup[pos] = i;
+        pool.lookupFilled++;
+    }
+}
 
-    /* First see if the current index is at or above offset. If not, do not
-       make any modifications as these are considered read-only. */
-    if (index < offset) return;
-    // Replace the value at index with the marker value.
-    pool.at(index) = marker;
-    // Decrement the counter.
-    counter--;
+/* Returns a Yogi handle of item, or -1 if it is not in the pool.  When
+   several slots hold item, any of them may be returned. */
+template <typename T>
+int YogiManager::findInPool(YogiPool<T> &pool, T item) {
+    long pos = lookupPosition(pool, item);
+    if (pos < 0) return -1;
+    return pool.lookup[pos];
+}
 
+template <typename T>
+int YogiManager::insertIntoPool(YogiPool<T> &pool, T newItem) {
+    if (YogiPassthrough<T>::enabled) {
+        /* Only the constants are indexed, and they never change after
+           construction, so no lock is needed. */
+        int known = findInPool(pool, newItem);
+        if (known >= 0) return known;
+        int handle = YogiPassthrough<T>::toYogi(newItem);
+        if ((unsigned int) handle < (unsigned int) pool.offset) {
+            std::cerr << "YogiMPI: MPI handle " << handle << " collides with "
+                      << "a predefined Yogi handle; rebuild without "
+                      << "passthrough (YPASSTHROUGH=0)." << std::endl;
+            std::abort();
+        }
+        return handle;
+    }
+    YogiLockGuard guard(pool.mutex, threadMultiple);
+
+    /* Constants keep their Yogi handles.  Anything else takes a new slot,
+       even if an earlier translation holds the same handle: MPI returns
+       one object for repeated queries (MPI_Comm_group and the like), and
+       every handle the application gets must be freed on its own.  A live
+       slot never holds a constant, so any match is one. */
+    int known = findInPool(pool, newItem);
+    if (known >= 0 && known < pool.offset) return known;
+
+    // No free slots left, so add a chunk.
+    if (pool.freeSlots.empty()) growPool(pool);
+
+    // Take the most recently released slot and store the new item there.
+    int index = pool.freeSlots.back();
+    pool.freeSlots.pop_back();
+    pool.slot(index) = newItem;
+    if (pool.indexAll) addToLookup(pool, index);
+    // Bump up the counters and return the index.
+    pool.chunkLive[index >> YogiPool<T>::chunkShift]++;
+    pool.count++;
+    pool.inserts++;
+    if (pool.count - pool.offset > pool.highWater) {
+        pool.highWater = pool.count - pool.offset;
+    }
+    return index;
 }
 
 template <typename T>
-T YogiManager::fetchFromPool(std::vector<T> &pool, int index) {
-    return pool.at(index);
+void YogiManager::removeFromPool(YogiPool<T> &pool, int index) {
+    // Passthrough handles were never stored.
+    if (YogiPassthrough<T>::enabled) return;
+    YogiLockGuard guard(pool.mutex, threadMultiple);
+
+    /* First see if the current index is at or above offset. If not, do not
+       make any modifications as these are considered read-only. */
+    if (index < pool.offset || index >= pool.capacity()) return;
+    T &entry = pool.slot(index);
+    // A slot already holding the marker is free; don't release it twice.
+    if (entry == pool.marker) return;
+    // Drop the handle from the lookup before its slot is overwritten.
+    if (pool.indexAll) removeFromLookup(pool, index);
+    // Replace the value at index with the marker value.
+    entry = pool.marker;
+    pool.freeSlots.push_back(index);
+    // Decrement the counters, and give back chunks left empty at the end.
+    int chunk = index >> YogiPool<T>::chunkShift;
+    pool.chunkLive[chunk]--;
+    pool.count--;
+    pool.removes++;
+    if (chunk + 1 >= (int) pool.chunks.size() - 1 && pool.chunkLive[chunk] == 0) {
+        shrinkPool(pool);
+    }
 }
 
 MPI_Aint YogiManager::aintToMPI(YogiMPI_Aint in_aint) {
     return (MPI_Aint) in_aint;
 }
 
-MPI_Comm YogiManager::commToMPI(YogiMPI_Comm in_comm) {
-    MPI_Comm a_comm = fetchFromPool(commPool, in_comm);
-    return a_comm;
-}
-
 #if YogiMPI_VERSION == 3
 MPI_Count YogiManager::countToMPI(YogiMPI_Count in_count) {
     return (MPI_Count) in_count;
@@ -722,23 +1881,10 @@ MPI_Message YogiManager::messageToMPI(YogiMPI_Message in_message) {
 }
 #endif
 
-MPI_Datatype YogiManager::datatypeToMPI(YogiMPI_Datatype in_data) {
-    MPI_Datatype a_datatype = fetchFromPool(datatypePool, in_data);
-    return a_datatype;
-}
-
-MPI_Errhandler YogiManager::errhandlerToMPI(YogiMPI_Errhandler in_errhandler) {
-    return fetchFromPool(errPool, in_errhandler);
-}
-
 MPI_File YogiManager::fileToMPI(YogiMPI_File in_file) {
     return fetchFromPool(filePool, in_file);
 }
 
-MPI_Group YogiManager::groupToMPI(YogiMPI_Group in_group) {
-    return fetchFromPool(groupPool, in_group);
-}
-
 MPI_Info YogiManager::infoToMPI(YogiMPI_Info in_info) {
     return fetchFromPool(infoPool, in_info);
 }
@@ -747,11 +1893,6 @@ MPI_Offset YogiManager::offsetToMPI(YogiMPI_Offset in_offset) {
     return (MPI_Offset) in_offset;
 }
 
-MPI_Op YogiManager::opToMPI(YogiMPI_Win in_op) {
-    MPI_Op an_op = fetchFromPool(opPool, in_op);
-    return an_op;
-}
-
 MPI_Request YogiManager::requestToMPI(YogiMPI_Request in_request) {
     return fetchFromPool(requestPool, in_request);
 }
@@ -761,15 +1902,33 @@ MPI_Status * YogiManager::statusToMPI(YogiMPI_Status * in_status) {
      * structure padding since this area is never directly accessed by us.
      * It is ensured to be larger than we need.
     */
-    return reinterpret_cast<MPI_Status *> (in_status->realStatus);
+    if (statusAligned(in_status)) {
+        return reinterpret_cast<MPI_Status *> (in_status->realStatus);
+    }
+    std::memcpy((void *)&alignedStatus, (void *)(in_status->realStatus),
+                sizeof(MPI_Status));
+    return &alignedStatus;
+}
+
+MPI_Status * YogiManager::statusesToMPI(YogiMPI_Status * in_statuses,
+                                        int count) {
+    /* An MPI_Status is smaller than a YogiMPI_Status, so count of them
+       packed together fit in the caller's array of count. */
+    if (statusesAligned(in_statuses)) {
+        return reinterpret_cast<MPI_Status *> (in_statuses);
+    }
+    if ((int) alignedStatuses.size() < count) alignedStatuses.resize(count);
+    return &alignedStatuses[0];
 }
 
 MPI_Status * YogiManager::statusToMPI(const YogiMPI_Status * in_status) {
-    /* This will grab the number of bytes needed.  We don't care about
-     * structure padding since this area is never directly accessed by us.
-     * It is ensured to be larger than we need.
-    */
-    return YogiManager::statusToMPI(const_cast<YogiMPI_Status *>(in_status));
+    if (statusAligned(in_status)) {
+        return reinterpret_cast<MPI_Status *> (
+                   const_cast<YogiMPI_Status *>(in_status)->realStatus);
+    }
+    std::memcpy((void *)&alignedInputStatus, (void *)(in_status->realStatus),
+                sizeof(MPI_Status));
+    return &alignedInputStatus;
 }
 
 MPI_Win YogiManager::winToMPI(YogiMPI_Win in_win) {
@@ -778,58 +1937,27 @@ MPI_Win YogiManager::winToMPI(YogiMPI_Win in_win) {
 
 // Array conversions from Yogi handles to MPI handles
 
-void YogiManager::requestToMPI(YogiMPI_Request * in_yogi,
-                               MPI_Request * &out_mpi, int count) {
-    int i;
-    out_mpi = new MPI_Request[count];
+void YogiManager::requestToMPI(const YogiMPI_Request * in_yogi,
+                               MPI_Request * out_mpi, int count) {
     for (int i = 0; i < count; i++) {
         out_mpi[i] = requestToMPI(in_yogi[i]);
     }
 }
 
-void YogiManager::requestToMPI(const YogiMPI_Request * in_yogi,
-                               MPI_Request * &out_mpi, int count) {
-    YogiManager::requestToMPI(const_cast<YogiMPI_Request *>(in_yogi),out_mpi, count);
-}
-
-void YogiManager::aintToMPI(YogiMPI_Aint * in_yogi, MPI_Aint * &out_mpi,
+void YogiManager::aintToMPI(const YogiMPI_Aint * in_yogi, MPI_Aint * out_mpi,
                             int count) {
-    int i;
-    out_mpi = new MPI_Aint[count];
     for (int i = 0; i < count; i++) {
         out_mpi[i] = aintToMPI(in_yogi[i]);
     }
 }
 
-void YogiManager::aintToMPI(const YogiMPI_Aint * in_yogi, MPI_Aint * &out_mpi,
-                            int count) {
-    YogiManager::aintToMPI(const_cast<YogiMPI_Aint *>(in_yogi), out_mpi, count);
-}
-
-void YogiManager::datatypeToMPI(YogiMPI_Datatype * in_yogi,
-                                MPI_Datatype * &out_mpi, int count) {
-    int i;
-    out_mpi = new MPI_Datatype[count];
+void YogiManager::datatypeToMPI(const YogiMPI_Datatype * in_yogi,
+                                MPI_Datatype * out_mpi, int count) {
     for (int i = 0; i < count; i++) {
         out_mpi[i] = datatypeToMPI(in_yogi[i]);
     }
 }
 
-void YogiManager::datatypeToMPI(const YogiMPI_Datatype * in_yogi,
-                                MPI_Datatype * &out_mpi, int count) {
-    YogiManager::datatypeToMPI(const_cast<YogiMPI_Datatype *>(in_yogi), out_mpi, count);
-}
-
-/* Create MPI_Status arrays when required.  The MPI_Status objects remain
-   uninitialized. */
-void YogiManager::createStatus(MPI_Status * &out_mpi, int count) {
-    out_mpi = new MPI_Status[count];
-}
-
-void YogiManager::createStatus(MPI_Status * &out_mpi, int *count) {
-    out_mpi = new MPI_Status[*count];
-}
-
 // Conversions from MPI handles to Yogi handles
 
 YogiMPI_Aint YogiManager::aintToYogi(MPI_Aint in_aint) {
@@ -837,7 +1965,7 @@ YogiMPI_Aint YogiManager::aintToYogi(MPI_Aint in_aint) {
 }
 
 YogiMPI_Comm YogiManager::commToYogi(MPI_Comm in_comm) {
-    return insertIntoPool(commPool, in_comm, MPI_COMM_NULL, commOffset, numComms);
+    return insertIntoPool(commPool, in_comm);
 }
 
 #if YogiMPI_VERSION == 3
@@ -846,29 +1974,29 @@ YogiMPI_Count YogiManager::countToYogi(MPI_Count in_count) {
 }
 
 YogiMPI_Message YogiManager::messageToYogi(MPI_Message in_message) {
-    return insertIntoPool(messagePool, in_message, MPI_MESSAGE_NULL, messageOffset, numMessages);
+    return insertIntoPool(messagePool, in_message);
 }
 #endif
 
 YogiMPI_Datatype YogiManager::datatypeToYogi(MPI_Datatype in_data) {
-    return insertIntoPool(datatypePool, in_data, MPI_DATATYPE_NULL, datatypeOffset, numDatatypes);
+    return insertIntoPool(datatypePool, in_data);
 }
 
 YogiMPI_Errhandler YogiManager::errhandlerToYogi(MPI_Errhandler in_errhandler) {
-    return insertIntoPool(errPool, in_errhandler, MPI_ERRHANDLER_NULL, errOffset, numErrs);
+    return insertIntoPool(errPool, in_errhandler);
 }
 
 YogiMPI_File YogiManager::fileToYogi(MPI_File in_file) {
-    return insertIntoPool(filePool, in_file, MPI_FILE_NULL, fileOffset, numFiles);
+    return insertIntoPool(filePool, in_file);
 
 }
 
 YogiMPI_Group YogiManager::groupToYogi(MPI_Group in_group) {
-    return insertIntoPool(groupPool, in_group, MPI_GROUP_NULL, groupOffset, numGroups);
+    return insertIntoPool(groupPool, in_group);
 }
 
 YogiMPI_Info YogiManager::infoToYogi(MPI_Info in_info) {
-    return insertIntoPool(infoPool, in_info, MPI_INFO_NULL, infoOffset, numInfos);
+    return insertIntoPool(infoPool, in_info);
 }
 
 YogiMPI_Offset YogiManager::offsetToYogi(MPI_Offset in_offset) {
@@ -876,11 +2004,11 @@ YogiMPI_Offset YogiManager::offsetToYogi(MPI_Offset in_offset) {
 }
 
 YogiMPI_Op YogiManager::opToYogi(MPI_Op in_op) {
-    return insertIntoPool(opPool, in_op, MPI_OP_NULL, opOffset, numOps);
+    return insertIntoPool(opPool, in_op);
 }
 
 YogiMPI_Request YogiManager::requestToYogi(MPI_Request in_request) {
-    return insertIntoPool(requestPool, in_request, MPI_REQUEST_NULL, requestOffset, numRequests);
+    return insertIntoPool(requestPool, in_request);
 }
 
 /* Converts an MPI_Status object back to a YogiMPI_Status object.
@@ -896,7 +2024,36 @@ YogiMPI_Request YogiManager::requestToYogi(MPI_Request in_request) {
 YogiMPI_Status YogiManager::statusToYogi(MPI_Status &in_status,
                                          bool set_error) {
     YogiMPI_Status dest;
+    setStatusFields(in_status, dest, set_error);
 
+    /* If this isn't the same address, force a memcpy */
+    if ((void *)(dest.realStatus) != (void *)&in_status) {
+        std::memcpy((void *)(dest.realStatus), (void *)&in_status,
+                    sizeof(MPI_Status));
+    }
+    return dest;
+}
+
+void YogiManager::statusToYogiInPlace(YogiMPI_Status * in_status,
+                                      bool set_error) {
+    if (statusAligned(in_status)) {
+        setStatusFields(*reinterpret_cast<MPI_Status *> (in_status->realStatus),
+                        *in_status, set_error);
+        return;
+    }
+    // MPI wrote the copy statusToMPI handed out.
+    std::memcpy((void *)(in_status->realStatus), (void *)&alignedStatus,
+                sizeof(MPI_Status));
+    setStatusFields(alignedStatus, *in_status, set_error);
+}
+
+/* Fills the public fields of a YogiMPI_Status from an MPI_Status.
+   @param in_status The MPI_Status to read.
+   @param dest The YogiMPI_Status whose public fields are set.
+   @param set_error See statusToYogi.
+*/
+void YogiManager::setStatusFields(const MPI_Status &in_status,
+                                  YogiMPI_Status &dest, bool set_error) {
     if (in_status.MPI_TAG == MPI_ANY_TAG) {
         dest.MPI_TAG = YogiMPI_ANY_TAG;
     }
@@ -916,159 +2073,383 @@ YogiMPI_Status YogiManager::statusToYogi(MPI_Status &in_status,
         }
     }
     else dest.MPI_ERROR = errorToYogi(in_status.MPI_ERROR);
-
-    /* If this isn't the same address, force a memcpy */
-    if ((void *)(dest.realStatus) != (void *)&in_status) {
-        std::memcpy((void *)(dest.realStatus), (void *)&in_status,
-                    sizeof(MPI_Status));
-    }
-    return dest;
 }
 
 YogiMPI_Win YogiManager::winToYogi(MPI_Win in_win) {
-    return insertIntoPool(winPool, in_win, MPI_WIN_NULL, winOffset, numWins);
+    return insertIntoPool(winPool, in_win);
 }
 
 // Array conversion from MPI to Yogi
 
-void YogiManager::requestToYogi(MPI_Request * &in_mpi,
-                                YogiMPI_Request * &out_yogi, int count,
-                                bool free_mpi) {
-    int i;
+void YogiManager::requestToYogi(MPI_Request * in_mpi,
+                                YogiMPI_Request * out_yogi, int count) {
     for (int i = 0; i < count; i++) {
         out_yogi[i] = requestToYogi(in_mpi[i]);
     }
-    if (free_mpi) freeRequest(in_mpi);
 }
 
-void YogiManager::aintToYogi(MPI_Aint * &in_mpi,
-                             YogiMPI_Aint * &out_yogi, int count,
-                             bool free_mpi) {
-    int i;
+void YogiManager::aintToYogi(MPI_Aint * in_mpi, YogiMPI_Aint * out_yogi,
+                             int count) {
     for (int i = 0; i < count; i++) {
         out_yogi[i] = aintToYogi(in_mpi[i]);
     }
-    if (free_mpi) freeAint(in_mpi);
 }
 
-void YogiManager::datatypeToYogi(MPI_Datatype * &in_mpi,
-                                 YogiMPI_Datatype * &out_yogi, int count,
-                                 bool free_mpi) {
-    int i;
+void YogiManager::datatypeToYogi(MPI_Datatype * in_mpi,
+                                 YogiMPI_Datatype * out_yogi, int count) {
     for (int i = 0; i < count; i++) {
         out_yogi[i] = datatypeToYogi(in_mpi[i]);
     }
-    if (free_mpi) freeDatatype(in_mpi);
 }
 
-void YogiManager::statusToYogi(MPI_Status * &in_mpi, YogiMPI_Status *& out_yogi,
-                               int count, bool free_mpi) {
-    int i;
+void YogiManager::statusToYogi(MPI_Status * in_mpi, YogiMPI_Status * out_yogi,
+                               int count) {
     for (int i = 0; i < count; i++) {
         out_yogi[i] = statusToYogi(in_mpi[i]);
     }
-    if (free_mpi) freeStatus(in_mpi);
+}
+
+void YogiManager::statusesToYogiInPlace(YogiMPI_Status * in_statuses,
+                                        int count) {
+    if (count <= 0) return;
+    const MPI_Status *written = statusesAligned(in_statuses) ?
+        reinterpret_cast<MPI_Status *> (in_statuses) : &alignedStatuses[0];
+    /* Packed in place, MPI status i sits at byte i * sizeof(MPI_Status) and
+       moves to the realStatus of element i, which is never at a lower
+       address.  Going from the last element down, a move only overwrites
+       statuses that have already moved, or its own source, which is read
+       out first since the realStatus need not be aligned. */
+    for (int i = count - 1; i >= 0; i--) {
+        MPI_Status status = written[i];
+        std::memcpy((void *)(in_statuses[i].realStatus), (void *)&status,
+                    sizeof(MPI_Status));
+        setStatusFields(status, in_statuses[i], true);
+    }
+}
+
+template <typename T>
+int YogiManager::resolveInPool(YogiPool<T> &pool, T item) {
+    if (!YogiPassthrough<T>::enabled) {
+        YogiLockGuard guard(pool.mutex, threadMultiple);
+        int found = findInPool(pool, item);
+        if (found >= 0) return found;
+    }
+    return insertIntoPool(pool, item);
+}
+
+YogiMPI_Comm YogiManager::commToYogiResolve(MPI_Comm in_comm) {
+    return resolveInPool(commPool, in_comm);
+}
+
+YogiMPI_Group YogiManager::groupToYogiResolve(MPI_Group in_group) {
+    return resolveInPool(groupPool, in_group);
+}
+
+YogiMPI_Win YogiManager::winToYogiResolve(MPI_Win in_win) {
+    return resolveInPool(winPool, in_win);
+}
+
+YogiMPI_File YogiManager::fileToYogiResolve(MPI_File in_file) {
+    return resolveInPool(filePool, in_file);
 }
 
 YogiMPI_Datatype YogiManager::datatypeToYogiFindOnly(MPI_Datatype in_data) {
-    return findInPool(datatypePool, in_data, numDatatypes);
+    if (YogiPassthrough<MPI_Datatype>::enabled) {
+        // Every datatype is known: a constant, or its own handle.
+        return insertIntoPool(datatypePool, in_data);
+    }
+    YogiLockGuard guard(datatypePool.mutex, threadMultiple);
+    int found = findInPool(datatypePool, in_data);
+    if (found < 0) return YogiMPI_DATATYPE_NULL;
+    return found;
+}
+
+template <typename T>
+void YogiManager::fillPoolStats(YogiPool<T> &pool, YogiX_Pool_info *info) {
+    YogiLockGuard guard(pool.mutex, threadMultiple);
+    info->live = pool.count - pool.offset;
+    info->high_water = pool.highWater;
+    info->capacity = pool.capacity();
+    info->inserts = pool.inserts;
+    info->removes = pool.removes;
+    double seconds = (YogiProfiler::now() - poolStartTime) / 1e9;
+    if (seconds <= 0) seconds = 1e-9;
+    info->insert_rate = pool.inserts / seconds;
+    info->remove_rate = pool.removes / seconds;
+}
+
+bool YogiManager::poolStats(int handleClass, YogiX_Pool_info *info) {
+    static const char * const names[YogiX_NUM_POOLS] = {
+        "comm", "datatype", "request", "op", "group", "info", "errhandler",
+        "win", "file", "message"
+    };
+    if (handleClass < 0 || handleClass >= YogiX_NUM_POOLS) return false;
+    info->name = names[handleClass];
+    switch (handleClass) {
+    case YogiX_POOL_COMM: fillPoolStats(commPool, info); break;
+    case YogiX_POOL_DATATYPE: fillPoolStats(datatypePool, info); break;
+    case YogiX_POOL_REQUEST: fillPoolStats(requestPool, info); break;
+    case YogiX_POOL_OP: fillPoolStats(opPool, info); break;
+    case YogiX_POOL_GROUP: fillPoolStats(groupPool, info); break;
+    case YogiX_POOL_INFO: fillPoolStats(infoPool, info); break;
+    case YogiX_POOL_ERRHANDLER: fillPoolStats(errPool, info); break;
+    case YogiX_POOL_WIN: fillPoolStats(winPool, info); break;
+    case YogiX_POOL_FILE: fillPoolStats(filePool, info); break;
+#if YogiMPI_VERSION == 3
+    case YogiX_POOL_MESSAGE: fillPoolStats(messagePool, info); break;
+#endif
+    default: return false;
+    }
+    return true;
+}
+
+bool YogiManager::requestsLive() {
+    if (YogiPassthrough<MPI_Request>::enabled) return true;
+    YogiLockGuard guard(requestPool.mutex, threadMultiple);
+    return requestPool.count > requestPool.offset;
+}
+
+void YogiManager::reportPools() {
+    char *setting = std::getenv("YOGI_POOL_STATS");
+    if (setting == NULL || std::string(setting) != "1") return;
+
+    /* Per class: live, inserts, removes (summed), high water, capacity
+       (largest rank). */
+    const int fields = 5;
+    std::vector<long long> local(YogiX_NUM_POOLS * fields, 0);
+    std::vector<long long> sum(local.size()), max(local.size());
+    std::vector<int> known;
+    for (int i = 0; i < YogiX_NUM_POOLS; i++) {
+        YogiX_Pool_info info;
+        if (!poolStats(i, &info)) continue;
+        known.push_back(i);
+        long long *row = &local[i * fields];
+        row[0] = info.live;
+        row[1] = info.inserts;
+        row[2] = info.removes;
+        row[3] = info.high_water;
+        row[4] = info.capacity;
+    }
+
+    int rank = 0, size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Reduce(&local[0], &sum[0], local.size(), MPI_LONG_LONG, MPI_SUM, 0,
+               MPI_COMM_WORLD);
+    MPI_Reduce(&local[0], &max[0], local.size(), MPI_LONG_LONG, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    if (rank != 0) return;
+
+    std::ostringstream out;
+    out << "YogiMPI handle pools, " << size << " ranks (live, inserts and "
+        << "removes summed; high water and capacity of the largest rank)"
+        << std::endl;
+    out << std::left << std::setw(12) << "Class" << std::right
+        << std::setw(12) << "Live" << std::setw(12) << "High water"
+        << std::setw(12) << "Capacity" << std::setw(14) << "Inserts"
+        << std::setw(14) << "Removes" << std::endl;
+    for (std::size_t k = 0; k < known.size(); k++) {
+        YogiX_Pool_info info;
+        poolStats(known[k], &info);
+        int row = known[k] * fields;
+        out << std::left << std::setw(12) << info.name << std::right
+            << std::setw(12) << sum[row] << std::setw(12) << max[row + 3]
+            << std::setw(12) << max[row + 4] << std::setw(14) << sum[row + 1]
+            << std::setw(14) << sum[row + 2] << std::endl;
+    }
+    std::cerr << out.str();
 }
 
 // Removing Yogi handles
 
 YogiMPI_Comm YogiManager::unmapComm(YogiMPI_Comm to_free) {
-    removeFromPool(commPool, to_free, MPI_COMM_NULL, commOffset, numComms);
+    removeFromPool(commPool, to_free);
+    scheduler.releaseComm(to_free);
+    std::shared_ptr<YogiNodeComms> nodeComms;
+    {
+        YogiLockGuard guard(commCacheMutex, threadMultiple);
+#ifdef YOGI_PASSTHROUGH
+        nodeComms = commCache[to_free].nodeComms;
+        commCache.erase(to_free);
+#else
+        if (to_free >= 0 && to_free < (int) commCache.size()) {
+            nodeComms = commCache[to_free].nodeComms;
+            commCache[to_free] = YogiCommCache();
+        }
+#endif
+        std::vector<std::shared_ptr<YogiNodeComms> >::iterator built =
+            std::find(nodeCommsBuilt.begin(), nodeCommsBuilt.end(), nodeComms);
+        if (!nodeComms || built == nodeCommsBuilt.end()) {
+            return YogiMPI_COMM_NULL;
+        }
+        nodeCommsBuilt.erase(built);
+    }
+    // Freeing the communicator was collective, so this can be too.
+    freeNodeComms(*nodeComms);
     return YogiMPI_COMM_NULL;
 }
 
 YogiMPI_Datatype YogiManager::unmapDatatype(YogiMPI_Datatype to_free) {
-    removeFromPool(datatypePool, to_free, MPI_DATATYPE_NULL, datatypeOffset,
-                   numDatatypes);
+    removeFromPool(datatypePool, to_free);
+    YogiLockGuard guard(commCacheMutex, threadMultiple);
+    datatypeEpoch++;
     return YogiMPI_DATATYPE_NULL;
 }
 
 YogiMPI_Errhandler YogiManager::unmapErrhandler(YogiMPI_Errhandler to_free)  {
-    removeFromPool(errPool, to_free, MPI_ERRHANDLER_NULL, errOffset, numErrs);
+    removeFromPool(errPool, to_free);
     return YogiMPI_ERRHANDLER_NULL;
 }
 
 YogiMPI_File YogiManager::unmapFile(YogiMPI_File to_free) {
-    removeFromPool(filePool, to_free, MPI_FILE_NULL, fileOffset, numFiles);
+    removeFromPool(filePool, to_free);
     return YogiMPI_FILE_NULL;
 }
 
 YogiMPI_Group YogiManager::unmapGroup(YogiMPI_Group to_free) {
-    removeFromPool(groupPool, to_free, MPI_GROUP_NULL, groupOffset, numGroups);
+    removeFromPool(groupPool, to_free);
     return YogiMPI_GROUP_NULL;
 }
 
 YogiMPI_Info YogiManager::unmapInfo(YogiMPI_Info to_free) {
-    removeFromPool(infoPool, to_free, MPI_INFO_NULL, infoOffset, numInfos);
+    removeFromPool(infoPool, to_free);
     return YogiMPI_INFO_NULL;
 }
 
 YogiMPI_Op YogiManager::unmapOp(YogiMPI_Op to_free) {
-    removeFromPool(opPool, to_free, MPI_OP_NULL, opOffset, numOps);
+    removeFromPool(opPool, to_free);
+    YogiLockGuard guard(callbackMutex, threadMultiple);
+    /* MPI only marks the op for deallocation, and a reduction already
+       started may still call it, so the function stays reachable: a slot
+       keeps it for good, and an opUserFn entry until the handle is
+       reused. */
+    for (int i = 0; i < numOpSlots; i++) {
+        if (opSlots[i].op == to_free) {
+            opSlots[i].op = -1;
+            opSlots[i].retired = true;
+        }
+    }
     return YogiMPI_OP_NULL;
 }
 
 YogiMPI_Request YogiManager::unmapRequest(YogiMPI_Request to_free) {
-    removeFromPool(requestPool, to_free, MPI_REQUEST_NULL, requestOffset,
-                   numRequests);
+    if (persistentCount.load(std::memory_order_relaxed) != 0) {
+        YogiLockGuard guard(persistentMutex, threadMultiple);
+        if (persistentRequests.erase(to_free)) {
+            persistentCount--;
+            persistentEpoch++;
+        }
+    }
+    removeFromPool(requestPool, to_free);
     return YogiMPI_REQUEST_NULL;
 }
 
 YogiMPI_Win YogiManager::unmapWin(YogiMPI_Win to_free) {
-    removeFromPool(winPool, to_free, MPI_WIN_NULL, winOffset, numWins);
+    removeFromPool(winPool, to_free);
     return YogiMPI_WIN_NULL;
 }
 
 #if YogiMPI_VERSION == 3
 YogiMPI_Message YogiManager::unmapMessage(YogiMPI_Message to_free) {
-    removeFromPool(messagePool, to_free, MPI_MESSAGE_NULL, messageOffset,
-                   numMessages);
+    removeFromPool(messagePool, to_free);
     return YogiMPI_MESSAGE_NULL;
 }
 #endif
 
-/* Used to deallocate temporary arrays.  Keeping these here to track memory
-   allocations (may implemented in future). */
-void YogiManager::freeRequest(MPI_Request * &to_free) {
-    delete[] to_free;
-}
+/* Each thread keeps its own stock of conversion buffers, so borrowing one
+   never needs a lock.  The stock frees its buffers when the thread exits. */
+struct ScratchBuffers
+{
+    std::vector<std::vector<char> *> spare;
+    ~ScratchBuffers() {
+        for (std::size_t i = 0; i < spare.size(); i++) delete spare[i];
+    }
+};
 
-void YogiManager::freeAint(MPI_Aint * &to_free) {
-    delete[] to_free;
+static ScratchBuffers & threadScratch() {
+    static thread_local ScratchBuffers buffers;
+    return buffers;
 }
 
-void YogiManager::freeDatatype(MPI_Datatype * &to_free) {
-    delete[] to_free;
+std::vector<char> * YogiScratchStock::borrow() {
+    ScratchBuffers & buffers = threadScratch();
+    if (buffers.spare.empty()) return new std::vector<char>();
+    std::vector<char> * buffer = buffers.spare.back();
+    buffers.spare.pop_back();
+    return buffer;
 }
 
-void YogiManager::freeStatus(MPI_Status * &to_free) {
-    delete[] to_free;
+void YogiScratchStock::giveBack(std::vector<char> * buffer) {
+    threadScratch().spare.push_back(buffer);
 }
 
 void YogiManager::copyAttrFn(int keyval, YogiMPI_Comm_copy_attr_function* f) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     commCopyAttrFn[keyval] = f;
 }
 
 YogiMPI_Comm_copy_attr_function* YogiManager::copyAttrFn(int keyval) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     return commCopyAttrFn[keyval];
 }
 
 void YogiManager::delAttrFn(int keyval, YogiMPI_Comm_delete_attr_function* f) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     commDelAttrFn[keyval] = f;
 }
 
 YogiMPI_Comm_delete_attr_function* YogiManager::delAttrFn(int keyval) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     return commDelAttrFn[keyval];
 }
 
 void YogiManager::userFn(int op, YogiMPI_User_function* f) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     opUserFn[op] = f;
 }
 
 YogiMPI_User_function* YogiManager::userFn(int op) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
     return opUserFn[op];
 }
+
+YogiMPI_User_function* YogiManager::userFunction(YogiMPI_Op op) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
+    for (int i = 0; i < numOpSlots; i++) {
+        if (opSlots[i].op == op) return opSlots[i].fn;
+    }
+    std::map<int, YogiMPI_User_function*>::iterator found = opUserFn.find(op);
+    return found == opUserFn.end() ? NULL : found->second;
+}
+
+MPI_User_function* YogiManager::claimOpSlot(YogiMPI_User_function* fn,
+                                            int &slot, bool &reused) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
+    /* A retired slot with the same function first, since a reduction of
+       its freed op still calls the right function through it. */
+    int empty = -1;
+    for (slot = 0; slot < numOpSlots; slot++) {
+        if (opSlots[slot].retired && opSlots[slot].fn == fn) break;
+        if (empty < 0 && opSlots[slot].fn == nullptr) empty = slot;
+    }
+    reused = slot < numOpSlots;
+    if (!reused) slot = empty;
+    if (slot < 0) return NULL;
+    opSlots[slot].fn.store(fn, std::memory_order_release);
+    opSlots[slot].op = -1;
+    opSlots[slot].retired = false;
+    return opTrampolines[slot];
+}
+
+void YogiManager::bindOpSlot(int slot, YogiMPI_Op op) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
+    opSlots[slot].op = op;
+}
+
+void YogiManager::releaseOpSlot(int slot, bool reused) {
+    YogiLockGuard guard(callbackMutex, threadMultiple);
+    opSlots[slot].op = -1;
+    // A reduction of the freed op the slot served may still call fn.
+    if (reused) opSlots[slot].retired = true;
+    else opSlots[slot].fn = nullptr;
+}
@@ -3,24 +3,551 @@
 
 #include "yogimpi.h"
 #include "mpi.h"
+#include "YogiReduce.h"
+#include "YogiSchedule.h"
+#ifdef YOGI_DISPATCH
+#include "yogimpi_dispatch.h"
+#endif
 #include <map>
+#include <deque>
 #include <vector>
 #include <iostream>
 #include <fstream>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <stdexcept>
+
+/* Storage for one class of handle translation.  Slots below offset hold the
+   predefined MPI constants and are never handed out or released.  Slots
+   live in fixed-size chunks: growing adds a chunk without moving the others,
+   and once the last two chunks are empty the last one is released, so a
+   burst of handles does not pin memory for the rest of the run.  Released
+   slots are kept on a stack of free indices, so inserting and removing a
+   handle costs the same no matter how many handles are live.  The lookup
+   table is an open-addressing hash index from MPI handle to slot, used to
+   find the Yogi handle of an MPI handle without a scan, for callbacks and
+   Yogi_Resolve*.  Translating an MPI handle an MPI call returned always
+   takes a new slot, since MPI may return one object several times and
+   each copy is freed on its own; the index then holds one entry per slot.
+   Pools for per-operation objects (requests, messages) only index their
+   constants.  The mutex guards the whole pool once MPI runs with
+   MPI_THREAD_MULTIPLE. */
+template <typename T>
+struct YogiPool
+{
+    static const int chunkShift = 7;
+    static const int chunkSize = 1 << chunkShift;
+
+    T & slot(int index) {
+        return chunks[index >> chunkShift][index & (chunkSize - 1)];
+    }
+    int capacity() const {
+        return (int) chunks.size() << chunkShift;
+    }
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<T[]> > chunks;
+    std::vector<int> chunkLive;
+    std::vector<int> freeSlots;
+    std::vector<int> lookup;
+    int lookupFilled;
+    bool indexAll;
+    T marker;
+    int offset;
+    int count;
+    int highWater;
+    long long inserts;
+    long long removes;
+};
+
+/* configure defines YOGI_PASSTHROUGH when every MPI handle type except
+   MPI_File is a plain int, as on MPICH and its derivatives.  Handles MPI
+   creates are then their own Yogi handles: pools only hold the predefined
+   constants, and translating anything else is a cast.  Such handles never
+   fall below the pool offsets, where the Yogi constants live. */
+#ifdef YOGI_PASSTHROUGH
+#define YOGI_PASSTHROUGH_BUILD true
+#else
+#define YOGI_PASSTHROUGH_BUILD false
+#endif
+
+template <typename T, bool Enabled = YOGI_PASSTHROUGH_BUILD &&
+                                     std::is_integral<T>::value &&
+                                     sizeof(T) == sizeof(int)>
+struct YogiPassthrough
+{
+    static const bool enabled = false;
+    static T toMPI(int) { return T(); }
+    static int toYogi(T) { return -1; }
+};
+
+template <typename T>
+struct YogiPassthrough<T, true>
+{
+    static const bool enabled = true;
+    static T toMPI(int handle) { return (T) handle; }
+    static int toYogi(T handle) { return (int) handle; }
+};
+
+/* Holds a mutex for the rest of a scope, but only when active.  Lets the
+   single-threaded path skip locking altogether. */
+class YogiLockGuard
+{
+public:
+    YogiLockGuard(std::mutex &m, bool active) : held(active ? &m : NULL) {
+        if (held != NULL) held->lock();
+    }
+    ~YogiLockGuard() {
+        if (held != NULL) held->unlock();
+    }
+private:
+    YogiLockGuard(const YogiLockGuard &);
+    YogiLockGuard & operator=(const YogiLockGuard &);
+    std::mutex *held;
+};
+
+/* Per-thread stock of heap buffers for array conversions that outgrow the
+   inline storage of a YogiScratch.  Buffers only grow and go back on the
+   stock when the scratch object leaves scope, so once a thread has converted
+   its largest array the wrappers stop calling the allocator. */
+class YogiScratchStock
+{
+public:
+    static std::vector<char> * borrow();
+    static void giveBack(std::vector<char> * buffer);
+};
+
+/* Temporary MPI-side array for a single wrapper call.  Up to N elements live
+   on the stack; larger arrays borrow a buffer from the calling thread's
+   YogiScratchStock.  T must be a plain MPI handle or struct. */
+template <typename T, int N = 64>
+class YogiScratch
+{
+public:
+    YogiScratch() : heap(NULL) {}
+    ~YogiScratch() {
+        if (heap != NULL) YogiScratchStock::giveBack(heap);
+    }
+    T * get(int count) {
+        if (count <= N) return local;
+        if (heap == NULL) heap = YogiScratchStock::borrow();
+        std::size_t bytes = (std::size_t) count * sizeof(T);
+        if (heap->size() < bytes) heap->resize(bytes);
+        return reinterpret_cast<T *>(&(*heap)[0]);
+    }
+private:
+    YogiScratch(const YogiScratch &);
+    YogiScratch & operator=(const YogiScratch &);
+    T local[N];
+    std::vector<char> * heap;
+};
+
+struct YogiConstPair
+{
+    int yogi;
+    int mpi;
+};
+
+/* Translation of small integer constants such as error classes, combiners
+   and attribute keys.  Keys are stored in a dense array starting from the
+   smallest key, so a lookup is a range check and an index.  Keys far from
+   zero, like MPI_UNDEFINED or a large MPI_ERR_LASTCODE, go to a small
+   overflow map instead of stretching the array. */
+class YogiConstTable
+{
+public:
+    static const int denseLimit;
+
+    YogiConstTable() : low(0) {}
+    void build(const YogiConstPair *pairs, int count, bool toYogi);
+    int find(int key, int fallback) const {
+        long long index = (long long) key - low;
+        if (index >= 0 && index < (long long) values.size() && known[index]) {
+            return values[index];
+        }
+        if (overflow.empty()) return fallback;
+        return findOverflow(key, fallback);
+    }
+private:
+    int findOverflow(int key, int fallback) const;
+
+    int low;
+    std::vector<int> values;
+    std::vector<char> known;
+    std::map<int, int> overflow;
+};
+
+/* Call statistics for one wrapped function.  Bucket b of the latency
+   histogram counts calls that took between 2^b and 2^(b+1) nanoseconds; the
+   last bucket also takes everything slower. */
+struct YogiProfileEntry
+{
+    static const int numBuckets = 32;
+    std::atomic<unsigned long long> calls;
+    std::atomic<unsigned long long> bytes;
+    std::atomic<unsigned long long> nanoseconds;
+    std::atomic<unsigned long long> buckets[numBuckets];
+};
+
+/* Optional per-call profiler.  Wrappers generated with YOGI_PROFILE defined
+   check enabled around the MPI call, so a rank that does not ask for
+   profiling pays one predictable branch per call.  Profiling is switched on
+   at MPI_Init by setting the YOGI_PROFILE environment variable to anything
+   other than 0, and the summary over all ranks is written by rank 0 at
+   MPI_Finalize.  Counters are relaxed atomics so that MPI_THREAD_MULTIPLE
+   callers can record concurrently. */
+class YogiProfiler
+{
+public:
+    YogiProfiler() : enabled(false), names(NULL), numFunctions(0),
+                     entries(NULL) {}
+    ~YogiProfiler() { delete[] entries; }
+
+    static long long now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static int bucketFor(long long elapsed);
+
+    /* Reads YOGI_PROFILE and, if set, allocates one entry per name. */
+    void start(const char * const *functionNames, int count);
+    void record(int function, long long startTime, long long bytes = 0);
+    const YogiProfileEntry & entry(int function) const {
+        return entries[function];
+    }
+    /* Combines the entries of every rank and writes the summary.  Collective
+       over MPI_COMM_WORLD; called just before MPI_Finalize. */
+    void report();
+
+    bool enabled;
+private:
+    YogiProfiler(const YogiProfiler &);
+    YogiProfiler & operator=(const YogiProfiler &);
+    const char * const *names;
+    int numFunctions;
+    YogiProfileEntry *entries;
+};
+
+/* Facts about a communicator that wrappers need for sizing arrays.
+   remoteSize is the group a collective exchanges with: the remote group of
+   an intercommunicator, otherwise the communicator itself.  indegree and
+   outdegree are the neighbor counts of its virtual topology, or 0 without
+   one. */
+struct YogiCommInfo
+{
+    int size;
+    int rank;
+    int remoteSize;
+    int isInter;
+    int indegree;
+    int outdegree;
+};
+
+/* A communicator split by node for the hierarchical collectives.  node
+   holds the ranks that share memory with this one, and leaders the first
+   rank of each node.  window gives every node rank a slot of two buffers
+   of hierarchicalMaxBytes, which alternate calls use in turn, so one node
+   barrier per call is enough to keep a call from overwriting data the
+   previous one is still reading.  usable is false when every node has a
+   single rank, where splitting would not help. */
+struct YogiNodeComms
+{
+    YogiNodeComms() : usable(false), node(MPI_COMM_NULL),
+                      leaders(MPI_COMM_NULL), window(MPI_WIN_NULL),
+                      rank(0), nodeRank(0), nodeSize(1), numNodes(1),
+                      base(NULL), slotBytes(0), calls(0) {}
+    bool usable;
+    MPI_Comm node;
+    MPI_Comm leaders;
+    MPI_Win window;
+    int rank;
+    int nodeRank;
+    int nodeSize;
+    int numNodes;
+    // Slot 0 of the window; slot r starts r * slotBytes after it.
+    char *base;
+    MPI_Aint slotBytes;
+    // The leaders rank of the node of every rank in the communicator.
+    std::vector<int> leaderOf;
+    unsigned long calls;
+};
+
+/* Per-communicator cache entry: the info above, plus the last datatype
+   array converted for each side (send or receive) of a collective on it.
+   typeEpoch records the datatype pool's epoch at conversion time, so a
+   freed and reused Yogi datatype never maps to a stale MPI handle. */
+struct YogiCommCache
+{
+    YogiCommCache() : valid(false) {
+        typeEpoch[0] = typeEpoch[1] = 0;
+    }
+    bool valid;
+    YogiCommInfo info;
+    unsigned long typeEpoch[2];
+    std::vector<YogiMPI_Datatype> yogiTypes[2];
+    std::vector<MPI_Datatype> mpiTypes[2];
+    // Built by the first hierarchical collective on the communicator.
+    std::shared_ptr<YogiNodeComms> nodeComms;
+};
+
+/* The last conversion of one array of persistent requests, found again
+   by the array's address.  epoch is the manager's persistent epoch at
+   conversion time; freeing any persistent request moves it on, so a
+   reused Yogi handle never maps to a stale MPI request. */
+struct YogiPersistentSet
+{
+    YogiPersistentSet() : array(NULL), epoch(0) {}
+    const YogiMPI_Request *array;
+    unsigned long epoch;
+    std::vector<YogiMPI_Request> yogiRequests;
+    std::vector<MPI_Request> mpiRequests;
+};
+
+/* One finished request of a completion queue, not yet handed out. */
+struct YogiCompletion
+{
+    int id;
+    MPI_Status status;
+};
+
+/* The requests handed to a completion queue (YogiX_Cq_*).  Their MPI
+   handles stay here, packed at the front, between polls, and their Yogi
+   handles are released when they are added.  A poll then costs one
+   MPI_Testsome plus work for the requests that finished. */
+struct YogiCompletionQueue
+{
+    std::mutex mutex;
+    std::vector<MPI_Request> requests;
+    std::vector<int> ids;
+    // Testsome's output, kept to avoid allocating on every poll.
+    std::vector<int> indices;
+    std::vector<MPI_Status> statuses;
+    // Finished beyond what the caller asked for so far.
+    std::deque<YogiCompletion> ready;
+};
+
+/* A collective made once by YogiX_Allreduce_init or YogiX_Alltoallv_init
+   and run by each YogiX_Start.  Its handles are converted, and its count
+   and displacement arrays copied, when it is made.  When MPI has
+   persistent collectives, persistent is the MPI request and request the
+   Yogi handle every start hands out; otherwise persistent is
+   MPI_REQUEST_NULL and each start replays the call with the kept
+   handles.  An allreduce uses sendtype for its datatype. */
+struct YogiPlan
+{
+    enum Kind { allreduce, alltoallv };
+    YogiPlan() : kind(allreduce), sendbuf(NULL), recvbuf(NULL), count(0),
+                 datatype(YogiMPI_DATATYPE_NULL), op(YogiMPI_OP_NULL),
+                 comm(YogiMPI_COMM_NULL), sendtype(MPI_DATATYPE_NULL),
+                 recvtype(MPI_DATATYPE_NULL), mpiOp(MPI_OP_NULL),
+                 mpiComm(MPI_COMM_NULL), persistent(MPI_REQUEST_NULL),
+                 request(YogiMPI_REQUEST_NULL) {}
+    Kind kind;
+    // MPI_IN_PLACE already converted.
+    const void *sendbuf;
+    void *recvbuf;
+    int count;
+    YogiMPI_Datatype datatype;
+    YogiMPI_Op op;
+    YogiMPI_Comm comm;
+    MPI_Datatype sendtype;
+    MPI_Datatype recvtype;
+    MPI_Op mpiOp;
+    MPI_Comm mpiComm;
+    // Alltoallv only; the send side stays empty in place.
+    std::vector<int> sendcounts;
+    std::vector<int> sdispls;
+    std::vector<int> recvcounts;
+    std::vector<int> rdispls;
+    MPI_Request persistent;
+    YogiMPI_Request request;
+};
+
+/* A user-defined reduction bound to one of the manager's trampolines.  The
+   trampoline reads fn without locking, so an MPI reduction calls straight
+   into the user's function, whatever op any other reduction is using.
+   Freeing the op only retires the slot: MPI may still run a reduction
+   started before the free, so fn stays in place for good. */
+struct YogiOpSlot
+{
+    YogiOpSlot() : fn(nullptr), op(-1), retired(false) {}
+    std::atomic<YogiMPI_User_function*> fn;
+    YogiMPI_Op op;
+    bool retired;
+};
+
+/* One event of the binary call trace.  Every record has the same size so
+   the trace file is a header followed by a plain array of records. */
+struct YogiTraceRecord
+{
+    long long timestamp;
+    long long bytes;
+    int function;
+    int event;
+    int thread;
+    int callDepth;
+    int peer;
+    int tag;
+    int comm;
+    int error;
+};
+
+/* Binary call trace for YOGI_DEBUG builds, written to yogimpi.trace.<rank>.
+   Wrappers push an enter and an exit record for each call into a bounded
+   ring.  A slot's sequence number says whether it is free or filled, so
+   MPI_THREAD_MULTIPLE callers can push without taking a lock.  A background
+   thread drains the ring and writes records in large blocks.  A caller
+   only waits if the ring is full.  src/yogimpi_trace.py decodes the file. */
+class YogiTracer
+{
+public:
+    static const int ringSize = 1 << 16;
+    static const int blockRecords = 4096;
+    static const int enterEvent = 0;
+    static const int exitEvent = 1;
+
+    YogiTracer();
+    ~YogiTracer();
+
+    /* Opens the trace file and starts the writer thread.  The names are
+       written to the file header, indexed by function id. */
+    void start(int rank, const char * const *functionNames, int count);
+    void enter(int function, int peer, int tag, int comm);
+    void exit(int function, long long bytes, int error);
+    /* Writes whatever is still queued, then closes the file. */
+    void stop();
+
+    bool active;
+private:
+    struct Slot
+    {
+        std::atomic<unsigned long long> sequence;
+        YogiTraceRecord record;
+    };
+
+    YogiTracer(const YogiTracer &);
+    YogiTracer & operator=(const YogiTracer &);
+    void push(YogiTraceRecord &record);
+    void drain();
+
+    Slot *ring;
+    std::atomic<unsigned long long> head;
+    unsigned long long tail;
+    std::atomic<bool> stopping;
+    std::thread writer;
+    std::FILE *file;
+    long long origin;
+};
+
+/* The optional progress thread, for MPIs that only move nonblocking
+   operations along inside MPI calls.  YOGI_PROGRESS_THREAD=1 asks for it:
+   MPI_Init and MPI_Init_thread then request MPI_THREAD_MULTIPLE, and the
+   thread starts if MPI provides it.  While YogiMPI has live requests or
+   unfinished schedules (YogiSchedule.h) it advances the schedules and
+   pokes MPI's progress engine every YOGI_PROGRESS_INTERVAL microseconds
+   (default 10, 0 to only yield).  Idle, it doubles the pause up to
+   YOGI_PROGRESS_MAX_INTERVAL (default 1000).  YOGI_PROGRESS_CPU=n pins it
+   to core n on Linux.
+
+   It never tests the application's own requests: a request may only be
+   used by one thread at a time, and testing one may free it. */
+class YogiProgress
+{
+public:
+    YogiProgress();
+    ~YogiProgress();
+
+    // Whether YOGI_PROGRESS_THREAD asked for the thread.
+    bool wanted() const { return enabled; }
+    /* Starts the thread if wanted and MPI is thread-multiple; otherwise
+       global rank 0 says why there is none. */
+    void start(bool threadMultiple);
+    // Stops and joins the thread.  Called before MPI_Finalize.
+    void stop();
+
+    bool active;
+private:
+    YogiProgress(const YogiProgress &);
+    YogiProgress & operator=(const YogiProgress &);
+    void run();
+
+    bool enabled;
+    long interval;
+    long maxInterval;
+    int cpu;
+    std::atomic<bool> stopping;
+    std::thread worker;
+};
 
 class YogiManager
 {
 public:
     static const int defaultPoolSize;
+    static const int lookupEmpty;
+    static const int lookupDeleted;
 
-    static YogiManager* getInstance();
+    /* Number of predefined handles at the bottom of each pool. */
+    static const int errhandlerOffset = 3;
+    static const int commOffset = 3;
+    static const int requestOffset = 1;
+    static const int winOffset = 1;
+    static const int opOffset = 15;
+    static const int datatypeOffset = 57;
+    static const int infoOffset = 1;
+    static const int groupOffset = 2;
+    static const int fileOffset = 1;
+    static const int messageOffset = 3;
 
-    int callDepth;
+    /* Copies of the predefined handles, indexed by Yogi handle, so that the
+       most common conversions are an inline array read. */
+    static MPI_Errhandler predefinedErrhandlers[errhandlerOffset];
+    static MPI_Comm predefinedComms[commOffset];
+    static MPI_Op predefinedOps[opOffset];
+    static MPI_Datatype predefinedDatatypes[datatypeOffset];
+    static MPI_Group predefinedGroups[groupOffset];
+
+    static YogiManager* getInstance() {
+        if (_instance == 0) return createInstance();
+        return _instance;
+    }
+
+    /* The manager without the construction check.  Only valid once
+       YogiMPI_Init or YogiMPI_Init_thread has run, which every wrapped
+       function other than the pre-initialization queries may assume. */
+    static YogiManager& instance() {
+        return *_instance;
+    }
+
+    /* Both are per thread: callDepth is the nesting level the trace
+       records for the calling thread, and currentOp tells a user-op
+       callback which reduction the calling thread is in. */
+    static thread_local int callDepth;
+    static thread_local YogiMPI_Op currentOp;
+
+    YogiProfiler profiler;
+    YogiTracer tracer;
+    // Nonblocking and neighbor collectives MPI lacks (YogiSchedule.h).
+    YogiScheduler scheduler;
+    YogiProgress progress;
+
+    /* Message size of a call for the profiler and the trace: count times
+       the size of the datatype it was given.  Failed calls count zero
+       bytes, since their datatype may not be valid. */
+    static long long messageBytes(int mpiError, int count,
+                                  MPI_Datatype datatype);
+
+    /* Turn on locking of the pools and callback tables.  Set from
+       YogiMPI_Init_thread when MPI provides MPI_THREAD_MULTIPLE. */
+    void setThreadMultiple(bool multiple);
 
     void setGlobalRank(int rank);
-    void openDebugLog();
-    void closeDebugLog();
-    void writeToDebugLog(const char * toWrite);
     void loadMPILibrary();
     int errorToMPI(int yogiMPIError);
     int amodeToMPI(int amode);
@@ -45,7 +572,7 @@ public:
     MPI_Comm commToMPI(YogiMPI_Comm in_comm);
     MPI_Request requestToMPI(YogiMPI_Request in_request);
     MPI_Win winToMPI(YogiMPI_Win in_win);
-    MPI_Op opToMPI(YogiMPI_Win in_op);
+    MPI_Op opToMPI(YogiMPI_Op in_op);
     MPI_Datatype datatypeToMPI(YogiMPI_Datatype in_data);
     MPI_Info infoToMPI(YogiMPI_Info in_info);
     MPI_Group groupToMPI(YogiMPI_Group in_group);
@@ -55,20 +582,79 @@ public:
     MPI_Count countToMPI(YogiMPI_Count in_count);
     MPI_Message messageToMPI(YogiMPI_Message in_msg);
 #endif
+    /* The MPI_Status inside in_status.  Storage not aligned for an
+       MPI_Status, like a Fortran INTEGER array, is copied to a per-thread
+       MPI_Status instead, which statusToYogiInPlace copies back. */
     MPI_Status * statusToMPI(YogiMPI_Status * in_status);
     MPI_Status * statusToMPI(const YogiMPI_Status * in_status);
+    /* Views the caller's status array as a packed MPI_Status array, so MPI
+       can write its statuses straight into the caller's storage, or hands
+       out a per-thread array of count when that storage is not aligned.
+       Call statusesToYogiInPlace afterwards to spread them into place. */
+    MPI_Status * statusesToMPI(YogiMPI_Status * in_statuses, int count);
+
+    // Array-conversion to MPI, into a caller-supplied array
+    void requestToMPI(const YogiMPI_Request *, MPI_Request *, int);
+    void aintToMPI(const YogiMPI_Aint *, MPI_Aint *, int);
+    void datatypeToMPI(const YogiMPI_Datatype *, MPI_Datatype *, int);
+
+    /* Size, rank and neighbor counts of a communicator.  Queried from MPI
+       on first use and kept until the communicator is freed. */
+    YogiCommInfo commInfo(YogiMPI_Comm comm);
+    /* Converts a datatype array for side 0 (send) or 1 (receive) of a
+       collective on comm.  When the contents match that side's previous
+       array, returns the previous conversion without converting again.
+       Otherwise converts into the cache.  Under MPI_THREAD_MULTIPLE the
+       array is converted into scratch instead. */
+    MPI_Datatype * datatypeToMPICached(YogiMPI_Comm comm, int side,
+                                       const YogiMPI_Datatype *in_data,
+                                       int count,
+                                       YogiScratch<MPI_Datatype> &scratch);
 
-    // Create MPI_Status arrays when required
-    void createStatus(MPI_Status *&, int);
-    void createStatus(MPI_Status *&, int *);
+    /* Persistent requests are marked when created, so arrays made only of
+       them can be converted once and reused by requestToMPICached, and
+       completion queues can refuse them. */
+    void markPersistent(YogiMPI_Request request);
+    bool isPersistent(YogiMPI_Request request);
+    /* Converts an array of requests for MPI_Startall and its kin.  When
+       every request is persistent, the conversion is kept per array
+       address, and the next call with the same array and contents returns
+       it without converting again.  Anything else, or any call under
+       MPI_THREAD_MULTIPLE, is converted into scratch. */
+    MPI_Request * requestToMPICached(const YogiMPI_Request *in_requests,
+                                     int count,
+                                     YogiScratch<MPI_Request> &scratch);
 
-    // Array-conversion to MPI
-    void requestToMPI(YogiMPI_Request *, MPI_Request *&, int);
-    void requestToMPI(const YogiMPI_Request *, MPI_Request *&, int);
-    void aintToMPI(YogiMPI_Aint *, MPI_Aint *&, int);
-    void aintToMPI(const YogiMPI_Aint *, MPI_Aint *&, int);
-    void datatypeToMPI(YogiMPI_Datatype *, MPI_Datatype *&, int);
-    void datatypeToMPI(const YogiMPI_Datatype *, MPI_Datatype *&, int);
+    /* Completion queues, addressed by YogiX_Cq handles.  completionQueue
+       returns NULL for a handle that is not a live queue, and
+       freeCompletionQueue refuses one with requests still in it. */
+    int createCompletionQueue();
+    YogiCompletionQueue * completionQueue(int handle);
+    int freeCompletionQueue(int handle);
+    /* Moves requests into queue, setting each handle to
+       YogiMPI_REQUEST_NULL.  Returns a Yogi error code. */
+    int addToCompletionQueue(YogiCompletionQueue &queue, int count,
+                             YogiMPI_Request *requests, const int *ids);
+    /* Hands out up to maxcount finished requests, waiting for at least one
+       if wait is set.  *outcount is YogiMPI_UNDEFINED once the queue is
+       empty.  Returns a Yogi error code. */
+    int pollCompletionQueue(YogiCompletionQueue &queue, bool wait,
+                            int maxcount, int *outcount, int *ids,
+                            YogiMPI_Status *statuses);
+    // Requests added to queue and not yet handed out.
+    int completionQueuePending(YogiCompletionQueue &queue);
+
+    /* Plans of YogiX_Start, addressed by YogiX_Plan handles.  createPlan
+       makes plan persistent in MPI when it can (unless info sets
+       yogimpi_persistent to false) and stores it in *handle; plan returns
+       NULL for a handle that is not a live plan.  The others return Yogi
+       error codes, and startPlan runs the collective to completion when
+       request is NULL. */
+    int createPlan(std::unique_ptr<YogiPlan> made, MPI_Info info,
+                   int *handle);
+    YogiPlan * plan(int handle);
+    int startPlan(YogiPlan &plan, YogiMPI_Request *request);
+    int freePlan(int handle);
 
     YogiMPI_Offset offsetToYogi(MPI_Offset in_offset);
     YogiMPI_Errhandler errhandlerToYogi(MPI_Errhandler in_errhandler);
@@ -86,23 +672,79 @@ public:
     YogiMPI_Message messageToYogi(MPI_Message in_message);
 #endif
     YogiMPI_Status statusToYogi(MPI_Status &in_status, bool set_error = true);
+    /* Fills the public fields of a status whose realStatus MPI has already
+       written. */
+    void statusToYogiInPlace(YogiMPI_Status * in_status,
+                             bool set_error = true);
 
     // Array-conversion to Yogi
-    void requestToYogi(MPI_Request * &in_mpi, YogiMPI_Request *& out_yogi,
-                       int count, bool free_mpi = false);
-    void aintToYogi(MPI_Aint * &in_mpi, YogiMPI_Aint *& out_yogi,
-                    int count, bool free_mpi = false);
-    void datatypeToYogi(MPI_Datatype * &in_mpi, YogiMPI_Datatype *& out_yogi,
-                        int count, bool free_mpi = false);
-    void statusToYogi(MPI_Status * &in_mpi, YogiMPI_Status *& out_yogi,
-                      int count, bool free_mpi = false);
+    void requestToYogi(MPI_Request * in_mpi, YogiMPI_Request * out_yogi,
+                       int count);
+    void aintToYogi(MPI_Aint * in_mpi, YogiMPI_Aint * out_yogi, int count);
+    void datatypeToYogi(MPI_Datatype * in_mpi, YogiMPI_Datatype * out_yogi,
+                        int count);
+    void statusToYogi(MPI_Status * in_mpi, YogiMPI_Status * out_yogi,
+                      int count);
+    /* Moves count packed MPI_Status objects, written by MPI through
+       statusesToMPI, into the realStatus of each element, and fills the
+       public fields. */
+    void statusesToYogiInPlace(YogiMPI_Status * in_statuses, int count);
 
     YogiMPI_Datatype datatypeToYogiFindOnly(MPI_Datatype in_data);
+    /* The Yogi handle an MPI handle is already known by, or a new one if
+       it is not known, for handles MPI passes to callbacks. */
+    YogiMPI_Comm commToYogiResolve(MPI_Comm in_comm);
+    YogiMPI_Group groupToYogiResolve(MPI_Group in_group);
+    YogiMPI_Win winToYogiResolve(MPI_Win in_win);
+    YogiMPI_File fileToYogiResolve(MPI_File in_file);
+
+    /* Occupancy of the pool for a YogiX_POOL_* class.  Returns false for
+       an unknown class. */
+    bool poolStats(int handleClass, YogiX_Pool_info *info);
+    /* Whether any request handle is live, for the progress thread.  Always
+       true in passthrough builds, whose pool does not hold requests. */
+    bool requestsLive();
+    /* If YOGI_POOL_STATS is set to 1, rank 0 prints every pool's occupancy,
+       over all ranks, to stderr.  Collective over MPI_COMM_WORLD. */
+    void reportPools();
 
-    void freeRequest(MPI_Request * &to_free);
-    void freeAint(MPI_Aint * &to_free);
-    void freeDatatype(MPI_Datatype * &to_free);
-    void freeStatus(MPI_Status * &to_free);
+    /* Node-aware Allreduce and Bcast, used when YOGI_HIERARCHICAL is 1.
+       Each returns false, having done nothing, when the call does not
+       qualify, and otherwise does the collective itself and sets
+       *mpi_error.  Whether a call qualifies depends only on arguments
+       every rank shares, so all ranks take the same path. */
+    bool hierarchicalAllreduce(const void *sendbuf, void *recvbuf, int count,
+                               YogiMPI_Datatype datatype,
+                               MPI_Datatype mpiDatatype, YogiMPI_Op op,
+                               MPI_Op mpiOp, YogiMPI_Comm comm,
+                               MPI_Comm mpiComm, int *mpi_error) {
+        return hierarchical &&
+               allreduceByNode(sendbuf, recvbuf, count, datatype, mpiDatatype,
+                               op, mpiOp, comm, mpiComm, mpi_error);
+    }
+    bool hierarchicalBcast(void *buffer, int count, MPI_Datatype datatype,
+                           int root, YogiMPI_Comm comm, MPI_Comm mpiComm,
+                           int *mpi_error) {
+        return hierarchical &&
+               bcastByNode(buffer, count, datatype, root, comm, mpiComm,
+                           mpi_error);
+    }
+    /* MPI_Reduce_local through YogiMPI's own kernels (YogiReduce.h).
+       Returns false, having done nothing, when there is no kernel for
+       op and datatype. */
+    bool reduceLocal(const void *inbuf, void *inoutbuf, int count,
+                     YogiMPI_Datatype datatype, YogiMPI_Op op,
+                     int *mpi_error) {
+        YogiReduceKernel kernel = yogiReduceKernel(op, datatype);
+        if (kernel == NULL || count < 0) return false;
+        kernel(inbuf, inoutbuf, count);
+        *mpi_error = MPI_SUCCESS;
+        return true;
+    }
+    /* Frees the node communicators and windows of the hierarchical
+       collectives, in the order they were built.  Collective; called from
+       YogiMPI_Finalize. */
+    void releaseNodeComms();
 
     YogiMPI_Comm unmapComm(YogiMPI_Comm to_free);
     YogiMPI_Datatype unmapDatatype(YogiMPI_Datatype to_free);
@@ -123,71 +765,217 @@ public:
     YogiMPI_Comm_delete_attr_function* delAttrFn(int);
     void userFn(int, YogiMPI_User_function*);
     YogiMPI_User_function* userFn(int);
+    /* The user function of op, bound to a trampoline or not, or NULL for a
+       predefined op. */
+    YogiMPI_User_function* userFunction(YogiMPI_Op op);
 
-    YogiMPI_Op currentOp;
+    /* Each of the first numOpSlots live user ops gets its own trampoline,
+       which calls its user function directly.  claimOpSlot returns the
+       trampoline for fn, and the slot to bind or release afterwards, or
+       NULL when all are taken.  A retired slot is only taken again by an
+       op with the same function; reused tells releaseOpSlot to retire it
+       again rather than empty it. */
+    static const int numOpSlots = 64;
+    MPI_User_function* claimOpSlot(YogiMPI_User_function* fn, int &slot,
+                                   bool &reused);
+    void bindOpSlot(int slot, YogiMPI_Op op);
+    void releaseOpSlot(int slot, bool reused);
 
 protected:
     YogiManager();
 private:
-    template <typename T>
-    int findInPool(std::vector<T> &pool, T newItem, int counter);
+    template <int Slot>
+    static void opTrampoline(void *invec, void *inoutvec, int *len,
+                             MPI_Datatype *datatype);
+    template <int Count>
+    friend struct YogiOpTrampolines;
 
-    template <typename T, typename V>
-    int insertIntoPool(std::vector<T> &pool, T newItem, V marker_in, int offset,
-                       int &counter);
+    YogiCommCache & commCacheFor(YogiMPI_Comm comm);
+
+    void setStatusFields(const MPI_Status &in_status, YogiMPI_Status &dest,
+                         bool set_error);
 
     template <typename T, typename V>
-    void removeFromPool(std::vector<T> &pool, int index, V marker_in,
-                        int offset, int &counter);
+    void initPool(YogiPool<T> &pool, V marker_in, int offset,
+                  bool indexAll = true);
+
+    template <typename T>
+    void growPool(YogiPool<T> &pool);
+
+    template <typename T>
+    void shrinkPool(YogiPool<T> &pool);
+
+    template <typename T>
+    void fillPoolStats(YogiPool<T> &pool, YogiX_Pool_info *info);
+
+    template <typename T>
+    int findInPool(YogiPool<T> &pool, T item);
+
+    template <typename T>
+    static std::size_t hashHandle(T item);
+
+    template <typename T>
+    long lookupPosition(YogiPool<T> &pool, T item);
+
+    template <typename T>
+    void addToLookup(YogiPool<T> &pool, int index);
+
+    template <typename T>
+    void removeFromLookup(YogiPool<T> &pool, int index);
+
+    template <typename T>
+    void rebuildLookup(YogiPool<T> &pool, std::size_t minSize);
+
+    template <typename T>
+    int insertIntoPool(YogiPool<T> &pool, T newItem);
 
     template <typename T>
-    T fetchFromPool(std::vector<T> &pool, int index);
+    int resolveInPool(YogiPool<T> &pool, T item);
 
+    template <typename T>
+    void removeFromPool(YogiPool<T> &pool, int index);
+
+    template <typename T>
+    T fetchFromPool(YogiPool<T> &pool, int index) {
+        if (YogiPassthrough<T>::enabled &&
+            (unsigned int) index >= (unsigned int) pool.offset) {
+            return YogiPassthrough<T>::toMPI(index);
+        }
+        YogiLockGuard guard(pool.mutex, threadMultiple);
+        if ((unsigned int) index >= (unsigned int) pool.capacity()) {
+            throw std::out_of_range("YogiMPI handle out of range");
+        }
+        return pool.slot(index);
+    }
+
+    static YogiManager* createInstance();
     static YogiManager* _instance;
 
     int globalRank;
-    std::ofstream debugLogFile;
+    long long poolStartTime;
+
+    bool threadMultiple;
+    std::mutex callbackMutex;
+
+#ifdef YOGI_PASSTHROUGH
+    /* Communicator handles are MPI's own values, too sparse for a vector. */
+    std::unordered_map<YogiMPI_Comm, YogiCommCache> commCache;
+#else
+    std::vector<YogiCommCache> commCache;
+#endif
+    std::mutex commCacheMutex;
+    std::atomic<unsigned long> datatypeEpoch;
+
+    /* The live persistent requests.  The sets are not used under
+       MPI_THREAD_MULTIPLE, where the cache is bypassed; persistentCount
+       lets unmapRequest skip the lock while there are none. */
+    static const int numPersistentSets = 8;
+    std::unordered_set<YogiMPI_Request> persistentRequests;
+    std::mutex persistentMutex;
+    std::atomic<int> persistentCount;
+    unsigned long persistentEpoch;
+    YogiPersistentSet persistentSets[numPersistentSets];
+
+    /* Settings of the hierarchical collectives, from YOGI_HIERARCHICAL,
+       YOGI_HIERARCHICAL_MAX_BYTES, YOGI_HIERARCHICAL_MIN_RANKS and
+       YOGI_HIERARCHICAL_NODE_RANKS. */
+    bool hierarchical;
+    long hierarchicalMaxBytes;
+    int hierarchicalMinRanks;
+    int hierarchicalNodeRanks;
+    // Every live YogiNodeComms, oldest first.
+    std::vector<std::shared_ptr<YogiNodeComms> > nodeCommsBuilt;
+
+    bool allreduceByNode(const void *sendbuf, void *recvbuf, int count,
+                         YogiMPI_Datatype datatype, MPI_Datatype mpiDatatype,
+                         YogiMPI_Op op, MPI_Op mpiOp, YogiMPI_Comm comm,
+                         MPI_Comm mpiComm, int *mpi_error);
+    bool bcastByNode(void *buffer, int count, MPI_Datatype datatype, int root,
+                     YogiMPI_Comm comm, MPI_Comm mpiComm, int *mpi_error);
+    /* The node split of comm, built on first use, or NULL when a call of
+       bytes bytes on comm should not use it. */
+    YogiNodeComms * nodeCommsFor(YogiMPI_Comm comm, MPI_Comm mpiComm,
+                                 long long bytes);
+
+    std::vector<std::unique_ptr<YogiCompletionQueue> > completionQueues;
+    std::mutex completionQueueMutex;
+    std::vector<std::unique_ptr<YogiPlan> > plans;
+    std::mutex planMutex;
 
     std::map<int, YogiMPI_Comm_copy_attr_function*> commCopyAttrFn;
     std::map<int, YogiMPI_Comm_delete_attr_function*> commDelAttrFn;
     std::map<int, YogiMPI_User_function*> opUserFn;
-    std::map<int, int> yogiComps;
-    std::map<int, int> mpiErrors;
-    std::map<int, int> yogiErrors;
-
-    std::vector<MPI_Errhandler> errPool;
-    int numErrs;
-    int errOffset;
-    std::vector<MPI_Comm> commPool;
-    int numComms;
-    int commOffset;
-    std::vector<MPI_Request> requestPool;
-    int numRequests;
-    int requestOffset;
-    std::vector<MPI_Win> winPool;
-    int numWins;
-    int winOffset;
-    std::vector<MPI_Op> opPool;
-    int numOps;
-    int opOffset;
-    std::vector<MPI_Datatype> datatypePool;
-    int numDatatypes;
-    int datatypeOffset;
-    std::vector<MPI_Info> infoPool;
-    int numInfos;
-    int infoOffset;
-    std::vector<MPI_Group> groupPool;
-    int numGroups;
-    int groupOffset;
-    std::vector<MPI_File> filePool;
-    int numFiles;
-    int fileOffset;
+    YogiOpSlot opSlots[numOpSlots];
+    MPI_User_function* opTrampolines[numOpSlots];
+    YogiConstTable yogiComps;
+    YogiConstTable mpiErrors;
+    YogiConstTable yogiErrors;
+    YogiConstTable yogiCombiners;
+    YogiConstTable yogiTopos;
+    YogiConstTable yogiThreadModels;
+    YogiConstTable mpiThreadModels;
+    YogiConstTable mpiCommAttrs;
+    YogiConstTable mpiWinAttrs;
+    YogiConstTable mpiLockTypes;
+    YogiConstTable mpiTypeclasses;
+    YogiConstTable mpiWhence;
+
+    YogiPool<MPI_Errhandler> errPool;
+    YogiPool<MPI_Comm> commPool;
+    YogiPool<MPI_Request> requestPool;
+    YogiPool<MPI_Win> winPool;
+    YogiPool<MPI_Op> opPool;
+    YogiPool<MPI_Datatype> datatypePool;
+    YogiPool<MPI_Info> infoPool;
+    YogiPool<MPI_Group> groupPool;
+    YogiPool<MPI_File> filePool;
 #if YogiMPI_VERSION == 3
-    std::vector<MPI_Message> messagePool;
-    int numMessages;
-    int messageOffset;
+    YogiPool<MPI_Message> messagePool;
 #endif
     void *libraryHandle;
 };
 
+/* Predefined handles are translated without touching the pools.  The cast
+   to unsigned sends negative handles down the checked path. */
+inline MPI_Errhandler YogiManager::errhandlerToMPI(YogiMPI_Errhandler in_errhandler) {
+    if ((unsigned int) in_errhandler < (unsigned int) errhandlerOffset) {
+        return predefinedErrhandlers[in_errhandler];
+    }
+    return fetchFromPool(errPool, in_errhandler);
+}
+
+inline MPI_Comm YogiManager::commToMPI(YogiMPI_Comm in_comm) {
+    if ((unsigned int) in_comm < (unsigned int) commOffset) {
+        return predefinedComms[in_comm];
+    }
+    return fetchFromPool(commPool, in_comm);
+}
+
+inline MPI_Op YogiManager::opToMPI(YogiMPI_Op in_op) {
+    if ((unsigned int) in_op < (unsigned int) opOffset) {
+        return predefinedOps[in_op];
+    }
+    return fetchFromPool(opPool, in_op);
+}
+
+inline MPI_Datatype YogiManager::datatypeToMPI(YogiMPI_Datatype in_data) {
+    if ((unsigned int) in_data < (unsigned int) datatypeOffset) {
+        return predefinedDatatypes[in_data];
+    }
+    return fetchFromPool(datatypePool, in_data);
+}
+
+inline MPI_Group YogiManager::groupToMPI(YogiMPI_Group in_group) {
+    if ((unsigned int) in_group < (unsigned int) groupOffset) {
+        return predefinedGroups[in_group];
+    }
+    return fetchFromPool(groupPool, in_group);
+}
+
+/* Every wrapper returns through here, so success skips the table. */
+inline int YogiManager::errorToYogi(int mpiError) {
+    if (mpiError == MPI_SUCCESS) return YogiMPI_SUCCESS;
+    return yogiErrors.find(mpiError, YogiMPI_ERR_INTERN);
+}
+
 #endif
@@ -0,0 +1,267 @@
+#include "YogiReduce.h"
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+
+/* The kernels are one loop template, instantiated per (type, op) and
+   compiled once per instruction set: the loop is forced inline into a
+   wrapper carrying that set's target attribute, and the compiler
+   vectorizes each copy for it.  This file is built with -O3 whatever the
+   rest of the library uses (see the Makefile). */
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define YOGI_REDUCE_X86 1
+#define YOGI_INLINE inline __attribute__((always_inline))
+#else
+#define YOGI_INLINE inline
+#endif
+
+namespace {
+
+struct OpMax {
+    template <typename T> static T apply(T a, T b) { return a > b ? a : b; }
+};
+struct OpMin {
+    template <typename T> static T apply(T a, T b) { return a < b ? a : b; }
+};
+struct OpSum {
+    template <typename T> static T apply(T a, T b) { return (T) (a + b); }
+};
+struct OpProd {
+    template <typename T> static T apply(T a, T b) { return (T) (a * b); }
+};
+struct OpLand {
+    template <typename T> static T apply(T a, T b) {
+        return (T) ((a != 0) & (b != 0));
+    }
+};
+struct OpLor {
+    template <typename T> static T apply(T a, T b) {
+        return (T) ((a != 0) | (b != 0));
+    }
+};
+struct OpLxor {
+    template <typename T> static T apply(T a, T b) {
+        return (T) ((a != 0) ^ (b != 0));
+    }
+};
+struct OpBand {
+    template <typename T> static T apply(T a, T b) { return (T) (a & b); }
+};
+struct OpBor {
+    template <typename T> static T apply(T a, T b) { return (T) (a | b); }
+};
+struct OpBxor {
+    template <typename T> static T apply(T a, T b) { return (T) (a ^ b); }
+};
+
+/* The value-index pairs of MPI_MAXLOC and MPI_MINLOC, laid out as the MPI
+   pair datatypes are.  On a tie the lower index wins. */
+template <typename V, typename I>
+struct Pair {
+    V value;
+    I index;
+};
+struct OpMaxloc {
+    template <typename P> static P apply(P a, P b) {
+        if (a.value > b.value) return a;
+        if (a.value == b.value && a.index < b.index) return a;
+        return b;
+    }
+};
+struct OpMinloc {
+    template <typename P> static P apply(P a, P b) {
+        if (a.value < b.value) return a;
+        if (a.value == b.value && a.index < b.index) return a;
+        return b;
+    }
+};
+
+template <typename T, typename Op>
+static YOGI_INLINE void combine(const void *in, void *inout, long count) {
+    const T * __restrict__ a = (const T *) in;
+    T * __restrict__ b = (T *) inout;
+    for (long i = 0; i < count; i++) b[i] = Op::apply(a[i], b[i]);
+}
+
+template <typename T, typename Op>
+void combineGeneric(const void *in, void *inout, long count) {
+    combine<T, Op>(in, inout, count);
+}
+
+#ifdef YOGI_REDUCE_X86
+template <typename T, typename Op>
+__attribute__((target("avx2")))
+void combineAvx2(const void *in, void *inout, long count) {
+    combine<T, Op>(in, inout, count);
+}
+
+template <typename T, typename Op>
+__attribute__((target("avx512f,avx512bw")))
+void combineAvx512(const void *in, void *inout, long count) {
+    combine<T, Op>(in, inout, count);
+}
+#endif
+
+enum { isaOff, isaGeneric, isaAvx2, isaAvx512 };
+
+const int numOps = YogiMPI_LXOR + 1;
+const int numDatatypes = 64;
+
+/* The kernels of the chosen instruction set, by datatype and op. */
+struct KernelTable {
+    KernelTable();
+    void choose();
+
+    template <typename T, typename Op> void add(int datatype, int op);
+    template <typename T> void addFloat(int datatype);
+    template <typename T> void addLogical(int datatype);
+    template <typename T> void addBitwise(int datatype);
+    template <typename T> void addInteger(int datatype);
+    template <typename V, typename I> void addPair(int datatype);
+
+    int isa;
+    YogiReduceKernel kernels[numDatatypes][numOps];
+};
+
+template <typename T, typename Op>
+void KernelTable::add(int datatype, int op) {
+    YogiReduceKernel kernel = combineGeneric<T, Op>;
+#ifdef YOGI_REDUCE_X86
+    if (isa == isaAvx2) kernel = combineAvx2<T, Op>;
+    if (isa == isaAvx512) kernel = combineAvx512<T, Op>;
+#endif
+    kernels[datatype][op] = kernel;
+}
+
+template <typename T>
+void KernelTable::addFloat(int datatype) {
+    add<T, OpMax>(datatype, YogiMPI_MAX);
+    add<T, OpMin>(datatype, YogiMPI_MIN);
+    add<T, OpSum>(datatype, YogiMPI_SUM);
+    add<T, OpProd>(datatype, YogiMPI_PROD);
+}
+
+template <typename T>
+void KernelTable::addLogical(int datatype) {
+    add<T, OpLand>(datatype, YogiMPI_LAND);
+    add<T, OpLor>(datatype, YogiMPI_LOR);
+    add<T, OpLxor>(datatype, YogiMPI_LXOR);
+}
+
+template <typename T>
+void KernelTable::addBitwise(int datatype) {
+    add<T, OpBand>(datatype, YogiMPI_BAND);
+    add<T, OpBor>(datatype, YogiMPI_BOR);
+    add<T, OpBxor>(datatype, YogiMPI_BXOR);
+}
+
+template <typename T>
+void KernelTable::addInteger(int datatype) {
+    addFloat<T>(datatype);
+    addLogical<T>(datatype);
+    addBitwise<T>(datatype);
+}
+
+/* The pair loops do not vectorize well, and their wide versions measured
+   slower than the plain ones, so they always use those. */
+template <typename V, typename I>
+void KernelTable::addPair(int datatype) {
+    kernels[datatype][YogiMPI_MAXLOC] = combineGeneric<Pair<V, I>, OpMaxloc>;
+    kernels[datatype][YogiMPI_MINLOC] = combineGeneric<Pair<V, I>, OpMinloc>;
+}
+
+KernelTable::KernelTable() {
+    for (int i = 0; i < numDatatypes; i++) {
+        for (int j = 0; j < numOps; j++) kernels[i][j] = NULL;
+    }
+    choose();
+    if (isa == isaOff) return;
+
+    // The op and datatype pairs allowed by MPI 3.1, section 5.9.2.
+    addInteger<int>(YogiMPI_INT);
+    addInteger<long>(YogiMPI_LONG);
+    addInteger<short>(YogiMPI_SHORT);
+    addInteger<unsigned short>(YogiMPI_UNSIGNED_SHORT);
+    addInteger<unsigned>(YogiMPI_UNSIGNED);
+    addInteger<unsigned long>(YogiMPI_UNSIGNED_LONG);
+    addInteger<long long>(YogiMPI_LONG_LONG_INT);
+    addInteger<unsigned long long>(YogiMPI_UNSIGNED_LONG_LONG);
+    addInteger<signed char>(YogiMPI_SIGNED_CHAR);
+    addInteger<unsigned char>(YogiMPI_UNSIGNED_CHAR);
+    addInteger<int8_t>(YogiMPI_INT8_T);
+    addInteger<int16_t>(YogiMPI_INT16_T);
+    addInteger<int32_t>(YogiMPI_INT32_T);
+    addInteger<int64_t>(YogiMPI_INT64_T);
+    addInteger<uint8_t>(YogiMPI_UINT8_T);
+    addInteger<uint16_t>(YogiMPI_UINT16_T);
+    addInteger<uint32_t>(YogiMPI_UINT32_T);
+    addInteger<uint64_t>(YogiMPI_UINT64_T);
+    addInteger<int8_t>(YogiMPI_INTEGER1);
+    addInteger<int16_t>(YogiMPI_INTEGER2);
+    addInteger<int32_t>(YogiMPI_INTEGER4);
+    addInteger<int64_t>(YogiMPI_INTEGER8);
+    addFloat<float>(YogiMPI_FLOAT);
+    addFloat<double>(YogiMPI_DOUBLE);
+    addFloat<long double>(YogiMPI_LONG_DOUBLE);
+    addFloat<float>(YogiMPI_REAL4);
+    addFloat<double>(YogiMPI_REAL8);
+    addLogical<bool>(YogiMPI_C_BOOL);
+#if YogiMPI_VERSION == 3
+    addLogical<bool>(YogiMPI_CXX_BOOL);
+#endif
+    addBitwise<unsigned char>(YogiMPI_BYTE);
+    addPair<float, int>(YogiMPI_FLOAT_INT);
+    addPair<double, int>(YogiMPI_DOUBLE_INT);
+    addPair<long, int>(YogiMPI_LONG_INT);
+    addPair<int, int>(YogiMPI_2INT);
+    addPair<short, int>(YogiMPI_SHORT_INT);
+    addPair<long double, int>(YogiMPI_LONG_DOUBLE_INT);
+    addPair<float, float>(YogiMPI_2REAL);
+    addPair<double, double>(YogiMPI_2DOUBLE_PRECISION);
+    addPair<int, int>(YogiMPI_2INTEGER);
+}
+
+/* The widest instruction set the CPU has, capped by YOGI_REDUCE_KERNELS. */
+void KernelTable::choose() {
+    isa = isaGeneric;
+#ifdef YOGI_REDUCE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) isa = isaAvx2;
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw")) {
+        isa = isaAvx512;
+    }
+#endif
+    char *setting = std::getenv("YOGI_REDUCE_KERNELS");
+    if (setting == NULL) return;
+    std::string cap(setting);
+    if (cap == "0") isa = isaOff;
+    if (cap == "generic") isa = isaGeneric;
+    if (cap == "avx2" && isa > isaAvx2) isa = isaAvx2;
+}
+
+KernelTable & kernelTable() {
+    static KernelTable table;
+    return table;
+}
+
+}
+
+YogiReduceKernel yogiReduceKernel(YogiMPI_Op op, YogiMPI_Datatype datatype) {
+    if ((unsigned int) op >= (unsigned int) numOps ||
+        (unsigned int) datatype >= (unsigned int) numDatatypes) {
+        return NULL;
+    }
+    return kernelTable().kernels[datatype][op];
+}
+
+const char * yogiReduceIsa() {
+    switch (kernelTable().isa) {
+    case isaAvx512: return "avx512";
+    case isaAvx2: return "avx2";
+    case isaGeneric: return "generic";
+    default: return "off";
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef YOGIREDUCE_H
+#define YOGIREDUCE_H
+
+#include "yogimpi.h"
+
+/* Local reduction kernels for the predefined ops over the predefined
+   datatypes, for the reductions YogiMPI does itself.  Each kernel combines
+   count elements as MPI_Reduce_local does: inout[i] = in[i] op inout[i].
+   in and inout must not overlap.
+
+   The kernels are built for several instruction sets (on x86 with GCC or
+   Clang: the baseline, AVX2 and AVX-512) and the widest the CPU supports
+   is chosen the first time one is asked for.  YOGI_REDUCE_KERNELS set to
+   "generic", "avx2" or "avx512" caps that choice, and "0" turns the
+   kernels off, so every reduction goes to MPI. */
+
+typedef void (*YogiReduceKernel)(const void *in, void *inout, long count);
+
+/* The kernel for op over datatype, or NULL if there is none: a
+   user-defined op or datatype, a pair the MPI standard does not allow, or
+   a type without a portable C layout (complex and Fortran LOGICAL). */
+YogiReduceKernel yogiReduceKernel(YogiMPI_Op op, YogiMPI_Datatype datatype);
+
+/* The instruction set of the kernels in use: "avx512", "avx2", "generic",
+   or "off". */
+const char * yogiReduceIsa();
+
+#endif
@@ -0,0 +1,731 @@
+#include "YogiManager.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+YogiScheduleComm::~YogiScheduleComm() {
+    if (comm != MPI_COMM_NULL) MPI_Comm_free(&comm);
+}
+
+char * YogiSchedule::storage(MPI_Aint bytes) {
+    buffers.push_back(std::unique_ptr<char[]>(new char[bytes > 0 ? bytes
+                                                                  : 1]));
+    return buffers.back().get();
+}
+
+void * YogiSchedule::temporary(int count, MPI_Datatype datatype) {
+    MPI_Aint lb, extent, trueLb, trueExtent;
+    MPI_Type_get_extent(datatype, &lb, &extent);
+    MPI_Type_get_true_extent(datatype, &trueLb, &trueExtent);
+    MPI_Aint bytes = count > 0 ? trueExtent + (count - 1) * extent : 0;
+    return storage(bytes) - trueLb;
+}
+
+YogiRound & YogiSchedule::round(int index) {
+    if (index >= (int) rounds.size()) rounds.resize(index + 1);
+    return rounds[index];
+}
+
+void YogiSchedule::send(int index, const void *buffer, int count,
+                        MPI_Datatype datatype, int peer, int offset) {
+    YogiTransfer transfer = {true, (void *) buffer, count, datatype, peer,
+                             offset};
+    round(index).transfers.push_back(transfer);
+}
+
+void YogiSchedule::receive(int index, void *buffer, int count,
+                           MPI_Datatype datatype, int peer, int offset) {
+    YogiTransfer transfer = {false, buffer, count, datatype, peer, offset};
+    round(index).transfers.push_back(transfer);
+}
+
+void YogiSchedule::reduce(int index, const void *in, void *inout) {
+    YogiReduction reduction = {in, inout};
+    round(index).reductions.push_back(reduction);
+}
+
+YogiScheduler::YogiScheduler() : threadMultiple(false), outstanding(0),
+                                   driven(false) {
+    char *setting = std::getenv("YOGI_EMULATE_COLLECTIVES");
+    emulating = setting != NULL && std::string(setting) == "1";
+}
+
+// Generalized request callbacks
+
+int YogiScheduler::queryFn(void *state, MPI_Status *status) {
+    YogiSchedule *schedule = (YogiSchedule *) state;
+    MPI_Status_set_elements(status, MPI_BYTE, 0);
+    MPI_Status_set_cancelled(status, 0);
+    status->MPI_SOURCE = MPI_UNDEFINED;
+    status->MPI_TAG = MPI_UNDEFINED;
+    return schedule->error;
+}
+
+/* MPI calls this once the request is both complete and freed, after the
+   schedule has left the running list. */
+int YogiScheduler::freeFn(void *state) {
+    delete (YogiSchedule *) state;
+    return MPI_SUCCESS;
+}
+
+// Collectives cannot be cancelled.
+int YogiScheduler::cancelFn(void *, int) {
+    return MPI_SUCCESS;
+}
+
+// Progress
+
+bool YogiScheduler::advance(YogiSchedule &schedule) {
+    MPI_Comm comm = schedule.comm->comm;
+    for (;;) {
+        if (!schedule.pending.empty()) {
+            int done = 0;
+            int mpiError = MPI_Testall((int) schedule.pending.size(),
+                                       &schedule.pending[0], &done,
+                                       MPI_STATUSES_IGNORE);
+            if (mpiError != MPI_SUCCESS) {
+                schedule.error = mpiError;
+                return true;
+            }
+            if (!done) return false;
+            schedule.pending.clear();
+        }
+        if (schedule.next > 0) {
+            YogiRound &finished = schedule.rounds[schedule.next - 1];
+            for (std::size_t i = 0; i < finished.reductions.size(); i++) {
+                int mpiError = combine(schedule, finished.reductions[i].in,
+                                       finished.reductions[i].inout);
+                if (mpiError != MPI_SUCCESS) {
+                    schedule.error = mpiError;
+                    return true;
+                }
+            }
+        }
+        if (schedule.next == schedule.rounds.size()) return true;
+
+        // Receives go first, so the sends of the round find them posted.
+        YogiRound &round = schedule.rounds[schedule.next++];
+        for (int pass = 0; pass < 2; pass++) {
+            for (std::size_t i = 0; i < round.transfers.size(); i++) {
+                YogiTransfer &transfer = round.transfers[i];
+                if (transfer.send != (pass == 1)) continue;
+                MPI_Request request;
+                int mpiError;
+                if (transfer.send) {
+                    mpiError = MPI_Isend(transfer.buffer, transfer.count,
+                                         transfer.datatype, transfer.peer,
+                                         schedule.tag + transfer.tag, comm,
+                                         &request);
+                }
+                else {
+                    mpiError = MPI_Irecv(transfer.buffer, transfer.count,
+                                         transfer.datatype, transfer.peer,
+                                         schedule.tag + transfer.tag, comm,
+                                         &request);
+                }
+                if (mpiError != MPI_SUCCESS) {
+                    for (std::size_t k = 0; k < schedule.pending.size(); k++) {
+                        MPI_Request_free(&schedule.pending[k]);
+                    }
+                    schedule.pending.clear();
+                    schedule.error = mpiError;
+                    return true;
+                }
+                schedule.pending.push_back(request);
+            }
+        }
+    }
+}
+
+void YogiScheduler::advanceAll() {
+    YogiLockGuard guard(mutex, threadMultiple);
+    std::list<YogiSchedule *>::iterator it = running.begin();
+    while (it != running.end()) {
+        YogiSchedule *schedule = *it;
+        if (!advance(*schedule)) {
+            ++it;
+            continue;
+        }
+        it = running.erase(it);
+        outstanding--;
+        // The duplicate may go now; the schedule itself waits for freeFn.
+        schedule->comm.reset();
+        MPI_Grequest_complete(schedule->request);
+    }
+}
+
+int YogiScheduler::combine(YogiSchedule &schedule, const void *in,
+                           void *inout) {
+    YogiManager &yogi = YogiManager::instance();
+    int mpiError;
+    if (yogi.reduceLocal(in, inout, schedule.count, schedule.datatype,
+                         schedule.op, &mpiError)) {
+        return mpiError;
+    }
+    /* A user op is called directly, through the function found when the
+       schedule started: the application may free the op while the
+       schedule runs, and MPI holds no reference to it for us. */
+    if (schedule.userFn != NULL) {
+        int len = schedule.count;
+        YogiMPI_Datatype datatype = schedule.datatype;
+        schedule.userFn((void *) in, inout, &len, &datatype);
+        return MPI_SUCCESS;
+    }
+#if YogiMPI_VERSION == 3 || YogiMPI_SUBVERSION > 1
+    return MPI_Reduce_local((void *) in, inout, schedule.count,
+                            schedule.mpiDatatype, schedule.mpiOp);
+#else
+    // MPI 2.1 has no MPI_Reduce_local, and reduceLocal missed this op.
+    return MPI_ERR_OP;
+#endif
+}
+
+/* Each loop tests until the call would have returned, and goes back to
+   blocking in MPI once no schedule is left to advance. */
+
+bool YogiScheduler::pollWait(MPI_Request *request, MPI_Status *status,
+                             int *mpi_error) {
+    while (polling()) {
+        advanceAll();
+        int flag = 0;
+        *mpi_error = MPI_Test(request, &flag, status);
+        if (*mpi_error != MPI_SUCCESS || flag) return true;
+    }
+    *mpi_error = MPI_Wait(request, status);
+    return true;
+}
+
+bool YogiScheduler::pollWaitall(int count, MPI_Request *requests,
+                                MPI_Status *statuses, int *mpi_error) {
+    while (polling()) {
+        advanceAll();
+        int flag = 0;
+        *mpi_error = MPI_Testall(count, requests, &flag, statuses);
+        if (*mpi_error != MPI_SUCCESS || flag) return true;
+    }
+    *mpi_error = MPI_Waitall(count, requests, statuses);
+    return true;
+}
+
+bool YogiScheduler::pollWaitany(int count, MPI_Request *requests, int *index,
+                                MPI_Status *status, int *mpi_error) {
+    while (polling()) {
+        advanceAll();
+        int flag = 0;
+        *mpi_error = MPI_Testany(count, requests, index, &flag, status);
+        if (*mpi_error != MPI_SUCCESS || flag) return true;
+    }
+    *mpi_error = MPI_Waitany(count, requests, index, status);
+    return true;
+}
+
+bool YogiScheduler::pollWaitsome(int incount, MPI_Request *requests,
+                                 int *outcount, int *indices,
+                                 MPI_Status *statuses, int *mpi_error) {
+    while (polling()) {
+        advanceAll();
+        *mpi_error = MPI_Testsome(incount, requests, outcount, indices,
+                                  statuses);
+        if (*mpi_error != MPI_SUCCESS || *outcount != 0) return true;
+    }
+    *mpi_error = MPI_Waitsome(incount, requests, outcount, indices,
+                              statuses);
+    return true;
+}
+
+// Schedules
+
+YogiSchedule * YogiScheduler::create(YogiMPI_Comm comm, MPI_Comm mpiComm,
+                                     int *size, int *mpi_error) {
+    if (mpiComm == MPI_COMM_NULL) {
+        *mpi_error = MPI_ERR_COMM;
+        return NULL;
+    }
+    YogiCommInfo info = YogiManager::instance().commInfo(comm);
+    if (info.isInter) {
+        *mpi_error = MPI_ERR_COMM;
+        return NULL;
+    }
+    std::shared_ptr<YogiScheduleComm> shared;
+    {
+        YogiLockGuard guard(mutex, threadMultiple);
+        std::map<YogiMPI_Comm, std::shared_ptr<YogiScheduleComm> >::iterator
+            known = comms.find(comm);
+        if (known != comms.end()) shared = known->second;
+    }
+    if (!shared) {
+        /* Only communicators adoptComm never saw get here, such as those
+           from MPI_Comm_idup.  MPI_Comm_dup then needs every rank of comm
+           to reach its first collective before any can go on. */
+        shared.reset(new YogiScheduleComm());
+        *mpi_error = MPI_Comm_dup(mpiComm, &shared->comm);
+        if (*mpi_error != MPI_SUCCESS) return NULL;
+        YogiLockGuard guard(mutex, threadMultiple);
+        comms[comm] = shared;
+    }
+    YogiSchedule *schedule = new YogiSchedule();
+    schedule->comm = shared;
+    schedule->rank = info.rank;
+    {
+        YogiLockGuard guard(mutex, threadMultiple);
+        schedule->tag = (int) (shared->sequence++ % tagRanges) *
+                        tagsPerSchedule;
+    }
+    *size = info.size;
+    return schedule;
+}
+
+int YogiScheduler::start(YogiSchedule *schedule, MPI_Request *request) {
+    MPI_Request started;
+    int mpiError = MPI_Grequest_start(queryFn, freeFn, cancelFn, schedule,
+                                      &started);
+    if (mpiError != MPI_SUCCESS) {
+        delete schedule;
+        return mpiError;
+    }
+    schedule->request = started;
+    {
+        YogiLockGuard guard(mutex, threadMultiple);
+        running.push_back(schedule);
+        outstanding++;
+    }
+    // Posts the first round; the schedule may even finish, and be freed.
+    advanceAll();
+    if (request != NULL) {
+        *request = started;
+        return MPI_SUCCESS;
+    }
+    if (!wait(&started, MPI_STATUS_IGNORE, &mpiError)) {
+        mpiError = MPI_Wait(&started, MPI_STATUS_IGNORE);
+    }
+    return mpiError;
+}
+
+int YogiScheduler::adoptComm(YogiMPI_Comm comm, MPI_Comm mpiComm) {
+#if YogiMPI_VERSION == 3
+    if (!emulating) return MPI_SUCCESS;
+#endif
+    if (mpiComm == MPI_COMM_NULL) return MPI_SUCCESS;
+    int inter = 0;
+    MPI_Comm_test_inter(mpiComm, &inter);
+    if (inter) return MPI_SUCCESS;
+    std::shared_ptr<YogiScheduleComm> shared(new YogiScheduleComm());
+    int mpiError = MPI_Comm_dup(mpiComm, &shared->comm);
+    if (mpiError != MPI_SUCCESS) return mpiError;
+    YogiLockGuard guard(mutex, threadMultiple);
+    comms[comm] = shared;
+    return MPI_SUCCESS;
+}
+
+void YogiScheduler::releaseComm(YogiMPI_Comm comm) {
+    std::shared_ptr<YogiScheduleComm> dropped;
+    YogiLockGuard guard(mutex, threadMultiple);
+    std::map<YogiMPI_Comm, std::shared_ptr<YogiScheduleComm> >::iterator
+        known = comms.find(comm);
+    if (known == comms.end()) return;
+    dropped = known->second;
+    comms.erase(known);
+}
+
+void YogiScheduler::release() {
+    YogiLockGuard guard(mutex, threadMultiple);
+    comms.clear();
+}
+
+/* Elements count or counts[i], starting at displs[i], or at i * count
+   without displacements, in units of extent. */
+static int countAt(const int *counts, int count, int i) {
+    return counts ? counts[i] : count;
+}
+
+static MPI_Aint offsetAt(const int *displs, int count, int i,
+                         MPI_Aint extent) {
+    return (displs ? (MPI_Aint) displs[i] : (MPI_Aint) i * count) * extent;
+}
+
+static MPI_Aint extentOf(MPI_Datatype datatype) {
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(datatype, &lb, &extent);
+    return extent;
+}
+
+/* Binomial tree from root: receive from the parent in round first, then
+   send to every child in the round after. */
+void YogiScheduler::addBcast(YogiSchedule &schedule, int first, void *buffer,
+                             int count, MPI_Datatype datatype, int root,
+                             int size, int tag) {
+    int relative = (schedule.rank - root + size) % size;
+    int mask = 1;
+    while (mask < size) {
+        if (relative & mask) {
+            schedule.receive(first, buffer, count, datatype,
+                             (relative - mask + root) % size, tag);
+            break;
+        }
+        mask <<= 1;
+    }
+    for (mask >>= 1; mask > 0; mask >>= 1) {
+        if (relative + mask < size) {
+            schedule.send(first + 1, buffer, count, datatype,
+                          (relative + mask + root) % size, tag);
+        }
+    }
+}
+
+/* Dissemination: in round k every rank signals the rank 2^k above it. */
+int YogiScheduler::barrier(YogiMPI_Comm comm, MPI_Comm mpiComm,
+                           MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    int rank = schedule->rank;
+    int round = 0;
+    for (int distance = 1; distance < size; distance <<= 1, round++) {
+        schedule->send(round, NULL, 0, MPI_BYTE, (rank + distance) % size);
+        schedule->receive(round, NULL, 0, MPI_BYTE,
+                          (rank - distance + size) % size);
+    }
+    return start(schedule, request);
+}
+
+int YogiScheduler::bcast(void *buffer, int count, MPI_Datatype datatype,
+                         int root, YogiMPI_Comm comm, MPI_Comm mpiComm,
+                         MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    if (root < 0 || root >= size) {
+        delete schedule;
+        return MPI_ERR_ROOT;
+    }
+    addBcast(*schedule, 0, buffer, count, datatype, root, size, 0);
+    return start(schedule, request);
+}
+
+/* A binomial tree to rank 0 in rank order, so ops need not commute: rank r
+   receives the combined values of ranks r + mask up to r + 2 mask - 1 and
+   puts its own, those of r to r + mask - 1, in front of them.  Rank 0 then
+   hands the result to the root, or broadcasts it for an allreduce. */
+int YogiScheduler::reduce(const void *sendbuf, void *recvbuf, int count,
+                          YogiMPI_Datatype datatype, MPI_Datatype mpiDatatype,
+                          YogiMPI_Op op, MPI_Op mpiOp, int root, bool all,
+                          YogiMPI_Comm comm, MPI_Comm mpiComm,
+                          MPI_Request *request) {
+    if (count < 0) return MPI_ERR_COUNT;
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    if (!all && (root < 0 || root >= size)) {
+        delete schedule;
+        return MPI_ERR_ROOT;
+    }
+    schedule->count = count;
+    schedule->datatype = datatype;
+    schedule->mpiDatatype = mpiDatatype;
+    schedule->op = op;
+    schedule->mpiOp = mpiOp;
+    schedule->userFn = YogiManager::instance().userFunction(op);
+
+    int rank = schedule->rank;
+    const void *source = sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf;
+    void *mine = schedule->temporary(count, mpiDatatype);
+    void *theirs = NULL;
+    int round = 0;
+    schedule->send(round, source, count, mpiDatatype, rank);
+    schedule->receive(round, mine, count, mpiDatatype, rank);
+    for (int mask = 1; mask < size; mask <<= 1) {
+        round++;
+        if (rank & mask) {
+            schedule->send(round, mine, count, mpiDatatype, rank - mask);
+            break;
+        }
+        if (rank + mask < size) {
+            if (theirs == NULL) {
+                theirs = schedule->temporary(count, mpiDatatype);
+            }
+            schedule->receive(round, theirs, count, mpiDatatype,
+                              rank + mask);
+            schedule->reduce(round, mine, theirs);
+            std::swap(mine, theirs);
+        }
+    }
+    int target = all ? 0 : root;
+    round++;
+    if (rank == 0) {
+        schedule->send(round, mine, count, mpiDatatype, target, 1);
+    }
+    if (rank == target) {
+        schedule->receive(round, recvbuf, count, mpiDatatype, 0, 1);
+    }
+    if (all) {
+        addBcast(*schedule, round + 1, recvbuf, count, mpiDatatype, 0, size,
+                 2);
+    }
+    return start(schedule, request);
+}
+
+/* Gathers and scatters post every message at once, as MPIs do for small
+   communicators. */
+int YogiScheduler::gather(const void *sendbuf, int sendcount,
+                          MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                          const int *recvcounts, const int *displs,
+                          MPI_Datatype recvtype, int root, YogiMPI_Comm comm,
+                          MPI_Comm mpiComm, MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    if (root < 0 || root >= size) {
+        delete schedule;
+        return MPI_ERR_ROOT;
+    }
+    int rank = schedule->rank;
+    if (rank != root) {
+        schedule->send(0, sendbuf, sendcount, sendtype, root);
+        return start(schedule, request);
+    }
+    MPI_Aint extent = extentOf(recvtype);
+    for (int i = 0; i < size; i++) {
+        if (i == rank) {
+            if (sendbuf == MPI_IN_PLACE) continue;
+            schedule->send(0, sendbuf, sendcount, sendtype, rank);
+        }
+        schedule->receive(0, (char *) recvbuf +
+                             offsetAt(displs, recvcount, i, extent),
+                          countAt(recvcounts, recvcount, i), recvtype, i);
+    }
+    return start(schedule, request);
+}
+
+int YogiScheduler::scatter(const void *sendbuf, int sendcount,
+                           const int *sendcounts, const int *displs,
+                           MPI_Datatype sendtype, void *recvbuf,
+                           int recvcount, MPI_Datatype recvtype, int root,
+                           YogiMPI_Comm comm, MPI_Comm mpiComm,
+                           MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    if (root < 0 || root >= size) {
+        delete schedule;
+        return MPI_ERR_ROOT;
+    }
+    int rank = schedule->rank;
+    if (rank != root) {
+        schedule->receive(0, recvbuf, recvcount, recvtype, root);
+        return start(schedule, request);
+    }
+    MPI_Aint extent = extentOf(sendtype);
+    for (int i = 0; i < size; i++) {
+        if (i == rank) {
+            if (recvbuf == MPI_IN_PLACE) continue;
+            schedule->receive(0, recvbuf, recvcount, recvtype, rank);
+        }
+        schedule->send(0, (const char *) sendbuf +
+                          offsetAt(displs, sendcount, i, extent),
+                       countAt(sendcounts, sendcount, i), sendtype, i);
+    }
+    return start(schedule, request);
+}
+
+int YogiScheduler::allgather(const void *sendbuf, int sendcount,
+                             MPI_Datatype sendtype, void *recvbuf,
+                             int recvcount, const int *recvcounts,
+                             const int *displs, MPI_Datatype recvtype,
+                             YogiMPI_Comm comm, MPI_Comm mpiComm,
+                             MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    int rank = schedule->rank;
+    MPI_Aint extent = extentOf(recvtype);
+    bool inPlace = sendbuf == MPI_IN_PLACE;
+    if (inPlace) {
+        // This rank's block is already where it belongs.
+        sendbuf = (char *) recvbuf + offsetAt(displs, recvcount, rank, extent);
+        sendcount = countAt(recvcounts, recvcount, rank);
+        sendtype = recvtype;
+    }
+    for (int i = 0; i < size; i++) {
+        if (i == rank && inPlace) continue;
+        schedule->receive(0, (char *) recvbuf +
+                             offsetAt(displs, recvcount, i, extent),
+                          countAt(recvcounts, recvcount, i), recvtype, i);
+        schedule->send(0, sendbuf, sendcount, sendtype, i);
+    }
+    return start(schedule, request);
+}
+
+int YogiScheduler::alltoall(const void *sendbuf, int sendcount,
+                            const int *sendcounts, const int *sdispls,
+                            MPI_Datatype sendtype, void *recvbuf,
+                            int recvcount, const int *recvcounts,
+                            const int *rdispls, MPI_Datatype recvtype,
+                            YogiMPI_Comm comm, MPI_Comm mpiComm,
+                            MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    MPI_Aint recvExtent = extentOf(recvtype);
+    if (sendbuf == MPI_IN_PLACE) {
+        /* Blocks are sent from a copy of the receive buffer taken now,
+           since the receives overwrite it. */
+        MPI_Aint lb, trueLb, trueExtent, low = 0, high = 0;
+        bool any = false;
+        MPI_Type_get_true_extent(recvtype, &trueLb, &trueExtent);
+        for (int i = 0; i < size; i++) {
+            int count = countAt(recvcounts, recvcount, i);
+            if (count <= 0) continue;
+            lb = offsetAt(rdispls, recvcount, i, recvExtent) + trueLb;
+            MPI_Aint ub = lb + (count - 1) * recvExtent + trueExtent;
+            low = any ? std::min(low, lb) : lb;
+            high = any ? std::max(high, ub) : ub;
+            any = true;
+        }
+        char *copy = schedule->storage(high - low);
+        if (any) std::memcpy(copy, (char *) recvbuf + low, high - low);
+        sendbuf = copy - low;
+        sendcount = recvcount;
+        sendcounts = recvcounts;
+        sdispls = rdispls;
+        sendtype = recvtype;
+    }
+    MPI_Aint sendExtent = extentOf(sendtype);
+    for (int i = 0; i < size; i++) {
+        schedule->receive(0, (char *) recvbuf +
+                             offsetAt(rdispls, recvcount, i, recvExtent),
+                          countAt(recvcounts, recvcount, i), recvtype, i);
+        schedule->send(0, (const char *) sendbuf +
+                          offsetAt(sdispls, sendcount, i, sendExtent),
+                       countAt(sendcounts, sendcount, i), sendtype, i);
+    }
+    return start(schedule, request);
+}
+
+/* The sources and destinations of comm's virtual topology, in the order
+   of the neighbor collectives' blocks.  Cartesian neighbors come in pairs
+   per dimension, lower first. */
+static int topologyNeighbors(MPI_Comm comm, int rank,
+                             std::vector<int> &sources,
+                             std::vector<int> &destinations,
+                             bool *cartesian) {
+    int topology;
+    int mpiError = MPI_Topo_test(comm, &topology);
+    if (mpiError != MPI_SUCCESS) return mpiError;
+    *cartesian = topology == MPI_CART;
+    if (topology == MPI_CART) {
+        int ndims;
+        MPI_Cartdim_get(comm, &ndims);
+        for (int d = 0; d < ndims; d++) {
+            int lower, upper;
+            MPI_Cart_shift(comm, d, 1, &lower, &upper);
+            sources.push_back(lower);
+            sources.push_back(upper);
+        }
+        destinations = sources;
+    }
+    else if (topology == MPI_GRAPH) {
+        int count;
+        MPI_Graph_neighbors_count(comm, rank, &count);
+        sources.resize(count);
+        if (count > 0) MPI_Graph_neighbors(comm, rank, count, &sources[0]);
+        destinations = sources;
+    }
+#if YogiMPI_VERSION == 3 || YogiMPI_SUBVERSION > 1
+    else if (topology == MPI_DIST_GRAPH) {
+        int indegree, outdegree, weighted;
+        MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree,
+                                       &weighted);
+        sources.resize(indegree);
+        destinations.resize(outdegree);
+        std::vector<int> sourceWeights(indegree + 1);
+        std::vector<int> destinationWeights(outdegree + 1);
+        MPI_Dist_graph_neighbors(comm, indegree, sources.data(),
+                                 &sourceWeights[0], outdegree,
+                                 destinations.data(), &destinationWeights[0]);
+    }
+#endif
+    else {
+        return MPI_ERR_TOPOLOGY;
+    }
+    return MPI_SUCCESS;
+}
+
+/* On a Cartesian topology a block goes out tagged with its direction, and
+   arrives in the opposite one, so the two blocks between ranks that are
+   each other's lower and upper neighbor (a periodic dimension of two) do
+   not swap. */
+static int sendTag(bool cartesian, int block) {
+    return cartesian && block < YogiScheduler::tagsPerSchedule ? block : 0;
+}
+
+static int receiveTag(bool cartesian, int block) {
+    return cartesian && block < YogiScheduler::tagsPerSchedule ? block ^ 1
+                                                               : 0;
+}
+
+int YogiScheduler::neighborAllgather(const void *sendbuf, int sendcount,
+                                     MPI_Datatype sendtype, void *recvbuf,
+                                     int recvcount, const int *recvcounts,
+                                     const int *displs, MPI_Datatype recvtype,
+                                     YogiMPI_Comm comm, MPI_Comm mpiComm,
+                                     MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    std::vector<int> sources, destinations;
+    bool cartesian;
+    mpiError = topologyNeighbors(mpiComm, schedule->rank, sources,
+                                 destinations, &cartesian);
+    if (mpiError != MPI_SUCCESS) {
+        delete schedule;
+        return mpiError;
+    }
+    MPI_Aint extent = extentOf(recvtype);
+    for (int i = 0; i < (int) sources.size(); i++) {
+        schedule->receive(0, (char *) recvbuf +
+                             offsetAt(displs, recvcount, i, extent),
+                          countAt(recvcounts, recvcount, i), recvtype,
+                          sources[i], receiveTag(cartesian, i));
+    }
+    for (int i = 0; i < (int) destinations.size(); i++) {
+        schedule->send(0, sendbuf, sendcount, sendtype, destinations[i],
+                       sendTag(cartesian, i));
+    }
+    return start(schedule, request);
+}
+
+int YogiScheduler::neighborAlltoall(const void *sendbuf, int sendcount,
+                                    const int *sendcounts, const int *sdispls,
+                                    MPI_Datatype sendtype, void *recvbuf,
+                                    int recvcount, const int *recvcounts,
+                                    const int *rdispls, MPI_Datatype recvtype,
+                                    YogiMPI_Comm comm, MPI_Comm mpiComm,
+                                    MPI_Request *request) {
+    int size, mpiError;
+    YogiSchedule *schedule = create(comm, mpiComm, &size, &mpiError);
+    if (schedule == NULL) return mpiError;
+    std::vector<int> sources, destinations;
+    bool cartesian;
+    mpiError = topologyNeighbors(mpiComm, schedule->rank, sources,
+                                 destinations, &cartesian);
+    if (mpiError != MPI_SUCCESS) {
+        delete schedule;
+        return mpiError;
+    }
+    MPI_Aint recvExtent = extentOf(recvtype);
+    MPI_Aint sendExtent = extentOf(sendtype);
+    for (int i = 0; i < (int) sources.size(); i++) {
+        schedule->receive(0, (char *) recvbuf +
+                             offsetAt(rdispls, recvcount, i, recvExtent),
+                          countAt(recvcounts, recvcount, i), recvtype,
+                          sources[i], receiveTag(cartesian, i));
+    }
+    for (int i = 0; i < (int) destinations.size(); i++) {
+        schedule->send(0, (const char *) sendbuf +
+                          offsetAt(sdispls, sendcount, i, sendExtent),
+                       countAt(sendcounts, sendcount, i), sendtype,
+                       destinations[i], sendTag(cartesian, i));
+    }
+    return start(schedule, request);
+}
@@ -0,0 +1,269 @@
+#ifndef YOGISCHEDULE_H
+#define YOGISCHEDULE_H
+
+#include "yogimpi.h"
+#include "mpi.h"
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Nonblocking and neighbor collectives done by YogiMPI itself, for MPIs
+   older than 3.0 that lack them.  A collective becomes a schedule: rounds
+   of point-to-point transfers, each round posted with MPI_Isend and
+   MPI_Irecv once the one before it has finished, and followed by any
+   local reductions.  The application gets a generalized request
+   (MPI_Grequest_start) for the schedule, so its handle works everywhere a
+   request does: in Waitall arrays, MPI_Request_free or a completion queue.
+
+   An MPI generalized request does not progress by itself.  Schedules move
+   on whenever the application tests or waits on any request, and while
+   any are unfinished the Wait family polls instead of blocking in MPI,
+   unless the progress thread (YogiProgress) moves them instead.  Other
+   blocking calls (MPI_Recv, MPI_Probe, blocking collectives and the
+   like) do not move them: without the progress thread, a rank that
+   blocks there while a peer waits for its part of a schedule hangs.
+
+   Schedules send on a duplicate of the user communicator, made by the
+   call that created the communicator (and by MPI_Init for MPI_COMM_WORLD
+   and MPI_COMM_SELF), since MPI_Comm_dup is collective and starting a
+   nonblocking collective must not wait for the other ranks.
+   In MPI 3 builds setting YOGI_EMULATE_COLLECTIVES to 1 routes the same
+   calls through here, for testing and for MPIs whose own nonblocking
+   collectives do not progress. */
+
+/* One message of a round.  A transfer with this rank as its peer is a
+   local copy, which also converts between datatypes. */
+struct YogiTransfer
+{
+    bool send;
+    void *buffer;
+    int count;
+    MPI_Datatype datatype;
+    int peer;
+    // Added to the schedule's tag; see YogiScheduler::tagsPerSchedule.
+    int tag;
+};
+
+/* inout = in op inout, over the schedule's count, datatype and op. */
+struct YogiReduction
+{
+    const void *in;
+    void *inout;
+};
+
+struct YogiRound
+{
+    std::vector<YogiTransfer> transfers;
+    // Done once every transfer of the round has finished.
+    std::vector<YogiReduction> reductions;
+};
+
+/* The private duplicate of a user communicator that schedules send on, so
+   their messages never match the application's.  Freed once neither the
+   user communicator nor any unfinished schedule refers to it. */
+struct YogiScheduleComm
+{
+    YogiScheduleComm() : comm(MPI_COMM_NULL), sequence(0) {}
+    ~YogiScheduleComm();
+    MPI_Comm comm;
+    // Collectives started on it so far, which picks each one's tags.
+    unsigned int sequence;
+};
+
+struct YogiSchedule
+{
+    YogiSchedule() : tag(0), rank(0), next(0), count(0),
+                     datatype(YogiMPI_DATATYPE_NULL),
+                     mpiDatatype(MPI_DATATYPE_NULL), op(YogiMPI_OP_NULL),
+                     mpiOp(MPI_OP_NULL), userFn(NULL), error(MPI_SUCCESS),
+                     request(MPI_REQUEST_NULL) {}
+
+    /* Buffers that live as long as the schedule: bytes bytes, or room for
+       count elements of datatype as the pointer to pass with them to
+       MPI. */
+    char * storage(MPI_Aint bytes);
+    void * temporary(int count, MPI_Datatype datatype);
+    void send(int round, const void *buffer, int count,
+              MPI_Datatype datatype, int peer, int tag = 0);
+    void receive(int round, void *buffer, int count, MPI_Datatype datatype,
+                 int peer, int tag = 0);
+    void reduce(int round, const void *in, void *inout);
+    YogiRound & round(int index);
+
+    std::shared_ptr<YogiScheduleComm> comm;
+    int tag;
+    int rank;
+    std::vector<YogiRound> rounds;
+    // The round to post next; the one before it may still be in flight.
+    std::size_t next;
+    std::vector<MPI_Request> pending;
+    std::vector<std::unique_ptr<char[]> > buffers;
+
+    // The reduction, if any.
+    int count;
+    YogiMPI_Datatype datatype;
+    MPI_Datatype mpiDatatype;
+    YogiMPI_Op op;
+    MPI_Op mpiOp;
+    // The function of a user op, or NULL for a predefined one.
+    YogiMPI_User_function *userFn;
+
+    // The first MPI error, which ends the schedule.
+    int error;
+    MPI_Request request;
+};
+
+class YogiScheduler
+{
+public:
+    /* Every schedule tags its messages from its own range of this many
+       tags.  1024 ranges fit the smallest MPI_TAG_UB MPI allows, 32767, so
+       a communicator can have that many collectives in flight. */
+    static const int tagsPerSchedule = 32;
+    static const int tagRanges = 1024;
+
+    YogiScheduler();
+
+    void setThreadMultiple(bool multiple) { threadMultiple = multiple; }
+    /* Set while the progress thread (YogiProgress) runs.  The Wait family
+       may then block in MPI, since the thread finishes the schedules. */
+    void setDriven(bool driving) {
+        driven.store(driving, std::memory_order_relaxed);
+    }
+
+    // True while any schedule is unfinished.
+    bool busy() const {
+        return outstanding.load(std::memory_order_relaxed) > 0;
+    }
+    /* Advances every unfinished schedule that can move.  Cheap when there
+       are none, so the Test family calls it unconditionally. */
+    void progress() {
+        if (busy()) advanceAll();
+    }
+
+    /* The Wait family while schedules are unfinished: polls the requests
+       and advances the schedules until MPI_Wait and its kin would have
+       returned, and sets *mpi_error.  Each returns false, having done
+       nothing, when no schedule is unfinished or the progress thread
+       drives them, and MPI may block as usual. */
+    bool wait(MPI_Request *request, MPI_Status *status, int *mpi_error) {
+        return polling() && pollWait(request, status, mpi_error);
+    }
+    bool waitall(int count, MPI_Request *requests, MPI_Status *statuses,
+                 int *mpi_error) {
+        return polling() && pollWaitall(count, requests, statuses, mpi_error);
+    }
+    bool waitany(int count, MPI_Request *requests, int *index,
+                 MPI_Status *status, int *mpi_error) {
+        return polling() &&
+               pollWaitany(count, requests, index, status, mpi_error);
+    }
+    bool waitsome(int incount, MPI_Request *requests, int *outcount,
+                  int *indices, MPI_Status *statuses, int *mpi_error) {
+        return polling() && pollWaitsome(incount, requests, outcount,
+                                         indices, statuses, mpi_error);
+    }
+
+    /* The collectives.  Arguments are those of the MPI function, already
+       converted, with both handles of the communicator.  Where an MPI
+       function has a "v" form, counts and displacements of NULL stand for
+       the plain form's single count, with blocks one after another.  Each
+       starts the schedule and returns an MPI error code; with request set
+       to NULL it also waits for the schedule, for the blocking neighbor
+       collectives.  Intercommunicators are refused with MPI_ERR_COMM. */
+    int barrier(YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    int bcast(void *buffer, int count, MPI_Datatype datatype, int root,
+              YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    // With all set, an allreduce, and root is ignored.
+    int reduce(const void *sendbuf, void *recvbuf, int count,
+               YogiMPI_Datatype datatype, MPI_Datatype mpiDatatype,
+               YogiMPI_Op op, MPI_Op mpiOp, int root, bool all,
+               YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    int gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
+               void *recvbuf, int recvcount, const int *recvcounts,
+               const int *displs, MPI_Datatype recvtype, int root,
+               YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    int scatter(const void *sendbuf, int sendcount, const int *sendcounts,
+                const int *displs, MPI_Datatype sendtype, void *recvbuf,
+                int recvcount, MPI_Datatype recvtype, int root,
+                YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    int allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
+                  void *recvbuf, int recvcount, const int *recvcounts,
+                  const int *displs, MPI_Datatype recvtype,
+                  YogiMPI_Comm comm, MPI_Comm mpiComm, MPI_Request *request);
+    int alltoall(const void *sendbuf, int sendcount, const int *sendcounts,
+                 const int *sdispls, MPI_Datatype sendtype, void *recvbuf,
+                 int recvcount, const int *recvcounts, const int *rdispls,
+                 MPI_Datatype recvtype, YogiMPI_Comm comm, MPI_Comm mpiComm,
+                 MPI_Request *request);
+    int neighborAllgather(const void *sendbuf, int sendcount,
+                          MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                          const int *recvcounts, const int *displs,
+                          MPI_Datatype recvtype, YogiMPI_Comm comm,
+                          MPI_Comm mpiComm, MPI_Request *request);
+    int neighborAlltoall(const void *sendbuf, int sendcount,
+                         const int *sendcounts, const int *sdispls,
+                         MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                         const int *recvcounts, const int *rdispls,
+                         MPI_Datatype recvtype, YogiMPI_Comm comm,
+                         MPI_Comm mpiComm, MPI_Request *request);
+
+    /* Makes the duplicate of a new intracommunicator that its schedules
+       send on.  Called by every call that creates one, where all its
+       ranks take part anyway; does nothing unless this build or
+       YOGI_EMULATE_COLLECTIVES uses the schedules.  Returns an MPI error
+       code. */
+    int adoptComm(YogiMPI_Comm comm, MPI_Comm mpiComm);
+    /* Drops the duplicate of a user communicator being freed.  Schedules
+       still running on it keep it until they finish. */
+    void releaseComm(YogiMPI_Comm comm);
+    /* Drops every duplicate.  Called from YogiMPI_Finalize. */
+    void release();
+
+    // From YOGI_EMULATE_COLLECTIVES; only read in MPI 3 builds.
+    bool emulating;
+private:
+    YogiScheduler(const YogiScheduler &);
+    YogiScheduler & operator=(const YogiScheduler &);
+
+    bool polling() const {
+        return busy() && !driven.load(std::memory_order_relaxed);
+    }
+    bool pollWait(MPI_Request *request, MPI_Status *status, int *mpi_error);
+    bool pollWaitall(int count, MPI_Request *requests, MPI_Status *statuses,
+                     int *mpi_error);
+    bool pollWaitany(int count, MPI_Request *requests, int *index,
+                     MPI_Status *status, int *mpi_error);
+    bool pollWaitsome(int incount, MPI_Request *requests, int *outcount,
+                      int *indices, MPI_Status *statuses, int *mpi_error);
+
+    /* A new schedule on comm, or NULL with *mpi_error set when comm is not
+       an intracommunicator. */
+    YogiSchedule * create(YogiMPI_Comm comm, MPI_Comm mpiComm, int *size,
+                          int *mpi_error);
+    /* Hands a built schedule to the progress engine, and waits for it when
+       request is NULL. */
+    int start(YogiSchedule *schedule, MPI_Request *request);
+    void advanceAll();
+    // True once the schedule has finished, with or without an error.
+    bool advance(YogiSchedule &schedule);
+    int combine(YogiSchedule &schedule, const void *in, void *inout);
+    void addBcast(YogiSchedule &schedule, int first, void *buffer, int count,
+                  MPI_Datatype datatype, int root, int size, int tag);
+
+    static int queryFn(void *state, MPI_Status *status);
+    static int freeFn(void *state);
+    static int cancelFn(void *state, int complete);
+
+    bool threadMultiple;
+    std::mutex mutex;
+    std::atomic<int> outstanding;
+    std::atomic<bool> driven;
+    std::list<YogiSchedule *> running;
+    std::map<YogiMPI_Comm, std::shared_ptr<YogiScheduleComm> > comms;
+};
+
+#endif
@@ -0,0 +1,296 @@
+#include "YogiManager.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <algorithm>
+
+/* Microbenchmarks for the YogiManager handle pools and converters.  These
+   run without MPI_Init, feeding the pools made-up handle values that are
+   never passed to the MPI library.  Every row reports nanoseconds and heap
+   allocations per operation, and the capacity of the pool it used
+   afterwards.
+
+   Usage: bench_YogiManager [operations]   (default 1000000) */
+
+typedef std::chrono::steady_clock benchClock;
+
+/* Count every allocation made through operator new, which covers the
+   pools' vectors, chunks and lookup tables. */
+static std::atomic<long> allocations(0);
+
+void * operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void *memory = std::malloc(size ? size : 1);
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+/* Build a fake, non-null MPI handle from an integer. Works whether the
+   MPI distribution uses integers or pointers for its handles. */
+template <typename T>
+T fakeHandle(std::size_t i) {
+    return (T)(std::intptr_t)(0x10000 + i * 16);
+}
+
+/* Times one phase of a workload and prints it as a table row. */
+class Measurement {
+public:
+    Measurement(const char *workload, long handles,
+                int pool = YogiX_POOL_REQUEST)
+        : workload(workload), handles(handles), pool(pool),
+          startAllocations(allocations.load()), start(benchClock::now()) {}
+
+    void report(long ops) {
+        benchClock::time_point stop = benchClock::now();
+        long allocated = allocations.load() - startAllocations;
+        std::chrono::duration<double, std::nano> elapsed = stop - start;
+        YogiX_Pool_info info;
+        YogiManager::getInstance()->poolStats(pool, &info);
+        std::cout << std::left << std::setw(24) << workload << std::right
+                  << std::setw(10) << handles
+                  << std::setw(12) << std::fixed << std::setprecision(1)
+                  << elapsed.count() / ops
+                  << std::setw(12) << std::setprecision(3)
+                  << (double) allocated / ops
+                  << std::setw(12) << info.capacity << std::endl;
+    }
+
+private:
+    const char *workload;
+    long handles;
+    int pool;
+    long startAllocations;
+    benchClock::time_point start;
+};
+
+void fill(std::vector<YogiMPI_Request> &live, long first) {
+    YogiManager *manager = YogiManager::getInstance();
+    for (std::size_t i = 0; i < live.size(); i++) {
+        live[i] = manager->requestToYogi(fakeHandle<MPI_Request>(first + i));
+    }
+}
+
+void release(std::vector<YogiMPI_Request> &live) {
+    YogiManager *manager = YogiManager::getInstance();
+    for (std::size_t i = 0; i < live.size(); i++) {
+        manager->unmapRequest(live[i]);
+    }
+}
+
+/* Fill the request pool up to liveCount handles, then measure the cost of
+   one remove plus one insert while that many handles stay live. */
+void requestChurn(long liveCount, long churnOps) {
+    YogiManager *manager = YogiManager::getInstance();
+    std::vector<YogiMPI_Request> live(liveCount);
+
+    Measurement filling("fill", liveCount);
+    fill(live, 0);
+    filling.report(liveCount);
+
+    Measurement churning("steady churn", liveCount);
+    for (long i = 0; i < churnOps; i++) {
+        long slot = (i * 7919) % liveCount;
+        manager->unmapRequest(live[slot]);
+        live[slot] = manager->requestToYogi(
+                         fakeHandle<MPI_Request>(liveCount + i));
+    }
+    churning.report(churnOps);
+    release(live);
+}
+
+/* Free liveCount handles in a random order, which scatters the free list,
+   then measure refilling from it. */
+void randomFreeOrder(long liveCount, std::mt19937 &random) {
+    std::vector<YogiMPI_Request> live(liveCount);
+    fill(live, 0);
+    std::shuffle(live.begin(), live.end(), random);
+
+    Measurement freeing("random free", liveCount);
+    release(live);
+    freeing.report(liveCount);
+
+    Measurement refilling("refill after random", liveCount);
+    fill(live, liveCount);
+    refilling.report(liveCount);
+    release(live);
+}
+
+/* Leave a random tenth of liveCount handles live, so every chunk is
+   sparsely used, then measure churn and a full refill.  The capacity
+   column shows how much of the peak the pool still holds. */
+void fragmented(long liveCount, long churnOps, std::mt19937 &random) {
+    YogiManager *manager = YogiManager::getInstance();
+    std::vector<YogiMPI_Request> live(liveCount);
+    fill(live, 0);
+    std::shuffle(live.begin(), live.end(), random);
+    std::vector<YogiMPI_Request> freed(live.begin() + liveCount / 10,
+                                       live.end());
+    live.resize(liveCount / 10);
+    release(freed);
+
+    Measurement churning("fragmented churn", (long) live.size());
+    for (long i = 0; i < churnOps; i++) {
+        long slot = (i * 7919) % (long) live.size();
+        manager->unmapRequest(live[slot]);
+        live[slot] = manager->requestToYogi(
+                         fakeHandle<MPI_Request>(liveCount + i));
+    }
+    churning.report(churnOps);
+
+    Measurement refilling("fragmented refill", (long) freed.size());
+    fill(freed, liveCount + churnOps);
+    refilling.report((long) freed.size());
+    release(freed);
+    release(live);
+}
+
+/* Grow the pool to liveCount handles and drain it in order; the capacity
+   column after draining shows what the pool gave back. */
+void stress(long liveCount) {
+    std::vector<YogiMPI_Request> live(liveCount);
+
+    Measurement filling("stress insert", liveCount);
+    fill(live, 0);
+    filling.report(liveCount);
+
+    Measurement draining("stress remove", liveCount);
+    release(live);
+    draining.report(liveCount);
+}
+
+/* Register liveCount derived datatypes, then measure translating already
+   known MPI datatypes back to Yogi, as user-op callbacks and
+   MPI_Type_get_contents do. */
+void datatypeLookup(long liveCount, long lookupOps) {
+    YogiManager *manager = YogiManager::getInstance();
+    std::vector<YogiMPI_Datatype> live(liveCount);
+
+    for (long i = 0; i < liveCount; i++) {
+        live[i] = manager->datatypeToYogi(fakeHandle<MPI_Datatype>(i));
+    }
+
+    long mismatches = 0;
+    Measurement finding("datatype find", liveCount, YogiX_POOL_DATATYPE);
+    for (long i = 0; i < lookupOps; i++) {
+        long slot = (i * 7919) % liveCount;
+        YogiMPI_Datatype found = manager->datatypeToYogiFindOnly(
+                                     fakeHandle<MPI_Datatype>(slot));
+        if (found != live[slot]) mismatches++;
+    }
+    finding.report(lookupOps);
+
+    Measurement resolving("datatype resolve", liveCount,
+                          YogiX_POOL_DATATYPE);
+    for (long i = 0; i < lookupOps; i++) {
+        long slot = (i * 7919) % liveCount;
+        YogiMPI_Datatype found = manager->datatypeToYogi(
+                                     fakeHandle<MPI_Datatype>(slot));
+        if (found != live[slot]) mismatches++;
+    }
+    resolving.report(lookupOps);
+
+    for (long i = 0; i < liveCount; i++) {
+        manager->unmapDatatype(live[i]);
+    }
+    if (mismatches) {
+        std::cerr << mismatches << " lookups returned the wrong handle."
+                  << std::endl;
+    }
+}
+
+/* The converters every completion call goes through, per element. */
+void converters(long ops) {
+    YogiManager *manager = YogiManager::getInstance();
+    const int width = 64;
+    std::vector<YogiMPI_Request> requests(width);
+    std::vector<MPI_Request> mpiRequests(width);
+    std::vector<YogiMPI_Status> statuses(width);
+    fill(requests, 0);
+
+    long sink = 0;
+    Measurement single("statusToYogi", 1);
+    for (long i = 0; i < ops; i++) {
+        MPI_Status *mpiStatus = manager->statusToMPI(&statuses[0]);
+        mpiStatus->MPI_SOURCE = (int) (i & 7);
+        mpiStatus->MPI_TAG = (int) i;
+        mpiStatus->MPI_ERROR = MPI_SUCCESS;
+        manager->statusToYogiInPlace(&statuses[0]);
+        sink += statuses[0].MPI_TAG;
+    }
+    single.report(ops);
+
+    Measurement array("statuses to Yogi", width);
+    for (long i = 0; i < ops / width; i++) {
+        MPI_Status *mpiStatuses = manager->statusesToMPI(&statuses[0],
+                                                         width);
+        for (int j = 0; j < width; j++) {
+            mpiStatuses[j].MPI_SOURCE = j;
+            mpiStatuses[j].MPI_TAG = (int) i;
+            mpiStatuses[j].MPI_ERROR = MPI_SUCCESS;
+        }
+        manager->statusesToYogiInPlace(&statuses[0], width);
+        sink += statuses[width - 1].MPI_SOURCE;
+    }
+    array.report(ops / width * width);
+
+    Measurement success("errorToYogi success", 1);
+    for (long i = 0; i < ops; i++) {
+        sink += manager->errorToYogi(MPI_SUCCESS);
+    }
+    success.report(ops);
+
+    Measurement failure("errorToYogi error", 1);
+    for (long i = 0; i < ops; i++) {
+        sink += manager->errorToYogi(MPI_ERR_TRUNCATE);
+    }
+    failure.report(ops);
+
+    Measurement requestArray("requests to MPI", width);
+    for (long i = 0; i < ops / width; i++) {
+        manager->requestToMPI(&requests[0], &mpiRequests[0], width);
+        sink += mpiRequests[i % width] != MPI_REQUEST_NULL;
+    }
+    requestArray.report(ops / width * width);
+
+    release(requests);
+    // Keep the loops from being optimized away.
+    if (sink == 42) std::cout << std::endl;
+}
+
+int main(int argc, char **argv) {
+    long ops = 1000000;
+    if (argc > 1) ops = std::atol(argv[1]);
+    std::mt19937 random(12345);
+
+    std::cout << "Handle translation: "
+              << (YogiPassthrough<MPI_Comm>::enabled ? "passthrough"
+                                                     : "pooled")
+              << std::endl << std::endl;
+    std::cout << std::left << std::setw(24) << "workload" << std::right
+              << std::setw(10) << "handles"
+              << std::setw(12) << "ns/op"
+              << std::setw(12) << "allocs/op"
+              << std::setw(12) << "capacity" << std::endl;
+    for (long live = 1000; live <= 1000000; live *= 10) {
+        requestChurn(live, ops);
+    }
+    for (long live = 1000; live <= 1000000; live *= 10) {
+        randomFreeOrder(live, random);
+    }
+    fragmented(100000, ops, random);
+    stress(1000000);
+    for (long live = 1000; live <= 1000000; live *= 10) {
+        datatypeLookup(live, ops);
+    }
+    converters(ops);
+    return 0;
+}
@@ -62,7 +62,38 @@ class GenerateWrap(object):
 
     mpiTypes = mpiHandles + mpiTypeDefs + mpiObjects
 
-    manPrefix = "YogiManager::getInstance()->"
+    # Each generated function binds the manager to a local reference once,
+    # and every conversion goes through that reference.
+    manPrefix = "yogi."
+    manLocal = "YogiManager &yogi = YogiManager::instance();"
+
+    # Functions the MPI standard allows before MPI_Init, when the manager
+    # may not have been constructed yet.
+    preInitFunctions = [ 'MPI_Initialized', 'MPI_Finalized', 'MPI_Get_version',
+                         'MPI_Get_library_version' ]
+    preInitLocal = "YogiManager &yogi = *YogiManager::getInstance();"
+
+    # Functions written by hand in yogimpi.cxx.in.  They trace their calls
+    # under ids from the same table as the generated wrappers.
+    handWrittenFunctions = [ 'MPI_Init', 'MPI_Init_thread', 'MPI_Finalize',
+                             'MPI_Error_class', 'MPI_Error_string',
+                             'MPI_Get_processor_name', 'MPI_Type_get_contents',
+                             'MPI_Type_create_darray', 'MPI_Wtick',
+                             'MPI_Wtime' ]
+
+    # MPI functions called by hand-written code that are not wrapped.  The
+    # dispatch table needs them too.
+    dispatchExtraFunctions = [ 'MPI_Comm_f2c', 'MPI_Group_f2c',
+                               'MPI_Comm_spawn' ]
+
+    # (count, datatype) argument pairs that size a call's message for the
+    # profiler and the trace, in order of preference.
+    sizeArgs = [ ('count', 'datatype'), ('sendcount', 'sendtype'),
+                 ('origin_count', 'origin_datatype') ]
+
+    # Scalar arguments recorded in the trace as the peer rank and the tag.
+    peerArgs = [ 'dest', 'source', 'root', 'target_rank' ]
+    tagArgs = [ 'tag', 'sendtag' ]
 
     #mpiFunctionMap = { 'MPI_User_function': 'UserFunction' }
     mpiFunctionMap = { }
@@ -82,13 +113,16 @@ class GenerateWrap(object):
 #                 'MPI_Comm_copy_attr_function': 'CommCopyFunction',
 #                 'MPI_Comm_delete_attr_function': 'CommDeleteFunction'
 
-    def __init__(self, xmlInput, version, yogiVersion="unknown"):
+    def __init__(self, xmlInput, version, yogiVersion="unknown",
+                 statusLayout="compact"):
         # Prefix for all the functions to wrap.
         self.prefix = 'Yogi'
         # MPI version to support
         self.mpiVersion = wrap_objects.MPIVersion(version)
         # YogiMPI version
         self.yogimpiVersion = yogiVersion
+        # YogiMPI_Status layout: compact (the default ABI) or aligned.
+        self.statusLayout = statusLayout
         # Parsed functions to wrap.
         self.functions = []
 
@@ -109,9 +143,15 @@ class GenerateWrap(object):
                 thisFunction.mpi_version = wrap_objects.MPIVersion(mpiVersion.text)
             else:
                 thisFunction.mpi_version = wrap_objects.MPIVersion('2.1')
-            # If this function is in too high a version of MPI, skip it.
+            # If this function is in too high a version of MPI, skip it,
+            # unless YogiMPI can emulate it.
             if thisFunction.mpi_version > self.mpiVersion:
-                continue
+                emulations = [codeElement for codeElement in
+                              funcElement.findall('Code')
+                              if codeElement.attrib.get('order') == 'emulate']
+                if not emulations:
+                    continue
+                thisFunction.emulated = True
             thisFunction.name = funcElement.attrib['name']
             thisFunction.return_type = funcElement.find('ReturnType').text
             fortranSupport = funcElement.find('FortranSupport')
@@ -167,6 +207,8 @@ class GenerateWrap(object):
                     thisArg.is_plural = True
                     thisArg.is_pointer = True
                     thisArg.dims = argElement.attrib['dims']
+                thisArg.written = argElement.attrib.get('written', None)
+                thisArg.written_if = argElement.attrib.get('writtenif', None)
 
                 if rawType.startswith('MPI_'):
                     if not rawType.endswith('function*'):
@@ -196,6 +238,7 @@ class GenerateWrap(object):
 
                 freeVal = argElement.attrib.get('free', None)
                 thisArg.free_handle = self._checkTrue(freeVal)
+                thisArg.cache_side = argElement.attrib.get('cache', None)
                 thisArg.convert_class = argElement.attrib.get('class', None)
                 for conv in argElement.findall('Convert'):
                     if thisArg.convert_class:
@@ -249,13 +292,9 @@ class GenerateWrap(object):
                 if anArg.is_input and anArg.is_pointer:
                     # MPI_Status input arguments are always pointers.
                     printName = anArg.mpi_name
-                elif anArg.is_pointer and not anArg.is_plural:
-                    # An MPI_Status argument that is scalar and only
-                    # output is almost always a pointer, but a conversion
-                    # variable is normally passed.  Therefore we need the
-                    # & to pass the address.
-                    printName = '&' + anArg.mpi_name
-                elif anArg.is_plural:
+                else:
+                    # An output MPI_Status, scalar or array, is converted to
+                    # a pointer into the caller's YogiMPI_Status storage.
                     printName = anArg.mpi_name
             else:
                 printName = anArg.call_name
@@ -276,41 +315,74 @@ class GenerateWrap(object):
         callRealMPI += ');'
         return callRealMPI
 
+    ## Writes the lines around the MPI call for an output MPI_Status.
+    #  Statuses go straight into the caller's storage unless it is
+    #  misaligned; afterwards the public fields are filled and packed array
+    #  entries spread out.
     def _statusOutputLines(self, sourceFile, aFunc, phase):
-        convPrefix = GenerateWrap.manPrefix + 'statusTo'
+        if not aFunc.status_ignore:
+            return
+        theArg = aFunc.args[aFunc.status_ignore_arg]
+        if theArg.is_plural and theArg.dims is None:
+            msg = 'Func ' + aFunc.name + ', arg ' + theArg.name +\
+                  ' has no dimensions.'
+            raise ValueError(msg)
         if phase == 'input':
-            if aFunc.status_ignore:
-                theArg = aFunc.args[aFunc.status_ignore_arg]
-                tempVarDecl = 'MPI_Status '
-                if theArg.is_plural:
-                    tempVarDecl += '* '
-                tempVarDecl += theArg.mpi_name
-                if theArg.is_plural:
-                    tempVarDecl += ' = NULL'
-                sourceFile.addLines(tempVarDecl + ';')
-                if theArg.is_plural:
-                    if theArg.dims is None:
-                        msg = 'Func ' + aFunc.name + ', arg ' + theArg.name +\
-                              ' has no dimensions.'
-                        raise ValueError(msg)
-                    convLine = GenerateWrap.manPrefix + 'createStatus(' +\
-                               theArg.mpi_name + ', ' + theArg.dims + ');'
-                    sourceFile.addLines(convLine)
+            if theArg.is_plural:
+                convCall = GenerateWrap.manPrefix + 'statusesToMPI(' +\
+                           theArg.call_name + ', ' + theArg.dims + ')'
+            else:
+                convCall = GenerateWrap.manPrefix + 'statusToMPI(' +\
+                           theArg.call_name + ')'
+            sourceFile.addLines('MPI_Status * ' + theArg.mpi_name + ' = ' +\
+                                convCall + ';')
         elif phase == 'output':
-            if aFunc.status_ignore:
-                outToYogi = ''
-                theArg = aFunc.args[aFunc.status_ignore_arg]
-                if theArg.is_pointer and not theArg.is_plural:
-                    outToYogi += '*'
-                if not theArg.is_plural:
-                    outToYogi += theArg.call_name  + ' = ' + convPrefix +\
-                                 'Yogi(' + theArg.mpi_name + ');'
-                if theArg.is_plural:
-                    arrayConv = GenerateWrap.manPrefix + 'statusToYogi'
-                    outToYogi = arrayConv + '(' + theArg.mpi_name + ', ' +\
-                                theArg.call_name + ', ' + theArg.dims +\
-                                ', true);'
-                sourceFile.addLines(outToYogi)
+            if theArg.is_plural:
+                # Only the statuses MPI wrote are spread out and translated.
+                written = theArg.written or theArg.dims
+                if theArg.written_if:
+                    sourceFile.addIf(theArg.written_if)
+                sourceFile.addLines(GenerateWrap.manPrefix +\
+                                    'statusesToYogiInPlace(' +\
+                                    theArg.call_name + ', ' + written + ');')
+                if theArg.written_if:
+                    sourceFile.endIf()
+            else:
+                sourceFile.addLines(GenerateWrap.manPrefix +\
+                                    'statusToYogiInPlace(' +\
+                                    theArg.call_name + ');')
+
+    ## Declares the MPI-side array for a plural argument.  Small arrays stay
+    #  on the stack and larger ones reuse a per-thread buffer, so converting
+    #  an array does not allocate once the buffers have grown.
+    def _scratchArray(self, sourceFile, anArg):
+        scratchName = 'scratch_' + anArg.call_name
+        sourceFile.addLines('YogiScratch<' + anArg.mpi_type + '> ' +\
+                            scratchName + ';')
+        sourceFile.addLines(anArg.mpi_type + ' * ' + anArg.mpi_name + ' = ' +\
+                            scratchName + '.get(' + anArg.dims + ');')
+
+    ## Converts an array through one of the manager's caches, which skip
+    #  the conversion when the same array comes again: a collective's
+    #  datatypes through its communicator's cache (cache="send" or "recv"),
+    #  or an array of persistent requests (cache="persistent").
+    def _cachedArray(self, sourceFile, anArg):
+        sides = { 'send': '0', 'recv': '1' }
+        scratchName = 'scratch_' + anArg.call_name
+        if anArg.mpi_type == 'MPI_Datatype' and anArg.cache_side in sides:
+            convertCall = 'datatypeToMPICached(comm, ' +\
+                          sides[anArg.cache_side] + ', '
+        elif anArg.mpi_type == 'MPI_Request' and \
+             anArg.cache_side == 'persistent':
+            convertCall = 'requestToMPICached('
+        else:
+            raise ValueError('arg ' + anArg.name + ' cannot be cached.')
+        sourceFile.addLines('YogiScratch<' + anArg.mpi_type + '> ' +\
+                            scratchName + ';')
+        sourceFile.addLines(anArg.mpi_type + ' * ' + anArg.mpi_name + ' = ' +\
+                            GenerateWrap.manPrefix + convertCall +\
+                            anArg.call_name + ', ' + anArg.dims + ', ' +\
+                            scratchName + ');')
 
     def _makeConstantCall(self, sourceFile, anArg, before=True):
         if anArg.is_mpi_type:
@@ -435,17 +507,15 @@ class GenerateWrap(object):
                 callString += returnVal + ' = ' + convFunc + '(' + inputArg +\
                               ');'
             else:
-                callString += '*' + returnVal + ' = ' + convFunc + '(*' +\
-                              inputArg + ');'
+                # MPI updated the status where it lives, so only the public
+                # fields need filling in.
+                callString += convFunc + 'InPlace(' + returnVal + ');'
         elif anArg.is_plural and anArg.dims:
             # Array conversion functions don't produce a return value.  This
             # becomes the second argument, passed by reference, which is
             # modified in-place.
             callString += convFunc + '(' + inputArg + ', ' + returnVal + ', ' +\
-                          anArg.dims
-            if not before:
-                callString += ', true'
-            callString += ');'
+                          anArg.dims + ');'
         else:
             if (not before and anArg.is_pointer):
                 # If this is a conversion after the MPI call, dereference the
@@ -463,6 +533,7 @@ class GenerateWrap(object):
     def writeFiles(self):
         self.writeCHeader()
         self.writeCUserHeader()
+        self.writeDispatchHeader()
         self.writeCXXSource()
         self.writeFortranHeader()
         self.writeFortranBridge()
@@ -484,8 +555,14 @@ class GenerateWrap(object):
                              minorVersion)
         if majorVersion == '3':
             extra_op.addLines('integer, parameter :: YOG_NO_OP = 14')
+        status_size = source_writers.FortranSource()
+        if self.statusLayout == 'aligned':
+            status_size.addLines('integer, parameter :: YOG_STATUS_SIZE = 16')
+        else:
+            status_size.addLines('integer, parameter :: YOG_STATUS_SIZE = 15')
         header_file.merge(set_version, 'SET_VERSION')
         header_file.merge(extra_op, 'EXTRA_OP')
+        header_file.merge(status_size, 'STATUS_SIZE')
         header_file.writeFile('yogimpif.h')
 
     # Writes the C++ code that binds YogiMPI to the Fortran layer.
@@ -730,6 +807,41 @@ class GenerateWrap(object):
         user_header.merge(func_defines, 'YOGI_DEFINES')
         user_header.writeFile('mpitoyogi.h')
 
+    ## Writes the dispatch table used when YogiMPI is built with
+    #  -DYOGI_DISPATCH.  Each MPI function gets a pointer type taken from
+    #  the MPI's own prototype, an id, and a macro that routes calls through
+    #  the table.
+    def writeDispatchHeader(self):
+        dispatch_header = source_writers.CSource(inputFile=\
+                                                 'yogimpi_dispatch.h.in')
+        allNames = []
+        for aName in GenerateWrap.handWrittenFunctions +\
+                     GenerateWrap.dispatchExtraFunctions +\
+                     [aFunc.name for aFunc in self.functions
+                      if not aFunc.emulated]:
+            if aName not in allNames:
+                allNames.append(aName)
+        dispatch_types = source_writers.CSource()
+        for aName in allNames:
+            dispatch_types.addLines('typedef decltype(&::' + aName + ') ' +\
+                                    'YogiFn_' + aName + ';')
+        dispatch_types.newLine()
+        dispatch_types.addLines('enum YogiSymbolId {')
+        dispatch_types.addIndent()
+        for aName in allNames:
+            dispatch_types.addLines('YOGI_SYM_' + aName + ',')
+        dispatch_types.addLines('YOGI_NUM_SYMBOLS')
+        dispatch_types.removeIndent()
+        dispatch_types.addLines('};')
+        dispatch_defines = source_writers.CSource()
+        for aName in allNames:
+            dispatch_defines.addLines('#define ' + aName + ' ((YogiFn_' +\
+                                      aName + ') yogiSymbol(YOGI_SYM_' +\
+                                      aName + ', "' + aName + '"))')
+        dispatch_header.merge(dispatch_types, 'YOGI_DISPATCH_TYPES')
+        dispatch_header.merge(dispatch_defines, 'YOGI_DISPATCH_DEFINES')
+        dispatch_header.writeFile('yogimpi_dispatch.h')
+
     # Writes the actual header file for YogiMPI.
     def writeCHeader(self):
         c_header = source_writers.CSource(inputFile='yogimpi.h.in')
@@ -739,6 +851,9 @@ class GenerateWrap(object):
         set_version.addLines('#define YogiMPI_VERSION_STR "' + self.yogimpiVersion + '"',
                              '#define YogiMPI_VERSION ' + majorVersion,
                              '#define YogiMPI_SUBVERSION ' + minorVersion)
+        status_layout = source_writers.CSource()
+        aligned = '1' if self.statusLayout == 'aligned' else '0'
+        status_layout.addLines('#define YogiMPI_STATUS_ALIGNED ' + aligned)
         func_protos = source_writers.CSource()
         for aFunc in self.functions:
             name = self.prefix + aFunc.name
@@ -746,6 +861,7 @@ class GenerateWrap(object):
             func_protos.addPrototype(name, aFunc.return_type, arg_string)
             func_protos.newLine()
         c_header.merge(set_version, 'SET_VERSION')
+        c_header.merge(status_layout, 'STATUS_LAYOUT')
         c_header.merge(func_protos, 'YOGI_PROTOTYPES')
         c_header.writeFile('yogimpi.h')
 
@@ -774,10 +890,15 @@ class GenerateWrap(object):
                 varDecl = anArg.mpi_type + ' ' + anArg.mpi_name
                 # Declare it now, to be put on the stack.
                 sourceFile.addLines(varDecl + ';')
+            elif anArg.dims and anArg.cache_side is not None:
+                self._cachedArray(sourceFile, anArg)
+                return
+            elif anArg.dims:
+                # The size of the conversion array is only known at runtime.
+                self._scratchArray(sourceFile, anArg)
             else:
-                # The conversion array must be allocated because the size will
-                # not be known until runtime. Plus you don't want the stack
-                # overflowing from vararg-sized arrays, so use the heap.
+                # Leave it to _makeMPIConversion to report the missing
+                # dimensions.
                 varDecl = anArg.mpi_type + ' * ' + anArg.mpi_name
                 sourceFile.addLines(varDecl + ' = NULL;')
             if anArg.is_input:
@@ -853,16 +974,121 @@ class GenerateWrap(object):
                         self._makeMPIConversion(sourceFile, anArg, before=False)
                     except ValueError as v:
                         print(funcException + str(v))
-            elif anArg.is_input and anArg.is_plural:
-                stripType = anArg.mpi_type.replace('MPI_', '')
-                freeFunc = GenerateWrap.manPrefix + 'free' + stripType
-                sourceFile.addLines(freeFunc + '(' + anArg.mpi_name + ');')
+
+    ## Returns the C++ identifier of a function's profiler and trace id.
+    def _functionId(self, name):
+        return 'YOGI_ID_' + name
+
+    ## Returns the scalar (not pointer, not array) arguments of a function
+    #  by name.
+    def _scalarArgs(self, aFunc):
+        scalars = {}
+        for anArg in aFunc.args:
+            if not anArg.is_pointer and not anArg.is_plural:
+                scalars[anArg.name] = anArg
+        return scalars
+
+    ## Returns an expression for the bytes a call moves, from its first
+    #  scalar count and datatype pair, or 0 if it has none.
+    def _messageBytes(self, aFunc):
+        scalars = self._scalarArgs(aFunc)
+        argNames = [anArg.name for anArg in aFunc.args]
+        for countName, typeName in GenerateWrap.sizeArgs:
+            countArg = scalars.get(countName)
+            typeArg = scalars.get(typeName)
+            if countArg is None or typeArg is None:
+                continue
+            if countArg.type != 'int' or typeArg.type != 'MPI_Datatype':
+                continue
+            count = countArg.call_name
+            if countName == 'sendcount' and 'sendbuf' in argNames:
+                # MPI ignores the send arguments for MPI_IN_PLACE.
+                count = '(sendbuf == MPI_IN_PLACE ? 0 : ' + count + ')'
+            return GenerateWrap.manPrefix + 'messageBytes(mpi_error, ' +\
+                   count + ', ' + typeArg.mpi_name + ')'
+        return '0'
+
+    ## Returns the trace call for entering a function, with the peer, tag
+    #  and communicator it was given, or -1 for those it does not take.
+    def _traceEnterCall(self, aFunc):
+        scalars = self._scalarArgs(aFunc)
+        values = []
+        for candidates in [GenerateWrap.peerArgs, GenerateWrap.tagArgs]:
+            value = '-1'
+            for argName in candidates:
+                anArg = scalars.get(argName)
+                if anArg is not None and anArg.type == 'int':
+                    value = anArg.call_name
+                    break
+            values.append(value)
+        commArg = scalars.get('comm')
+        if commArg is not None and commArg.type == 'MPI_Comm':
+            values.append(commArg.call_name)
+        else:
+            values.append('-1')
+        return GenerateWrap.manPrefix + 'tracer.enter(' +\
+               self._functionId(aFunc.name) + ', ' + ', '.join(values) + ');'
+
+    ## Writes the MPI call of a wrapper, or what replaces it.  An "instead"
+    #  condition guards the call.  An "emulate" expression replaces it when
+    #  the MPI is too old to have the function, and otherwise when the
+    #  application asks for YogiMPI's emulation at run time.
+    #  @param status The MPI status argument of this branch, if any.
+    def _callLines(self, sourceFile, aFunc, callString, status=None):
+        emulateCode = aFunc.getBlock('emulate')
+        if emulateCode is not None:
+            emulation = ' '.join(line.strip() for line in emulateCode)
+            emulation = 'mpi_error = ' +\
+                        emulation.replace('{manPrefix}',
+                                          GenerateWrap.manPrefix) + ';'
+            if aFunc.emulated:
+                sourceFile.addLines(emulation)
+                return
+            sourceFile.addIf(GenerateWrap.manPrefix + 'scheduler.emulating')
+            sourceFile.addLines(emulation)
+            sourceFile.endIf()
+            sourceFile.addElse()
+            sourceFile.addLines(callString)
+            sourceFile.endElse()
+            return
+        insteadCode = aFunc.getBlock('instead')
+        if insteadCode is not None:
+            condition = ' '.join(line.strip() for line in insteadCode)
+            condition = condition.replace('{manPrefix}',
+                                          GenerateWrap.manPrefix)
+            if status is not None:
+                condition = condition.replace('{status}', status)
+            sourceFile.addIf('!(' + condition + ')')
+        sourceFile.addLines(callString)
+        if insteadCode is not None:
+            sourceFile.endIf()
 
     ## Writes the internal C++ source file for YogiMPI.
     def writeCXXSource(self):
         cxx_source = source_writers.CSource(inputFile='yogimpi.cxx.in')
         yogi_functions = source_writers.CSource()
 
+        # Every function gets an id, used to index the profiler and trace
+        # tables, and a name for reports.
+        function_ids = source_writers.CSource()
+        allNames = GenerateWrap.handWrittenFunctions +\
+                   [aFunc.name for aFunc in self.functions]
+        function_ids.addLines('enum YogiFunctionId {')
+        function_ids.addIndent()
+        for aName in allNames:
+            function_ids.addLines(self._functionId(aName) + ',')
+        function_ids.addLines('YOGI_NUM_FUNCTIONS')
+        function_ids.removeIndent()
+        function_ids.addLines('};')
+        function_ids.newLine()
+        function_ids.addLines('static const char * const ' +\
+                              'functionNames[YOGI_NUM_FUNCTIONS] = {')
+        function_ids.addIndent()
+        for aName in allNames:
+            function_ids.addLines('"' + aName + '",')
+        function_ids.removeIndent()
+        function_ids.addLines('};')
+
         for aFunc in self.functions:
             aFunc.validate()
             for i, anArg in enumerate(aFunc.args):
@@ -881,10 +1107,12 @@ class GenerateWrap(object):
             name = self.prefix + aFunc.name
             arg_string = aFunc.cArgString()
             yogi_functions.addFunction(name, aFunc.return_type, arg_string)
-            writeDebug = "Entering " + name
+            if aFunc.name in GenerateWrap.preInitFunctions:
+                yogi_functions.addLines(GenerateWrap.preInitLocal)
+            else:
+                yogi_functions.addLines(GenerateWrap.manLocal)
             yogi_functions.addLinesNoIndent('#ifdef YOGI_DEBUG')
-            yogi_functions.addLines(GenerateWrap.manPrefix +\
-                                    'writeToDebugLog("' + writeDebug + '");')
+            yogi_functions.addLines(self._traceEnterCall(aFunc))
             yogi_functions.addLinesNoIndent('#endif')
             yogi_functions.addLines('int mpi_error;')
 
@@ -903,10 +1131,22 @@ class GenerateWrap(object):
                 for aLine in bcCode:
                     aLine = aLine.replace('{manPrefix}', GenerateWrap.manPrefix)
                     yogi_functions.addLines(aLine)
+            # callDepth only indents the debug log, and it is thread-local,
+            # so keep it out of release builds.
+            yogi_functions.addLinesNoIndent('#ifdef YOGI_DEBUG')
             yogi_functions.addLines(GenerateWrap.manPrefix + 'callDepth++;')
+            yogi_functions.addLinesNoIndent('#endif')
             for anArg in aFunc.args:
                 if anArg.type == 'MPI_Op':
                     yogi_functions.addLines(GenerateWrap.manPrefix + 'currentOp = ' + anArg.call_name + ';')
+            profiled = aFunc.name not in GenerateWrap.preInitFunctions
+            if profiled:
+                yogi_functions.addLinesNoIndent('#ifdef YOGI_PROFILE')
+                yogi_functions.addLines('long long profile_start = ' +\
+                                        GenerateWrap.manPrefix +\
+                                        'profiler.enabled ? ' +\
+                                        'YogiProfiler::now() : 0;')
+                yogi_functions.addLinesNoIndent('#endif')
 
             withoutIgnore = self._mpiCallString(aFunc, False)
             if aFunc.status_ignore:
@@ -918,18 +1158,34 @@ class GenerateWrap(object):
                 ignoreCallName = ignoreArg.name.strip('[]')
                 yogi_functions.addIf(ignoreCallName + ' == ' + self.prefix +\
                                      ignoreType)
-                yogi_functions.addLines(withIgnore)
+                self._callLines(yogi_functions, aFunc, withIgnore,
+                                ignoreType)
                 yogi_functions.endIf()
                 yogi_functions.addElse()
                 self._statusOutputLines(yogi_functions, aFunc, 'input')
-                yogi_functions.addLines(withoutIgnore)
+                self._callLines(yogi_functions, aFunc, withoutIgnore,
+                                ignoreArg.mpi_name)
                 self._statusOutputLines(yogi_functions, aFunc, 'output')
                 yogi_functions.endElse()
             else:
-                yogi_functions.addLines(withoutIgnore)
+                self._callLines(yogi_functions, aFunc, withoutIgnore)
+
+            if profiled:
+                yogi_functions.addLinesNoIndent('#ifdef YOGI_PROFILE')
+                yogi_functions.addIf(GenerateWrap.manPrefix +\
+                                     'profiler.enabled')
+                yogi_functions.addLines(GenerateWrap.manPrefix +\
+                                        'profiler.record(' +\
+                                        self._functionId(aFunc.name) +\
+                                        ', profile_start, ' +\
+                                        self._messageBytes(aFunc) + ');')
+                yogi_functions.endIf()
+                yogi_functions.addLinesNoIndent('#endif')
 
             # Write a code block marked as "aftercall"
+            yogi_functions.addLinesNoIndent('#ifdef YOGI_DEBUG')
             yogi_functions.addLines(GenerateWrap.manPrefix + 'callDepth--;')
+            yogi_functions.addLinesNoIndent('#endif')
             afterCode = aFunc.getBlock('aftercall')
             if afterCode is not None:
                 for aLine in afterCode:
@@ -946,15 +1202,17 @@ class GenerateWrap(object):
                     aLine = aLine.replace('{manPrefix}', GenerateWrap.manPrefix)
                     yogi_functions.addLines(aLine)
 
-            writeDebug = "Exiting " + name
             yogi_functions.addLinesNoIndent('#ifdef YOGI_DEBUG')
-            yogi_functions.addLines(GenerateWrap.manPrefix +\
-                                    'writeToDebugLog("' + writeDebug + '");')
+            yogi_functions.addLines(GenerateWrap.manPrefix + 'tracer.exit(' +\
+                                    self._functionId(aFunc.name) + ', ' +\
+                                    self._messageBytes(aFunc) +\
+                                    ', mpi_error);')
             yogi_functions.addLinesNoIndent('#endif')
             errorConv = GenerateWrap.manPrefix + 'errorToYogi'
             yogi_functions.addLines('return ' + errorConv + '(mpi_error);')
             yogi_functions.endFunction(name)
             yogi_functions.newLine()
+        cxx_source.merge(function_ids, 'YOGI_FUNCTION_IDS')
         cxx_source.merge(yogi_functions, 'YOGI_FUNCTIONS')
         cxx_source.writeFile('yogimpi.cxx')
 
@@ -978,5 +1236,8 @@ if __name__ == '__main__':
     parser.add_argument('inputfile', help='The input xml file')
     parser.add_argument('--mpiver', required=True, help='MPI version to support (2.1, 2.2, 3.0)')
     parser.add_argument('--version', required=True, help='The version of YogiMPI')
+    parser.add_argument('--status-layout', default='compact',
+                        choices=['compact', 'aligned'],
+                        help='YogiMPI_Status layout (aligned changes the ABI)')
     args = parser.parse_args()
-    GenerateWrap(args.inputfile, args.mpiver, args.version)
+    GenerateWrap(args.inputfile, args.mpiver, args.version, args.status_layout)
@@ -0,0 +1,774 @@
+/*
+                                  COPYRIGHT
+
+ The following is a notice of limited availability of the code, and disclaimer
+ which must be included in the prologue of the code and in all source listings
+ of the code.
+
+ Copyright Notice
+  + 2002 University of Chicago
+  + 2016 Stephen Adamec
+
+ Permission is hereby granted to use, reproduce, prepare derivative works, and
+ to redistribute to others.  This software was authored by:
+
+ Mathematics and Computer Science Division
+ Argonne National Laboratory, Argonne IL 60439
+
+ (and)
+
+ Department of Computer Science
+ University of Illinois at Urbana-Champaign
+
+ (and)
+
+ Stephen Adamec
+
+                              GOVERNMENT LICENSE
+
+ Portions of this material resulted from work developed under a U.S.
+ Government Contract and are subject to the following license: the Government
+ is granted for itself and others acting on its behalf a paid-up, nonexclusive,
+ irrevocable worldwide license in this computer software to reproduce, prepare
+ derivative works, and perform publicly and display publicly.
+
+                                    DISCLAIMER
+
+ This computer code material was prepared, in part, as an account of work
+ sponsored by an agency of the United States Government.  Neither the United
+ States, nor the University of Chicago, nor any of their employees, makes any
+ warranty express or implied, or assumes any legal liability or responsibility
+ for the accuracy, completeness, or usefulness of any information, apparatus,
+ product, or process disclosed, or represents that its use would not infringe
+ privately owned rights.
+*/
+
+#include "yogimpi.h"
+
+#ifndef MPITOYOGI_H
+#define MPITOYOGI_H
+
+#define MPI_VERSION YogiMPI_VERSION
+#define MPI_SUBVERSION YogiMPI_SUBVERSION
+
+#define MPI_Group YogiMPI_Group
+#define MPI_Comm YogiMPI_Comm
+#define MPI_Datatype YogiMPI_Datatype
+#define MPI_Request YogiMPI_Request
+#define MPI_Op YogiMPI_Op
+#define MPI_Info YogiMPI_Info
+#define MPI_File YogiMPI_File
+#define MPI_Errhandler YogiMPI_Errhandler
+#define MPI_Win YogiMPI_Win
+#if YogiMPI_VERSION == 3
+#define MPI_Message YogiMPI_Message
+
+#define MPI_MESSAGE_NO_PROC YogiMPI_MESSAGE_NO_PROC
+#endif
+
+#define MPI_SUCCESS YogiMPI_SUCCESS
+#define MPI_ERR_BUFFER YogiMPI_ERR_BUFFER
+#define MPI_ERR_COUNT YogiMPI_ERR_COUNT
+#define MPI_ERR_TYPE YogiMPI_ERR_TYPE
+#define MPI_ERR_TAG YogiMPI_ERR_TAG
+#define MPI_ERR_COMM YogiMPI_ERR_COMM
+#define MPI_ERR_RANK YogiMPI_ERR_RANK
+#define MPI_ERR_REQUEST YogiMPI_ERR_REQUEST
+#define MPI_ERR_ROOT YogiMPI_ERR_ROOT
+#define MPI_ERR_GROUP YogiMPI_ERR_GROUP
+#define MPI_ERR_OP YogiMPI_ERR_OP
+#define MPI_ERR_TOPOLOGY YogiMPI_ERR_TOPOLOGY
+#define MPI_ERR_DIMS YogiMPI_ERR_DIMS
+#define MPI_ERR_ARG YogiMPI_ERR_ARG
+#define MPI_ERR_UNKNOWN YogiMPI_ERR_UNKNOWN
+#define MPI_ERR_TRUNCATE YogiMPI_ERR_TRUNCATE
+#define MPI_ERR_OTHER YogiMPI_ERR_OTHER
+#define MPI_ERR_INTERN YogiMPI_ERR_INTERN
+#define MPI_ERR_PENDING YogiMPI_ERR_PENDING
+#define MPI_ERR_IN_STATUS YogiMPI_ERR_IN_STATUS
+
+#define MPI_ERR_FILE YogiMPI_ERR_FILE
+#define MPI_ERR_NOT_SAME YogiMPI_ERR_NOT_SAME
+#define MPI_ERR_AMODE YogiMPI_ERR_AMODE
+#define MPI_ERR_UNSUPPORTED_DATAREP YogiMPI_ERR_UNSUPPORTED_DATAREP
+#define MPI_ERR_UNSUPPORTED_OPERATION YogiMPI_ERR_UNSUPPORTED_OPERATION
+#define MPI_ERR_NO_SUCH_FILE YogiMPI_ERR_NO_SUCH_FILE
+#define MPI_ERR_FILE_EXISTS YogiMPI_ERR_FILE_EXISTS
+#define MPI_ERR_BAD_FILE YogiMPI_ERR_BAD_FILE
+#define MPI_ERR_ACCESS YogiMPI_ERR_ACCESS
+#define MPI_ERR_NO_SPACE YogiMPI_ERR_NO_SPACE
+#define MPI_ERR_QUOTA YogiMPI_ERR_QUOTA
+#define MPI_ERR_READ_ONLY YogiMPI_ERR_READ_ONLY
+#define MPI_ERR_FILE_IN_USE YogiMPI_ERR_FILE_IN_USE
+#define MPI_ERR_DUP_DATAREP YogiMPI_ERR_DUP_DATAREP
+#define MPI_ERR_CONVERSION YogiMPI_ERR_CONVERSION
+#define MPI_ERR_IO YogiMPI_ERR_IO
+#define MPI_ERR_INFO YogiMPI_ERR_INFO
+#define MPI_ERR_INFO_KEY YogiMPI_ERR_INFO_KEY
+#define MPI_ERR_INFO_VALUE YogiMPI_ERR_INFO_VALUE
+#define MPI_ERR_INFO_NOKEY YogiMPI_ERR_INFO_NOKEY
+#define MPI_ERR_NAME YogiMPI_ERR_NAME
+#define MPI_ERR_NO_MEM YogiMPI_ERR_NO_MEM
+#define MPI_ERR_PORT YogiMPI_ERR_PORT
+#define MPI_ERR_SERVICE YogiMPI_ERR_SERVICE
+#define MPI_ERR_SPAWN YogiMPI_ERR_SPAWN
+#define MPI_ERR_WIN YogiMPI_ERR_WIN
+#define MPI_ERR_KEYVAL YogiMPI_ERR_KEYVAL
+#define MPI_ERR_BASE YogiMPI_ERR_BASE
+#define MPI_ERR_LOCKTYPE YogiMPI_ERR_LOCKTYPE
+#define MPI_ERR_RMA_CONFLICT YogiMPI_ERR_RMA_CONFLICT
+#define MPI_ERR_RMA_SYNC YogiMPI_ERR_RMA_SYNC
+#define MPI_ERR_SIZE YogiMPI_ERR_SIZE
+#define MPI_ERR_DISP YogiMPI_ERR_DISP
+#define MPI_ERR_ASSERT YogiMPI_ERR_ASSERT
+#define MPI_ERR_LASTCODE YogiMPI_ERR_LASTCODE
+
+#define MPI_BOTTOM YogiMPI_BOTTOM
+
+#define MPI_PROC_NULL YogiMPI_PROC_NULL
+#define MPI_ROOT YogiMPI_ROOT
+#define MPI_ANY_SOURCE YogiMPI_ANY_SOURCE
+#define MPI_ANY_TAG YogiMPI_ANY_TAG
+#define MPI_UNDEFINED YogiMPI_UNDEFINED
+#define MPI_BSEND_OVERHEAD YogiMPI_BSEND_OVERHEAD
+#define MPI_KEYVAL_INVALID YogiMPI_KEYVAL_INVALID
+
+/* Dist graph create constants */
+#define MPI_WEIGHTS_EMPTY YogiMPI_WEIGHTS_EMPTY
+#define MPI_UNWEIGHTED YogiMPI_UNWEIGHTED
+
+#define MPI_MODE_NOCHECK YogiMPI_MODE_NOCHECK
+#define MPI_MODE_NOSTORE YogiMPI_MODE_NOSTORE
+#define MPI_MODE_NOPUT YogiMPI_MODE_NOPUT
+#define MPI_MODE_NOPRECEDE YogiMPI_MODE_NOPRECEDE
+#define MPI_MODE_NOSUCCEED YogiMPI_MODE_NOSUCCEED
+
+#define MPI_SEEK_SET YogiMPI_SEEK_SET
+#define MPI_SEEK_CUR YogiMPI_SEEK_CUR
+#define MPI_SEEK_END YogiMPI_SEEK_END
+
+#define MPI_TYPECLASS_REAL YogiMPI_TYPECLASS_REAL
+#define MPI_TYPECLASS_INTEGER YogiMPI_TYPECLASS_INTEGER
+#define MPI_TYPECLASS_COMPLEX YogiMPI_TYPECLASS_COMPLEX
+
+#define MPI_MODE_RDONLY YogiMPI_MODE_RDONLY
+#define MPI_MODE_RDWR YogiMPI_MODE_RDWR
+#define MPI_MODE_WRONLY YogiMPI_MODE_WRONLY
+#define MPI_MODE_CREATE YogiMPI_MODE_CREATE
+#define MPI_MODE_EXCL YogiMPI_MODE_EXCL
+#define MPI_MODE_DELETE_ON_CLOSE YogiMPI_MODE_DELETE_ON_CLOSE
+#define MPI_MODE_UNIQUE_OPEN YogiMPI_MODE_UNIQUE_OPEN
+#define MPI_MODE_SEQUENTIAL YogiMPI_MODE_SEQUENTIAL
+#define MPI_MODE_APPEND YogiMPI_MODE_APPEND
+
+#define MPI_DISPLACEMENT_CURRENT YogiMPI_DISPLACEMENT_CURRENT
+
+#define MPI_MAX_INFO_KEY YogiMPI_MAX_INFO_KEY
+#define MPI_MAX_INFO_VAL YogiMPI_MAX_INFO_VAL
+
+#define MPI_ORDER_C YogiMPI_ORDER_C
+#define MPI_ORDER_FORTRAN YogiMPI_ORDER_FORTRAN
+#define MPI_DISTRIBUTE_BLOCK YogiMPI_DISTRIBUTE_BLOCK
+#define MPI_DISTRIBUTE_CYCLIC YogiMPI_DISTRIBUTE_CYCLIC
+#define MPI_DISTRIBUTE_NONE YogiMPI_DISTRIBUTE_NONE
+#define MPI_DISTRIBUTE_DFLT_DARG YogiMPI_DISTRIBUTE_DFLT_DARG
+
+#define MPI_MAX_PROCESSOR_NAME YogiMPI_MAX_PROCESSOR_NAME
+#define MPI_MAX_ERROR_STRING YogiMPI_MAX_ERROR_STRING
+#define MPI_MAX_PORT_NAME YogiMPI_MAX_PORT_NAME
+#define MPI_MAX_OBJECT_NAME YogiMPI_MAX_OBJECT_NAME
+#define MPI_MAX_DATAREP_STRING YogiMPI_MAX_DATAREP_STRING
+
+#define MPI_CHAR YogiMPI_CHAR
+#define MPI_SHORT YogiMPI_SHORT
+#define MPI_INT YogiMPI_INT
+#define MPI_LONG YogiMPI_LONG
+#define MPI_UNSIGNED_CHAR YogiMPI_UNSIGNED_CHAR
+#define MPI_UNSIGNED_SHORT YogiMPI_UNSIGNED_SHORT
+#define MPI_UNSIGNED YogiMPI_UNSIGNED
+#define MPI_UNSIGNED_LONG YogiMPI_UNSIGNED_LONG
+#define MPI_FLOAT YogiMPI_FLOAT
+#define MPI_DOUBLE YogiMPI_DOUBLE
+#define MPI_LONG_DOUBLE YogiMPI_LONG_DOUBLE
+#define MPI_BYTE YogiMPI_BYTE
+#define MPI_PACKED YogiMPI_PACKED
+
+#define MPI_FLOAT_INT YogiMPI_FLOAT_INT
+#define MPI_DOUBLE_INT YogiMPI_DOUBLE_INT
+#define MPI_LONG_INT YogiMPI_LONG_INT
+#define MPI_2INT YogiMPI_2INT
+#define MPI_SHORT_INT YogiMPI_SHORT_INT
+#define MPI_LONG_DOUBLE_INT YogiMPI_LONG_DOUBLE_INT
+#define MPI_SIGNED_CHAR YogiMPI_SIGNED_CHAR
+#define MPI_WCHAR YogiMPI_WCHAR
+
+#define MPI_C_BOOL YogiMPI_C_BOOL
+#define MPI_C_FLOAT_COMPLEX YogiMPI_C_FLOAT_COMPLEX
+#define MPI_C_COMPLEX YogiMPI_C_COMPLEX
+#define MPI_C_DOUBLE_COMPLEX YogiMPI_C_DOUBLE_COMPLEX
+#define MPI_C_LONG_DOUBLE_COMPLEX YogiMPI_C_LONG_DOUBLE_COMPLEX
+
+#if YogiMPI_VERSION == 3
+#define MPI_CXX_BOOL YogiMPI_CXX_BOOL
+#define MPI_CXX_FLOAT_COMPLEX YogiMPI_CXX_FLOAT_COMPLEX
+#define MPI_CXX_DOUBLE_COMPLEX YogiMPI_CXX_DOUBLE_COMPLEX
+#define MPI_CXX_LONG_DOUBLE_COMPLEX YogiMPI_CXX_LONG_DOUBLE_COMPLEX
+#endif
+
+#define MPI_LONG_LONG_INT YogiMPI_LONG_LONG_INT
+#define MPI_INT8_T YogiMPI_INT8_T
+#define MPI_INT16_T YogiMPI_INT16_T
+#define MPI_INT32_T YogiMPI_INT32_T
+#define MPI_INT64_T YogiMPI_INT64_T
+#define MPI_UINT8_T YogiMPI_UINT8_T
+#define MPI_UINT16_T YogiMPI_UINT16_T
+#define MPI_UINT32_T YogiMPI_UINT32_T
+#define MPI_UINT64_T YogiMPI_UINT64_T
+
+#define MPI_LONG_LONG YogiMPI_LONG_LONG
+
+#define MPI_COMPLEX YogiMPI_COMPLEX
+#define MPI_DOUBLE_COMPLEX YogiMPI_DOUBLE_COMPLEX
+#define MPI_LOGICAL YogiMPI_LOGICAL
+#define MPI_2REAL YogiMPI_2REAL
+#define MPI_2DOUBLE_PRECISION YogiMPI_2DOUBLE_PRECISION
+#define MPI_2INTEGER YogiMPI_2INTEGER
+#define MPI_INTEGER1 YogiMPI_INTEGER1
+#define MPI_INTEGER2 YogiMPI_INTEGER2
+#define MPI_INTEGER4 YogiMPI_INTEGER4
+#define MPI_INTEGER8 YogiMPI_INTEGER8
+#define MPI_REAL4 YogiMPI_REAL4
+#define MPI_REAL8 YogiMPI_REAL8
+#define MPI_UNSIGNED_LONG_LONG YogiMPI_UNSIGNED_LONG_LONG
+
+#define MPI_CHARACTER YogiMPI_CHARACTER
+#define MPI_INTEGER YogiMPI_INTEGER
+#define MPI_REAL YogiMPI_REAL
+#define MPI_DOUBLE_PRECISION YogiMPI_DOUBLE_PRECISION
+
+#define MPI_UB YogiMPI_UB
+#define MPI_LB YogiMPI_LB
+
+#define MPI_SIGNED_CHAR YogiMPI_SIGNED_CHAR
+
+#define MPI_AINT YogiMPI_AINT
+#define MPI_OFFSET YogiMPI_OFFSET
+#if YogiMPI_VERSION == 3
+#define MPI_COUNT YogiMPI_COUNT
+#endif
+
+#define MPI_COMM_WORLD YogiMPI_COMM_WORLD
+#define MPI_COMM_SELF YogiMPI_COMM_SELF
+
+#define MPI_IDENT YogiMPI_IDENT
+#define MPI_CONGRUENT YogiMPI_CONGRUENT
+#define MPI_SIMILAR YogiMPI_SIMILAR
+#define MPI_UNEQUAL YogiMPI_UNEQUAL
+
+#define MPI_TAG_UB YogiMPI_TAG_UB
+#define MPI_IO YogiMPI_IO
+#define MPI_HOST YogiMPI_HOST
+#define MPI_WTIME_IS_GLOBAL YogiMPI_WTIME_IS_GLOBAL
+#define MPI_APPNUM YogiMPI_APPNUM
+
+#define MPI_WIN_BASE YogiMPI_WIN_BASE
+#define MPI_WIN_SIZE YogiMPI_WIN_SIZE
+#define MPI_WIN_DISP_UNIT YogiMPI_WIN_DISP_UNIT
+
+#define MPI_MAX YogiMPI_MAX
+#define MPI_MIN YogiMPI_MIN
+#define MPI_SUM YogiMPI_SUM
+#define MPI_PROD YogiMPI_PROD
+#define MPI_MAXLOC YogiMPI_MAXLOC
+#define MPI_MINLOC YogiMPI_MINLOC
+#define MPI_BAND YogiMPI_BAND
+#define MPI_BOR YogiMPI_BOR
+#define MPI_BXOR YogiMPI_BXOR
+#define MPI_LAND YogiMPI_LAND
+#define MPI_LOR YogiMPI_LOR
+#define MPI_LXOR YogiMPI_LXOR
+#define MPI_REPLACE YogiMPI_REPLACE
+#define MPI_NO_OP YogiMPI_NO_OP
+
+#define MPI_GROUP_NULL YogiMPI_GROUP_NULL
+#define MPI_COMM_NULL YogiMPI_COMM_NULL
+#define MPI_DATATYPE_NULL YogiMPI_DATATYPE_NULL
+#define MPI_REQUEST_NULL YogiMPI_REQUEST_NULL
+#define MPI_OP_NULL YogiMPI_OP_NULL
+#define MPI_INFO_NULL YogiMPI_INFO_NULL
+#define MPI_FILE_NULL YogiMPI_FILE_NULL
+#define MPI_ERRHANDLER_NULL YogiMPI_ERRHANDLER_NULL
+#define MPI_WIN_NULL YogiMPI_WIN_NULL
+#if YogiMPI_VERSION == 3
+#define MPI_MESSAGE_NULL YogiMPI_MESSAGE_NULL
+#endif
+
+#define MPI_ERRORS_ARE_FATAL YogiMPI_ERRORS_ARE_FATAL
+#define MPI_ERRORS_RETURN YogiMPI_ERRORS_RETURN
+
+#define MPI_GROUP_EMPTY YogiMPI_GROUP_EMPTY
+
+#define MPI_MAX_LIBRARY_VERSION_STRING YogiMPI_MAX_LIBRARY_VERSION_STRING
+
+#define MPI_THREAD_SINGLE YogiMPI_THREAD_SINGLE
+#define MPI_THREAD_FUNNELED YogiMPI_THREAD_FUNNELED
+#define MPI_THREAD_SERIALIZED YogiMPI_THREAD_SERIALIZED
+#define MPI_THREAD_MULTIPLE YogiMPI_THREAD_MULTIPLE
+
+#define MPI_LOCK_EXCLUSIVE YogiMPI_LOCK_EXCLUSIVE
+#define MPI_LOCK_SHARED YogiMPI_LOCK_SHARED
+
+#define MPI_GRAPH YogiMPI_GRAPH
+#define MPI_CART YogiMPI_CART
+#define MPI_DIST_GRAPH YogiMPI_DIST_GRAPH
+
+#define MPI_COMBINER_NAMED YogiMPI_COMBINER_NAMED
+#define MPI_COMBINER_DUP YogiMPI_COMBINER_DUP
+#define MPI_COMBINER_CONTIGUOUS YogiMPI_COMBINER_CONTIGUOUS
+#define MPI_COMBINER_VECTOR YogiMPI_COMBINER_VECTOR
+#define MPI_COMBINER_HVECTOR_INTEGER YogiMPI_COMBINER_HVECTOR_INTEGER
+#define MPI_COMBINER_HVECTOR YogiMPI_COMBINER_HVECTOR
+#define MPI_COMBINER_INDEXED YogiMPI_COMBINER_INDEXED
+#define MPI_COMBINER_HINDEXED_INTEGER YogiMPI_COMBINER_HINDEXED_INTEGER
+#define MPI_COMBINER_HINDEXED YogiMPI_COMBINER_HINDEXED
+#define MPI_COMBINER_INDEXED_BLOCK YogiMPI_COMBINER_INDEXED_BLOCK
+#define MPI_COMBINER_STRUCT_INTEGER YogiMPI_COMBINER_STRUCT_INTEGER
+#define MPI_COMBINER_STRUCT YogiMPI_COMBINER_STRUCT
+#define MPI_COMBINER_SUBARRAY YogiMPI_COMBINER_SUBARRAY
+#define MPI_COMBINER_DARRAY YogiMPI_COMBINER_DARRAY
+#define MPI_COMBINER_F90_REAL YogiMPI_COMBINER_F90_REAL
+#define MPI_COMBINER_F90_COMPLEX YogiMPI_COMBINER_F90_COMPLEX
+#define MPI_COMBINER_F90_INTEGER YogiMPI_COMBINER_F90_INTEGER
+#define MPI_COMBINER_RESIZED YogiMPI_COMBINER_RESIZED
+
+#define MPI_COMM_TYPE_SHARED YogiMPI_COMM_TYPE_SHARED
+
+#define MPI_ERRCODES_IGNORE YogiMPI_ERRCODES_IGNORE
+
+#define MPI_Status YogiMPI_Status
+#define MPI_STATUS_IGNORE YogiMPI_STATUS_IGNORE
+#define MPI_STATUSES_IGNORE YogiMPI_STATUSES_IGNORE
+
+#define MPI_Aint YogiMPI_Aint
+
+#define MPI_Offset YogiMPI_Offset
+
+#define MPI_Fint YogiMPI_Fint
+
+#define MPI_IN_PLACE YogiMPI_IN_PLACE
+
+#define MPI_User_function YogiMPI_User_function
+#define MPI_Comm_errhandler_function YogiMPI_Comm_errhandler_function
+#define MPI_Copy_function YogiMPI_Copy_function
+#define MPI_Delete_function YogiMPI_Delete_function
+#define MPI_Handler_function YogiMPI_Handler_function
+#define MPI_Type_copy_attr_function YogiMPI_Type_copy_attr_function
+#define MPI_Type_delete_attr_function YogiMPI_Type_delete_attr_function
+#define MPI_Win_copy_attr_function YogiMPI_Win_copy_attr_function
+#define MPI_Win_delete_attr_function YogiMPI_Win_delete_attr_function
+#define MPI_File_errhandler_function YogiMPI_File_errhandler_function
+#define MPI_Win_errhandler_function YogiMPI_Win_errhandler_function
+#define MPI_Grequest_cancel_function YogiMPI_Grequest_cancel_function
+#define MPI_Grequest_free_function YogiMPI_Grequest_free_function
+#define MPI_Grequest_query_function YogiMPI_Grequest_query_function
+#define MPI_Datarep_conversion_function YogiMPI_Datarep_conversion_function
+#define MPI_Datarep_extent_function YogiMPI_Datarep_extent_function
+#define MPI_Comm_copy_attr_function YogiMPI_Comm_copy_attr_function
+#define MPI_Comm_delete_attr_function YogiMPI_Comm_delete_attr_function
+
+#define MPI_CONVERSION_FN_NULL YogiMPI_CONVERSION_FN_NULL
+#define MPI_NULL_COPY_FN YogiMPI_NULL_COPY_FN
+#define MPI_DUP_FN YogiMPI_DUP_FN
+#define MPI_NULL_DELETE_FN YogiMPI_NULL_DELETE_FN
+#define MPI_COMM_NULL_COPY_FN YogiMPI_COMM_NULL_COPY_FN
+#define MPI_COMM_DUP_FN YogiMPI_COMM_DUP_FN
+#define MPI_COMM_NULL_DELETE_FN YogiMPI_COMM_NULL_DELETE_FN
+#define MPI_WIN_NULL_COPY_FN YogiMPI_WIN_NULL_COPY_FN
+#define MPI_WIN_NULL_DELETE_FN YogiMPI_WIN_NULL_DELETE_FN
+#define MPI_WIN_DUP_FN YogiMPI_WIN_DUP_FN
+
+
+// Handle hard-coded functions
+#define MPI_Comm_spawn YogiMPI_Comm_spawn
+#define MPI_Init YogiMPI_Init
+#define MPI_Init_thread YogiMPI_Init_thread
+#define MPI_Error_class YogiMPI_Error_class
+#define MPI_Error_string YogiMPI_Error_string
+#define MPI_Finalize YogiMPI_Finalize
+#define MPI_Get_processor_name YogiMPI_Get_processor_name
+#define MPI_Type_get_contents YogiMPI_Type_get_contents
+#define MPI_Type_create_darray YogiMPI_Type_create_darray
+#define MPI_Wtick YogiMPI_Wtick
+#define MPI_Wtime YogiMPI_Wtime
+#define MPI_Comm_c2f YogiMPI_Comm_c2f
+#define MPI_Comm_f2c YogiMPI_Comm_f2c
+#define MPI_Errhandler_c2f YogiMPI_Errhandler_c2f
+#define MPI_Errhandler_f2c YogiMPI_Errhandler_f2c
+#define MPI_File_c2f YogiMPI_File_c2f
+#define MPI_File_f2c YogiMPI_File_f2c
+#define MPI_Group_c2f YogiMPI_Group_c2f
+#define MPI_Group_f2c YogiMPI_Group_f2c
+#define MPI_Info_c2f YogiMPI_Info_c2f
+#define MPI_Info_f2c YogiMPI_Info_f2c
+#define MPI_Op_c2f YogiMPI_Op_c2f
+#define MPI_Op_f2c YogiMPI_Op_f2c
+#define MPI_Request_c2f YogiMPI_Request_c2f
+#define MPI_Request_f2c YogiMPI_Request_f2c
+#define MPI_Status_f2c YogiMPI_Status_f2c
+#define MPI_Status_c2f YogiMPI_Status_c2f
+#define MPI_Type_c2f YogiMPI_Type_c2f
+#define MPI_Type_f2c YogiMPI_Type_f2c
+#define MPI_Win_c2f YogiMPI_Win_c2f
+#define MPI_Win_f2c YogiMPI_Win_f2c
+#if YogiMPI_VERSION == 3
+#define MPI_Count YogiMPI_Count
+#endif
+
+// Begin automatically generated code
+#define MPI_Abort YogiMPI_Abort
+#define MPI_Accumulate YogiMPI_Accumulate
+#define MPI_Add_error_class YogiMPI_Add_error_class
+#define MPI_Add_error_code YogiMPI_Add_error_code
+#define MPI_Add_error_string YogiMPI_Add_error_string
+#define MPI_Address YogiMPI_Address
+#define MPI_Allgather YogiMPI_Allgather
+#define MPI_Allgatherv YogiMPI_Allgatherv
+#define MPI_Alloc_mem YogiMPI_Alloc_mem
+#define MPI_Allreduce YogiMPI_Allreduce
+#define MPI_Alltoall YogiMPI_Alltoall
+#define MPI_Alltoallv YogiMPI_Alltoallv
+#define MPI_Alltoallw YogiMPI_Alltoallw
+#define MPI_Attr_delete YogiMPI_Attr_delete
+#define MPI_Attr_get YogiMPI_Attr_get
+#define MPI_Attr_put YogiMPI_Attr_put
+#define MPI_Barrier YogiMPI_Barrier
+#define MPI_Bcast YogiMPI_Bcast
+#define MPI_Bsend YogiMPI_Bsend
+#define MPI_Bsend_init YogiMPI_Bsend_init
+#define MPI_Buffer_attach YogiMPI_Buffer_attach
+#define MPI_Buffer_detach YogiMPI_Buffer_detach
+#define MPI_Cancel YogiMPI_Cancel
+#define MPI_Cart_coords YogiMPI_Cart_coords
+#define MPI_Cart_create YogiMPI_Cart_create
+#define MPI_Cart_get YogiMPI_Cart_get
+#define MPI_Cart_map YogiMPI_Cart_map
+#define MPI_Cart_rank YogiMPI_Cart_rank
+#define MPI_Cart_shift YogiMPI_Cart_shift
+#define MPI_Cart_sub YogiMPI_Cart_sub
+#define MPI_Cartdim_get YogiMPI_Cartdim_get
+#define MPI_Close_port YogiMPI_Close_port
+#define MPI_Comm_accept YogiMPI_Comm_accept
+#define MPI_Comm_call_errhandler YogiMPI_Comm_call_errhandler
+#define MPI_Comm_compare YogiMPI_Comm_compare
+#define MPI_Comm_connect YogiMPI_Comm_connect
+#define MPI_Comm_create YogiMPI_Comm_create
+#define MPI_Comm_create_errhandler YogiMPI_Comm_create_errhandler
+#define MPI_Comm_create_group YogiMPI_Comm_create_group
+#define MPI_Comm_create_keyval YogiMPI_Comm_create_keyval
+#define MPI_Comm_delete_attr YogiMPI_Comm_delete_attr
+#define MPI_Comm_disconnect YogiMPI_Comm_disconnect
+#define MPI_Comm_dup YogiMPI_Comm_dup
+#define MPI_Comm_dup_with_info YogiMPI_Comm_dup_with_info
+#define MPI_Comm_free YogiMPI_Comm_free
+#define MPI_Comm_free_keyval YogiMPI_Comm_free_keyval
+#define MPI_Comm_get_attr YogiMPI_Comm_get_attr
+#define MPI_Comm_get_errhandler YogiMPI_Comm_get_errhandler
+#define MPI_Comm_get_info YogiMPI_Comm_get_info
+#define MPI_Comm_get_name YogiMPI_Comm_get_name
+#define MPI_Comm_get_parent YogiMPI_Comm_get_parent
+#define MPI_Comm_group YogiMPI_Comm_group
+#define MPI_Comm_idup YogiMPI_Comm_idup
+#define MPI_Comm_join YogiMPI_Comm_join
+#define MPI_Comm_rank YogiMPI_Comm_rank
+#define MPI_Comm_remote_group YogiMPI_Comm_remote_group
+#define MPI_Comm_remote_size YogiMPI_Comm_remote_size
+#define MPI_Comm_set_attr YogiMPI_Comm_set_attr
+#define MPI_Comm_set_errhandler YogiMPI_Comm_set_errhandler
+#define MPI_Comm_set_info YogiMPI_Comm_set_info
+#define MPI_Comm_set_name YogiMPI_Comm_set_name
+#define MPI_Comm_size YogiMPI_Comm_size
+#define MPI_Comm_split YogiMPI_Comm_split
+#define MPI_Comm_split_type YogiMPI_Comm_split_type
+#define MPI_Comm_test_inter YogiMPI_Comm_test_inter
+#define MPI_Compare_and_swap YogiMPI_Compare_and_swap
+#define MPI_Dims_create YogiMPI_Dims_create
+#define MPI_Dist_graph_create YogiMPI_Dist_graph_create
+#define MPI_Dist_graph_create_adjacent YogiMPI_Dist_graph_create_adjacent
+#define MPI_Dist_graph_neighbors YogiMPI_Dist_graph_neighbors
+#define MPI_Dist_graph_neighbors_count YogiMPI_Dist_graph_neighbors_count
+#define MPI_Errhandler_create YogiMPI_Errhandler_create
+#define MPI_Errhandler_free YogiMPI_Errhandler_free
+#define MPI_Errhandler_get YogiMPI_Errhandler_get
+#define MPI_Errhandler_set YogiMPI_Errhandler_set
+#define MPI_Exscan YogiMPI_Exscan
+#define MPI_Fetch_and_op YogiMPI_Fetch_and_op
+#define MPI_File_call_errhandler YogiMPI_File_call_errhandler
+#define MPI_File_close YogiMPI_File_close
+#define MPI_File_create_errhandler YogiMPI_File_create_errhandler
+#define MPI_File_delete YogiMPI_File_delete
+#define MPI_File_get_amode YogiMPI_File_get_amode
+#define MPI_File_get_atomicity YogiMPI_File_get_atomicity
+#define MPI_File_get_byte_offset YogiMPI_File_get_byte_offset
+#define MPI_File_get_errhandler YogiMPI_File_get_errhandler
+#define MPI_File_get_group YogiMPI_File_get_group
+#define MPI_File_get_info YogiMPI_File_get_info
+#define MPI_File_get_position YogiMPI_File_get_position
+#define MPI_File_get_position_shared YogiMPI_File_get_position_shared
+#define MPI_File_get_size YogiMPI_File_get_size
+#define MPI_File_get_type_extent YogiMPI_File_get_type_extent
+#define MPI_File_get_view YogiMPI_File_get_view
+#define MPI_File_iread YogiMPI_File_iread
+#define MPI_File_iread_at YogiMPI_File_iread_at
+#define MPI_File_iread_shared YogiMPI_File_iread_shared
+#define MPI_File_iwrite YogiMPI_File_iwrite
+#define MPI_File_iwrite_at YogiMPI_File_iwrite_at
+#define MPI_File_iwrite_shared YogiMPI_File_iwrite_shared
+#define MPI_File_open YogiMPI_File_open
+#define MPI_File_preallocate YogiMPI_File_preallocate
+#define MPI_File_read YogiMPI_File_read
+#define MPI_File_read_all YogiMPI_File_read_all
+#define MPI_File_read_all_begin YogiMPI_File_read_all_begin
+#define MPI_File_read_all_end YogiMPI_File_read_all_end
+#define MPI_File_read_at YogiMPI_File_read_at
+#define MPI_File_read_at_all YogiMPI_File_read_at_all
+#define MPI_File_read_at_all_begin YogiMPI_File_read_at_all_begin
+#define MPI_File_read_at_all_end YogiMPI_File_read_at_all_end
+#define MPI_File_read_ordered YogiMPI_File_read_ordered
+#define MPI_File_read_ordered_begin YogiMPI_File_read_ordered_begin
+#define MPI_File_read_ordered_end YogiMPI_File_read_ordered_end
+#define MPI_File_read_shared YogiMPI_File_read_shared
+#define MPI_File_seek YogiMPI_File_seek
+#define MPI_File_seek_shared YogiMPI_File_seek_shared
+#define MPI_File_set_atomicity YogiMPI_File_set_atomicity
+#define MPI_File_set_errhandler YogiMPI_File_set_errhandler
+#define MPI_File_set_info YogiMPI_File_set_info
+#define MPI_File_set_size YogiMPI_File_set_size
+#define MPI_File_set_view YogiMPI_File_set_view
+#define MPI_File_sync YogiMPI_File_sync
+#define MPI_File_write YogiMPI_File_write
+#define MPI_File_write_all YogiMPI_File_write_all
+#define MPI_File_write_all_begin YogiMPI_File_write_all_begin
+#define MPI_File_write_all_end YogiMPI_File_write_all_end
+#define MPI_File_write_at YogiMPI_File_write_at
+#define MPI_File_write_at_all YogiMPI_File_write_at_all
+#define MPI_File_write_at_all_begin YogiMPI_File_write_at_all_begin
+#define MPI_File_write_at_all_end YogiMPI_File_write_at_all_end
+#define MPI_File_write_ordered YogiMPI_File_write_ordered
+#define MPI_File_write_ordered_begin YogiMPI_File_write_ordered_begin
+#define MPI_File_write_ordered_end YogiMPI_File_write_ordered_end
+#define MPI_File_write_shared YogiMPI_File_write_shared
+#define MPI_Finalized YogiMPI_Finalized
+#define MPI_Free_mem YogiMPI_Free_mem
+#define MPI_Gather YogiMPI_Gather
+#define MPI_Gatherv YogiMPI_Gatherv
+#define MPI_Get YogiMPI_Get
+#define MPI_Get_accumulate YogiMPI_Get_accumulate
+#define MPI_Get_address YogiMPI_Get_address
+#define MPI_Get_count YogiMPI_Get_count
+#define MPI_Get_elements YogiMPI_Get_elements
+#define MPI_Get_elements_x YogiMPI_Get_elements_x
+#define MPI_Get_library_version YogiMPI_Get_library_version
+#define MPI_Get_version YogiMPI_Get_version
+#define MPI_Graph_create YogiMPI_Graph_create
+#define MPI_Graph_get YogiMPI_Graph_get
+#define MPI_Graph_map YogiMPI_Graph_map
+#define MPI_Graph_neighbors YogiMPI_Graph_neighbors
+#define MPI_Graph_neighbors_count YogiMPI_Graph_neighbors_count
+#define MPI_Graphdims_get YogiMPI_Graphdims_get
+#define MPI_Grequest_complete YogiMPI_Grequest_complete
+#define MPI_Grequest_start YogiMPI_Grequest_start
+#define MPI_Group_compare YogiMPI_Group_compare
+#define MPI_Group_difference YogiMPI_Group_difference
+#define MPI_Group_excl YogiMPI_Group_excl
+#define MPI_Group_free YogiMPI_Group_free
+#define MPI_Group_incl YogiMPI_Group_incl
+#define MPI_Group_intersection YogiMPI_Group_intersection
+#define MPI_Group_range_excl YogiMPI_Group_range_excl
+#define MPI_Group_range_incl YogiMPI_Group_range_incl
+#define MPI_Group_rank YogiMPI_Group_rank
+#define MPI_Group_size YogiMPI_Group_size
+#define MPI_Group_translate_ranks YogiMPI_Group_translate_ranks
+#define MPI_Group_union YogiMPI_Group_union
+#define MPI_Iallgather YogiMPI_Iallgather
+#define MPI_Iallgatherv YogiMPI_Iallgatherv
+#define MPI_Iallreduce YogiMPI_Iallreduce
+#define MPI_Ialltoall YogiMPI_Ialltoall
+#define MPI_Ialltoallv YogiMPI_Ialltoallv
+#define MPI_Ialltoallw YogiMPI_Ialltoallw
+#define MPI_Ibarrier YogiMPI_Ibarrier
+#define MPI_Ibcast YogiMPI_Ibcast
+#define MPI_Ibsend YogiMPI_Ibsend
+#define MPI_Iexscan YogiMPI_Iexscan
+#define MPI_Igather YogiMPI_Igather
+#define MPI_Igatherv YogiMPI_Igatherv
+#define MPI_Improbe YogiMPI_Improbe
+#define MPI_Imrecv YogiMPI_Imrecv
+#define MPI_Ineighbor_allgather YogiMPI_Ineighbor_allgather
+#define MPI_Ineighbor_allgatherv YogiMPI_Ineighbor_allgatherv
+#define MPI_Ineighbor_alltoall YogiMPI_Ineighbor_alltoall
+#define MPI_Ineighbor_alltoallv YogiMPI_Ineighbor_alltoallv
+#define MPI_Ineighbor_alltoallw YogiMPI_Ineighbor_alltoallw
+#define MPI_Info_create YogiMPI_Info_create
+#define MPI_Info_delete YogiMPI_Info_delete
+#define MPI_Info_dup YogiMPI_Info_dup
+#define MPI_Info_free YogiMPI_Info_free
+#define MPI_Info_get YogiMPI_Info_get
+#define MPI_Info_get_nkeys YogiMPI_Info_get_nkeys
+#define MPI_Info_get_nthkey YogiMPI_Info_get_nthkey
+#define MPI_Info_get_valuelen YogiMPI_Info_get_valuelen
+#define MPI_Info_set YogiMPI_Info_set
+#define MPI_Initialized YogiMPI_Initialized
+#define MPI_Intercomm_create YogiMPI_Intercomm_create
+#define MPI_Intercomm_merge YogiMPI_Intercomm_merge
+#define MPI_Iprobe YogiMPI_Iprobe
+#define MPI_Irecv YogiMPI_Irecv
+#define MPI_Ireduce YogiMPI_Ireduce
+#define MPI_Ireduce_scatter YogiMPI_Ireduce_scatter
+#define MPI_Ireduce_scatter_block YogiMPI_Ireduce_scatter_block
+#define MPI_Irsend YogiMPI_Irsend
+#define MPI_Is_thread_main YogiMPI_Is_thread_main
+#define MPI_Iscan YogiMPI_Iscan
+#define MPI_Iscatter YogiMPI_Iscatter
+#define MPI_Iscatterv YogiMPI_Iscatterv
+#define MPI_Isend YogiMPI_Isend
+#define MPI_Issend YogiMPI_Issend
+#define MPI_Keyval_create YogiMPI_Keyval_create
+#define MPI_Keyval_free YogiMPI_Keyval_free
+#define MPI_Lookup_name YogiMPI_Lookup_name
+#define MPI_Mprobe YogiMPI_Mprobe
+#define MPI_Mrecv YogiMPI_Mrecv
+#define MPI_Neighbor_allgather YogiMPI_Neighbor_allgather
+#define MPI_Neighbor_allgatherv YogiMPI_Neighbor_allgatherv
+#define MPI_Neighbor_alltoall YogiMPI_Neighbor_alltoall
+#define MPI_Neighbor_alltoallv YogiMPI_Neighbor_alltoallv
+#define MPI_Neighbor_alltoallw YogiMPI_Neighbor_alltoallw
+#define MPI_Op_commutative YogiMPI_Op_commutative
+#define MPI_Op_create YogiMPI_Op_create
+#define MPI_Op_free YogiMPI_Op_free
+#define MPI_Open_port YogiMPI_Open_port
+#define MPI_Pack YogiMPI_Pack
+#define MPI_Pack_external YogiMPI_Pack_external
+#define MPI_Pack_external_size YogiMPI_Pack_external_size
+#define MPI_Pack_size YogiMPI_Pack_size
+#define MPI_Pcontrol YogiMPI_Pcontrol
+#define MPI_Probe YogiMPI_Probe
+#define MPI_Publish_name YogiMPI_Publish_name
+#define MPI_Put YogiMPI_Put
+#define MPI_Query_thread YogiMPI_Query_thread
+#define MPI_Raccumulate YogiMPI_Raccumulate
+#define MPI_Recv YogiMPI_Recv
+#define MPI_Recv_init YogiMPI_Recv_init
+#define MPI_Reduce YogiMPI_Reduce
+#define MPI_Reduce_local YogiMPI_Reduce_local
+#define MPI_Reduce_scatter YogiMPI_Reduce_scatter
+#define MPI_Reduce_scatter_block YogiMPI_Reduce_scatter_block
+#define MPI_Register_datarep YogiMPI_Register_datarep
+#define MPI_Request_free YogiMPI_Request_free
+#define MPI_Request_get_status YogiMPI_Request_get_status
+#define MPI_Rget YogiMPI_Rget
+#define MPI_Rget_accumulate YogiMPI_Rget_accumulate
+#define MPI_Rput YogiMPI_Rput
+#define MPI_Rsend YogiMPI_Rsend
+#define MPI_Rsend_init YogiMPI_Rsend_init
+#define MPI_Scan YogiMPI_Scan
+#define MPI_Scatter YogiMPI_Scatter
+#define MPI_Scatterv YogiMPI_Scatterv
+#define MPI_Send YogiMPI_Send
+#define MPI_Send_init YogiMPI_Send_init
+#define MPI_Sendrecv YogiMPI_Sendrecv
+#define MPI_Sendrecv_replace YogiMPI_Sendrecv_replace
+#define MPI_Ssend YogiMPI_Ssend
+#define MPI_Ssend_init YogiMPI_Ssend_init
+#define MPI_Start YogiMPI_Start
+#define MPI_Startall YogiMPI_Startall
+#define MPI_Status_set_cancelled YogiMPI_Status_set_cancelled
+#define MPI_Status_set_elements YogiMPI_Status_set_elements
+#define MPI_Status_set_elements_x YogiMPI_Status_set_elements_x
+#define MPI_Test YogiMPI_Test
+#define MPI_Test_cancelled YogiMPI_Test_cancelled
+#define MPI_Testall YogiMPI_Testall
+#define MPI_Testany YogiMPI_Testany
+#define MPI_Testsome YogiMPI_Testsome
+#define MPI_Topo_test YogiMPI_Topo_test
+#define MPI_Type_commit YogiMPI_Type_commit
+#define MPI_Type_contiguous YogiMPI_Type_contiguous
+#define MPI_Type_create_hindexed YogiMPI_Type_create_hindexed
+#define MPI_Type_create_hindexed_block YogiMPI_Type_create_hindexed_block
+#define MPI_Type_create_hvector YogiMPI_Type_create_hvector
+#define MPI_Type_create_indexed_block YogiMPI_Type_create_indexed_block
+#define MPI_Type_create_keyval YogiMPI_Type_create_keyval
+#define MPI_Type_create_resized YogiMPI_Type_create_resized
+#define MPI_Type_create_struct YogiMPI_Type_create_struct
+#define MPI_Type_create_subarray YogiMPI_Type_create_subarray
+#define MPI_Type_delete_attr YogiMPI_Type_delete_attr
+#define MPI_Type_dup YogiMPI_Type_dup
+#define MPI_Type_extent YogiMPI_Type_extent
+#define MPI_Type_free YogiMPI_Type_free
+#define MPI_Type_free_keyval YogiMPI_Type_free_keyval
+#define MPI_Type_get_attr YogiMPI_Type_get_attr
+#define MPI_Type_get_envelope YogiMPI_Type_get_envelope
+#define MPI_Type_get_extent YogiMPI_Type_get_extent
+#define MPI_Type_get_extent_x YogiMPI_Type_get_extent_x
+#define MPI_Type_get_name YogiMPI_Type_get_name
+#define MPI_Type_get_true_extent YogiMPI_Type_get_true_extent
+#define MPI_Type_get_true_extent_x YogiMPI_Type_get_true_extent_x
+#define MPI_Type_hindexed YogiMPI_Type_hindexed
+#define MPI_Type_hvector YogiMPI_Type_hvector
+#define MPI_Type_indexed YogiMPI_Type_indexed
+#define MPI_Type_lb YogiMPI_Type_lb
+#define MPI_Type_match_size YogiMPI_Type_match_size
+#define MPI_Type_set_attr YogiMPI_Type_set_attr
+#define MPI_Type_set_name YogiMPI_Type_set_name
+#define MPI_Type_size YogiMPI_Type_size
+#define MPI_Type_size_x YogiMPI_Type_size_x
+#define MPI_Type_struct YogiMPI_Type_struct
+#define MPI_Type_ub YogiMPI_Type_ub
+#define MPI_Type_vector YogiMPI_Type_vector
+#define MPI_Unpack YogiMPI_Unpack
+#define MPI_Unpack_external YogiMPI_Unpack_external
+#define MPI_Unpublish_name YogiMPI_Unpublish_name
+#define MPI_Wait YogiMPI_Wait
+#define MPI_Waitall YogiMPI_Waitall
+#define MPI_Waitany YogiMPI_Waitany
+#define MPI_Waitsome YogiMPI_Waitsome
+#define MPI_Win_allocate YogiMPI_Win_allocate
+#define MPI_Win_allocate_shared YogiMPI_Win_allocate_shared
+#define MPI_Win_attach YogiMPI_Win_attach
+#define MPI_Win_call_errhandler YogiMPI_Win_call_errhandler
+#define MPI_Win_complete YogiMPI_Win_complete
+#define MPI_Win_create YogiMPI_Win_create
+#define MPI_Win_create_dynamic YogiMPI_Win_create_dynamic
+#define MPI_Win_create_errhandler YogiMPI_Win_create_errhandler
+#define MPI_Win_create_keyval YogiMPI_Win_create_keyval
+#define MPI_Win_delete_attr YogiMPI_Win_delete_attr
+#define MPI_Win_detach YogiMPI_Win_detach
+#define MPI_Win_fence YogiMPI_Win_fence
+#define MPI_Win_flush YogiMPI_Win_flush
+#define MPI_Win_flush_all YogiMPI_Win_flush_all
+#define MPI_Win_flush_local YogiMPI_Win_flush_local
+#define MPI_Win_flush_local_all YogiMPI_Win_flush_local_all
+#define MPI_Win_free YogiMPI_Win_free
+#define MPI_Win_free_keyval YogiMPI_Win_free_keyval
+#define MPI_Win_get_attr YogiMPI_Win_get_attr
+#define MPI_Win_get_errhandler YogiMPI_Win_get_errhandler
+#define MPI_Win_get_group YogiMPI_Win_get_group
+#define MPI_Win_get_info YogiMPI_Win_get_info
+#define MPI_Win_get_name YogiMPI_Win_get_name
+#define MPI_Win_lock YogiMPI_Win_lock
+#define MPI_Win_lock_all YogiMPI_Win_lock_all
+#define MPI_Win_post YogiMPI_Win_post
+#define MPI_Win_set_attr YogiMPI_Win_set_attr
+#define MPI_Win_set_errhandler YogiMPI_Win_set_errhandler
+#define MPI_Win_set_info YogiMPI_Win_set_info
+#define MPI_Win_set_name YogiMPI_Win_set_name
+#define MPI_Win_shared_query YogiMPI_Win_shared_query
+#define MPI_Win_start YogiMPI_Win_start
+#define MPI_Win_sync YogiMPI_Win_sync
+#define MPI_Win_test YogiMPI_Win_test
+#define MPI_Win_unlock YogiMPI_Win_unlock
+#define MPI_Win_unlock_all YogiMPI_Win_unlock_all
+#define MPI_Win_wait YogiMPI_Win_wait
+
+// End automatically generated code
+
+#endif /* MPITOYOGI_H */
@@ -1,6 +1,48 @@
 #include "YogiManager.h"
 #include <iostream>
 #include <algorithm>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+
+// A user op for the op slot checks.
+void addInts(void *in, void *inout, int *len, YogiMPI_Datatype *datatype) {
+    for (int i = 0; i < *len; i++) {
+        static_cast<int *> (inout)[i] += static_cast<int *> (in)[i];
+    }
+}
+
+/* Each thread repeatedly maps a batch of its own fake request handles and
+   releases them again, checking that every Yogi handle still translates to
+   the handle it was created from. */
+void requestStress(YogiManager *manager, int thread, int *errors) {
+    const int batch = 64;
+    std::vector<YogiMPI_Request> live(batch);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        for (int i = 0; i < batch; i++) {
+            std::intptr_t fake = 0x100000 + (thread * batch + i) * 16;
+            live[i] = manager->requestToYogi((MPI_Request) fake);
+        }
+        for (int i = 0; i < batch; i++) {
+            std::intptr_t fake = 0x100000 + (thread * batch + i) * 16;
+            if (manager->requestToMPI(live[i]) != (MPI_Request) fake) {
+                (*errors)++;
+            }
+            manager->unmapRequest(live[i]);
+        }
+    }
+}
+
+/* Each thread pushes matched enter and exit records into the trace. */
+void traceStress(YogiTracer *tracer, int thread) {
+    for (int i = 0; i < 10000; i++) {
+        tracer->enter(0, thread, i, 0);
+        tracer->exit(0, i, 0);
+    }
+}
 
 int main() {
     YogiManager *manager = YogiManager::getInstance();
@@ -16,4 +58,331 @@ int main() {
     std::cout << "Source: " << another->MPI_SOURCE << std::endl;
     std::cout << "Tag: " << another->MPI_TAG << std::endl;
     std::cout << "Error: " << another->MPI_ERROR << std::endl;
+
+    // Statuses written packed by MPI are spread out to their elements.
+    YogiMPI_Status statuses[4];
+    MPI_Status *packed = manager->statusesToMPI(statuses, 4);
+    for (int i = 0; i < 4; i++) {
+        packed[i].MPI_SOURCE = i;
+        packed[i].MPI_TAG = i == 3 ? MPI_ANY_TAG : 100 + i;
+        packed[i].MPI_ERROR = 0;
+    }
+    manager->statusesToYogiInPlace(statuses, 4);
+    for (int i = 0; i < 4; i++) {
+        int tag = i == 3 ? YogiMPI_ANY_TAG : 100 + i;
+        MPI_Status *real = manager->statusToMPI(&statuses[i]);
+        if (statuses[i].MPI_SOURCE != i || statuses[i].MPI_TAG != tag ||
+            real->MPI_SOURCE != i) {
+            std::cout << "Status " << i << " not spread out" << std::endl;
+            return 1;
+        }
+    }
+
+    /* Storage only int-aligned, as from Fortran, goes through aligned
+       copies and still ends up in place. */
+    if (alignof(MPI_Status) > sizeof(int)) {
+        std::vector<long long> storage(4 * sizeof(YogiMPI_Status) /
+                                       sizeof(long long) + 1);
+        char *base = reinterpret_cast<char *> (&storage[0]);
+        // A single status whose realStatus is misaligned.
+        std::size_t shift = offsetof(YogiMPI_Status, realStatus) %
+                            alignof(MPI_Status) == 0 ? sizeof(int) : 0;
+        YogiMPI_Status *one = reinterpret_cast<YogiMPI_Status *> (base + shift);
+        MPI_Status *single = manager->statusToMPI(one);
+        if ((void *) single == (void *) one->realStatus) return 1;
+        single->MPI_SOURCE = 7;
+        single->MPI_TAG = 70;
+        manager->statusToYogiInPlace(one);
+        if (one->MPI_SOURCE != 7 || one->MPI_TAG != 70 ||
+            manager->statusToMPI(one)->MPI_TAG != 70) {
+            return 1;
+        }
+        // An array starting misaligned, so not packed in place.
+        YogiMPI_Status *odd = reinterpret_cast<YogiMPI_Status *> (
+                                  base + sizeof(int));
+        packed = manager->statusesToMPI(odd, 4);
+        if ((void *) packed == (void *) odd) return 1;
+        for (int i = 0; i < 4; i++) {
+            packed[i].MPI_SOURCE = i;
+            packed[i].MPI_TAG = 200 + i;
+            packed[i].MPI_ERROR = 0;
+        }
+        manager->statusesToYogiInPlace(odd, 4);
+        for (int i = 0; i < 4; i++) {
+            const YogiMPI_Status *element = &odd[i];
+            if (odd[i].MPI_SOURCE != i || odd[i].MPI_TAG != 200 + i ||
+                manager->statusToMPI(element)->MPI_TAG != 200 + i) {
+                std::cout << "Unaligned status " << i << " not in place"
+                          << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    /* A freed op's slot taken again by an op MPI then fails to create
+       keeps calling the function for reductions still running. */
+    {
+        int slot = -1, again = -1;
+        bool reused = true;
+        MPI_User_function *trampoline = manager->claimOpSlot(addInts, slot,
+                                                             reused);
+        if (trampoline == NULL || reused) return 1;
+        YogiMPI_Op op = manager->opToYogi((MPI_Op) (std::intptr_t) 0x600000);
+        manager->bindOpSlot(slot, op);
+        manager->unmapOp(op);
+        manager->claimOpSlot(addInts, again, reused);
+        if (again != slot || !reused) return 1;
+        manager->releaseOpSlot(again, reused);
+        int in = 2, inout = 3, len = 1;
+        MPI_Datatype type = MPI_INT;
+        trampoline(&in, &inout, &len, &type);
+        if (inout != 5) {
+            std::cout << "Retired op slot lost its function" << std::endl;
+            return 1;
+        }
+    }
+
+    // A burst of requests grows the pool, and draining it gives the
+    // memory back.
+    YogiX_Pool_info before, during, after;
+    manager->poolStats(YogiX_POOL_REQUEST, &before);
+    std::vector<YogiMPI_Request> burst(5000);
+    for (std::size_t i = 0; i < burst.size(); i++) {
+        burst[i] = manager->requestToYogi(
+                       (MPI_Request) (std::intptr_t) (0x300000 + i * 16));
+    }
+    manager->poolStats(YogiX_POOL_REQUEST, &during);
+    for (std::size_t i = 0; i < burst.size(); i += 2) {
+        manager->unmapRequest(burst[i]);
+    }
+    for (std::size_t i = 1; i < burst.size(); i += 2) {
+        manager->unmapRequest(burst[i]);
+    }
+    manager->poolStats(YogiX_POOL_REQUEST, &after);
+    std::cout << "Request pool capacity: " << before.capacity << " -> "
+              << during.capacity << " -> " << after.capacity << std::endl;
+    if (during.live != before.live + 5000 || after.live != before.live ||
+        during.capacity < 5000 || after.capacity > before.capacity + 128 ||
+        after.high_water < 5000 || after.removes != before.removes + 5000) {
+        std::cout << "Request pool did not shrink back" << std::endl;
+        return 1;
+    }
+
+    // Known MPI handles must translate back to the same Yogi handle.
+    YogiMPI_Comm world = manager->commToYogi(MPI_COMM_WORLD);
+    std::cout << "World: " << world << std::endl;
+    YogiMPI_Datatype dbl = manager->datatypeToYogiFindOnly(MPI_DOUBLE);
+    std::cout << "Double: " << dbl << std::endl;
+    if (world != YogiMPI_COMM_WORLD || dbl != YogiMPI_DOUBLE) return 1;
+
+    // MPI may return one object twice, and each copy is freed on its own,
+    // so freeing one must leave the other mapped.
+    if (!YogiPassthrough<MPI_Datatype>::enabled) {
+        MPI_Datatype shared = (MPI_Datatype) (std::intptr_t) 0x600000;
+        YogiMPI_Datatype original = manager->datatypeToYogi(shared);
+        YogiMPI_Datatype copy = manager->datatypeToYogi(shared);
+        manager->unmapDatatype(copy);
+        if (original == copy || manager->datatypeToMPI(original) != shared ||
+            manager->datatypeToYogiFindOnly(shared) != original) {
+            std::cout << "Shared MPI handle lost its mapping" << std::endl;
+            return 1;
+        }
+        manager->unmapDatatype(original);
+        if (manager->datatypeToYogiFindOnly(shared) != YogiMPI_DATATYPE_NULL) {
+            std::cout << "Freed MPI handle still mapped" << std::endl;
+            return 1;
+        }
+    }
+
+    // Constant tables, including keys kept outside the dense range.
+    if (manager->errorToYogi(MPI_ERR_TRUNCATE) != YogiMPI_ERR_TRUNCATE ||
+        manager->errorToYogi(MPI_ERR_LASTCODE) != YogiMPI_ERR_LASTCODE ||
+        manager->errorToMPI(YogiMPI_ERR_IN_STATUS) != MPI_ERR_IN_STATUS ||
+        manager->topoToYogi(MPI_UNDEFINED) != YogiMPI_UNDEFINED ||
+        manager->comparisonToYogi(MPI_CONGRUENT) != YogiMPI_CONGRUENT) {
+        std::cout << "Constant translation failed" << std::endl;
+        return 1;
+    }
+
+    // Large conversion arrays must reuse the thread's buffer once released.
+    MPI_Request *first, *second;
+    {
+        YogiScratch<MPI_Request> scratch;
+        first = scratch.get(1000);
+    }
+    {
+        YogiScratch<MPI_Request> scratch;
+        second = scratch.get(500);
+    }
+    std::cout << "Scratch reused: " << (first == second) << std::endl;
+    if (first != second) return 1;
+
+    // Cached datatype arrays: a repeat is served from the cache, and a
+    // freed and reused Yogi handle is converted again.
+    MPI_Datatype fakeA = (MPI_Datatype) (std::intptr_t) 0x200000;
+    MPI_Datatype fakeB = (MPI_Datatype) (std::intptr_t) 0x200010;
+    YogiMPI_Datatype types[2];
+    types[0] = manager->datatypeToYogi(fakeA);
+    types[1] = YogiMPI_INT;
+    YogiScratch<MPI_Datatype> typeScratch;
+    MPI_Datatype *cached = manager->datatypeToMPICached(YogiMPI_COMM_WORLD, 0,
+                                                        types, 2, typeScratch);
+    MPI_Datatype *again = manager->datatypeToMPICached(YogiMPI_COMM_WORLD, 0,
+                                                       types, 2, typeScratch);
+    if (cached != again || again[0] != fakeA || again[1] != MPI_INT) {
+        std::cout << "Datatype cache miss" << std::endl;
+        return 1;
+    }
+    manager->unmapDatatype(types[0]);
+    YogiMPI_Datatype reused = manager->datatypeToYogi(fakeB);
+    types[0] = reused;
+    again = manager->datatypeToMPICached(YogiMPI_COMM_WORLD, 0, types, 2,
+                                         typeScratch);
+    std::cout << "Reused datatype handle converted: " << (again[0] == fakeB)
+              << std::endl;
+    if (again[0] != fakeB) return 1;
+    manager->unmapDatatype(reused);
+
+    // Persistent request sets: a repeat is served from the set, and freed
+    // persistent requests whose Yogi handles come back are converted again.
+    if (!YogiPassthrough<MPI_Request>::enabled) {
+        YogiMPI_Request persistent[2];
+        for (int i = 0; i < 2; i++) {
+            persistent[i] = manager->requestToYogi(
+                                (MPI_Request) (std::intptr_t) (0x400000 + i * 16));
+            manager->markPersistent(persistent[i]);
+        }
+        YogiScratch<MPI_Request> requestScratch;
+        MPI_Request *set = manager->requestToMPICached(persistent, 2,
+                                                       requestScratch);
+        MPI_Request *setAgain = manager->requestToMPICached(persistent, 2,
+                                                            requestScratch);
+        if (set != setAgain || set == requestScratch.get(2)) {
+            std::cout << "Persistent set not reused" << std::endl;
+            return 1;
+        }
+        manager->unmapRequest(persistent[1]);
+        manager->unmapRequest(persistent[0]);
+        for (int i = 0; i < 2; i++) {
+            YogiMPI_Request old = persistent[i];
+            persistent[i] = manager->requestToYogi(
+                                (MPI_Request) (std::intptr_t) (0x500000 + i * 16));
+            manager->markPersistent(persistent[i]);
+            if (persistent[i] != old) return 1;
+        }
+        setAgain = manager->requestToMPICached(persistent, 2, requestScratch);
+        std::cout << "Reused persistent requests converted: "
+                  << (setAgain[0] == (MPI_Request) (std::intptr_t) 0x500000)
+                  << std::endl;
+        if (setAgain[0] != (MPI_Request) (std::intptr_t) 0x500000) return 1;
+        manager->unmapRequest(persistent[0]);
+        manager->unmapRequest(persistent[1]);
+    }
+
+    // Reduction kernels, with odd lengths so vector loops leave a tail.
+    {
+        std::cout << "Reduction kernels: " << yogiReduceIsa() << std::endl;
+        const int n = 67;
+        std::vector<double> in(n), inout(n);
+        std::vector<int> ints(n), intsOut(n);
+        for (int i = 0; i < n; i++) {
+            in[i] = i % 5;
+            inout[i] = 2.0;
+            ints[i] = i;
+            intsOut[i] = 0x0f;
+        }
+        YogiReduceKernel kernel = yogiReduceKernel(YogiMPI_MAX,
+                                                   YogiMPI_DOUBLE);
+        if (kernel) kernel(&in[0], &inout[0], n);
+        for (int i = 0; i < n && kernel; i++) {
+            if (inout[i] != (i % 5 > 2 ? i % 5 : 2.0)) kernel = NULL;
+        }
+        YogiReduceKernel band = yogiReduceKernel(YogiMPI_BAND, YogiMPI_INT);
+        if (band) band(&ints[0], &intsOut[0], n);
+        for (int i = 0; i < n && band; i++) {
+            if (intsOut[i] != (i & 0x0f)) band = NULL;
+        }
+        struct { double value; int index; } pairs[3] = {{1, 4}, {3, 1}, {3, 5}},
+                                            pairsOut[3] = {{2, 0}, {3, 2}, {3, 0}};
+        YogiReduceKernel maxloc = yogiReduceKernel(YogiMPI_MAXLOC,
+                                                   YogiMPI_DOUBLE_INT);
+        if (maxloc) maxloc(pairs, pairsOut, 3);
+        if (!kernel || !band || !maxloc || pairsOut[0].index != 0 ||
+            pairsOut[1].index != 1 || pairsOut[2].index != 0) {
+            std::cout << "Reduction kernel wrong" << std::endl;
+            return 1;
+        }
+        if (yogiReduceKernel(YogiMPI_SUM, YogiMPI_BYTE) ||
+            yogiReduceKernel(YogiMPI_BAND, YogiMPI_DOUBLE) ||
+            yogiReduceKernel(YogiMPI_REPLACE, YogiMPI_INT) ||
+            yogiReduceKernel(YogiMPI_SUM, YogiManager::datatypeOffset + 1)) {
+            std::cout << "Kernel for a pair MPI does not allow" << std::endl;
+            return 1;
+        }
+    }
+
+    // Profiler latency buckets and counters.
+    if (YogiProfiler::bucketFor(1) != 0 ||
+        YogiProfiler::bucketFor(1024) != 10 ||
+        YogiProfiler::bucketFor(2047) != 10 ||
+        YogiProfiler::bucketFor(1LL << 40) !=
+            YogiProfileEntry::numBuckets - 1) {
+        std::cout << "Profiler buckets wrong" << std::endl;
+        return 1;
+    }
+    static const char * const profiled[] = { "MPI_Example" };
+    setenv("YOGI_PROFILE", "1", 1);
+    manager->profiler.start(profiled, 1);
+    for (int i = 0; i < 3; i++) {
+        manager->profiler.record(0, YogiProfiler::now() - 1500);
+    }
+    const YogiProfileEntry &example = manager->profiler.entry(0);
+    unsigned long long fast = 0;
+    for (int b = 0; b < 10; b++) fast += example.buckets[b].load();
+    std::cout << "Profiled calls: " << example.calls.load() << std::endl;
+    if (!manager->profiler.enabled || example.calls.load() != 3 ||
+        fast != 0 || example.nanoseconds.load() < 4500) {
+        return 1;
+    }
+    manager->profiler.enabled = false;
+
+    // Trace records from many threads must all reach the file, more of them
+    // than fit in the ring at once.
+    static const char * const traced[] = { "MPI_Example" };
+    const int traceThreads = 8;
+    manager->tracer.start(9999, traced, 1);
+    std::vector<std::thread> tracing;
+    for (int t = 0; t < traceThreads; t++) {
+        tracing.push_back(std::thread(traceStress, &manager->tracer, t));
+    }
+    for (int t = 0; t < traceThreads; t++) tracing[t].join();
+    manager->tracer.stop();
+    std::FILE *traceFile = std::fopen("yogimpi.trace.9999", "rb");
+    if (traceFile == NULL) return 1;
+    std::fseek(traceFile, 0, SEEK_END);
+    long traceBytes = std::ftell(traceFile);
+    std::fclose(traceFile);
+    std::remove("yogimpi.trace.9999");
+    long headerBytes = 8 + 4 * sizeof(int) + sizeof("MPI_Example");
+    long traceRecords = (traceBytes - headerBytes) / sizeof(YogiTraceRecord);
+    std::cout << "Trace records: " << traceRecords << std::endl;
+    if (traceRecords != traceThreads * 20000L) return 1;
+
+    // Concurrent request traffic, as under MPI_THREAD_MULTIPLE.
+    const int numThreads = 32;
+    std::vector<std::thread> threads;
+    std::vector<int> errors(numThreads, 0);
+    manager->setThreadMultiple(true);
+    for (int t = 0; t < numThreads; t++) {
+        threads.push_back(std::thread(requestStress, manager, t, &errors[t]));
+    }
+    int totalErrors = 0;
+    for (int t = 0; t < numThreads; t++) {
+        threads[t].join();
+        totalErrors += errors[t];
+    }
+    manager->setThreadMultiple(false);
+    std::cout << "Threaded request errors: " << totalErrors << std::endl;
+    if (totalErrors != 0) return 1;
+    return 0;
 }
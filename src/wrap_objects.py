@@ -167,6 +167,10 @@ class MPIArgument(MPICode):
         # If the argument is plural, the dimensions. This is not necessarily
         # set for all plural arguments, but it is required for MPI type args.
         self.dims = None
+        # For an output status array, how many statuses MPI wrote, if not
+        # dims, and the condition under which it wrote any.
+        self.written = None
+        self.written_if = None
 
         # The following variables are only used if is_mpi_type is True.
         # Otherwise the values all remain set to False and None.
@@ -181,6 +185,9 @@ class MPIArgument(MPICode):
         self.mpi_func_ptr = False
         # Whether a handle will be freed by the operation.
         self.free_handle = False
+        # For a datatype array of a collective, which side ("send" or
+        # "recv") of the communicator's conversion cache it goes through.
+        self.cache_side = None
 
     def validate(self):
         if self.is_output:
@@ -218,7 +225,14 @@ class MPIConvertValue(object):
 class MPIFunction(MPICode):
 
     def __init__(self):
-        super().__init__(orders=['first', 'beforecall', 'aftercall', 'beforereturn'])
+        # An "instead" block is a condition: when it is true, it has done the
+        # work of the MPI call itself and set mpi_error, and the call is
+        # skipped.  In a function with an optional status, {status} stands
+        # for the MPI status argument of the branch.  An "emulate" block is
+        # an expression giving the MPI error code of doing the call without
+        # MPI's own function, for MPI versions that lack it.
+        super().__init__(orders=['first', 'beforecall', 'instead',
+                                 'emulate', 'aftercall', 'beforereturn'])
         self.name = None
         self.status_ignore = False
         self.status_ignore_type = None
@@ -227,6 +241,9 @@ class MPIFunction(MPICode):
         self.args = []
         self.fortran_support = True
         self.mpi_version = None
+        # Kept, though the MPI is older than the function, for its
+        # "emulate" block.
+        self.emulated = False
 
     def validate(self):
         for anArg in self.args:
@@ -0,0 +1,12985 @@
+/*
+                                  COPYRIGHT
+
+ The following is a notice of limited availability of the code, and disclaimer
+ which must be included in the prologue of the code and in all source listings
+ of the code.
+
+ Copyright Notice
+  + 2002 University of Chicago
+  + 2016 Stephen Adamec
+
+ Permission is hereby granted to use, reproduce, prepare derivative works, and
+ to redistribute to others.  This software was authored by:
+
+ Mathematics and Computer Science Division
+ Argonne National Laboratory, Argonne IL 60439
+
+ (and)
+
+ Department of Computer Science
+ University of Illinois at Urbana-Champaign
+
+ (and)
+
+ Stephen Adamec
+
+                              GOVERNMENT LICENSE
+
+ Portions of this material resulted from work developed under a U.S.
+ Government Contract and are subject to the following license: the Government
+ is granted for itself and others acting on its behalf a paid-up, nonexclusive,
+ irrevocable worldwide license in this computer software to reproduce, prepare
+ derivative works, and perform publicly and display publicly.
+
+                                    DISCLAIMER
+
+ This computer code material was prepared, in part, as an account of work
+ sponsored by an agency of the United States Government.  Neither the United
+ States, nor the University of Chicago, nor any of their employees, makes any
+ warranty express or implied, or assumes any legal liability or responsibility
+ for the accuracy, completeness, or usefulness of any information, apparatus,
+ product, or process disclosed, or represents that its use would not infringe
+ privately owned rights.
+*/
+
+#include "YogiManager.h"
+#include <cstring>
+
+/* Ids and names of the wrapped functions, shared by the profiler and the
+   trace. */
+enum YogiFunctionId {
+    YOGI_ID_MPI_Init,
+    YOGI_ID_MPI_Init_thread,
+    YOGI_ID_MPI_Finalize,
+    YOGI_ID_MPI_Error_class,
+    YOGI_ID_MPI_Error_string,
+    YOGI_ID_MPI_Get_processor_name,
+    YOGI_ID_MPI_Type_get_contents,
+    YOGI_ID_MPI_Type_create_darray,
+    YOGI_ID_MPI_Wtick,
+    YOGI_ID_MPI_Wtime,
+    YOGI_ID_MPI_Abort,
+    YOGI_ID_MPI_Accumulate,
+    YOGI_ID_MPI_Add_error_class,
+    YOGI_ID_MPI_Add_error_code,
+    YOGI_ID_MPI_Add_error_string,
+    YOGI_ID_MPI_Address,
+    YOGI_ID_MPI_Allgather,
+    YOGI_ID_MPI_Allgatherv,
+    YOGI_ID_MPI_Alloc_mem,
+    YOGI_ID_MPI_Allreduce,
+    YOGI_ID_MPI_Alltoall,
+    YOGI_ID_MPI_Alltoallv,
+    YOGI_ID_MPI_Alltoallw,
+    YOGI_ID_MPI_Attr_delete,
+    YOGI_ID_MPI_Attr_get,
+    YOGI_ID_MPI_Attr_put,
+    YOGI_ID_MPI_Barrier,
+    YOGI_ID_MPI_Bcast,
+    YOGI_ID_MPI_Bsend,
+    YOGI_ID_MPI_Bsend_init,
+    YOGI_ID_MPI_Buffer_attach,
+    YOGI_ID_MPI_Buffer_detach,
+    YOGI_ID_MPI_Cancel,
+    YOGI_ID_MPI_Cart_coords,
+    YOGI_ID_MPI_Cart_create,
+    YOGI_ID_MPI_Cart_get,
+    YOGI_ID_MPI_Cart_map,
+    YOGI_ID_MPI_Cart_rank,
+    YOGI_ID_MPI_Cart_shift,
+    YOGI_ID_MPI_Cart_sub,
+    YOGI_ID_MPI_Cartdim_get,
+    YOGI_ID_MPI_Close_port,
+    YOGI_ID_MPI_Comm_accept,
+    YOGI_ID_MPI_Comm_call_errhandler,
+    YOGI_ID_MPI_Comm_compare,
+    YOGI_ID_MPI_Comm_connect,
+    YOGI_ID_MPI_Comm_create,
+    YOGI_ID_MPI_Comm_create_errhandler,
+    YOGI_ID_MPI_Comm_create_group,
+    YOGI_ID_MPI_Comm_create_keyval,
+    YOGI_ID_MPI_Comm_delete_attr,
+    YOGI_ID_MPI_Comm_disconnect,
+    YOGI_ID_MPI_Comm_dup,
+    YOGI_ID_MPI_Comm_dup_with_info,
+    YOGI_ID_MPI_Comm_free,
+    YOGI_ID_MPI_Comm_free_keyval,
+    YOGI_ID_MPI_Comm_get_attr,
+    YOGI_ID_MPI_Comm_get_errhandler,
+    YOGI_ID_MPI_Comm_get_info,
+    YOGI_ID_MPI_Comm_get_name,
+    YOGI_ID_MPI_Comm_get_parent,
+    YOGI_ID_MPI_Comm_group,
+    YOGI_ID_MPI_Comm_idup,
+    YOGI_ID_MPI_Comm_join,
+    YOGI_ID_MPI_Comm_rank,
+    YOGI_ID_MPI_Comm_remote_group,
+    YOGI_ID_MPI_Comm_remote_size,
+    YOGI_ID_MPI_Comm_set_attr,
+    YOGI_ID_MPI_Comm_set_errhandler,
+    YOGI_ID_MPI_Comm_set_info,
+    YOGI_ID_MPI_Comm_set_name,
+    YOGI_ID_MPI_Comm_size,
+    YOGI_ID_MPI_Comm_split,
+    YOGI_ID_MPI_Comm_split_type,
+    YOGI_ID_MPI_Comm_test_inter,
+    YOGI_ID_MPI_Compare_and_swap,
+    YOGI_ID_MPI_Dims_create,
+    YOGI_ID_MPI_Dist_graph_create,
+    YOGI_ID_MPI_Dist_graph_create_adjacent,
+    YOGI_ID_MPI_Dist_graph_neighbors,
+    YOGI_ID_MPI_Dist_graph_neighbors_count,
+    YOGI_ID_MPI_Errhandler_create,
+    YOGI_ID_MPI_Errhandler_free,
+    YOGI_ID_MPI_Errhandler_get,
+    YOGI_ID_MPI_Errhandler_set,
+    YOGI_ID_MPI_Exscan,
+    YOGI_ID_MPI_Fetch_and_op,
+    YOGI_ID_MPI_File_call_errhandler,
+    YOGI_ID_MPI_File_close,
+    YOGI_ID_MPI_File_create_errhandler,
+    YOGI_ID_MPI_File_delete,
+    YOGI_ID_MPI_File_get_amode,
+    YOGI_ID_MPI_File_get_atomicity,
+    YOGI_ID_MPI_File_get_byte_offset,
+    YOGI_ID_MPI_File_get_errhandler,
+    YOGI_ID_MPI_File_get_group,
+    YOGI_ID_MPI_File_get_info,
+    YOGI_ID_MPI_File_get_position,
+    YOGI_ID_MPI_File_get_position_shared,
+    YOGI_ID_MPI_File_get_size,
+    YOGI_ID_MPI_File_get_type_extent,
+    YOGI_ID_MPI_File_get_view,
+    YOGI_ID_MPI_File_iread,
+    YOGI_ID_MPI_File_iread_at,
+    YOGI_ID_MPI_File_iread_shared,
+    YOGI_ID_MPI_File_iwrite,
+    YOGI_ID_MPI_File_iwrite_at,
+    YOGI_ID_MPI_File_iwrite_shared,
+    YOGI_ID_MPI_File_open,
+    YOGI_ID_MPI_File_preallocate,
+    YOGI_ID_MPI_File_read,
+    YOGI_ID_MPI_File_read_all,
+    YOGI_ID_MPI_File_read_all_begin,
+    YOGI_ID_MPI_File_read_all_end,
+    YOGI_ID_MPI_File_read_at,
+    YOGI_ID_MPI_File_read_at_all,
+    YOGI_ID_MPI_File_read_at_all_begin,
+    YOGI_ID_MPI_File_read_at_all_end,
+    YOGI_ID_MPI_File_read_ordered,
+    YOGI_ID_MPI_File_read_ordered_begin,
+    YOGI_ID_MPI_File_read_ordered_end,
+    YOGI_ID_MPI_File_read_shared,
+    YOGI_ID_MPI_File_seek,
+    YOGI_ID_MPI_File_seek_shared,
+    YOGI_ID_MPI_File_set_atomicity,
+    YOGI_ID_MPI_File_set_errhandler,
+    YOGI_ID_MPI_File_set_info,
+    YOGI_ID_MPI_File_set_size,
+    YOGI_ID_MPI_File_set_view,
+    YOGI_ID_MPI_File_sync,
+    YOGI_ID_MPI_File_write,
+    YOGI_ID_MPI_File_write_all,
+    YOGI_ID_MPI_File_write_all_begin,
+    YOGI_ID_MPI_File_write_all_end,
+    YOGI_ID_MPI_File_write_at,
+    YOGI_ID_MPI_File_write_at_all,
+    YOGI_ID_MPI_File_write_at_all_begin,
+    YOGI_ID_MPI_File_write_at_all_end,
+    YOGI_ID_MPI_File_write_ordered,
+    YOGI_ID_MPI_File_write_ordered_begin,
+    YOGI_ID_MPI_File_write_ordered_end,
+    YOGI_ID_MPI_File_write_shared,
+    YOGI_ID_MPI_Finalized,
+    YOGI_ID_MPI_Free_mem,
+    YOGI_ID_MPI_Gather,
+    YOGI_ID_MPI_Gatherv,
+    YOGI_ID_MPI_Get,
+    YOGI_ID_MPI_Get_accumulate,
+    YOGI_ID_MPI_Get_address,
+    YOGI_ID_MPI_Get_count,
+    YOGI_ID_MPI_Get_elements,
+    YOGI_ID_MPI_Get_elements_x,
+    YOGI_ID_MPI_Get_library_version,
+    YOGI_ID_MPI_Get_version,
+    YOGI_ID_MPI_Graph_create,
+    YOGI_ID_MPI_Graph_get,
+    YOGI_ID_MPI_Graph_map,
+    YOGI_ID_MPI_Graph_neighbors,
+    YOGI_ID_MPI_Graph_neighbors_count,
+    YOGI_ID_MPI_Graphdims_get,
+    YOGI_ID_MPI_Grequest_complete,
+    YOGI_ID_MPI_Grequest_start,
+    YOGI_ID_MPI_Group_compare,
+    YOGI_ID_MPI_Group_difference,
+    YOGI_ID_MPI_Group_excl,
+    YOGI_ID_MPI_Group_free,
+    YOGI_ID_MPI_Group_incl,
+    YOGI_ID_MPI_Group_intersection,
+    YOGI_ID_MPI_Group_range_excl,
+    YOGI_ID_MPI_Group_range_incl,
+    YOGI_ID_MPI_Group_rank,
+    YOGI_ID_MPI_Group_size,
+    YOGI_ID_MPI_Group_translate_ranks,
+    YOGI_ID_MPI_Group_union,
+    YOGI_ID_MPI_Iallgather,
+    YOGI_ID_MPI_Iallgatherv,
+    YOGI_ID_MPI_Iallreduce,
+    YOGI_ID_MPI_Ialltoall,
+    YOGI_ID_MPI_Ialltoallv,
+    YOGI_ID_MPI_Ialltoallw,
+    YOGI_ID_MPI_Ibarrier,
+    YOGI_ID_MPI_Ibcast,
+    YOGI_ID_MPI_Ibsend,
+    YOGI_ID_MPI_Iexscan,
+    YOGI_ID_MPI_Igather,
+    YOGI_ID_MPI_Igatherv,
+    YOGI_ID_MPI_Improbe,
+    YOGI_ID_MPI_Imrecv,
+    YOGI_ID_MPI_Ineighbor_allgather,
+    YOGI_ID_MPI_Ineighbor_allgatherv,
+    YOGI_ID_MPI_Ineighbor_alltoall,
+    YOGI_ID_MPI_Ineighbor_alltoallv,
+    YOGI_ID_MPI_Ineighbor_alltoallw,
+    YOGI_ID_MPI_Info_create,
+    YOGI_ID_MPI_Info_delete,
+    YOGI_ID_MPI_Info_dup,
+    YOGI_ID_MPI_Info_free,
+    YOGI_ID_MPI_Info_get,
+    YOGI_ID_MPI_Info_get_nkeys,
+    YOGI_ID_MPI_Info_get_nthkey,
+    YOGI_ID_MPI_Info_get_valuelen,
+    YOGI_ID_MPI_Info_set,
+    YOGI_ID_MPI_Initialized,
+    YOGI_ID_MPI_Intercomm_create,
+    YOGI_ID_MPI_Intercomm_merge,
+    YOGI_ID_MPI_Iprobe,
+    YOGI_ID_MPI_Irecv,
+    YOGI_ID_MPI_Ireduce,
+    YOGI_ID_MPI_Ireduce_scatter,
+    YOGI_ID_MPI_Ireduce_scatter_block,
+    YOGI_ID_MPI_Irsend,
+    YOGI_ID_MPI_Is_thread_main,
+    YOGI_ID_MPI_Iscan,
+    YOGI_ID_MPI_Iscatter,
+    YOGI_ID_MPI_Iscatterv,
+    YOGI_ID_MPI_Isend,
+    YOGI_ID_MPI_Issend,
+    YOGI_ID_MPI_Keyval_create,
+    YOGI_ID_MPI_Keyval_free,
+    YOGI_ID_MPI_Lookup_name,
+    YOGI_ID_MPI_Mprobe,
+    YOGI_ID_MPI_Mrecv,
+    YOGI_ID_MPI_Neighbor_allgather,
+    YOGI_ID_MPI_Neighbor_allgatherv,
+    YOGI_ID_MPI_Neighbor_alltoall,
+    YOGI_ID_MPI_Neighbor_alltoallv,
+    YOGI_ID_MPI_Neighbor_alltoallw,
+    YOGI_ID_MPI_Op_commutative,
+    YOGI_ID_MPI_Op_create,
+    YOGI_ID_MPI_Op_free,
+    YOGI_ID_MPI_Open_port,
+    YOGI_ID_MPI_Pack,
+    YOGI_ID_MPI_Pack_external,
+    YOGI_ID_MPI_Pack_external_size,
+    YOGI_ID_MPI_Pack_size,
+    YOGI_ID_MPI_Pcontrol,
+    YOGI_ID_MPI_Probe,
+    YOGI_ID_MPI_Publish_name,
+    YOGI_ID_MPI_Put,
+    YOGI_ID_MPI_Query_thread,
+    YOGI_ID_MPI_Raccumulate,
+    YOGI_ID_MPI_Recv,
+    YOGI_ID_MPI_Recv_init,
+    YOGI_ID_MPI_Reduce,
+    YOGI_ID_MPI_Reduce_local,
+    YOGI_ID_MPI_Reduce_scatter,
+    YOGI_ID_MPI_Reduce_scatter_block,
+    YOGI_ID_MPI_Register_datarep,
+    YOGI_ID_MPI_Request_free,
+    YOGI_ID_MPI_Request_get_status,
+    YOGI_ID_MPI_Rget,
+    YOGI_ID_MPI_Rget_accumulate,
+    YOGI_ID_MPI_Rput,
+    YOGI_ID_MPI_Rsend,
+    YOGI_ID_MPI_Rsend_init,
+    YOGI_ID_MPI_Scan,
+    YOGI_ID_MPI_Scatter,
+    YOGI_ID_MPI_Scatterv,
+    YOGI_ID_MPI_Send,
+    YOGI_ID_MPI_Send_init,
+    YOGI_ID_MPI_Sendrecv,
+    YOGI_ID_MPI_Sendrecv_replace,
+    YOGI_ID_MPI_Ssend,
+    YOGI_ID_MPI_Ssend_init,
+    YOGI_ID_MPI_Start,
+    YOGI_ID_MPI_Startall,
+    YOGI_ID_MPI_Status_set_cancelled,
+    YOGI_ID_MPI_Status_set_elements,
+    YOGI_ID_MPI_Status_set_elements_x,
+    YOGI_ID_MPI_Test,
+    YOGI_ID_MPI_Test_cancelled,
+    YOGI_ID_MPI_Testall,
+    YOGI_ID_MPI_Testany,
+    YOGI_ID_MPI_Testsome,
+    YOGI_ID_MPI_Topo_test,
+    YOGI_ID_MPI_Type_commit,
+    YOGI_ID_MPI_Type_contiguous,
+    YOGI_ID_MPI_Type_create_hindexed,
+    YOGI_ID_MPI_Type_create_hindexed_block,
+    YOGI_ID_MPI_Type_create_hvector,
+    YOGI_ID_MPI_Type_create_indexed_block,
+    YOGI_ID_MPI_Type_create_keyval,
+    YOGI_ID_MPI_Type_create_resized,
+    YOGI_ID_MPI_Type_create_struct,
+    YOGI_ID_MPI_Type_create_subarray,
+    YOGI_ID_MPI_Type_delete_attr,
+    YOGI_ID_MPI_Type_dup,
+    YOGI_ID_MPI_Type_extent,
+    YOGI_ID_MPI_Type_free,
+    YOGI_ID_MPI_Type_free_keyval,
+    YOGI_ID_MPI_Type_get_attr,
+    YOGI_ID_MPI_Type_get_envelope,
+    YOGI_ID_MPI_Type_get_extent,
+    YOGI_ID_MPI_Type_get_extent_x,
+    YOGI_ID_MPI_Type_get_name,
+    YOGI_ID_MPI_Type_get_true_extent,
+    YOGI_ID_MPI_Type_get_true_extent_x,
+    YOGI_ID_MPI_Type_hindexed,
+    YOGI_ID_MPI_Type_hvector,
+    YOGI_ID_MPI_Type_indexed,
+    YOGI_ID_MPI_Type_lb,
+    YOGI_ID_MPI_Type_match_size,
+    YOGI_ID_MPI_Type_set_attr,
+    YOGI_ID_MPI_Type_set_name,
+    YOGI_ID_MPI_Type_size,
+    YOGI_ID_MPI_Type_size_x,
+    YOGI_ID_MPI_Type_struct,
+    YOGI_ID_MPI_Type_ub,
+    YOGI_ID_MPI_Type_vector,
+    YOGI_ID_MPI_Unpack,
+    YOGI_ID_MPI_Unpack_external,
+    YOGI_ID_MPI_Unpublish_name,
+    YOGI_ID_MPI_Wait,
+    YOGI_ID_MPI_Waitall,
+    YOGI_ID_MPI_Waitany,
+    YOGI_ID_MPI_Waitsome,
+    YOGI_ID_MPI_Win_allocate,
+    YOGI_ID_MPI_Win_allocate_shared,
+    YOGI_ID_MPI_Win_attach,
+    YOGI_ID_MPI_Win_call_errhandler,
+    YOGI_ID_MPI_Win_complete,
+    YOGI_ID_MPI_Win_create,
+    YOGI_ID_MPI_Win_create_dynamic,
+    YOGI_ID_MPI_Win_create_errhandler,
+    YOGI_ID_MPI_Win_create_keyval,
+    YOGI_ID_MPI_Win_delete_attr,
+    YOGI_ID_MPI_Win_detach,
+    YOGI_ID_MPI_Win_fence,
+    YOGI_ID_MPI_Win_flush,
+    YOGI_ID_MPI_Win_flush_all,
+    YOGI_ID_MPI_Win_flush_local,
+    YOGI_ID_MPI_Win_flush_local_all,
+    YOGI_ID_MPI_Win_free,
+    YOGI_ID_MPI_Win_free_keyval,
+    YOGI_ID_MPI_Win_get_attr,
+    YOGI_ID_MPI_Win_get_errhandler,
+    YOGI_ID_MPI_Win_get_group,
+    YOGI_ID_MPI_Win_get_info,
+    YOGI_ID_MPI_Win_get_name,
+    YOGI_ID_MPI_Win_lock,
+    YOGI_ID_MPI_Win_lock_all,
+    YOGI_ID_MPI_Win_post,
+    YOGI_ID_MPI_Win_set_attr,
+    YOGI_ID_MPI_Win_set_errhandler,
+    YOGI_ID_MPI_Win_set_info,
+    YOGI_ID_MPI_Win_set_name,
+    YOGI_ID_MPI_Win_shared_query,
+    YOGI_ID_MPI_Win_start,
+    YOGI_ID_MPI_Win_sync,
+    YOGI_ID_MPI_Win_test,
+    YOGI_ID_MPI_Win_unlock,
+    YOGI_ID_MPI_Win_unlock_all,
+    YOGI_ID_MPI_Win_wait,
+    YOGI_NUM_FUNCTIONS
+};
+
+static const char * const functionNames[YOGI_NUM_FUNCTIONS] = {
+    "MPI_Init",
+    "MPI_Init_thread",
+    "MPI_Finalize",
+    "MPI_Error_class",
+    "MPI_Error_string",
+    "MPI_Get_processor_name",
+    "MPI_Type_get_contents",
+    "MPI_Type_create_darray",
+    "MPI_Wtick",
+    "MPI_Wtime",
+    "MPI_Abort",
+    "MPI_Accumulate",
+    "MPI_Add_error_class",
+    "MPI_Add_error_code",
+    "MPI_Add_error_string",
+    "MPI_Address",
+    "MPI_Allgather",
+    "MPI_Allgatherv",
+    "MPI_Alloc_mem",
+    "MPI_Allreduce",
+    "MPI_Alltoall",
+    "MPI_Alltoallv",
+    "MPI_Alltoallw",
+    "MPI_Attr_delete",
+    "MPI_Attr_get",
+    "MPI_Attr_put",
+    "MPI_Barrier",
+    "MPI_Bcast",
+    "MPI_Bsend",
+    "MPI_Bsend_init",
+    "MPI_Buffer_attach",
+    "MPI_Buffer_detach",
+    "MPI_Cancel",
+    "MPI_Cart_coords",
+    "MPI_Cart_create",
+    "MPI_Cart_get",
+    "MPI_Cart_map",
+    "MPI_Cart_rank",
+    "MPI_Cart_shift",
+    "MPI_Cart_sub",
+    "MPI_Cartdim_get",
+    "MPI_Close_port",
+    "MPI_Comm_accept",
+    "MPI_Comm_call_errhandler",
+    "MPI_Comm_compare",
+    "MPI_Comm_connect",
+    "MPI_Comm_create",
+    "MPI_Comm_create_errhandler",
+    "MPI_Comm_create_group",
+    "MPI_Comm_create_keyval",
+    "MPI_Comm_delete_attr",
+    "MPI_Comm_disconnect",
+    "MPI_Comm_dup",
+    "MPI_Comm_dup_with_info",
+    "MPI_Comm_free",
+    "MPI_Comm_free_keyval",
+    "MPI_Comm_get_attr",
+    "MPI_Comm_get_errhandler",
+    "MPI_Comm_get_info",
+    "MPI_Comm_get_name",
+    "MPI_Comm_get_parent",
+    "MPI_Comm_group",
+    "MPI_Comm_idup",
+    "MPI_Comm_join",
+    "MPI_Comm_rank",
+    "MPI_Comm_remote_group",
+    "MPI_Comm_remote_size",
+    "MPI_Comm_set_attr",
+    "MPI_Comm_set_errhandler",
+    "MPI_Comm_set_info",
+    "MPI_Comm_set_name",
+    "MPI_Comm_size",
+    "MPI_Comm_split",
+    "MPI_Comm_split_type",
+    "MPI_Comm_test_inter",
+    "MPI_Compare_and_swap",
+    "MPI_Dims_create",
+    "MPI_Dist_graph_create",
+    "MPI_Dist_graph_create_adjacent",
+    "MPI_Dist_graph_neighbors",
+    "MPI_Dist_graph_neighbors_count",
+    "MPI_Errhandler_create",
+    "MPI_Errhandler_free",
+    "MPI_Errhandler_get",
+    "MPI_Errhandler_set",
+    "MPI_Exscan",
+    "MPI_Fetch_and_op",
+    "MPI_File_call_errhandler",
+    "MPI_File_close",
+    "MPI_File_create_errhandler",
+    "MPI_File_delete",
+    "MPI_File_get_amode",
+    "MPI_File_get_atomicity",
+    "MPI_File_get_byte_offset",
+    "MPI_File_get_errhandler",
+    "MPI_File_get_group",
+    "MPI_File_get_info",
+    "MPI_File_get_position",
+    "MPI_File_get_position_shared",
+    "MPI_File_get_size",
+    "MPI_File_get_type_extent",
+    "MPI_File_get_view",
+    "MPI_File_iread",
+    "MPI_File_iread_at",
+    "MPI_File_iread_shared",
+    "MPI_File_iwrite",
+    "MPI_File_iwrite_at",
+    "MPI_File_iwrite_shared",
+    "MPI_File_open",
+    "MPI_File_preallocate",
+    "MPI_File_read",
+    "MPI_File_read_all",
+    "MPI_File_read_all_begin",
+    "MPI_File_read_all_end",
+    "MPI_File_read_at",
+    "MPI_File_read_at_all",
+    "MPI_File_read_at_all_begin",
+    "MPI_File_read_at_all_end",
+    "MPI_File_read_ordered",
+    "MPI_File_read_ordered_begin",
+    "MPI_File_read_ordered_end",
+    "MPI_File_read_shared",
+    "MPI_File_seek",
+    "MPI_File_seek_shared",
+    "MPI_File_set_atomicity",
+    "MPI_File_set_errhandler",
+    "MPI_File_set_info",
+    "MPI_File_set_size",
+    "MPI_File_set_view",
+    "MPI_File_sync",
+    "MPI_File_write",
+    "MPI_File_write_all",
+    "MPI_File_write_all_begin",
+    "MPI_File_write_all_end",
+    "MPI_File_write_at",
+    "MPI_File_write_at_all",
+    "MPI_File_write_at_all_begin",
+    "MPI_File_write_at_all_end",
+    "MPI_File_write_ordered",
+    "MPI_File_write_ordered_begin",
+    "MPI_File_write_ordered_end",
+    "MPI_File_write_shared",
+    "MPI_Finalized",
+    "MPI_Free_mem",
+    "MPI_Gather",
+    "MPI_Gatherv",
+    "MPI_Get",
+    "MPI_Get_accumulate",
+    "MPI_Get_address",
+    "MPI_Get_count",
+    "MPI_Get_elements",
+    "MPI_Get_elements_x",
+    "MPI_Get_library_version",
+    "MPI_Get_version",
+    "MPI_Graph_create",
+    "MPI_Graph_get",
+    "MPI_Graph_map",
+    "MPI_Graph_neighbors",
+    "MPI_Graph_neighbors_count",
+    "MPI_Graphdims_get",
+    "MPI_Grequest_complete",
+    "MPI_Grequest_start",
+    "MPI_Group_compare",
+    "MPI_Group_difference",
+    "MPI_Group_excl",
+    "MPI_Group_free",
+    "MPI_Group_incl",
+    "MPI_Group_intersection",
+    "MPI_Group_range_excl",
+    "MPI_Group_range_incl",
+    "MPI_Group_rank",
+    "MPI_Group_size",
+    "MPI_Group_translate_ranks",
+    "MPI_Group_union",
+    "MPI_Iallgather",
+    "MPI_Iallgatherv",
+    "MPI_Iallreduce",
+    "MPI_Ialltoall",
+    "MPI_Ialltoallv",
+    "MPI_Ialltoallw",
+    "MPI_Ibarrier",
+    "MPI_Ibcast",
+    "MPI_Ibsend",
+    "MPI_Iexscan",
+    "MPI_Igather",
+    "MPI_Igatherv",
+    "MPI_Improbe",
+    "MPI_Imrecv",
+    "MPI_Ineighbor_allgather",
+    "MPI_Ineighbor_allgatherv",
+    "MPI_Ineighbor_alltoall",
+    "MPI_Ineighbor_alltoallv",
+    "MPI_Ineighbor_alltoallw",
+    "MPI_Info_create",
+    "MPI_Info_delete",
+    "MPI_Info_dup",
+    "MPI_Info_free",
+    "MPI_Info_get",
+    "MPI_Info_get_nkeys",
+    "MPI_Info_get_nthkey",
+    "MPI_Info_get_valuelen",
+    "MPI_Info_set",
+    "MPI_Initialized",
+    "MPI_Intercomm_create",
+    "MPI_Intercomm_merge",
+    "MPI_Iprobe",
+    "MPI_Irecv",
+    "MPI_Ireduce",
+    "MPI_Ireduce_scatter",
+    "MPI_Ireduce_scatter_block",
+    "MPI_Irsend",
+    "MPI_Is_thread_main",
+    "MPI_Iscan",
+    "MPI_Iscatter",
+    "MPI_Iscatterv",
+    "MPI_Isend",
+    "MPI_Issend",
+    "MPI_Keyval_create",
+    "MPI_Keyval_free",
+    "MPI_Lookup_name",
+    "MPI_Mprobe",
+    "MPI_Mrecv",
+    "MPI_Neighbor_allgather",
+    "MPI_Neighbor_allgatherv",
+    "MPI_Neighbor_alltoall",
+    "MPI_Neighbor_alltoallv",
+    "MPI_Neighbor_alltoallw",
+    "MPI_Op_commutative",
+    "MPI_Op_create",
+    "MPI_Op_free",
+    "MPI_Open_port",
+    "MPI_Pack",
+    "MPI_Pack_external",
+    "MPI_Pack_external_size",
+    "MPI_Pack_size",
+    "MPI_Pcontrol",
+    "MPI_Probe",
+    "MPI_Publish_name",
+    "MPI_Put",
+    "MPI_Query_thread",
+    "MPI_Raccumulate",
+    "MPI_Recv",
+    "MPI_Recv_init",
+    "MPI_Reduce",
+    "MPI_Reduce_local",
+    "MPI_Reduce_scatter",
+    "MPI_Reduce_scatter_block",
+    "MPI_Register_datarep",
+    "MPI_Request_free",
+    "MPI_Request_get_status",
+    "MPI_Rget",
+    "MPI_Rget_accumulate",
+    "MPI_Rput",
+    "MPI_Rsend",
+    "MPI_Rsend_init",
+    "MPI_Scan",
+    "MPI_Scatter",
+    "MPI_Scatterv",
+    "MPI_Send",
+    "MPI_Send_init",
+    "MPI_Sendrecv",
+    "MPI_Sendrecv_replace",
+    "MPI_Ssend",
+    "MPI_Ssend_init",
+    "MPI_Start",
+    "MPI_Startall",
+    "MPI_Status_set_cancelled",
+    "MPI_Status_set_elements",
+    "MPI_Status_set_elements_x",
+    "MPI_Test",
+    "MPI_Test_cancelled",
+    "MPI_Testall",
+    "MPI_Testany",
+    "MPI_Testsome",
+    "MPI_Topo_test",
+    "MPI_Type_commit",
+    "MPI_Type_contiguous",
+    "MPI_Type_create_hindexed",
+    "MPI_Type_create_hindexed_block",
+    "MPI_Type_create_hvector",
+    "MPI_Type_create_indexed_block",
+    "MPI_Type_create_keyval",
+    "MPI_Type_create_resized",
+    "MPI_Type_create_struct",
+    "MPI_Type_create_subarray",
+    "MPI_Type_delete_attr",
+    "MPI_Type_dup",
+    "MPI_Type_extent",
+    "MPI_Type_free",
+    "MPI_Type_free_keyval",
+    "MPI_Type_get_attr",
+    "MPI_Type_get_envelope",
+    "MPI_Type_get_extent",
+    "MPI_Type_get_extent_x",
+    "MPI_Type_get_name",
+    "MPI_Type_get_true_extent",
+    "MPI_Type_get_true_extent_x",
+    "MPI_Type_hindexed",
+    "MPI_Type_hvector",
+    "MPI_Type_indexed",
+    "MPI_Type_lb",
+    "MPI_Type_match_size",
+    "MPI_Type_set_attr",
+    "MPI_Type_set_name",
+    "MPI_Type_size",
+    "MPI_Type_size_x",
+    "MPI_Type_struct",
+    "MPI_Type_ub",
+    "MPI_Type_vector",
+    "MPI_Unpack",
+    "MPI_Unpack_external",
+    "MPI_Unpublish_name",
+    "MPI_Wait",
+    "MPI_Waitall",
+    "MPI_Waitany",
+    "MPI_Waitsome",
+    "MPI_Win_allocate",
+    "MPI_Win_allocate_shared",
+    "MPI_Win_attach",
+    "MPI_Win_call_errhandler",
+    "MPI_Win_complete",
+    "MPI_Win_create",
+    "MPI_Win_create_dynamic",
+    "MPI_Win_create_errhandler",
+    "MPI_Win_create_keyval",
+    "MPI_Win_delete_attr",
+    "MPI_Win_detach",
+    "MPI_Win_fence",
+    "MPI_Win_flush",
+    "MPI_Win_flush_all",
+    "MPI_Win_flush_local",
+    "MPI_Win_flush_local_all",
+    "MPI_Win_free",
+    "MPI_Win_free_keyval",
+    "MPI_Win_get_attr",
+    "MPI_Win_get_errhandler",
+    "MPI_Win_get_group",
+    "MPI_Win_get_info",
+    "MPI_Win_get_name",
+    "MPI_Win_lock",
+    "MPI_Win_lock_all",
+    "MPI_Win_post",
+    "MPI_Win_set_attr",
+    "MPI_Win_set_errhandler",
+    "MPI_Win_set_info",
+    "MPI_Win_set_name",
+    "MPI_Win_shared_query",
+    "MPI_Win_start",
+    "MPI_Win_sync",
+    "MPI_Win_test",
+    "MPI_Win_unlock",
+    "MPI_Win_unlock_all",
+    "MPI_Win_wait",
+};
+
+
+int Yogi_ResolveErrorCode(int *error) {
+    return YogiManager::getInstance()->errorToYogi(*error);
+}
+
+YogiMPI_Datatype Yogi_ResolveDatatype(void *input_pointer) {
+    MPI_Datatype *to_resolve = reinterpret_cast<MPI_Datatype *>(input_pointer);
+    return YogiManager::getInstance()->datatypeToYogiFindOnly(*to_resolve);
+}
+
+YogiMPI_Comm Yogi_ResolveComm(void *input_pointer) {
+    MPI_Comm *to_resolve = reinterpret_cast<MPI_Comm *>(input_pointer);
+    return YogiManager::getInstance()->commToYogiResolve(*to_resolve);
+}
+
+YogiMPI_Comm Yogi_ResolveFortranComm(int fortran_comm) {
+    MPI_Comm c_comm = MPI_Comm_f2c(fortran_comm);
+    return YogiManager::getInstance()->commToYogiResolve(c_comm);
+}
+
+YogiMPI_Group Yogi_ResolveFortranGroup(int fortran_group) {
+    MPI_Group c_group = MPI_Group_f2c(fortran_group);
+    return YogiManager::getInstance()->groupToYogiResolve(c_group);
+}
+
+YogiMPI_Offset Yogi_ResolveOffset(void *input_pointer) {
+    MPI_Offset *to_resolve = reinterpret_cast<MPI_Offset *>(input_pointer);
+    return YogiManager::getInstance()->offsetToYogi(*to_resolve);
+}
+
+YogiMPI_Win Yogi_ResolveWin(void *input_pointer) {
+    MPI_Win *to_resolve = reinterpret_cast<MPI_Win *>(input_pointer);
+    return YogiManager::getInstance()->winToYogiResolve(*to_resolve);
+}
+
+YogiMPI_File Yogi_ResolveFile(void *input_pointer) {
+    MPI_File *to_resolve = reinterpret_cast<MPI_File *>(input_pointer);
+    return YogiManager::getInstance()->fileToYogiResolve(*to_resolve);
+}
+
+YogiMPI_Aint Yogi_ResolveAint(void *input_pointer) {
+    MPI_Aint *to_resolve = reinterpret_cast<MPI_Aint *>(input_pointer);
+    return YogiManager::getInstance()->aintToYogi(*to_resolve);
+}
+
+int YogiMPI_Comm_spawn(const char *command, char *argv[], int maxprocs, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm *intercomm, int array_of_errcodes[]) {
+    MPI_Info mInfo = YogiManager::getInstance()->infoToMPI(info);
+    MPI_Comm mComm = YogiManager::getInstance()->commToMPI(comm);
+    MPI_Comm mInterComm = YogiManager::getInstance()->commToMPI(*intercomm);
+    YogiManager::getInstance()->callDepth++;
+    int mpi_err = MPI_Comm_spawn(command, argv, maxprocs, mInfo, root, mComm, &mInterComm, array_of_errcodes);
+    YogiManager::getInstance()->callDepth--;
+    return YogiManager::getInstance()->errorToYogi(mpi_err);
+}
+
+
+int YogiMPI_Init(int* argc, char ***argv)
+{
+    /* Construct the manager here so the wrappers never have to. */
+    YogiManager &yogi = *YogiManager::getInstance();
+    yogi.loadMPILibrary();
+    yogi.callDepth++;
+    int mpi_err;
+    int provided = MPI_THREAD_SINGLE;
+    /* The progress thread calls MPI alongside the application. */
+    if (yogi.progress.wanted()) {
+        mpi_err = MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
+        yogi.setThreadMultiple(provided == MPI_THREAD_MULTIPLE);
+    }
+    else {
+        mpi_err = MPI_Init(argc, argv);
+    }
+    yogi.callDepth--;
+#ifdef YOGI_DEBUG
+    int glob_rank = -1;
+    yogi.callDepth++;
+    MPI_Comm_rank(MPI_COMM_WORLD, &glob_rank);
+    yogi.callDepth--;
+    yogi.setGlobalRank(glob_rank);
+    /* The trace starts once MPI is up, so the call to MPI_Init itself
+       shows with no duration. */
+    yogi.tracer.start(glob_rank, functionNames, YOGI_NUM_FUNCTIONS);
+    yogi.tracer.enter(YOGI_ID_MPI_Init, -1, -1, -1);
+    yogi.tracer.exit(YOGI_ID_MPI_Init, 0, mpi_err);
+#endif
+#ifdef YOGI_PROFILE
+    yogi.profiler.start(functionNames, YOGI_NUM_FUNCTIONS);
+#endif
+    if (mpi_err == MPI_SUCCESS) {
+        yogi.scheduler.adoptComm(YogiMPI_COMM_WORLD, MPI_COMM_WORLD);
+        yogi.scheduler.adoptComm(YogiMPI_COMM_SELF, MPI_COMM_SELF);
+        yogi.progress.start(provided == MPI_THREAD_MULTIPLE);
+    }
+    return yogi.errorToYogi(mpi_err);
+}
+
+int YogiMPI_Init_thread(int* argc, char*** argv, int required, int* provided) {
+    int mpi_error;
+    /* Construct the manager here so the wrappers never have to. */
+    YogiManager &yogi = *YogiManager::getInstance();
+    yogi.loadMPILibrary();
+
+    required = yogi.threadmodelToMPI(required);
+    // The application gets the higher level, which MPI allows.
+    if (yogi.progress.wanted()) required = MPI_THREAD_MULTIPLE;
+    yogi.callDepth++;
+    mpi_error = MPI_Init_thread(argc, argv, required, provided);
+    yogi.callDepth--;
+    bool threadMultiple = *provided == MPI_THREAD_MULTIPLE;
+    yogi.setThreadMultiple(threadMultiple);
+    *provided = yogi.providedToYogi(*provided);
+#ifdef YOGI_DEBUG
+    int glob_rank = -1;
+    yogi.callDepth++;
+    MPI_Comm_rank(MPI_COMM_WORLD, &glob_rank);
+    yogi.callDepth--;
+    yogi.setGlobalRank(glob_rank);
+    /* The trace starts once MPI is up, so the call to MPI_Init_thread itself
+       shows with no duration. */
+    yogi.tracer.start(glob_rank, functionNames, YOGI_NUM_FUNCTIONS);
+    yogi.tracer.enter(YOGI_ID_MPI_Init_thread, -1, -1, -1);
+    yogi.tracer.exit(YOGI_ID_MPI_Init_thread, 0, mpi_error);
+#endif
+#ifdef YOGI_PROFILE
+    yogi.profiler.start(functionNames, YOGI_NUM_FUNCTIONS);
+#endif
+    if (mpi_error == MPI_SUCCESS) {
+        yogi.scheduler.adoptComm(YogiMPI_COMM_WORLD, MPI_COMM_WORLD);
+        yogi.scheduler.adoptComm(YogiMPI_COMM_SELF, MPI_COMM_SELF);
+        yogi.progress.start(threadMultiple);
+    }
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Error_class(int errorcode, int* errorclass) {
+
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Error_class, -1, -1, -1);
+#endif
+
+    /* We make an assumption that error codes line up with classes. In the
+       case of implementation-specific error codes that do not, this must
+       be revised. */
+    *errorclass = errorcode;
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Error_class, 0,
+                                            MPI_SUCCESS);
+#endif
+    return YogiManager::getInstance()->errorToYogi(MPI_SUCCESS);
+}
+
+int YogiMPI_Finalize() {
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Finalize, -1, -1, -1);
+#endif
+    // NOTE: Incrementing/decrementing "callDepth" around MPI_Finalize breaks
+    //       some things in some client unit tests.
+    YogiManager::getInstance()->progress.stop();
+#ifdef YOGI_PROFILE
+    YogiManager::getInstance()->profiler.report();
+#endif
+    YogiManager::getInstance()->releaseNodeComms();
+    YogiManager::getInstance()->scheduler.release();
+    YogiManager::getInstance()->reportPools();
+    int mpi_err = MPI_Finalize();
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Finalize, 0, mpi_err);
+    YogiManager::getInstance()->tracer.stop();
+#endif
+    return YogiManager::getInstance()->errorToYogi(mpi_err);
+}
+
+int YogiMPI_Get_processor_name(char* name, int* resultlen) {
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Get_processor_name, -1, -1, -1);
+#endif
+    if (MPI_MAX_PROCESSOR_NAME > YogiMPI_MAX_PROCESSOR_NAME) {
+        char *tmp_name = new char[MPI_MAX_PROCESSOR_NAME];
+        YogiManager::getInstance()->callDepth++;
+        mpi_error = MPI_Get_processor_name(tmp_name, resultlen);
+        YogiManager::getInstance()->callDepth--;
+        std::memcpy(name, tmp_name, YogiMPI_MAX_PROCESSOR_NAME - 1);
+        name[YogiMPI_MAX_PROCESSOR_NAME - 1] = '\0';
+        delete[] tmp_name;
+        if (*resultlen > YogiMPI_MAX_PROCESSOR_NAME - 1) {
+            *resultlen = YogiMPI_MAX_PROCESSOR_NAME - 1;
+        }
+    }
+    else {
+        YogiManager::getInstance()->callDepth++;
+        mpi_error = MPI_Get_processor_name(name, resultlen);
+        YogiManager::getInstance()->callDepth--;
+    }
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Get_processor_name, 0,
+                                            mpi_error);
+#endif
+    return YogiManager::getInstance()->errorToYogi(mpi_error);
+}
+
+int YogiMPI_Error_string(int errorcode, char* string, int* resultlen) {
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Error_string, -1, -1, -1);
+#endif
+    int mpi_error;
+    errorcode = YogiManager::getInstance()->errorToMPI(errorcode);
+    if (MPI_MAX_ERROR_STRING > YogiMPI_MAX_ERROR_STRING) {
+        char *tmp_string = new char[MPI_MAX_ERROR_STRING];
+        YogiManager::getInstance()->callDepth++;
+        mpi_error = MPI_Error_string(errorcode, tmp_string, resultlen);
+        YogiManager::getInstance()->callDepth--;
+        if (*resultlen > YogiMPI_MAX_ERROR_STRING - 1) {
+            std::memcpy(string, tmp_string, YogiMPI_MAX_ERROR_STRING - 1);
+            *resultlen = YogiMPI_MAX_ERROR_STRING - 1;
+            string[YogiMPI_MAX_ERROR_STRING - 1] = '\0';
+        }
+        else {
+            std::memcpy(string, tmp_string, *resultlen);
+            string[*resultlen] = '\0';
+        }
+        delete[] tmp_string;
+    }
+    else {
+        YogiManager::getInstance()->callDepth++;
+        mpi_error = MPI_Error_string(errorcode, string, resultlen);
+        YogiManager::getInstance()->callDepth--;
+    }
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Error_string, 0,
+                                            mpi_error);
+#endif
+    return YogiManager::getInstance()->errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_contents(YogiMPI_Datatype datatype, int max_integers,
+                              int max_addresses, int max_datatypes,
+                              int array_of_integers[],
+                              YogiMPI_Aint array_of_addresses[],
+                              YogiMPI_Datatype array_of_datatypes[]) {
+
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Type_get_contents, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = YogiManager::getInstance()->datatypeToMPI(datatype);
+
+    /* In order to appropriately handle this function, we must call
+     * MPI_Type_get_envelope to figure out what the user will get. This helps
+     * determine if the type is derived and if new datatype handles are added
+     * to our translation pool.
+     */
+    int num_integers, num_addresses, num_datatypes, combiner;
+    YogiManager::getInstance()->callDepth++;
+    MPI_Type_get_envelope(conv_datatype, &num_integers, &num_addresses,
+                          &num_datatypes, &combiner);
+    YogiManager::getInstance()->callDepth--;
+
+    YogiScratch<MPI_Aint> scratch_array_of_addresses;
+    YogiScratch<MPI_Datatype> scratch_array_of_datatypes;
+    MPI_Aint * conv_array_of_addresses =
+        scratch_array_of_addresses.get(max_addresses);
+    MPI_Datatype * conv_array_of_datatypes =
+        scratch_array_of_datatypes.get(max_datatypes);
+    YogiManager::getInstance()->callDepth++;
+    mpi_error = MPI_Type_get_contents(conv_datatype, max_integers,
+                                      max_addresses, max_datatypes,
+                                      array_of_integers,
+                                      conv_array_of_addresses,
+                                      conv_array_of_datatypes);
+    YogiManager::getInstance()->callDepth--;
+    if (combiner != MPI_COMBINER_F90_COMPLEX &&
+        combiner != MPI_COMBINER_F90_REAL &&
+        combiner != MPI_COMBINER_F90_INTEGER) {
+        /* The array won't be empty, so convert them to Yogi versions. */
+        YogiManager::getInstance()->datatypeToYogi(conv_array_of_datatypes,
+                                                   array_of_datatypes,
+                                                   max_datatypes);
+    }
+
+    YogiManager::getInstance()->aintToYogi(conv_array_of_addresses, array_of_addresses, max_addresses);
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Type_get_contents, 0,
+                                            mpi_error);
+#endif
+    return YogiManager::getInstance()->errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_darray(int size, int rank, int ndims, int array_of_gsizes[], int array_of_distribs[], int array_of_dargs[], int array_of_psizes[], int order, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Type_create_darray, -1, -1, -1);
+#endif
+
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = YogiManager::getInstance()->datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+
+    /* Constant conversion requires some temporary arrays to hold state
+     * and distribution values.
+     */
+    int *distribs_conv = new int[ndims];
+    int *dargs_conv = new int[ndims];
+    int i;
+    for (i = 0; i < ndims; i++) {
+        switch(array_of_distribs[i]) {
+            case YogiMPI_DISTRIBUTE_BLOCK:
+                distribs_conv[i] = MPI_DISTRIBUTE_BLOCK;
+                break;
+            case YogiMPI_DISTRIBUTE_CYCLIC:
+                distribs_conv[i] = MPI_DISTRIBUTE_CYCLIC;
+                    break;
+            case YogiMPI_DISTRIBUTE_NONE:
+                distribs_conv[i] = MPI_DISTRIBUTE_NONE;
+                    break;
+            default:
+                    distribs_conv[i] = array_of_distribs[i];
+        }
+        if (array_of_dargs[i] == YogiMPI_DISTRIBUTE_DFLT_DARG) {
+            dargs_conv[i] = MPI_DISTRIBUTE_DFLT_DARG;
+        }
+        else {
+                dargs_conv[i] = array_of_dargs[i];
+        }
+    }
+
+    if (order == YogiMPI_ORDER_C) {
+        order = MPI_ORDER_C;
+    }
+    else if(order == YogiMPI_ORDER_FORTRAN) {
+        order = MPI_ORDER_FORTRAN;
+    }
+
+    YogiManager::getInstance()->callDepth++;
+    mpi_error = MPI_Type_create_darray(size, rank, ndims, array_of_gsizes, distribs_conv, dargs_conv, array_of_psizes, order, conv_oldtype, &conv_newtype);
+    YogiManager::getInstance()->callDepth--;
+    *newtype = YogiManager::getInstance()->datatypeToYogi(conv_newtype);
+
+    delete[] distribs_conv;
+    delete[] dargs_conv;
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Type_create_darray, 0,
+                                            mpi_error);
+#endif
+    return YogiManager::getInstance()->errorToYogi(mpi_error);
+}
+
+double YogiMPI_Wtick() {
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Wtick, -1, -1, -1);
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Wtick, 0, MPI_SUCCESS);
+#endif
+    return MPI_Wtick();
+}
+
+double YogiMPI_Wtime() {
+#ifdef YOGI_DEBUG
+    YogiManager::getInstance()->tracer.enter(YOGI_ID_MPI_Wtime, -1, -1, -1);
+    YogiManager::getInstance()->tracer.exit(YOGI_ID_MPI_Wtime, 0, MPI_SUCCESS);
+#endif
+    return MPI_Wtime();
+}
+
+/* Converter functions between Fortran and C - really not needed since we
+   have a single ABI, but provided. */
+
+YogiMPI_Fint YogiMPI_Comm_c2f(YogiMPI_Comm comm) {
+    return comm;
+}
+
+YogiMPI_Comm YogiMPI_Comm_f2c(YogiMPI_Fint comm) {
+    return comm;
+}
+
+YogiMPI_Fint YogiMPI_Errhandler_c2f(YogiMPI_Errhandler err) {
+    return err;
+}
+
+YogiMPI_Errhandler YogiMPI_Errhandler_f2c(YogiMPI_Fint err) {
+    return err;
+}
+
+YogiMPI_Fint YogiMPI_File_c2f(YogiMPI_File file) {
+    return file;
+}
+
+YogiMPI_File YogiMPI_File_f2c(YogiMPI_Fint file) {
+    return file;
+}
+
+YogiMPI_Fint YogiMPI_Group_c2f(YogiMPI_Group group) {
+    return group;
+}
+
+YogiMPI_Group YogiMPI_Group_f2c(YogiMPI_Fint group) {
+    return group;
+}
+
+YogiMPI_Fint YogiMPI_Info_c2f(YogiMPI_Info info) {
+    return info;
+}
+
+YogiMPI_Info YogiMPI_Info_f2c(YogiMPI_Fint info) {
+    return info;
+}
+
+YogiMPI_Fint YogiMPI_Op_c2f(YogiMPI_Op op) {
+    return op;
+}
+
+YogiMPI_Op YogiMPI_Op_f2c(YogiMPI_Fint op) {
+    return op;
+}
+
+YogiMPI_Fint YogiMPI_Request_c2f(YogiMPI_Request request) {
+    return request;
+}
+
+YogiMPI_Request YogiMPI_Request_f2c(YogiMPI_Fint request) {
+    return request;
+}
+
+int YogiMPI_Status_f2c(const YogiMPI_Fint *f_status, YogiMPI_Status *c_status) {
+    /* Do nothing - these are already equivalent. */
+    return YogiManager::getInstance()->errorToYogi(MPI_SUCCESS);
+}
+
+int YogiMPI_Status_c2f(const YogiMPI_Status *c_status, YogiMPI_Fint *f_status) {
+    /* Do nothing - these are already equivalent. */
+    return YogiManager::getInstance()->errorToYogi(MPI_SUCCESS);
+}
+
+YogiMPI_Fint YogiMPI_Type_c2f(YogiMPI_Datatype datatype) {
+    return datatype;
+}
+
+YogiMPI_Datatype YogiMPI_Type_f2c(YogiMPI_Fint datatype) {
+    return datatype;
+}
+
+YogiMPI_Fint YogiMPI_Win_c2f(YogiMPI_Win win) {
+    return win;
+}
+
+YogiMPI_Win YogiMPI_Win_f2c(YogiMPI_Fint win) {
+    return win;
+}
+
+int YogiX_Pool_stats(int handle_class, YogiX_Pool_info *info) {
+    if (info == NULL) return YogiMPI_ERR_ARG;
+    if (!YogiManager::getInstance()->poolStats(handle_class, info)) {
+        return YogiMPI_ERR_ARG;
+    }
+    return YogiMPI_SUCCESS;
+}
+
+int YogiX_Startall_waitall(int count, YogiMPI_Request array_of_requests[],
+                           YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+    /* One conversion serves both calls, and none at all when the same
+       persistent set comes again. */
+    YogiScratch<MPI_Request> scratch_requests;
+    MPI_Request *conv_requests = yogi.requestToMPICached(array_of_requests,
+                                                         count,
+                                                         scratch_requests);
+    int mpi_error = MPI_Startall(count, conv_requests);
+    if (mpi_error != MPI_SUCCESS) return yogi.errorToYogi(mpi_error);
+    if (array_of_statuses == YogiMPI_STATUSES_IGNORE) {
+        if (!yogi.scheduler.waitall(count, conv_requests, MPI_STATUSES_IGNORE,
+                                    &mpi_error)) {
+            mpi_error = MPI_Waitall(count, conv_requests, MPI_STATUSES_IGNORE);
+        }
+    }
+    else {
+        MPI_Status *conv_statuses = yogi.statusesToMPI(array_of_statuses,
+                                                       count);
+        if (!yogi.scheduler.waitall(count, conv_requests, conv_statuses,
+                                    &mpi_error)) {
+            mpi_error = MPI_Waitall(count, conv_requests, conv_statuses);
+        }
+        yogi.statusesToYogiInPlace(array_of_statuses, count);
+    }
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiX_Cq_create(YogiX_Cq *cq) {
+    if (cq == NULL) return YogiMPI_ERR_ARG;
+    *cq = YogiManager::instance().createCompletionQueue();
+    return YogiMPI_SUCCESS;
+}
+
+int YogiX_Cq_add(YogiX_Cq cq, int count, YogiMPI_Request array_of_requests[],
+                 const int array_of_ids[]) {
+    YogiManager &yogi = YogiManager::instance();
+    YogiCompletionQueue *queue = yogi.completionQueue(cq);
+    if (queue == NULL) return YogiMPI_ERR_ARG;
+    if (count < 0) return YogiMPI_ERR_COUNT;
+    return yogi.addToCompletionQueue(*queue, count, array_of_requests,
+                                     array_of_ids);
+}
+
+int YogiX_Cq_poll(YogiX_Cq cq, int maxcount, int *outcount, int array_of_ids[],
+                  YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+    YogiCompletionQueue *queue = yogi.completionQueue(cq);
+    if (queue == NULL) return YogiMPI_ERR_ARG;
+    if (maxcount < 0) return YogiMPI_ERR_COUNT;
+    return yogi.pollCompletionQueue(*queue, false, maxcount, outcount,
+                                    array_of_ids, array_of_statuses);
+}
+
+int YogiX_Cq_wait(YogiX_Cq cq, int maxcount, int *outcount, int array_of_ids[],
+                  YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+    YogiCompletionQueue *queue = yogi.completionQueue(cq);
+    if (queue == NULL) return YogiMPI_ERR_ARG;
+    if (maxcount < 1) return YogiMPI_ERR_COUNT;
+    return yogi.pollCompletionQueue(*queue, true, maxcount, outcount,
+                                    array_of_ids, array_of_statuses);
+}
+
+int YogiX_Cq_pending(YogiX_Cq cq, int *count) {
+    YogiManager &yogi = YogiManager::instance();
+    YogiCompletionQueue *queue = yogi.completionQueue(cq);
+    if (queue == NULL || count == NULL) return YogiMPI_ERR_ARG;
+    *count = yogi.completionQueuePending(*queue);
+    return YogiMPI_SUCCESS;
+}
+
+int YogiX_Cq_free(YogiX_Cq *cq) {
+    if (cq == NULL) return YogiMPI_ERR_ARG;
+    int error = YogiManager::instance().freeCompletionQueue(*cq);
+    if (error == YogiMPI_SUCCESS) *cq = YogiX_CQ_NULL;
+    return error;
+}
+
+int YogiX_Allreduce_init(const void *sendbuf, void *recvbuf, int count,
+                         YogiMPI_Datatype datatype, YogiMPI_Op op,
+                         YogiMPI_Comm comm, YogiMPI_Info info,
+                         YogiX_Plan *plan) {
+    if (plan == NULL) return YogiMPI_ERR_ARG;
+    if (comm == YogiMPI_COMM_NULL) return YogiMPI_ERR_COMM;
+    if (count < 0) return YogiMPI_ERR_COUNT;
+    if (datatype == YogiMPI_DATATYPE_NULL) return YogiMPI_ERR_TYPE;
+    if (op == YogiMPI_OP_NULL) return YogiMPI_ERR_OP;
+    YogiManager &yogi = YogiManager::instance();
+    std::unique_ptr<YogiPlan> made(new YogiPlan());
+    made->kind = YogiPlan::allreduce;
+    made->sendbuf = sendbuf == YogiMPI_IN_PLACE ? MPI_IN_PLACE : sendbuf;
+    made->recvbuf = recvbuf;
+    made->count = count;
+    made->datatype = datatype;
+    made->op = op;
+    made->comm = comm;
+    made->sendtype = yogi.datatypeToMPI(datatype);
+    made->mpiOp = yogi.opToMPI(op);
+    made->mpiComm = yogi.commToMPI(comm);
+    return yogi.createPlan(std::move(made), yogi.infoToMPI(info), plan);
+}
+
+int YogiX_Alltoallv_init(const void *sendbuf, const int sendcounts[],
+                         const int sdispls[], YogiMPI_Datatype sendtype,
+                         void *recvbuf, const int recvcounts[],
+                         const int rdispls[], YogiMPI_Datatype recvtype,
+                         YogiMPI_Comm comm, YogiMPI_Info info,
+                         YogiX_Plan *plan) {
+    bool inPlace = sendbuf == YogiMPI_IN_PLACE;
+    if (plan == NULL || recvcounts == NULL || rdispls == NULL ||
+        (!inPlace && (sendcounts == NULL || sdispls == NULL))) {
+        return YogiMPI_ERR_ARG;
+    }
+    if (comm == YogiMPI_COMM_NULL) return YogiMPI_ERR_COMM;
+    if (recvtype == YogiMPI_DATATYPE_NULL ||
+        (!inPlace && sendtype == YogiMPI_DATATYPE_NULL)) {
+        return YogiMPI_ERR_TYPE;
+    }
+    YogiManager &yogi = YogiManager::instance();
+    int size = yogi.commInfo(comm).remoteSize;
+    for (int i = 0; i < size; i++) {
+        if (recvcounts[i] < 0 || (!inPlace && sendcounts[i] < 0)) {
+            return YogiMPI_ERR_COUNT;
+        }
+    }
+    std::unique_ptr<YogiPlan> made(new YogiPlan());
+    made->kind = YogiPlan::alltoallv;
+    made->sendbuf = inPlace ? MPI_IN_PLACE : sendbuf;
+    made->recvbuf = recvbuf;
+    made->comm = comm;
+    if (!inPlace) {
+        made->sendcounts.assign(sendcounts, sendcounts + size);
+        made->sdispls.assign(sdispls, sdispls + size);
+        made->sendtype = yogi.datatypeToMPI(sendtype);
+    }
+    made->recvcounts.assign(recvcounts, recvcounts + size);
+    made->rdispls.assign(rdispls, rdispls + size);
+    made->recvtype = yogi.datatypeToMPI(recvtype);
+    made->mpiComm = yogi.commToMPI(comm);
+    return yogi.createPlan(std::move(made), yogi.infoToMPI(info), plan);
+}
+
+int YogiX_Start(YogiX_Plan plan, YogiMPI_Request *request) {
+    YogiManager &yogi = YogiManager::instance();
+    YogiPlan *found = yogi.plan(plan);
+    if (found == NULL) return YogiMPI_ERR_ARG;
+    return yogi.startPlan(*found, request);
+}
+
+int YogiX_Plan_free(YogiX_Plan *plan) {
+    if (plan == NULL) return YogiMPI_ERR_ARG;
+    int error = YogiManager::instance().freePlan(*plan);
+    if (error == YogiMPI_SUCCESS) *plan = YogiX_PLAN_NULL;
+    return error;
+}
+
+// Begin automatically-generated function code.
+int YogiMPI_Abort(YogiMPI_Comm comm, int errorcode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Abort, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Abort(conv_comm, errorcode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Abort, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Abort, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Accumulate, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Accumulate((void*)origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_op, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Accumulate, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Accumulate, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Add_error_class(int* errorclass) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Add_error_class, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Add_error_class(errorclass);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Add_error_class, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Add_error_class, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Add_error_code(int errorclass, int* errorcode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Add_error_code, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Add_error_code(errorclass, errorcode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Add_error_code, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Add_error_code, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Add_error_string(int errorcode, const char* string) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Add_error_string, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Add_error_string(errorcode, (char*)string);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Add_error_string, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Add_error_string, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Address(const void* location, YogiMPI_Aint* address) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Address, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_address;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Address((void*)location, &conv_address);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Address, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *address = yogi.aintToYogi(conv_address);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Address, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Allgather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Allgather, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Allgather((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Allgather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Allgather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Allgatherv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* displs, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Allgatherv, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Allgatherv((void*)sendbuf, sendcount, conv_sendtype, recvbuf, (int*)recvcounts, (int*)displs, conv_recvtype, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Allgatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Allgatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Alloc_mem(YogiMPI_Aint size, YogiMPI_Info info, void* baseptr) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Alloc_mem, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_size;
+    conv_size = yogi.aintToMPI(size);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Alloc_mem(conv_size, conv_info, baseptr);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Alloc_mem, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Alloc_mem, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Allreduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Allreduce, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (!(yogi.hierarchicalAllreduce(sendbuf, recvbuf, count, datatype, conv_datatype, op, conv_op, comm, conv_comm, &mpi_error))) {
+        mpi_error = MPI_Allreduce((void*)sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Allreduce, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Allreduce, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Alltoall(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Alltoall, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Alltoall((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Alltoall, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Alltoall, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Alltoallv, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Alltoallv((void*)sendbuf, (int*)sendcounts, (int*)sdispls, conv_sendtype, recvbuf, (int*)recvcounts, (int*)rdispls, conv_recvtype, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Alltoallv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Alltoallv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Alltoallw(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtypes[], void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Alltoallw, -1, -1, comm);
+#endif
+    int mpi_error;
+    int comm_size = yogi.commInfo(comm).remoteSize;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    YogiScratch<MPI_Datatype> scratch_sendtypes;
+    MPI_Datatype * conv_sendtypes = yogi.datatypeToMPICached(comm, 0, sendtypes, comm_size, scratch_sendtypes);
+    YogiScratch<MPI_Datatype> scratch_recvtypes;
+    MPI_Datatype * conv_recvtypes = yogi.datatypeToMPICached(comm, 1, recvtypes, comm_size, scratch_recvtypes);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Alltoallw(sendbuf, sendcounts, sdispls, conv_sendtypes, recvbuf, recvcounts, rdispls, conv_recvtypes, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Alltoallw, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Alltoallw, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Attr_delete(YogiMPI_Comm comm, int keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Attr_delete, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Attr_delete(conv_comm, keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Attr_delete, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Attr_delete, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Attr_get(YogiMPI_Comm comm, int keyval, void* attribute_val, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Attr_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    keyval = yogi.commattrToMPI(keyval);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Attr_get(conv_comm, keyval, attribute_val, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Attr_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Attr_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Attr_put(YogiMPI_Comm comm, int keyval, void* attribute_val) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Attr_put, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Attr_put(conv_comm, keyval, attribute_val);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Attr_put, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Attr_put, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Barrier(YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Barrier, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Barrier(conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Barrier, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Barrier, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Bcast(void* buffer, int count, YogiMPI_Datatype datatype, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Bcast, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (!(yogi.hierarchicalBcast(buffer, count, conv_datatype, root, comm, conv_comm, &mpi_error))) {
+        mpi_error = MPI_Bcast(buffer, count, conv_datatype, root, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Bcast, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Bcast, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Bsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Bsend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Bsend((void*)buf, count, conv_datatype, dest, tag, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Bsend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Bsend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Bsend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Bsend_init, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Bsend_init((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Bsend_init, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+    if (mpi_error == MPI_SUCCESS) yogi.markPersistent(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Bsend_init, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Buffer_attach(void* buffer, int size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Buffer_attach, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Buffer_attach(buffer, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Buffer_attach, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Buffer_attach, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Buffer_detach(void* buffer_addr, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Buffer_detach, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Buffer_detach(buffer_addr, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Buffer_detach, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Buffer_detach, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cancel(YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cancel, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(*request);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cancel(&conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cancel, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cancel, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_coords(YogiMPI_Comm comm, int rank, int maxdims, int coords[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_coords, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_coords(conv_comm, rank, maxdims, coords);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_coords, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_coords, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_create(YogiMPI_Comm comm_old, int ndims, int dims[], int periods[], int reorder, YogiMPI_Comm* comm_cart) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm_old;
+    conv_comm_old = yogi.commToMPI(comm_old);
+    MPI_Comm conv_comm_cart;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_create(conv_comm_old, ndims, dims, periods, reorder, &conv_comm_cart);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm_cart = yogi.commToYogi(conv_comm_cart);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*comm_cart, conv_comm_cart);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_get(YogiMPI_Comm comm, int maxdims, int dims[], int periods[], int coords[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_get(conv_comm, maxdims, dims, periods, coords);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_map(YogiMPI_Comm comm, int ndims, int dims[], int periods[], int* newrank) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_map, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_map(conv_comm, ndims, dims, periods, newrank);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_map, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*newrank == MPI_UNDEFINED) {
+        *newrank = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_map, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_rank(YogiMPI_Comm comm, int coords[], int* rank) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_rank, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_rank(conv_comm, coords, rank);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_rank, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_rank, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_shift(YogiMPI_Comm comm, int direction, int disp, int* rank_source, int* rank_dest) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_shift, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_shift(conv_comm, direction, disp, rank_source, rank_dest);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_shift, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*rank_source == MPI_PROC_NULL) {
+        *rank_source = YogiMPI_PROC_NULL;
+    }
+    if (*rank_dest == MPI_PROC_NULL) {
+        *rank_dest = YogiMPI_PROC_NULL;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_shift, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cart_sub(YogiMPI_Comm comm, int remain_dims[], YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cart_sub, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cart_sub(conv_comm, remain_dims, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cart_sub, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cart_sub, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Cartdim_get(YogiMPI_Comm comm, int* ndims) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Cartdim_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Cartdim_get(conv_comm, ndims);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Cartdim_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Cartdim_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Close_port(const char* port_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Close_port, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Close_port((char*)port_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Close_port, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Close_port, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_accept(const char* port_name, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_accept, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_accept((char*)port_name, conv_info, root, conv_comm, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_accept, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_accept, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_call_errhandler(YogiMPI_Comm comm, int errorcode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_call_errhandler, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    errorcode = yogi.errorToMPI(errorcode);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_call_errhandler(conv_comm, errorcode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_call_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_call_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_compare(YogiMPI_Comm comm1, YogiMPI_Comm comm2, int* result) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_compare, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm1;
+    conv_comm1 = yogi.commToMPI(comm1);
+    MPI_Comm conv_comm2;
+    conv_comm2 = yogi.commToMPI(comm2);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_compare(conv_comm1, conv_comm2, result);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_compare, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *result = yogi.comparisonToYogi(*result);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_compare, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_connect(const char* port_name, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_connect, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_connect((char*)port_name, conv_info, root, conv_comm, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_connect, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_connect, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_create(YogiMPI_Comm comm, YogiMPI_Group group, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_create, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_create(conv_comm, conv_group, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_create_errhandler(YogiMPI_Comm_errhandler_function* comm_errhandler_fn, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_create_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm_errhandler_function* conv_comm_errhandler_fn;
+    conv_comm_errhandler_fn = (MPI_Comm_errhandler_function*)comm_errhandler_fn;
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_create_errhandler(conv_comm_errhandler_fn, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_create_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_create_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_create_group(YogiMPI_Comm comm, YogiMPI_Group group, int tag, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_create_group, -1, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_create_group(conv_comm, conv_group, tag, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_create_group, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_create_group, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_create_keyval(YogiMPI_Comm_copy_attr_function* comm_copy_attr_fn, YogiMPI_Comm_delete_attr_function* comm_delete_attr_fn, int* comm_keyval, void* extra_state) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_create_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiMPI_Comm_copy_attr_function* comm_copy_attr_keep = nullptr;
+    YogiMPI_Comm_delete_attr_function* comm_delete_attr_keep = nullptr;
+    MPI_Comm_copy_attr_function* conv_comm_copy_attr_fn;
+    if (comm_copy_attr_fn == YogiMPI_COMM_NULL_COPY_FN) {
+        conv_comm_copy_attr_fn = MPI_COMM_NULL_COPY_FN;
+    }
+    else if(comm_copy_attr_fn == YogiMPI_COMM_DUP_FN) {
+        conv_comm_copy_attr_fn = MPI_COMM_DUP_FN;
+    }
+    else {
+        comm_copy_attr_keep = comm_copy_attr_fn;
+        conv_comm_copy_attr_fn = [](MPI_Comm c, int k, void* e, void* i, void* o, int* f) -> int {
+            YogiMPI_Comm revert_comm = Yogi_ResolveComm(&c);
+            k = YogiManager::instance().commattrToMPI(k);
+            auto fn = YogiManager::instance().copyAttrFn(k);
+            return fn(revert_comm, k, e, i, o, f);
+        };
+    }
+    MPI_Comm_delete_attr_function* conv_comm_delete_attr_fn;
+    if (comm_delete_attr_fn == YogiMPI_COMM_NULL_DELETE_FN) {
+        conv_comm_delete_attr_fn = MPI_COMM_NULL_DELETE_FN;
+    }
+    else {
+        comm_delete_attr_keep = comm_delete_attr_fn;
+        conv_comm_delete_attr_fn = [](MPI_Comm c, int k, void* v, void* e) -> int {
+            YogiMPI_Comm revert_comm = Yogi_ResolveComm(&c);
+            k = YogiManager::instance().commattrToMPI(k);
+            auto fn = YogiManager::instance().delAttrFn(k);
+            return fn(revert_comm, k, v, e);
+        };
+    }
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_create_keyval(conv_comm_copy_attr_fn, conv_comm_delete_attr_fn, comm_keyval, extra_state);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_create_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (comm_copy_attr_keep) yogi.copyAttrFn(*comm_keyval, comm_copy_attr_keep);
+    if (comm_delete_attr_keep) yogi.delAttrFn(*comm_keyval, comm_delete_attr_keep);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_create_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_delete_attr(YogiMPI_Comm comm, int comm_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_delete_attr, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    comm_keyval = yogi.commattrToMPI(comm_keyval);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_delete_attr(conv_comm, comm_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_delete_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_delete_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_disconnect(YogiMPI_Comm* comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_disconnect, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(*comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_disconnect(&conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_disconnect, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm = yogi.unmapComm(*comm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_disconnect, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_dup(YogiMPI_Comm comm, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_dup, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_dup(conv_comm, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_dup, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_dup, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_dup_with_info(YogiMPI_Comm comm, YogiMPI_Info info, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_dup_with_info, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_dup_with_info(conv_comm, conv_info, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_dup_with_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_dup_with_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_free(YogiMPI_Comm* comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(*comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_free(&conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm = yogi.unmapComm(*comm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_free_keyval(int* comm_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_free_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_free_keyval(comm_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_free_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*comm_keyval == MPI_KEYVAL_INVALID) {
+        *comm_keyval = YogiMPI_KEYVAL_INVALID;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_free_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_get_attr(YogiMPI_Comm comm, int comm_keyval, void* attribute_val, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_get_attr, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    comm_keyval = yogi.commattrToMPI(comm_keyval);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_get_attr(conv_comm, comm_keyval, attribute_val, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_get_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_get_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_get_errhandler(YogiMPI_Comm comm, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_get_errhandler, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_get_errhandler(conv_comm, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_get_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_errhandler == MPI_ERRHANDLER_NULL) {
+        *errhandler = YogiMPI_ERRHANDLER_NULL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_ARE_FATAL) {
+        *errhandler = YogiMPI_ERRORS_ARE_FATAL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_RETURN) {
+        *errhandler = YogiMPI_ERRORS_RETURN;
+    }
+    else {
+        *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_get_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_get_info(YogiMPI_Comm comm, YogiMPI_Info* info_used) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_get_info, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Info conv_info_used;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_get_info(conv_comm, &conv_info_used);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_get_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *info_used = yogi.infoToYogi(conv_info_used);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_get_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_get_name(YogiMPI_Comm comm, char* comm_name, int* resultlen) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_get_name, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_get_name(conv_comm, comm_name, resultlen);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_get_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_get_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_get_parent(YogiMPI_Comm* parent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_get_parent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_parent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_get_parent(&conv_parent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_get_parent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *parent = yogi.commToYogi(conv_parent);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_get_parent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_group(YogiMPI_Comm comm, YogiMPI_Group* group) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_group, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Group conv_group;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_group(conv_comm, &conv_group);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_group, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *group = yogi.groupToYogi(conv_group);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_group, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_idup(YogiMPI_Comm comm, YogiMPI_Comm* newcomm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_idup, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Comm conv_newcomm;
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_idup(conv_comm, &conv_newcomm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_idup, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_idup, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_join(int fd, YogiMPI_Comm* intercomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_join, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_intercomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_join(fd, &conv_intercomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_join, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *intercomm = yogi.commToYogi(conv_intercomm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_join, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_rank(YogiMPI_Comm comm, int* rank) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_rank, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_rank(conv_comm, rank);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_rank, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_rank, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_remote_group(YogiMPI_Comm comm, YogiMPI_Group* group) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_remote_group, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Group conv_group;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_remote_group(conv_comm, &conv_group);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_remote_group, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *group = yogi.groupToYogi(conv_group);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_remote_group, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_remote_size(YogiMPI_Comm comm, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_remote_size, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_remote_size(conv_comm, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_remote_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_remote_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_set_attr(YogiMPI_Comm comm, int comm_keyval, void* attribute_val) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_set_attr, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    comm_keyval = yogi.commattrToMPI(comm_keyval);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_set_attr(conv_comm, comm_keyval, attribute_val);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_set_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_set_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_set_errhandler(YogiMPI_Comm comm, YogiMPI_Errhandler errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_set_errhandler, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Errhandler conv_errhandler;
+    conv_errhandler = yogi.errhandlerToMPI(errhandler);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_set_errhandler(conv_comm, conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_set_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_set_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_set_info(YogiMPI_Comm comm, YogiMPI_Info info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_set_info, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_set_info(conv_comm, conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_set_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_set_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_set_name(YogiMPI_Comm comm, const char* comm_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_set_name, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_set_name(conv_comm, (char*)comm_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_set_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_set_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_size(YogiMPI_Comm comm, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_size, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_size(conv_comm, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_split(YogiMPI_Comm comm, int color, int key, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_split, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    if (color == YogiMPI_UNDEFINED) {
+        color = MPI_UNDEFINED;
+    }
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_split(conv_comm, color, key, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_split, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_newcomm == MPI_COMM_NULL) {
+        *newcomm = YogiMPI_COMM_NULL;
+    }
+    else {
+        *newcomm = yogi.commToYogi(conv_newcomm);
+    }
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_split, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_split_type(YogiMPI_Comm comm, int split_type, int key, YogiMPI_Info info, YogiMPI_Comm* newcomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_split_type, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    if (split_type == YogiMPI_UNDEFINED) {
+        split_type = MPI_UNDEFINED;
+    }
+    else if(split_type == YogiMPI_COMM_TYPE_SHARED) {
+        split_type = MPI_COMM_TYPE_SHARED;
+    }
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_newcomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_split_type(conv_comm, split_type, key, conv_info, &conv_newcomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_split_type, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newcomm = yogi.commToYogi(conv_newcomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newcomm, conv_newcomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_split_type, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Comm_test_inter(YogiMPI_Comm comm, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Comm_test_inter, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Comm_test_inter(conv_comm, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Comm_test_inter, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Comm_test_inter, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Compare_and_swap(const void* origin_addr, const void* compare_addr, void* result_addr, YogiMPI_Datatype datatype, int target_rank, YogiMPI_Aint target_disp, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Compare_and_swap, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Compare_and_swap((void*)origin_addr, (void*)compare_addr, result_addr, conv_datatype, target_rank, conv_target_disp, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Compare_and_swap, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Compare_and_swap, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Dims_create(int nnodes, int ndims, int dims[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Dims_create, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Dims_create(nnodes, ndims, dims);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Dims_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Dims_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Dist_graph_create(YogiMPI_Comm comm_old, int n, const int sources[], const int degrees[], const int destinations[], const int weights[], YogiMPI_Info info, int reorder, YogiMPI_Comm* comm_dist_graph) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Dist_graph_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm_old;
+    conv_comm_old = yogi.commToMPI(comm_old);
+    if (weights == YogiMPI_UNWEIGHTED) {
+        weights = (int *)MPI_UNWEIGHTED;
+    }
+    else if(weights == YogiMPI_WEIGHTS_EMPTY) {
+        weights = (int *)MPI_WEIGHTS_EMPTY;
+    }
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm_dist_graph;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Dist_graph_create(conv_comm_old, n, (int *)sources, (int *)degrees, (int *)destinations, (int *)weights, conv_info, reorder, &conv_comm_dist_graph);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Dist_graph_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm_dist_graph = yogi.commToYogi(conv_comm_dist_graph);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*comm_dist_graph, conv_comm_dist_graph);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Dist_graph_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Dist_graph_create_adjacent(YogiMPI_Comm comm_old, int indegree, const int sources[], const int sourceweights[], int outdegree, const int destinations[], const int destweights[], YogiMPI_Info info, int reorder, YogiMPI_Comm* comm_dist_graph) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Dist_graph_create_adjacent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm_old;
+    conv_comm_old = yogi.commToMPI(comm_old);
+    if (sourceweights == YogiMPI_UNWEIGHTED) {
+        sourceweights = (int *)MPI_UNWEIGHTED;
+    }
+    else if(sourceweights == YogiMPI_WEIGHTS_EMPTY) {
+        sourceweights = (int *)MPI_WEIGHTS_EMPTY;
+    }
+    if (destweights == YogiMPI_UNWEIGHTED) {
+        destweights = (int *)MPI_UNWEIGHTED;
+    }
+    else if(destweights == YogiMPI_WEIGHTS_EMPTY) {
+        destweights = (int *)MPI_WEIGHTS_EMPTY;
+    }
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm_dist_graph;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Dist_graph_create_adjacent(conv_comm_old, indegree, (int *)sources, (int *)sourceweights, outdegree, (int *)destinations, (int *)destweights, conv_info, reorder, &conv_comm_dist_graph);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Dist_graph_create_adjacent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm_dist_graph = yogi.commToYogi(conv_comm_dist_graph);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*comm_dist_graph, conv_comm_dist_graph);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Dist_graph_create_adjacent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Dist_graph_neighbors(YogiMPI_Comm comm, int maxindegree, int sources[], int sourceweights[], int maxoutdegree, int destinations[], int destweights[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Dist_graph_neighbors, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Dist_graph_neighbors(conv_comm, maxindegree, sources, sourceweights, maxoutdegree, destinations, destweights);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Dist_graph_neighbors, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Dist_graph_neighbors, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Dist_graph_neighbors_count(YogiMPI_Comm comm, int* indegree, int* outdegree, int* weighted) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Dist_graph_neighbors_count, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Dist_graph_neighbors_count(conv_comm, indegree, outdegree, weighted);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Dist_graph_neighbors_count, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Dist_graph_neighbors_count, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Errhandler_create(YogiMPI_Handler_function* function, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Errhandler_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Handler_function* conv_function;
+    conv_function = (MPI_Handler_function*)function;
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Errhandler_create(conv_function, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Errhandler_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Errhandler_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Errhandler_free(YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Errhandler_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Errhandler conv_errhandler;
+    conv_errhandler = yogi.errhandlerToMPI(*errhandler);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Errhandler_free(&conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Errhandler_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.unmapErrhandler(*errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Errhandler_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Errhandler_get(YogiMPI_Comm comm, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Errhandler_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Errhandler_get(conv_comm, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Errhandler_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Errhandler_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Errhandler_set(YogiMPI_Comm comm, YogiMPI_Errhandler errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Errhandler_set, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Errhandler conv_errhandler;
+    conv_errhandler = yogi.errhandlerToMPI(errhandler);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Errhandler_set(conv_comm, conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Errhandler_set, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Errhandler_set, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Exscan(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Exscan, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Exscan((void*)sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Exscan, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Exscan, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Fetch_and_op(const void* origin_addr, void* result_addr, YogiMPI_Datatype datatype, int target_rank, YogiMPI_Aint target_disp, YogiMPI_Op op, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Fetch_and_op, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Fetch_and_op((void*)origin_addr, result_addr, conv_datatype, target_rank, conv_target_disp, conv_op, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Fetch_and_op, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Fetch_and_op, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_call_errhandler(YogiMPI_File fh, int errorcode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_call_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    errorcode = yogi.errorToMPI(errorcode);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_call_errhandler(conv_fh, errorcode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_call_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_call_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_close(YogiMPI_File* fh) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_close, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(*fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_close(&conv_fh);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_close, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *fh = yogi.unmapFile(*fh);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_close, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_create_errhandler(YogiMPI_File_errhandler_function* file_errhandler_fn, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_create_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File_errhandler_function* conv_file_errhandler_fn;
+    conv_file_errhandler_fn = (MPI_File_errhandler_function*)file_errhandler_fn;
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_create_errhandler(conv_file_errhandler_fn, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_create_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_create_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_delete(const char* filename, YogiMPI_Info info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_delete, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_delete((char*)filename, conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_delete, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_delete, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_amode(YogiMPI_File fh, int* amode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_amode, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_amode(conv_fh, amode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_amode, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *amode = yogi.amodeToYogi(*amode);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_amode, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_atomicity(YogiMPI_File fh, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_atomicity, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_atomicity(conv_fh, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_atomicity, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_atomicity, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_byte_offset(YogiMPI_File fh, YogiMPI_Offset offset, YogiMPI_Offset* disp) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_byte_offset, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Offset conv_disp;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_byte_offset(conv_fh, conv_offset, &conv_disp);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_byte_offset, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *disp = yogi.offsetToYogi(conv_disp);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_byte_offset, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_errhandler(YogiMPI_File file, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_file;
+    conv_file = yogi.fileToMPI(file);
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_errhandler(conv_file, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_errhandler == MPI_ERRHANDLER_NULL) {
+        *errhandler = YogiMPI_ERRHANDLER_NULL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_ARE_FATAL) {
+        *errhandler = YogiMPI_ERRORS_ARE_FATAL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_RETURN) {
+        *errhandler = YogiMPI_ERRORS_RETURN;
+    }
+    else {
+        *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_group(YogiMPI_File fh, YogiMPI_Group* group) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_group, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Group conv_group;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_group(conv_fh, &conv_group);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_group, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *group = yogi.groupToYogi(conv_group);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_group, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_info(YogiMPI_File fh, YogiMPI_Info* info_used) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_info, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Info conv_info_used;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_info(conv_fh, &conv_info_used);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *info_used = yogi.infoToYogi(conv_info_used);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_position(YogiMPI_File fh, YogiMPI_Offset* offset) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_position, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_position(conv_fh, &conv_offset);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_position, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *offset = yogi.offsetToYogi(conv_offset);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_position, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_position_shared(YogiMPI_File fh, YogiMPI_Offset* offset) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_position_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_position_shared(conv_fh, &conv_offset);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_position_shared, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *offset = yogi.offsetToYogi(conv_offset);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_position_shared, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_size(YogiMPI_File fh, YogiMPI_Offset* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_size;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_size(conv_fh, &conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *size = yogi.offsetToYogi(conv_size);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_type_extent(YogiMPI_File fh, YogiMPI_Datatype datatype, YogiMPI_Aint* extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_type_extent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_type_extent(conv_fh, conv_datatype, &conv_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_type_extent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *extent = yogi.aintToYogi(conv_extent);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_type_extent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_get_view(YogiMPI_File fh, YogiMPI_Offset* disp, YogiMPI_Datatype* etype, YogiMPI_Datatype* filetype, char* datarep) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_get_view, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_disp;
+    MPI_Datatype conv_etype;
+    MPI_Datatype conv_filetype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_get_view(conv_fh, &conv_disp, &conv_etype, &conv_filetype, datarep);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_get_view, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *disp = yogi.offsetToYogi(conv_disp);
+    *etype = yogi.datatypeToYogi(conv_etype);
+    *filetype = yogi.datatypeToYogi(conv_filetype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_get_view, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iread(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iread, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iread(conv_fh, buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iread, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iread, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iread_at(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iread_at, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iread_at(conv_fh, conv_offset, buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iread_at, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iread_at, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iread_shared(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iread_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iread_shared(conv_fh, buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iread_shared, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iread_shared, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iwrite(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iwrite, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iwrite(conv_fh, (void*)buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iwrite, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iwrite, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iwrite_at(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iwrite_at, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iwrite_at(conv_fh, conv_offset, (void*)buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iwrite_at, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iwrite_at, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_iwrite_shared(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_iwrite_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_iwrite_shared(conv_fh, (void*)buf, count, conv_datatype, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_iwrite_shared, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_iwrite_shared, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_open(YogiMPI_Comm comm, const char* filename, int amode, YogiMPI_Info info, YogiMPI_File* fh) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_open, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    amode = yogi.amodeToMPI(amode);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_File conv_fh;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_open(conv_comm, (char*)filename, amode, conv_info, &conv_fh);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_open, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *fh = yogi.fileToYogi(conv_fh);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_open, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_preallocate(YogiMPI_File fh, YogiMPI_Offset size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_preallocate, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_size;
+    conv_size = yogi.offsetToMPI(size);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_preallocate(conv_fh, conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_preallocate, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_preallocate, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read(conv_fh, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read(conv_fh, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_all(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_all(conv_fh, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_all(conv_fh, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_all, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_all, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_all_begin(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_all_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_read_all_begin(conv_fh, buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_all_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_all_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_all_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_all_end(conv_fh, buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_all_end(conv_fh, buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_all_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_all_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_at(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_at, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_at(conv_fh, conv_offset, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_at(conv_fh, conv_offset, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_at, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_at, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_at_all(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_at_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_at_all(conv_fh, conv_offset, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_at_all(conv_fh, conv_offset, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_at_all, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_at_all, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_at_all_begin(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_at_all_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_read_at_all_begin(conv_fh, conv_offset, buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_at_all_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_at_all_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_at_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_at_all_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_at_all_end(conv_fh, buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_at_all_end(conv_fh, buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_at_all_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_at_all_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_ordered(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_ordered, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_ordered(conv_fh, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_ordered(conv_fh, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_ordered, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_ordered, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_ordered_begin(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_ordered_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_read_ordered_begin(conv_fh, buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_ordered_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_ordered_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_ordered_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_ordered_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_ordered_end(conv_fh, buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_ordered_end(conv_fh, buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_ordered_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_ordered_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_read_shared(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_read_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_read_shared(conv_fh, buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_read_shared(conv_fh, buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_read_shared, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_read_shared, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_seek(YogiMPI_File fh, YogiMPI_Offset offset, int whence) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_seek, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    whence = yogi.whenceToMPI(whence);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_seek(conv_fh, conv_offset, whence);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_seek, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_seek, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_seek_shared(YogiMPI_File fh, YogiMPI_Offset offset, int whence) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_seek_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    whence = yogi.whenceToMPI(whence);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_seek_shared(conv_fh, conv_offset, whence);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_seek_shared, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_seek_shared, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_set_atomicity(YogiMPI_File fh, int flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_set_atomicity, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_set_atomicity(conv_fh, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_set_atomicity, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_set_atomicity, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_set_errhandler(YogiMPI_File file, YogiMPI_Errhandler errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_set_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_file;
+    conv_file = yogi.fileToMPI(file);
+    MPI_Errhandler conv_errhandler;
+    conv_errhandler = yogi.errhandlerToMPI(errhandler);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_set_errhandler(conv_file, conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_set_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_set_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_set_info(YogiMPI_File fh, YogiMPI_Info info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_set_info, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_set_info(conv_fh, conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_set_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_set_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_set_size(YogiMPI_File fh, YogiMPI_Offset size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_set_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_size;
+    conv_size = yogi.offsetToMPI(size);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_set_size(conv_fh, conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_set_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_set_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_set_view(YogiMPI_File fh, YogiMPI_Offset disp, YogiMPI_Datatype etype, YogiMPI_Datatype filetype, const char* datarep, YogiMPI_Info info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_set_view, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_disp;
+    if (disp == YogiMPI_DISPLACEMENT_CURRENT) {
+        conv_disp = MPI_DISPLACEMENT_CURRENT;
+    }
+    else {
+        conv_disp = yogi.offsetToMPI(disp);
+    }
+    MPI_Datatype conv_etype;
+    conv_etype = yogi.datatypeToMPI(etype);
+    MPI_Datatype conv_filetype;
+    conv_filetype = yogi.datatypeToMPI(filetype);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_set_view(conv_fh, conv_disp, conv_etype, conv_filetype, (char*)datarep, conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_set_view, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_set_view, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_sync(YogiMPI_File fh) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_sync, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_sync(conv_fh);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_sync, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_sync, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write(conv_fh, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write(conv_fh, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_all(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_all(conv_fh, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_all(conv_fh, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_all, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_all, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_all_begin(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_all_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_write_all_begin(conv_fh, (void*)buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_all_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_all_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_all_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_all_end(conv_fh, buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_all_end(conv_fh, buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_all_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_all_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_at(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_at, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_at(conv_fh, conv_offset, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_at(conv_fh, conv_offset, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_at, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_at, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_at_all(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_at_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_at_all(conv_fh, conv_offset, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_at_all(conv_fh, conv_offset, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_at_all, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_at_all, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_at_all_begin(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_at_all_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Offset conv_offset;
+    conv_offset = yogi.offsetToMPI(offset);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_write_at_all_begin(conv_fh, conv_offset, (void*)buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_at_all_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_at_all_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_at_all_end(YogiMPI_File fh, const void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_at_all_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_at_all_end(conv_fh, (void*)buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_at_all_end(conv_fh, (void*)buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_at_all_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_at_all_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_ordered(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_ordered, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_ordered(conv_fh, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_ordered(conv_fh, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_ordered, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_ordered, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_ordered_begin(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_ordered_begin, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_File_write_ordered_begin(conv_fh, (void*)buf, count, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_ordered_begin, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_ordered_begin, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_ordered_end(YogiMPI_File fh, const void* buf, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_ordered_end, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_ordered_end(conv_fh, (void*)buf, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_ordered_end(conv_fh, (void*)buf, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_ordered_end, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_ordered_end, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_File_write_shared(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_File_write_shared, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_File conv_fh;
+    conv_fh = yogi.fileToMPI(fh);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_File_write_shared(conv_fh, (void*)buf, count, conv_datatype, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_File_write_shared(conv_fh, (void*)buf, count, conv_datatype, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_File_write_shared, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_File_write_shared, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Finalized(int* flag) {
+    YogiManager &yogi = *YogiManager::getInstance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Finalized, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    mpi_error = MPI_Finalized(flag);
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Finalized, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Free_mem(void* base) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Free_mem, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Free_mem(base);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Free_mem, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Free_mem, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Gather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Gather, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Gather((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Gather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Gather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Gatherv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* displs, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Gatherv, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Gatherv((void*)sendbuf, sendcount, conv_sendtype, recvbuf, (int*)recvcounts, (int*)displs, conv_recvtype, root, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Gatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Gatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get(void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get(origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, void* result_addr, int result_count, YogiMPI_Datatype result_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_accumulate, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Datatype conv_result_datatype;
+    conv_result_datatype = yogi.datatypeToMPI(result_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get_accumulate((void*)origin_addr, origin_count, conv_origin_datatype, result_addr, result_count, conv_result_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_op, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get_accumulate, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_accumulate, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_address(const void* location, YogiMPI_Aint* address) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_address, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_address;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get_address((void*)location, &conv_address);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get_address, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *address = yogi.aintToYogi(conv_address);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_address, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_count(const YogiMPI_Status* status, YogiMPI_Datatype datatype, int* count) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_count, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get_count(conv_status, conv_datatype, count);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get_count, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*count == MPI_UNDEFINED) {
+        *count = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_count, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_elements(const YogiMPI_Status* status, YogiMPI_Datatype datatype, int* count) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_elements, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get_elements(conv_status, conv_datatype, count);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get_elements, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*count == MPI_UNDEFINED) {
+        *count = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_elements, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_elements_x(const YogiMPI_Status* status, YogiMPI_Datatype datatype, YogiMPI_Count* count) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_elements_x, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Count conv_count;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Get_elements_x(conv_status, conv_datatype, &conv_count);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Get_elements_x, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_count == MPI_UNDEFINED) {
+        *count = YogiMPI_UNDEFINED;
+    }
+    else {
+        *count = yogi.countToYogi(conv_count);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_elements_x, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_library_version(char* version, int* resultlen) {
+    YogiManager &yogi = *YogiManager::getInstance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_library_version, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    mpi_error = MPI_Get_library_version(version, resultlen);
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_library_version, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Get_version(int* version, int* subversion) {
+    YogiManager &yogi = *YogiManager::getInstance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Get_version, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    mpi_error = MPI_Get_version(version, subversion);
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Get_version, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graph_create(YogiMPI_Comm comm_old, int nnodes, int indx[], int edges[], int reorder, YogiMPI_Comm* comm_graph) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graph_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm_old;
+    conv_comm_old = yogi.commToMPI(comm_old);
+    MPI_Comm conv_comm_graph;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graph_create(conv_comm_old, nnodes, indx, edges, reorder, &conv_comm_graph);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graph_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *comm_graph = yogi.commToYogi(conv_comm_graph);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*comm_graph, conv_comm_graph);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graph_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graph_get(YogiMPI_Comm comm, int maxindex, int maxedges, int indx[], int edges[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graph_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graph_get(conv_comm, maxindex, maxedges, indx, edges);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graph_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graph_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graph_map(YogiMPI_Comm comm, int nnodes, int indx[], int edges[], int* newrank) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graph_map, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graph_map(conv_comm, nnodes, indx, edges, newrank);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graph_map, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*newrank == MPI_UNDEFINED) {
+        *newrank = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graph_map, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graph_neighbors(YogiMPI_Comm comm, int rank, int maxneighbors, int neighbors[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graph_neighbors, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graph_neighbors(conv_comm, rank, maxneighbors, neighbors);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graph_neighbors, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graph_neighbors, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graph_neighbors_count(YogiMPI_Comm comm, int rank, int* nneighbors) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graph_neighbors_count, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graph_neighbors_count(conv_comm, rank, nneighbors);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graph_neighbors_count, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graph_neighbors_count, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Graphdims_get(YogiMPI_Comm comm, int* nnodes, int* nedges) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Graphdims_get, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Graphdims_get(conv_comm, nnodes, nedges);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Graphdims_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Graphdims_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Grequest_complete(YogiMPI_Request request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Grequest_complete, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(request);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Grequest_complete(conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Grequest_complete, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Grequest_complete, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Grequest_start(YogiMPI_Grequest_query_function* query_fn, YogiMPI_Grequest_free_function* free_fn, YogiMPI_Grequest_cancel_function* cancel_fn, void* extra_state, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Grequest_start, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Grequest_query_function* conv_query_fn;
+    conv_query_fn = (MPI_Grequest_query_function*)query_fn;
+    MPI_Grequest_free_function* conv_free_fn;
+    conv_free_fn = (MPI_Grequest_free_function*)free_fn;
+    MPI_Grequest_cancel_function* conv_cancel_fn;
+    conv_cancel_fn = (MPI_Grequest_cancel_function*)cancel_fn;
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Grequest_start(conv_query_fn, conv_free_fn, conv_cancel_fn, extra_state, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Grequest_start, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Grequest_start, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_compare(YogiMPI_Group group1, YogiMPI_Group group2, int* result) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_compare, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group1;
+    conv_group1 = yogi.groupToMPI(group1);
+    MPI_Group conv_group2;
+    conv_group2 = yogi.groupToMPI(group2);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_compare(conv_group1, conv_group2, result);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_compare, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *result = yogi.comparisonToYogi(*result);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_compare, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_difference(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_difference, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group1;
+    conv_group1 = yogi.groupToMPI(group1);
+    MPI_Group conv_group2;
+    conv_group2 = yogi.groupToMPI(group2);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_difference(conv_group1, conv_group2, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_difference, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_difference, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_excl(YogiMPI_Group group, int n, const int ranks[], YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_excl, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_excl(conv_group, n, (int *)ranks, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_excl, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_excl, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_free(YogiMPI_Group* group) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(*group);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_free(&conv_group);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *group = yogi.unmapGroup(*group);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_incl(YogiMPI_Group group, int n, const int ranks[], YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_incl, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_incl(conv_group, n, (int *)ranks, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_incl, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_newgroup == MPI_GROUP_EMPTY) {
+        *newgroup = YogiMPI_GROUP_EMPTY;
+    }
+    else {
+        *newgroup = yogi.groupToYogi(conv_newgroup);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_incl, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_intersection(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_intersection, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group1;
+    conv_group1 = yogi.groupToMPI(group1);
+    MPI_Group conv_group2;
+    conv_group2 = yogi.groupToMPI(group2);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_intersection(conv_group1, conv_group2, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_intersection, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_intersection, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_range_excl(YogiMPI_Group group, int n, int ranges[][3], YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_range_excl, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_range_excl(conv_group, n, ranges, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_range_excl, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_range_excl, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_range_incl(YogiMPI_Group group, int n, int ranges[][3], YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_range_incl, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_range_incl(conv_group, n, ranges, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_range_incl, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_range_incl, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_rank(YogiMPI_Group group, int* rank) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_rank, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_rank(conv_group, rank);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_rank, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*rank == MPI_UNDEFINED) {
+        *rank = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_rank, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_size(YogiMPI_Group group, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_size(conv_group, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_translate_ranks(YogiMPI_Group group1, int n, const int ranks1[], YogiMPI_Group group2, int ranks2[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_translate_ranks, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group1;
+    conv_group1 = yogi.groupToMPI(group1);
+    MPI_Group conv_group2;
+    conv_group2 = yogi.groupToMPI(group2);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_translate_ranks(conv_group1, n, (int *)ranks1, conv_group2, ranks2);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_translate_ranks, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    int i;
+    for(i = 0; i < n; ++i) {
+        if (ranks2[i] == MPI_UNDEFINED) ranks2[i] = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_translate_ranks, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Group_union(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Group_union, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group1;
+    conv_group1 = yogi.groupToMPI(group1);
+    MPI_Group conv_group2;
+    conv_group2 = yogi.groupToMPI(group2);
+    MPI_Group conv_newgroup;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Group_union(conv_group1, conv_group2, &conv_newgroup);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Group_union, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newgroup = yogi.groupToYogi(conv_newgroup);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Group_union, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iallgather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iallgather, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.allgather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Iallgather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iallgather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iallgather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iallgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iallgatherv, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.allgather(sendbuf, sendcount, conv_sendtype, recvbuf, 0, recvcounts, displs, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Iallgatherv(sendbuf, sendcount, conv_sendtype, recvbuf, recvcounts, displs, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iallgatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iallgatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iallreduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iallreduce, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.reduce(sendbuf, recvbuf, count, datatype, conv_datatype, op, conv_op, 0, true, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Iallreduce((void*)sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iallreduce, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iallreduce, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ialltoall(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ialltoall, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.alltoall(sendbuf, sendcount, NULL, NULL, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ialltoall(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ialltoall, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ialltoall, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ialltoallv(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ialltoallv, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.alltoall(sendbuf, 0, sendcounts, sdispls, conv_sendtype, recvbuf, 0, recvcounts, rdispls, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ialltoallv(sendbuf, sendcounts, sdispls, conv_sendtype, recvbuf, recvcounts, rdispls, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ialltoallv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ialltoallv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ialltoallw(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtypes[], void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ialltoallw, -1, -1, comm);
+#endif
+    int mpi_error;
+    int comm_size = yogi.commInfo(comm).remoteSize;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    YogiScratch<MPI_Datatype> scratch_sendtypes;
+    MPI_Datatype * conv_sendtypes = yogi.datatypeToMPICached(comm, 0, sendtypes, comm_size, scratch_sendtypes);
+    YogiScratch<MPI_Datatype> scratch_recvtypes;
+    MPI_Datatype * conv_recvtypes = yogi.datatypeToMPICached(comm, 1, recvtypes, comm_size, scratch_recvtypes);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ialltoallw(sendbuf, sendcounts, sdispls, conv_sendtypes, recvbuf, recvcounts, rdispls, conv_recvtypes, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ialltoallw, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ialltoallw, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ibarrier(YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ibarrier, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.barrier(comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ibarrier(conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ibarrier, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ibarrier, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ibcast(void* buffer, int count, YogiMPI_Datatype datatype, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ibcast, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.bcast(buffer, count, conv_datatype, root, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ibcast(buffer, count, conv_datatype, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ibcast, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ibcast, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ibsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ibsend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ibsend((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ibsend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ibsend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iexscan(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iexscan, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Iexscan(sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iexscan, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iexscan, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Igather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Igather, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.gather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, root, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Igather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Igather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Igather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Igatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Igatherv, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.gather(sendbuf, sendcount, conv_sendtype, recvbuf, 0, recvcounts, displs, conv_recvtype, root, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Igatherv(sendbuf, sendcount, conv_sendtype, recvbuf, recvcounts, displs, conv_recvtype, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Igatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Igatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Improbe(int source, int tag, YogiMPI_Comm comm, int* flag, YogiMPI_Message* message, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Improbe, source, tag, comm);
+#endif
+    int mpi_error;
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    else if(source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Message conv_message;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Improbe(source, tag, conv_comm, flag, &conv_message, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Improbe(source, tag, conv_comm, flag, &conv_message, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Improbe, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *message = yogi.messageToYogi(conv_message);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Improbe, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Imrecv(void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Message* message, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Imrecv, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Message conv_message;
+    conv_message = yogi.messageToMPI(*message);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Imrecv(buf, count, conv_datatype, &conv_message, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Imrecv, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Imrecv, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ineighbor_allgather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ineighbor_allgather, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAllgather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ineighbor_allgather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ineighbor_allgather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ineighbor_allgather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ineighbor_allgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ineighbor_allgatherv, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAllgather(sendbuf, sendcount, conv_sendtype, recvbuf, 0, recvcounts, displs, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ineighbor_allgatherv(sendbuf, sendcount, conv_sendtype, recvbuf, recvcounts, displs, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ineighbor_allgatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ineighbor_allgatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ineighbor_alltoall(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ineighbor_alltoall, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAlltoall(sendbuf, sendcount, NULL, NULL, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ineighbor_alltoall(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ineighbor_alltoall, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ineighbor_alltoall, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ineighbor_alltoallv(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ineighbor_alltoallv, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAlltoall(sendbuf, 0, sendcounts, sdispls, conv_sendtype, recvbuf, 0, recvcounts, rdispls, conv_recvtype, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, conv_sendtype, recvbuf, recvcounts, rdispls, conv_recvtype, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ineighbor_alltoallv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ineighbor_alltoallv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ineighbor_alltoallw(const void* sendbuf, const int sendcounts[], const YogiMPI_Aint sdispls[], const YogiMPI_Datatype sendtypes[], void* recvbuf, const int recvcounts[], const YogiMPI_Aint rdispls[], const YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ineighbor_alltoallw, -1, -1, comm);
+#endif
+    int mpi_error;
+    YogiCommInfo comm_info = yogi.commInfo(comm);
+    YogiScratch<MPI_Aint> scratch_sdispls;
+    MPI_Aint * conv_sdispls = scratch_sdispls.get(comm_info.outdegree);
+    yogi.aintToMPI(sdispls, conv_sdispls, comm_info.outdegree);
+    YogiScratch<MPI_Datatype> scratch_sendtypes;
+    MPI_Datatype * conv_sendtypes = yogi.datatypeToMPICached(comm, 0, sendtypes, comm_info.outdegree, scratch_sendtypes);
+    YogiScratch<MPI_Aint> scratch_rdispls;
+    MPI_Aint * conv_rdispls = scratch_rdispls.get(comm_info.indegree);
+    yogi.aintToMPI(rdispls, conv_rdispls, comm_info.indegree);
+    YogiScratch<MPI_Datatype> scratch_recvtypes;
+    MPI_Datatype * conv_recvtypes = yogi.datatypeToMPICached(comm, 1, recvtypes, comm_info.indegree, scratch_recvtypes);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ineighbor_alltoallw((void*)sendbuf, (int *)sendcounts, conv_sdispls, conv_sendtypes, recvbuf, (int *)recvcounts, conv_rdispls, conv_recvtypes, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ineighbor_alltoallw, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ineighbor_alltoallw, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_create(YogiMPI_Info* info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_create(&conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *info = yogi.infoToYogi(conv_info);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_delete(YogiMPI_Info info, const char* key) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_delete, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_delete(conv_info, (char*)key);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_delete, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_delete, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_dup(YogiMPI_Info info, YogiMPI_Info* newinfo) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_dup, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Info conv_newinfo;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_dup(conv_info, &conv_newinfo);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_dup, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newinfo = yogi.infoToYogi(conv_newinfo);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_dup, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_free(YogiMPI_Info* info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(*info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_free(&conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *info = yogi.unmapInfo(*info);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_get(YogiMPI_Info info, const char* key, int valuelen, char* value, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_get, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_get(conv_info, (char*)key, valuelen, value, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_get, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_get, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_get_nkeys(YogiMPI_Info info, int* nkeys) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_get_nkeys, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_get_nkeys(conv_info, nkeys);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_get_nkeys, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_get_nkeys, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_get_nthkey(YogiMPI_Info info, int n, char* key) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_get_nthkey, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_get_nthkey(conv_info, n, key);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_get_nthkey, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_get_nthkey, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_get_valuelen(YogiMPI_Info info, const char* key, int* valuelen, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_get_valuelen, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_get_valuelen(conv_info, (char*)key, valuelen, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_get_valuelen, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_get_valuelen, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Info_set(YogiMPI_Info info, const char* key, const char* value) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Info_set, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Info_set(conv_info, (char*)key, (char*)value);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Info_set, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Info_set, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Initialized(int* flag) {
+    YogiManager &yogi = *YogiManager::getInstance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Initialized, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    mpi_error = MPI_Initialized(flag);
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Initialized, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Intercomm_create(YogiMPI_Comm local_comm, int local_leader, YogiMPI_Comm peer_comm, int remote_leader, int tag, YogiMPI_Comm* newintercomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Intercomm_create, -1, tag, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_local_comm;
+    conv_local_comm = yogi.commToMPI(local_comm);
+    MPI_Comm conv_peer_comm;
+    conv_peer_comm = yogi.commToMPI(peer_comm);
+    MPI_Comm conv_newintercomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Intercomm_create(conv_local_comm, local_leader, conv_peer_comm, remote_leader, tag, &conv_newintercomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Intercomm_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newintercomm = yogi.commToYogi(conv_newintercomm);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Intercomm_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Intercomm_merge(YogiMPI_Comm intercomm, int high, YogiMPI_Comm* newintracomm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Intercomm_merge, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Comm conv_intercomm;
+    conv_intercomm = yogi.commToMPI(intercomm);
+    MPI_Comm conv_newintracomm;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Intercomm_merge(conv_intercomm, high, &conv_newintracomm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Intercomm_merge, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newintracomm = yogi.commToYogi(conv_newintracomm);
+    if (mpi_error == MPI_SUCCESS) {
+        mpi_error = yogi.scheduler.adoptComm(*newintracomm, conv_newintracomm);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Intercomm_merge, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iprobe(int source, int tag, YogiMPI_Comm comm, int* flag, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iprobe, source, tag, comm);
+#endif
+    int mpi_error;
+    if (source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    else if(source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Iprobe(source, tag, conv_comm, flag, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Iprobe(source, tag, conv_comm, flag, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iprobe, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iprobe, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Irecv(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Irecv, source, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    else if(source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Irecv(buf, count, conv_datatype, source, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Irecv, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Irecv, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ireduce(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ireduce, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.reduce(sendbuf, recvbuf, count, datatype, conv_datatype, op, conv_op, root, false, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Ireduce(sendbuf, recvbuf, count, conv_datatype, conv_op, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ireduce, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ireduce, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ireduce_scatter(void* sendbuf, void* recvbuf, int recvcounts[], YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ireduce_scatter, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ireduce_scatter(sendbuf, recvbuf, recvcounts, conv_datatype, conv_op, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ireduce_scatter, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ireduce_scatter, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ireduce_scatter_block(void* sendbuf, void* recvbuf, int recvcount, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ireduce_scatter_block, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ireduce_scatter_block(sendbuf, recvbuf, recvcount, conv_datatype, conv_op, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ireduce_scatter_block, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ireduce_scatter_block, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Irsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Irsend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Irsend((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Irsend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Irsend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Is_thread_main(int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Is_thread_main, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Is_thread_main(flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Is_thread_main, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Is_thread_main, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iscan(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iscan, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Iscan(sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iscan, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iscan, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iscatter(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iscatter, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.scatter(sendbuf, sendcount, NULL, NULL, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Iscatter(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iscatter, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iscatter, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Iscatterv(void* sendbuf, int sendcounts[], int displs[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Iscatterv, root, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.scatter(sendbuf, 0, sendcounts, displs, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, comm, conv_comm, &conv_request);
+    }
+    else {
+        mpi_error = MPI_Iscatterv(sendbuf, sendcounts, displs, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm, &conv_request);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Iscatterv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Iscatterv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Isend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Isend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Isend((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Isend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Isend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Issend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Issend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Issend((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Issend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Issend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Keyval_create(YogiMPI_Copy_function* copy_fn, YogiMPI_Delete_function* delete_fn, int* keyval, void* extra_state) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Keyval_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Copy_function* conv_copy_fn;
+    if (copy_fn == YogiMPI_NULL_COPY_FN) {
+        conv_copy_fn = MPI_NULL_COPY_FN;
+    }
+    else if(copy_fn == YogiMPI_DUP_FN) {
+        conv_copy_fn = MPI_DUP_FN;
+    }
+    else {
+        conv_copy_fn = (MPI_Copy_function*)copy_fn;
+    }
+    MPI_Delete_function* conv_delete_fn;
+    if (delete_fn == YogiMPI_NULL_DELETE_FN) {
+        conv_delete_fn = MPI_NULL_DELETE_FN;
+    }
+    else {
+        conv_delete_fn = (MPI_Delete_function*)delete_fn;
+    }
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Keyval_create(conv_copy_fn, conv_delete_fn, keyval, extra_state);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Keyval_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Keyval_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Keyval_free(int* keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Keyval_free, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Keyval_free(keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Keyval_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*keyval == MPI_KEYVAL_INVALID) {
+        *keyval = YogiMPI_KEYVAL_INVALID;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Keyval_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Lookup_name(char* service_name, YogiMPI_Info info, char* port_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Lookup_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Lookup_name(service_name, conv_info, port_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Lookup_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Lookup_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Mprobe(int source, int tag, YogiMPI_Comm comm, YogiMPI_Message* message, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Mprobe, source, tag, comm);
+#endif
+    int mpi_error;
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    else if(source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Message conv_message;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Mprobe(source, tag, conv_comm, &conv_message, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Mprobe(source, tag, conv_comm, &conv_message, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Mprobe, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *message = yogi.messageToYogi(conv_message);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Mprobe, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Mrecv(void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Message* message, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Mrecv, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Message conv_message;
+    conv_message = yogi.messageToMPI(*message);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Mrecv(buf, count, conv_datatype, &conv_message, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Mrecv(buf, count, conv_datatype, &conv_message, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Mrecv, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Mrecv, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Neighbor_allgather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Neighbor_allgather, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAllgather(sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, NULL);
+    }
+    else {
+        mpi_error = MPI_Neighbor_allgather((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Neighbor_allgather, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Neighbor_allgather, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Neighbor_allgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Neighbor_allgatherv, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAllgather(sendbuf, sendcount, conv_sendtype, recvbuf, 0, recvcounts, displs, conv_recvtype, comm, conv_comm, NULL);
+    }
+    else {
+        mpi_error = MPI_Neighbor_allgatherv(sendbuf, sendcount, conv_sendtype, recvbuf, recvcounts, displs, conv_recvtype, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Neighbor_allgatherv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Neighbor_allgatherv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Neighbor_alltoall(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Neighbor_alltoall, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAlltoall(sendbuf, sendcount, NULL, NULL, conv_sendtype, recvbuf, recvcount, NULL, NULL, conv_recvtype, comm, conv_comm, NULL);
+    }
+    else {
+        mpi_error = MPI_Neighbor_alltoall((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Neighbor_alltoall, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Neighbor_alltoall, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Neighbor_alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Neighbor_alltoallv, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (yogi.scheduler.emulating) {
+        mpi_error = yogi.scheduler.neighborAlltoall(sendbuf, 0, sendcounts, sdispls, conv_sendtype, recvbuf, 0, recvcounts, rdispls, conv_recvtype, comm, conv_comm, NULL);
+    }
+    else {
+        mpi_error = MPI_Neighbor_alltoallv((void*)sendbuf, (int *)sendcounts, (int *)sdispls, conv_sendtype, recvbuf, (int *)recvcounts, (int *)rdispls, conv_recvtype, conv_comm);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Neighbor_alltoallv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Neighbor_alltoallv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Neighbor_alltoallw(const void* sendbuf, const int sendcounts[], const YogiMPI_Aint sdispls[], const YogiMPI_Datatype sendtypes[], void* recvbuf, const int recvcounts[], const YogiMPI_Aint rdispls[], const YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Neighbor_alltoallw, -1, -1, comm);
+#endif
+    int mpi_error;
+    YogiCommInfo comm_info = yogi.commInfo(comm);
+    YogiScratch<MPI_Aint> scratch_sdispls;
+    MPI_Aint * conv_sdispls = scratch_sdispls.get(comm_info.outdegree);
+    yogi.aintToMPI(sdispls, conv_sdispls, comm_info.outdegree);
+    YogiScratch<MPI_Datatype> scratch_sendtypes;
+    MPI_Datatype * conv_sendtypes = yogi.datatypeToMPICached(comm, 0, sendtypes, comm_info.outdegree, scratch_sendtypes);
+    YogiScratch<MPI_Aint> scratch_rdispls;
+    MPI_Aint * conv_rdispls = scratch_rdispls.get(comm_info.indegree);
+    yogi.aintToMPI(rdispls, conv_rdispls, comm_info.indegree);
+    YogiScratch<MPI_Datatype> scratch_recvtypes;
+    MPI_Datatype * conv_recvtypes = yogi.datatypeToMPICached(comm, 1, recvtypes, comm_info.indegree, scratch_recvtypes);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Neighbor_alltoallw((void*)sendbuf, (int *)sendcounts, conv_sdispls, conv_sendtypes, recvbuf, (int *)recvcounts, conv_rdispls, conv_recvtypes, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Neighbor_alltoallw, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Neighbor_alltoallw, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Op_commutative(YogiMPI_Op op, int* commute) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Op_commutative, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Op_commutative(conv_op, commute);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Op_commutative, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Op_commutative, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Op_create(YogiMPI_User_function* user_fn, int commute, YogiMPI_Op* op) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Op_create, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_User_function* conv_user_fn;
+    conv_user_fn = (MPI_User_function*)user_fn;
+    MPI_Op conv_op;
+    YogiMPI_User_function* user_fn_keep = user_fn;
+    int op_slot = -1;
+    bool op_slot_reused = false;
+    if (user_fn) conv_user_fn = yogi.claimOpSlot(user_fn, op_slot, op_slot_reused);
+    if (op_slot < 0) {
+        /* Every trampoline is taken: share one that finds the user function
+           from the op the calling thread is reducing with. */
+        conv_user_fn = [](void* invec, void* inoutvec, int* len, MPI_Datatype* datatype) -> void {
+            YogiMPI_Datatype revert_datatype = Yogi_ResolveDatatype(datatype);
+            auto fn = YogiManager::instance().userFn(YogiManager::instance().currentOp);
+            return fn(invec, inoutvec, len, &revert_datatype);
+        };
+    }
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Op_create(conv_user_fn, commute, &conv_op);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Op_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *op = yogi.opToYogi(conv_op);
+    if (op_slot >= 0) {
+        if (mpi_error == MPI_SUCCESS) yogi.bindOpSlot(op_slot, *op);
+        else yogi.releaseOpSlot(op_slot, op_slot_reused);
+    }
+    else if (user_fn_keep) yogi.userFn(*op, user_fn_keep);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Op_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Op_free(YogiMPI_Op* op) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Op_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(*op);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Op_free(&conv_op);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Op_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *op = yogi.unmapOp(*op);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Op_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Open_port(YogiMPI_Info info, char* port_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Open_port, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Open_port(conv_info, port_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Open_port, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Open_port, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Pack(const void* inbuf, int incount, YogiMPI_Datatype datatype, void* outbuf, int outsize, int* position, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Pack, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Pack((void*)inbuf, incount, conv_datatype, outbuf, outsize, position, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Pack, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Pack, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Pack_external(char* datarep, void* inbuf, int incount, YogiMPI_Datatype datatype, void* outbuf, YogiMPI_Aint outsize, YogiMPI_Aint* position) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Pack_external, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_outsize;
+    conv_outsize = yogi.aintToMPI(outsize);
+    MPI_Aint conv_position;
+    conv_position = yogi.aintToMPI(*position);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Pack_external(datarep, inbuf, incount, conv_datatype, outbuf, conv_outsize, &conv_position);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Pack_external, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *position = yogi.aintToYogi(conv_position);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Pack_external, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Pack_external_size(char* datarep, int incount, YogiMPI_Datatype datatype, YogiMPI_Aint* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Pack_external_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_size;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Pack_external_size(datarep, incount, conv_datatype, &conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Pack_external_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *size = yogi.aintToYogi(conv_size);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Pack_external_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Pack_size(int incount, YogiMPI_Datatype datatype, YogiMPI_Comm comm, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Pack_size, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Pack_size(incount, conv_datatype, conv_comm, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Pack_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Pack_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Pcontrol(int level) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Pcontrol, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Pcontrol(level);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Pcontrol, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Pcontrol, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Probe(int source, int tag, YogiMPI_Comm comm, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Probe, source, tag, comm);
+#endif
+    int mpi_error;
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    else if(source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Probe(source, tag, conv_comm, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Probe(source, tag, conv_comm, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Probe, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Probe, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Publish_name(const char* service_name, YogiMPI_Info info, const char* port_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Publish_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Publish_name((char*)service_name, conv_info, (char*)port_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Publish_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Publish_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Put(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Put, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Put((void*)origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Put, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Put, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Query_thread(int* provided) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Query_thread, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Query_thread(provided);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Query_thread, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *provided = yogi.providedToYogi(*provided);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Query_thread, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Raccumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Raccumulate, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Raccumulate((void*)origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_op, conv_win, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Raccumulate, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Raccumulate, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Recv(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Recv, source, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    else if(source == YogiMPI_ANY_SOURCE) {
+        source = MPI_ANY_SOURCE;
+    }
+    if (tag == YogiMPI_ANY_TAG) {
+        tag = MPI_ANY_TAG;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Recv(buf, count, conv_datatype, source, tag, conv_comm, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Recv(buf, count, conv_datatype, source, tag, conv_comm, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Recv, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Recv, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Recv_init(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Recv_init, source, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Recv_init(buf, count, conv_datatype, source, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Recv_init, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+    if (mpi_error == MPI_SUCCESS) yogi.markPersistent(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Recv_init, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Reduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Reduce, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Reduce((void*)sendbuf, recvbuf, count, conv_datatype, conv_op, root, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Reduce, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Reduce, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Reduce_local(const void* inbuf, void* inoutbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Reduce_local, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (!(yogi.reduceLocal(inbuf, inoutbuf, count, datatype, op, &mpi_error))) {
+        mpi_error = MPI_Reduce_local((void*)inbuf, inoutbuf, count, conv_datatype, conv_op);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Reduce_local, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Reduce_local, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Reduce_scatter(const void* sendbuf, void* recvbuf, int recvcounts[], YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Reduce_scatter, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Reduce_scatter((void*)sendbuf, recvbuf, recvcounts, conv_datatype, conv_op, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Reduce_scatter, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Reduce_scatter, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Reduce_scatter_block(void* sendbuf, void* recvbuf, int recvcount, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Reduce_scatter_block, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Reduce_scatter_block(sendbuf, recvbuf, recvcount, conv_datatype, conv_op, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Reduce_scatter_block, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Reduce_scatter_block, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Register_datarep(const char* datarep, YogiMPI_Datarep_conversion_function* read_conversion_fn, YogiMPI_Datarep_conversion_function* write_conversion_fn, YogiMPI_Datarep_extent_function* dtype_file_extent_fn, void* extra_state) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Register_datarep, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datarep_conversion_function* conv_read_conversion_fn;
+    conv_read_conversion_fn = (MPI_Datarep_conversion_function*)read_conversion_fn;
+    MPI_Datarep_conversion_function* conv_write_conversion_fn;
+    conv_write_conversion_fn = (MPI_Datarep_conversion_function*)write_conversion_fn;
+    MPI_Datarep_extent_function* conv_dtype_file_extent_fn;
+    conv_dtype_file_extent_fn = (MPI_Datarep_extent_function*)dtype_file_extent_fn;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Register_datarep((char*)datarep, conv_read_conversion_fn, conv_write_conversion_fn, conv_dtype_file_extent_fn, extra_state);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Register_datarep, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Register_datarep, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Request_free(YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Request_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(*request);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Request_free(&conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Request_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.unmapRequest(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Request_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Request_get_status(YogiMPI_Request request, int* flag, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Request_get_status, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(request);
+    yogi.scheduler.progress();
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Request_get_status(conv_request, flag, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Request_get_status(conv_request, flag, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Request_get_status, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Request_get_status, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Rget(void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Rget, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Rget(origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_win, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Rget, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Rget, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Rget_accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, void* result_addr, int result_count, YogiMPI_Datatype result_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Rget_accumulate, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Datatype conv_result_datatype;
+    conv_result_datatype = yogi.datatypeToMPI(result_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Rget_accumulate((void*)origin_addr, origin_count, conv_origin_datatype, result_addr, result_count, conv_result_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_op, conv_win, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Rget_accumulate, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Rget_accumulate, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Rput(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Rput, target_rank, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_origin_datatype;
+    conv_origin_datatype = yogi.datatypeToMPI(origin_datatype);
+    MPI_Aint conv_target_disp;
+    conv_target_disp = yogi.aintToMPI(target_disp);
+    MPI_Datatype conv_target_datatype;
+    conv_target_datatype = yogi.datatypeToMPI(target_datatype);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Rput((void*)origin_addr, origin_count, conv_origin_datatype, target_rank, conv_target_disp, target_count, conv_target_datatype, conv_win, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Rput, profile_start, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Rput, yogi.messageBytes(mpi_error, origin_count, conv_origin_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Rsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Rsend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Rsend((void*)buf, count, conv_datatype, dest, tag, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Rsend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Rsend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Rsend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Rsend_init, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Rsend_init((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Rsend_init, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+    if (mpi_error == MPI_SUCCESS) yogi.markPersistent(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Rsend_init, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Scan(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Scan, -1, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Op conv_op;
+    conv_op = yogi.opToMPI(op);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+    yogi.currentOp = op;
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Scan((void*)sendbuf, recvbuf, count, conv_datatype, conv_op, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Scan, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Scan, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Scatter(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Scatter, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Scatter((void*)sendbuf, sendcount, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Scatter, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Scatter, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Scatterv(const void* sendbuf, const int* sendcounts, const int* displs, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Scatterv, root, -1, comm);
+#endif
+    int mpi_error;
+    if (sendbuf == YogiMPI_IN_PLACE) {
+        sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Scatterv((void*)sendbuf, (int*)sendcounts, (int*)displs, conv_sendtype, recvbuf, recvcount, conv_recvtype, root, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Scatterv, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Scatterv, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Send(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Send, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Send((void*)buf, count, conv_datatype, dest, tag, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Send, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Send, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Send_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Send_init, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Send_init((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Send_init, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+    if (mpi_error == MPI_SUCCESS) yogi.markPersistent(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Send_init, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Sendrecv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, int dest, int sendtag, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int source, int recvtag, YogiMPI_Comm comm, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Sendrecv, dest, sendtag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_sendtype;
+    conv_sendtype = yogi.datatypeToMPI(sendtype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Datatype conv_recvtype;
+    conv_recvtype = yogi.datatypeToMPI(recvtype);
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Sendrecv((void*)sendbuf, sendcount, conv_sendtype, dest, sendtag, recvbuf, recvcount, conv_recvtype, source, recvtag, conv_comm, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Sendrecv((void*)sendbuf, sendcount, conv_sendtype, dest, sendtag, recvbuf, recvcount, conv_recvtype, source, recvtag, conv_comm, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Sendrecv, profile_start, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Sendrecv, yogi.messageBytes(mpi_error, (sendbuf == MPI_IN_PLACE ? 0 : sendcount), conv_sendtype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Sendrecv_replace(void* buf, int count, YogiMPI_Datatype datatype, int dest, int sendtag, int source, int recvtag, YogiMPI_Comm comm, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Sendrecv_replace, dest, sendtag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    if (source == YogiMPI_PROC_NULL) {
+        source = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Sendrecv_replace(buf, count, conv_datatype, dest, sendtag, source, recvtag, conv_comm, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Sendrecv_replace(buf, count, conv_datatype, dest, sendtag, source, recvtag, conv_comm, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Sendrecv_replace, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Sendrecv_replace, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ssend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ssend, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ssend((void*)buf, count, conv_datatype, dest, tag, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ssend, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ssend, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Ssend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Ssend_init, dest, tag, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    if (dest == YogiMPI_PROC_NULL) {
+        dest = MPI_PROC_NULL;
+    }
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Request conv_request;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Ssend_init((void*)buf, count, conv_datatype, dest, tag, conv_comm, &conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Ssend_init, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *request = yogi.requestToYogi(conv_request);
+    if (mpi_error == MPI_SUCCESS) yogi.markPersistent(*request);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Ssend_init, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Start(YogiMPI_Request* request) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Start, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(*request);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Start(&conv_request);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Start, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Start, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Startall(int count, YogiMPI_Request array_of_requests[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Startall, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = yogi.requestToMPICached(array_of_requests, count, scratch_array_of_requests);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Startall(count, conv_array_of_requests);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Startall, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Startall, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Status_set_cancelled(YogiMPI_Status* status, int flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Status_set_cancelled, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Status_set_cancelled(conv_status, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Status_set_cancelled, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    yogi.statusToYogiInPlace(status);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Status_set_cancelled, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Status_set_elements(YogiMPI_Status* status, YogiMPI_Datatype datatype, int count) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Status_set_elements, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Status_set_elements(conv_status, conv_datatype, count);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Status_set_elements, profile_start, yogi.messageBytes(mpi_error, count, conv_datatype));
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    yogi.statusToYogiInPlace(status);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Status_set_elements, yogi.messageBytes(mpi_error, count, conv_datatype), mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Status_set_elements_x(YogiMPI_Status* status, YogiMPI_Datatype datatype, YogiMPI_Count count) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Status_set_elements_x, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Count conv_count;
+    conv_count = yogi.countToMPI(count);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Status_set_elements_x(conv_status, conv_datatype, conv_count);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Status_set_elements_x, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    yogi.statusToYogiInPlace(status);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Status_set_elements_x, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Test(YogiMPI_Request* request, int* flag, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Test, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(*request);
+    yogi.scheduler.progress();
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Test(&conv_request, flag, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Test(&conv_request, flag, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Test, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_request == MPI_REQUEST_NULL) {
+        *request = yogi.unmapRequest(*request);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Test, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Test_cancelled(const YogiMPI_Status* status, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Test_cancelled, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Status *conv_status = NULL;
+    conv_status = yogi.statusToMPI(status);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Test_cancelled(conv_status, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Test_cancelled, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Test_cancelled, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Testall(int count, YogiMPI_Request array_of_requests[], int* flag, YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Testall, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(count);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, count);
+    yogi.scheduler.progress();
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (array_of_statuses == YogiMPI_STATUSES_IGNORE) {
+        mpi_error = MPI_Testall(count, conv_array_of_requests, flag, MPI_STATUSES_IGNORE);
+    }
+    else {
+        MPI_Status * conv_array_of_statuses = yogi.statusesToMPI(array_of_statuses, count);
+        mpi_error = MPI_Testall(count, conv_array_of_requests, flag, conv_array_of_statuses);
+        if (*flag) {
+            yogi.statusesToYogiInPlace(array_of_statuses, count);
+        }
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Testall, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    int i;
+    for(i = 0; i < count; ++i) {
+        if(conv_array_of_requests[i] == MPI_REQUEST_NULL) {
+            array_of_requests[i] = yogi.unmapRequest(array_of_requests[i]);
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Testall, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Testany(int count, YogiMPI_Request array_of_requests[], int* indx, int* flag, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Testany, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(count);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, count);
+    yogi.scheduler.progress();
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        mpi_error = MPI_Testany(count, conv_array_of_requests, indx, flag, MPI_STATUS_IGNORE);
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        mpi_error = MPI_Testany(count, conv_array_of_requests, indx, flag, conv_status);
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Testany, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*indx == MPI_UNDEFINED) {
+        *indx = YogiMPI_UNDEFINED;
+    }
+    else {
+        if(conv_array_of_requests[*indx] == MPI_REQUEST_NULL) {
+            array_of_requests[*indx] = yogi.unmapRequest(array_of_requests[*indx]);
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Testany, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Testsome(int incount, YogiMPI_Request array_of_requests[], int* outcount, int array_of_indices[], YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Testsome, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(incount);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, incount);
+    yogi.scheduler.progress();
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (array_of_statuses == YogiMPI_STATUSES_IGNORE) {
+        mpi_error = MPI_Testsome(incount, conv_array_of_requests, outcount, array_of_indices, MPI_STATUSES_IGNORE);
+    }
+    else {
+        MPI_Status * conv_array_of_statuses = yogi.statusesToMPI(array_of_statuses, incount);
+        mpi_error = MPI_Testsome(incount, conv_array_of_requests, outcount, array_of_indices, conv_array_of_statuses);
+        if (*outcount != MPI_UNDEFINED) {
+            yogi.statusesToYogiInPlace(array_of_statuses, *outcount);
+        }
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Testsome, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*outcount == MPI_UNDEFINED) {
+        *outcount = YogiMPI_UNDEFINED;
+    }
+    else {
+        int i;
+        for(i = 0; i < *outcount; ++i) {
+            int requestIndex = array_of_indices[i];
+            if(conv_array_of_requests[requestIndex] == MPI_REQUEST_NULL) {
+                array_of_requests[requestIndex] = yogi.unmapRequest(array_of_requests[requestIndex]);
+            }
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Testsome, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Topo_test(YogiMPI_Comm comm, int* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Topo_test, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Topo_test(conv_comm, status);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Topo_test, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *status = yogi.topoToYogi(*status);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Topo_test, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_commit(YogiMPI_Datatype* datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_commit, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(*datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_commit(&conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_commit, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_commit, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_contiguous(int count, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_contiguous, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_contiguous(count, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_contiguous, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_contiguous, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_hindexed(int count, int array_of_blocklengths[], YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_hindexed, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Aint> scratch_array_of_displacements;
+    MPI_Aint * conv_array_of_displacements = scratch_array_of_displacements.get(count);
+    yogi.aintToMPI(array_of_displacements, conv_array_of_displacements, count);
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_hindexed(count, array_of_blocklengths, conv_array_of_displacements, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_hindexed, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_hindexed, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_hindexed_block(int count, int blocklength, YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_hindexed_block, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Aint> scratch_array_of_displacements;
+    MPI_Aint * conv_array_of_displacements = scratch_array_of_displacements.get(count);
+    yogi.aintToMPI(array_of_displacements, conv_array_of_displacements, count);
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_hindexed_block(count, blocklength, conv_array_of_displacements, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_hindexed_block, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_hindexed_block, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_hvector(int count, int blocklength, YogiMPI_Aint stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_hvector, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_stride;
+    conv_stride = yogi.aintToMPI(stride);
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_hvector(count, blocklength, conv_stride, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_hvector, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_hvector, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_indexed_block(int count, int blocklength, int array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_indexed_block, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_indexed_block(count, blocklength, array_of_displacements, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_indexed_block, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_indexed_block, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_keyval(YogiMPI_Type_copy_attr_function* type_copy_attr_fn, YogiMPI_Type_delete_attr_function* type_delete_attr_fn, int* type_keyval, void* extra_state) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Type_copy_attr_function* conv_type_copy_attr_fn;
+    conv_type_copy_attr_fn = (MPI_Type_copy_attr_function*)type_copy_attr_fn;
+    MPI_Type_delete_attr_function* conv_type_delete_attr_fn;
+    conv_type_delete_attr_fn = (MPI_Type_delete_attr_function*)type_delete_attr_fn;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_keyval(conv_type_copy_attr_fn, conv_type_delete_attr_fn, type_keyval, extra_state);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_resized(YogiMPI_Datatype oldtype, YogiMPI_Aint lb, YogiMPI_Aint extent, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_resized, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Aint conv_lb;
+    conv_lb = yogi.aintToMPI(lb);
+    MPI_Aint conv_extent;
+    conv_extent = yogi.aintToMPI(extent);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_resized(conv_oldtype, conv_lb, conv_extent, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_resized, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_resized, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_struct(int count, int array_of_blocklengths[], YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype array_of_types[], YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_struct, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Aint> scratch_array_of_displacements;
+    MPI_Aint * conv_array_of_displacements = scratch_array_of_displacements.get(count);
+    yogi.aintToMPI(array_of_displacements, conv_array_of_displacements, count);
+    YogiScratch<MPI_Datatype> scratch_array_of_types;
+    MPI_Datatype * conv_array_of_types = scratch_array_of_types.get(count);
+    yogi.datatypeToMPI(array_of_types, conv_array_of_types, count);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_struct(count, array_of_blocklengths, conv_array_of_displacements, conv_array_of_types, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_struct, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_struct, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_create_subarray(int ndims, int array_of_sizes[], int array_of_subsizes[], int array_of_starts[], int order, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_create_subarray, -1, -1, -1);
+#endif
+    int mpi_error;
+    if (order == YogiMPI_ORDER_C) {
+        order = MPI_ORDER_C;
+    }
+    else if(order == YogiMPI_ORDER_FORTRAN) {
+        order = MPI_ORDER_FORTRAN;
+    }
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_create_subarray(ndims, array_of_sizes, array_of_subsizes, array_of_starts, order, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_create_subarray, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_create_subarray, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_delete_attr(YogiMPI_Datatype datatype, int type_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_delete_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_delete_attr(conv_datatype, type_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_delete_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_delete_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_dup(YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_dup, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_dup(conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_dup, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_dup, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_extent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_extent(conv_datatype, &conv_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_extent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *extent = yogi.aintToYogi(conv_extent);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_extent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_free(YogiMPI_Datatype* datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(*datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_free(&conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *datatype = yogi.unmapDatatype(*datatype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_free_keyval(int* type_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_free_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_free_keyval(type_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_free_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_free_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_attr(YogiMPI_Datatype datatype, int type_keyval, void* attribute_val, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_attr(conv_datatype, type_keyval, attribute_val, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_envelope(YogiMPI_Datatype datatype, int* num_integers, int* num_addresses, int* num_datatypes, int* combiner) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_envelope, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_envelope(conv_datatype, num_integers, num_addresses, num_datatypes, combiner);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_envelope, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *combiner = yogi.combinerToYogi(*combiner);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_envelope, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* lb, YogiMPI_Aint* extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_extent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_lb;
+    MPI_Aint conv_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_extent(conv_datatype, &conv_lb, &conv_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_extent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_lb == MPI_UNDEFINED) {
+        *lb = YogiMPI_UNDEFINED;
+    }
+    else {
+        *lb = yogi.aintToYogi(conv_lb);
+    }
+    if (conv_extent == MPI_UNDEFINED) {
+        *extent = YogiMPI_UNDEFINED;
+    }
+    else {
+        *extent = yogi.aintToYogi(conv_extent);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_extent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_extent_x(YogiMPI_Datatype datatype, YogiMPI_Count* lb, YogiMPI_Count* extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_extent_x, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Count conv_lb;
+    MPI_Count conv_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_extent_x(conv_datatype, &conv_lb, &conv_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_extent_x, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_lb == MPI_UNDEFINED) {
+        *lb = YogiMPI_UNDEFINED;
+    }
+    else {
+        *lb = yogi.countToYogi(conv_lb);
+    }
+    if (conv_extent == MPI_UNDEFINED) {
+        *extent = YogiMPI_UNDEFINED;
+    }
+    else {
+        *extent = yogi.countToYogi(conv_extent);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_extent_x, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_name(YogiMPI_Datatype datatype, char* type_name, int* resultlen) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_name(conv_datatype, type_name, resultlen);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_true_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* true_lb, YogiMPI_Aint* true_extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_true_extent, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_true_lb;
+    MPI_Aint conv_true_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_true_extent(conv_datatype, &conv_true_lb, &conv_true_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_true_extent, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_true_lb == MPI_UNDEFINED) {
+        *true_lb = YogiMPI_UNDEFINED;
+    }
+    else {
+        *true_lb = yogi.aintToYogi(conv_true_lb);
+    }
+    if (conv_true_extent == MPI_UNDEFINED) {
+        *true_extent = YogiMPI_UNDEFINED;
+    }
+    else {
+        *true_extent = yogi.aintToYogi(conv_true_extent);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_true_extent, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_get_true_extent_x(YogiMPI_Datatype datatype, YogiMPI_Count* true_lb, YogiMPI_Count* true_extent) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_get_true_extent_x, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Count conv_true_lb;
+    MPI_Count conv_true_extent;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_get_true_extent_x(conv_datatype, &conv_true_lb, &conv_true_extent);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_get_true_extent_x, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_true_lb == MPI_UNDEFINED) {
+        *true_lb = YogiMPI_UNDEFINED;
+    }
+    else {
+        *true_lb = yogi.countToYogi(conv_true_lb);
+    }
+    if (conv_true_extent == MPI_UNDEFINED) {
+        *true_extent = YogiMPI_UNDEFINED;
+    }
+    else {
+        *true_extent = yogi.countToYogi(conv_true_extent);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_get_true_extent_x, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_hindexed(int count, int* array_of_blocklengths, YogiMPI_Aint* array_of_displacements, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_hindexed, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Aint> scratch_array_of_displacements;
+    MPI_Aint * conv_array_of_displacements = scratch_array_of_displacements.get(count);
+    yogi.aintToMPI(array_of_displacements, conv_array_of_displacements, count);
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_hindexed(count, array_of_blocklengths, conv_array_of_displacements, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_hindexed, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_hindexed, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_hvector(int count, int blocklength, YogiMPI_Aint stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_hvector, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_stride;
+    conv_stride = yogi.aintToMPI(stride);
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_hvector(count, blocklength, conv_stride, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_hvector, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_hvector, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_indexed(int count, const int array_of_blocklengths[], const int array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_indexed, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_indexed(count, (int *)array_of_blocklengths, (int *)array_of_displacements, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_indexed, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_indexed, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_lb(YogiMPI_Datatype datatype, YogiMPI_Aint* displacement) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_lb, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_displacement;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_lb(conv_datatype, &conv_displacement);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_lb, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *displacement = yogi.aintToYogi(conv_displacement);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_lb, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_match_size(int typeclass, int size, YogiMPI_Datatype* datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_match_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    typeclass = yogi.typeclassToMPI(typeclass);
+    MPI_Datatype conv_datatype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_match_size(typeclass, size, &conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_match_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *datatype = yogi.datatypeToYogi(conv_datatype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_match_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_set_attr(YogiMPI_Datatype datatype, int type_keyval, void* attribute_val) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_set_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_set_attr(conv_datatype, type_keyval, attribute_val);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_set_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_set_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_set_name(YogiMPI_Datatype datatype, const char* type_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_set_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_set_name(conv_datatype, (char*)type_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_set_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_set_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_size(YogiMPI_Datatype datatype, int* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_size, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_size(conv_datatype, size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_size, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*size == MPI_UNDEFINED) {
+        *size = YogiMPI_UNDEFINED;
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_size, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_size_x(YogiMPI_Datatype datatype, YogiMPI_Count* size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_size_x, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Count conv_size;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_size_x(conv_datatype, &conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_size_x, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_size == MPI_UNDEFINED) {
+        *size = YogiMPI_UNDEFINED;
+    }
+    else {
+        *size = yogi.countToYogi(conv_size);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_size_x, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_struct(int count, int* array_of_blocklengths, const YogiMPI_Aint* array_of_displacements, const YogiMPI_Datatype* array_of_types, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_struct, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Aint> scratch_array_of_displacements;
+    MPI_Aint * conv_array_of_displacements = scratch_array_of_displacements.get(count);
+    yogi.aintToMPI(array_of_displacements, conv_array_of_displacements, count);
+    YogiScratch<MPI_Datatype> scratch_array_of_types;
+    MPI_Datatype * conv_array_of_types = scratch_array_of_types.get(count);
+    yogi.datatypeToMPI(array_of_types, conv_array_of_types, count);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_struct(count, array_of_blocklengths, conv_array_of_displacements, conv_array_of_types, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_struct, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_struct, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_ub(YogiMPI_Datatype datatype, YogiMPI_Aint* displacement) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_ub, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Aint conv_displacement;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_ub(conv_datatype, &conv_displacement);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_ub, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *displacement = yogi.aintToYogi(conv_displacement);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_ub, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Type_vector(int count, int blocklength, int stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Type_vector, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_oldtype;
+    conv_oldtype = yogi.datatypeToMPI(oldtype);
+    MPI_Datatype conv_newtype;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Type_vector(count, blocklength, stride, conv_oldtype, &conv_newtype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Type_vector, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *newtype = yogi.datatypeToYogi(conv_newtype);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Type_vector, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Unpack(const void* inbuf, int insize, int* position, void* outbuf, int outcount, YogiMPI_Datatype datatype, YogiMPI_Comm comm) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Unpack, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Unpack((void*)inbuf, insize, position, outbuf, outcount, conv_datatype, conv_comm);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Unpack, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Unpack, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Unpack_external(char* datarep, void* inbuf, YogiMPI_Aint insize, YogiMPI_Aint* position, void* outbuf, int outcount, YogiMPI_Datatype datatype) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Unpack_external, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Aint conv_insize;
+    conv_insize = yogi.aintToMPI(insize);
+    MPI_Aint conv_position;
+    conv_position = yogi.aintToMPI(*position);
+    MPI_Datatype conv_datatype;
+    conv_datatype = yogi.datatypeToMPI(datatype);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Unpack_external(datarep, inbuf, conv_insize, &conv_position, outbuf, outcount, conv_datatype);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Unpack_external, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *position = yogi.aintToYogi(conv_position);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Unpack_external, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Unpublish_name(const char* service_name, YogiMPI_Info info, const char* port_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Unpublish_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Unpublish_name((char*)service_name, conv_info, (char*)port_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Unpublish_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Unpublish_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Wait(YogiMPI_Request* request, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Wait, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Request conv_request;
+    conv_request = yogi.requestToMPI(*request);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        if (!(yogi.scheduler.wait(&conv_request, MPI_STATUS_IGNORE, &mpi_error))) {
+            mpi_error = MPI_Wait(&conv_request, MPI_STATUS_IGNORE);
+        }
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        if (!(yogi.scheduler.wait(&conv_request, conv_status, &mpi_error))) {
+            mpi_error = MPI_Wait(&conv_request, conv_status);
+        }
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Wait, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_request == MPI_REQUEST_NULL) {
+        *request = yogi.unmapRequest(*request);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Wait, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Waitall(int count, YogiMPI_Request array_of_requests[], YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Waitall, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(count);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, count);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (array_of_statuses == YogiMPI_STATUSES_IGNORE) {
+        if (!(yogi.scheduler.waitall(count, conv_array_of_requests, MPI_STATUSES_IGNORE, &mpi_error))) {
+            mpi_error = MPI_Waitall(count, conv_array_of_requests, MPI_STATUSES_IGNORE);
+        }
+    }
+    else {
+        MPI_Status * conv_array_of_statuses = yogi.statusesToMPI(array_of_statuses, count);
+        if (!(yogi.scheduler.waitall(count, conv_array_of_requests, conv_array_of_statuses, &mpi_error))) {
+            mpi_error = MPI_Waitall(count, conv_array_of_requests, conv_array_of_statuses);
+        }
+        yogi.statusesToYogiInPlace(array_of_statuses, count);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Waitall, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    int i;
+    for(i = 0; i < count; ++i) {
+        if(conv_array_of_requests[i] == MPI_REQUEST_NULL) {
+            array_of_requests[i] = yogi.unmapRequest(array_of_requests[i]);
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Waitall, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Waitany(int count, YogiMPI_Request array_of_requests[], int* indx, YogiMPI_Status* status) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Waitany, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(count);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, count);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (status == YogiMPI_STATUS_IGNORE) {
+        if (!(yogi.scheduler.waitany(count, conv_array_of_requests, indx, MPI_STATUS_IGNORE, &mpi_error))) {
+            mpi_error = MPI_Waitany(count, conv_array_of_requests, indx, MPI_STATUS_IGNORE);
+        }
+    }
+    else {
+        MPI_Status * conv_status = yogi.statusToMPI(status);
+        if (!(yogi.scheduler.waitany(count, conv_array_of_requests, indx, conv_status, &mpi_error))) {
+            mpi_error = MPI_Waitany(count, conv_array_of_requests, indx, conv_status);
+        }
+        yogi.statusToYogiInPlace(status);
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Waitany, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*indx == MPI_UNDEFINED) {
+        *indx = YogiMPI_UNDEFINED;
+    }
+    else {
+        if(conv_array_of_requests[*indx] == MPI_REQUEST_NULL) {
+            array_of_requests[*indx] = yogi.unmapRequest(array_of_requests[*indx]);
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Waitany, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Waitsome(int incount, YogiMPI_Request array_of_requests[], int* outcount, int array_of_indices[], YogiMPI_Status array_of_statuses[]) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Waitsome, -1, -1, -1);
+#endif
+    int mpi_error;
+    YogiScratch<MPI_Request> scratch_array_of_requests;
+    MPI_Request * conv_array_of_requests = scratch_array_of_requests.get(incount);
+    yogi.requestToMPI(array_of_requests, conv_array_of_requests, incount);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    if (array_of_statuses == YogiMPI_STATUSES_IGNORE) {
+        if (!(yogi.scheduler.waitsome(incount, conv_array_of_requests, outcount, array_of_indices, MPI_STATUSES_IGNORE, &mpi_error))) {
+            mpi_error = MPI_Waitsome(incount, conv_array_of_requests, outcount, array_of_indices, MPI_STATUSES_IGNORE);
+        }
+    }
+    else {
+        MPI_Status * conv_array_of_statuses = yogi.statusesToMPI(array_of_statuses, incount);
+        if (!(yogi.scheduler.waitsome(incount, conv_array_of_requests, outcount, array_of_indices, conv_array_of_statuses, &mpi_error))) {
+            mpi_error = MPI_Waitsome(incount, conv_array_of_requests, outcount, array_of_indices, conv_array_of_statuses);
+        }
+        if (*outcount != MPI_UNDEFINED) {
+            yogi.statusesToYogiInPlace(array_of_statuses, *outcount);
+        }
+    }
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Waitsome, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (*outcount == MPI_UNDEFINED) {
+        *outcount = YogiMPI_UNDEFINED;
+    }
+    else {
+        int i;
+        for(i = 0; i < *outcount; ++i) {
+            int requestIndex = array_of_indices[i];
+            if(conv_array_of_requests[requestIndex] == MPI_REQUEST_NULL) {
+                array_of_requests[requestIndex] = yogi.unmapRequest(array_of_requests[requestIndex]);
+            }
+        }
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Waitsome, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_allocate(YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, void* baseptr, YogiMPI_Win* win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_allocate, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Aint conv_size;
+    conv_size = yogi.aintToMPI(size);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Win conv_win;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_allocate(conv_size, disp_unit, conv_info, conv_comm, baseptr, &conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_allocate, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *win = yogi.winToYogi(conv_win);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_allocate, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_allocate_shared(YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, void* baseptr, YogiMPI_Win* win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_allocate_shared, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Aint conv_size;
+    conv_size = yogi.aintToMPI(size);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Win conv_win;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_allocate_shared(conv_size, disp_unit, conv_info, conv_comm, baseptr, &conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_allocate_shared, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *win = yogi.winToYogi(conv_win);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_allocate_shared, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_attach(YogiMPI_Win win, void* base, YogiMPI_Aint size) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_attach, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Aint conv_size;
+    conv_size = yogi.aintToMPI(size);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_attach(conv_win, base, conv_size);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_attach, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_attach, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_call_errhandler(YogiMPI_Win win, int errorcode) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_call_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    errorcode = yogi.errorToMPI(errorcode);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_call_errhandler(conv_win, errorcode);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_call_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_call_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_complete(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_complete, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_complete(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_complete, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_complete, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_create(void* base, YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, YogiMPI_Win* win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_create, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Aint conv_size;
+    conv_size = yogi.aintToMPI(size);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Win conv_win;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_create(base, conv_size, disp_unit, conv_info, conv_comm, &conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_create, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *win = yogi.winToYogi(conv_win);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_create, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_create_dynamic(YogiMPI_Info info, YogiMPI_Comm comm, YogiMPI_Win* win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_create_dynamic, -1, -1, comm);
+#endif
+    int mpi_error;
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+    MPI_Comm conv_comm;
+    conv_comm = yogi.commToMPI(comm);
+    MPI_Win conv_win;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_create_dynamic(conv_info, conv_comm, &conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_create_dynamic, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *win = yogi.winToYogi(conv_win);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_create_dynamic, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_create_errhandler(YogiMPI_Win_errhandler_function* win_errhandler_fn, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_create_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win_errhandler_function* conv_win_errhandler_fn;
+    conv_win_errhandler_fn = (MPI_Win_errhandler_function*)win_errhandler_fn;
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_create_errhandler(conv_win_errhandler_fn, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_create_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_create_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_create_keyval(YogiMPI_Win_copy_attr_function* win_copy_attr_fn, YogiMPI_Win_delete_attr_function* win_delete_attr_fn, int* win_keyval, void* extra_state) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_create_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win_copy_attr_function* conv_win_copy_attr_fn;
+    conv_win_copy_attr_fn = (MPI_Win_copy_attr_function*)win_copy_attr_fn;
+    MPI_Win_delete_attr_function* conv_win_delete_attr_fn;
+    conv_win_delete_attr_fn = (MPI_Win_delete_attr_function*)win_delete_attr_fn;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_create_keyval(conv_win_copy_attr_fn, conv_win_delete_attr_fn, win_keyval, extra_state);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_create_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_create_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_delete_attr(YogiMPI_Win win, int win_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_delete_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_delete_attr(conv_win, win_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_delete_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_delete_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_detach(YogiMPI_Win win, const void* base) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_detach, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_detach(conv_win, (void*)base);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_detach, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_detach, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_fence(int assert, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_fence, -1, -1, -1);
+#endif
+    int mpi_error;
+    assert = yogi.onesidedToMPI(assert);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_fence(assert, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_fence, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_fence, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_flush(int rank, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_flush, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_flush(rank, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_flush, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_flush, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_flush_all(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_flush_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_flush_all(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_flush_all, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_flush_all, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_flush_local(int rank, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_flush_local, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_flush_local(rank, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_flush_local, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_flush_local, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_flush_local_all(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_flush_local_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_flush_local_all(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_flush_local_all, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_flush_local_all, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_free(YogiMPI_Win* win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_free, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(*win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_free(&conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_free, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *win = yogi.unmapWin(*win);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_free, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_free_keyval(int* win_keyval) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_free_keyval, -1, -1, -1);
+#endif
+    int mpi_error;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_free_keyval(win_keyval);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_free_keyval, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_free_keyval, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_get_attr(YogiMPI_Win win, int win_keyval, void* attribute_val, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_get_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    win_keyval = yogi.winattrToMPI(win_keyval);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_get_attr(conv_win, win_keyval, attribute_val, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_get_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_get_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_get_errhandler(YogiMPI_Win win, YogiMPI_Errhandler* errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_get_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Errhandler conv_errhandler;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_get_errhandler(conv_win, &conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_get_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    if (conv_errhandler == MPI_ERRHANDLER_NULL) {
+        *errhandler = YogiMPI_ERRHANDLER_NULL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_ARE_FATAL) {
+        *errhandler = YogiMPI_ERRORS_ARE_FATAL;
+    }
+    else if(conv_errhandler == MPI_ERRORS_RETURN) {
+        *errhandler = YogiMPI_ERRORS_RETURN;
+    }
+    else {
+        *errhandler = yogi.errhandlerToYogi(conv_errhandler);
+    }
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_get_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_get_group(YogiMPI_Win win, YogiMPI_Group* group) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_get_group, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Group conv_group;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_get_group(conv_win, &conv_group);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_get_group, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *group = yogi.groupToYogi(conv_group);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_get_group, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_get_info(YogiMPI_Win win, YogiMPI_Info* info_used) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_get_info, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Info conv_info_used;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_get_info(conv_win, &conv_info_used);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_get_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *info_used = yogi.infoToYogi(conv_info_used);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_get_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_get_name(YogiMPI_Win win, char* win_name, int* resultlen) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_get_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_get_name(conv_win, win_name, resultlen);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_get_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_get_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_lock(int lock_type, int rank, int assert, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_lock, -1, -1, -1);
+#endif
+    int mpi_error;
+    lock_type = yogi.locktypeToMPI(lock_type);
+    assert = yogi.onesidedToMPI(assert);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_lock(lock_type, rank, assert, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_lock, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_lock, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_lock_all(int assert, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_lock_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    assert = yogi.onesidedToMPI(assert);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_lock_all(assert, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_lock_all, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_lock_all, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_post(YogiMPI_Group group, int assert, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_post, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    assert = yogi.onesidedToMPI(assert);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_post(conv_group, assert, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_post, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_post, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_set_attr(YogiMPI_Win win, int win_keyval, void* attribute_val) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_set_attr, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_set_attr(conv_win, win_keyval, attribute_val);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_set_attr, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_set_attr, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_set_errhandler(YogiMPI_Win win, YogiMPI_Errhandler errhandler) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_set_errhandler, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Errhandler conv_errhandler;
+    conv_errhandler = yogi.errhandlerToMPI(errhandler);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_set_errhandler(conv_win, conv_errhandler);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_set_errhandler, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_set_errhandler, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_set_info(YogiMPI_Win win, YogiMPI_Info info) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_set_info, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    MPI_Info conv_info;
+    conv_info = yogi.infoToMPI(info);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_set_info(conv_win, conv_info);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_set_info, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_set_info, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_set_name(YogiMPI_Win win, const char* win_name) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_set_name, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_set_name(conv_win, (char*)win_name);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_set_name, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_set_name, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_shared_query(YogiMPI_Win win, int rank, YogiMPI_Aint* size, int* disp_unit, void* baseptr) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_shared_query, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+    if (rank == YogiMPI_PROC_NULL) {
+        rank = MPI_PROC_NULL;
+    }
+    MPI_Aint conv_size;
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_shared_query(conv_win, rank, &conv_size, disp_unit, baseptr);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_shared_query, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+    *size = yogi.aintToYogi(conv_size);
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_shared_query, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_start(YogiMPI_Group group, int assert, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_start, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Group conv_group;
+    conv_group = yogi.groupToMPI(group);
+    assert = yogi.onesidedToMPI(assert);
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_start(conv_group, assert, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_start, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_start, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_sync(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_sync, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_sync(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_sync, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_sync, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_test(YogiMPI_Win win, int* flag) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_test, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_test(conv_win, flag);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_test, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_test, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_unlock(int rank, YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_unlock, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_unlock(rank, conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_unlock, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_unlock, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_unlock_all(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_unlock_all, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_unlock_all(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_unlock_all, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_unlock_all, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+int YogiMPI_Win_wait(YogiMPI_Win win) {
+    YogiManager &yogi = YogiManager::instance();
+#ifdef YOGI_DEBUG
+    yogi.tracer.enter(YOGI_ID_MPI_Win_wait, -1, -1, -1);
+#endif
+    int mpi_error;
+    MPI_Win conv_win;
+    conv_win = yogi.winToMPI(win);
+#ifdef YOGI_DEBUG
+    yogi.callDepth++;
+#endif
+#ifdef YOGI_PROFILE
+    long long profile_start = yogi.profiler.enabled ? YogiProfiler::now() : 0;
+#endif
+    mpi_error = MPI_Win_wait(conv_win);
+#ifdef YOGI_PROFILE
+    if (yogi.profiler.enabled) {
+        yogi.profiler.record(YOGI_ID_MPI_Win_wait, profile_start, 0);
+    }
+#endif
+#ifdef YOGI_DEBUG
+    yogi.callDepth--;
+#endif
+#ifdef YOGI_DEBUG
+    yogi.tracer.exit(YOGI_ID_MPI_Win_wait, 0, mpi_error);
+#endif
+    return yogi.errorToYogi(mpi_error);
+}
+
+
+// End automatically-generated function code.
@@ -0,0 +1,1416 @@
+/*
+                                  COPYRIGHT
+
+ The following is a notice of limited availability of the code, and disclaimer
+ which must be included in the prologue of the code and in all source listings
+ of the code.
+
+ Copyright Notice
+  + 2002 University of Chicago
+  + 2016 Stephen Adamec
+
+ Permission is hereby granted to use, reproduce, prepare derivative works, and
+ to redistribute to others.  This software was authored by:
+
+ Mathematics and Computer Science Division
+ Argonne National Laboratory, Argonne IL 60439
+
+ (and)
+
+ Department of Computer Science
+ University of Illinois at Urbana-Champaign
+
+ (and)
+
+ Stephen Adamec
+
+                              GOVERNMENT LICENSE
+
+ Portions of this material resulted from work developed under a U.S.
+ Government Contract and are subject to the following license: the Government
+ is granted for itself and others acting on its behalf a paid-up, nonexclusive,
+ irrevocable worldwide license in this computer software to reproduce, prepare
+ derivative works, and perform publicly and display publicly.
+
+                                    DISCLAIMER
+
+ This computer code material was prepared, in part, as an account of work
+ sponsored by an agency of the United States Government.  Neither the United
+ States, nor the University of Chicago, nor any of their employees, makes any
+ warranty express or implied, or assumes any legal liability or responsibility
+ for the accuracy, completeness, or usefulness of any information, apparatus,
+ product, or process disclosed, or represents that its use would not infringe
+ privately owned rights.
+*/
+
+#ifndef YOGIMPI_H
+#define YOGIMPI_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define YogiMPI_VERSION_STR ""
+#define YogiMPI_VERSION 3
+#define YogiMPI_SUBVERSION 0
+
+
+/*
+ * MPI_Status can be treated as a series of integers (as in Fortran).
+ * YogiMPI stores an integer array larger than any known MPI distribution's
+ * MPI_Status byte size.  MPI writes its status straight into this array,
+ * and configure checks that the MPI being built against fits.
+ * YogiMPI_STATUS_ALIGNED is 1 when configure chose the aligned layout
+ * (YALIGNSTATUS=1), a different ABI from the default one.
+ */
+
+#define MAX_STATUS_SIZE 12
+#define YogiMPI_STATUS_ALIGNED 0
+
+
+/*
+ * Typedefs for opaque MPI data structures.
+ */
+typedef int YogiMPI_Group;
+typedef int YogiMPI_Comm;
+typedef int YogiMPI_Datatype;
+typedef int YogiMPI_Request;
+typedef int YogiMPI_Op;
+typedef int YogiMPI_Info;
+typedef int YogiMPI_File;
+typedef int YogiMPI_Errhandler;
+typedef int YogiMPI_Win;
+#if YogiMPI_VERSION == 3
+typedef int YogiMPI_Message;
+#endif
+
+/* MPI constants for return codes (both C and Fortran) */
+#define YogiMPI_SUCCESS 0
+#define YogiMPI_ERR_BUFFER 1
+#define YogiMPI_ERR_COUNT 2
+#define YogiMPI_ERR_TYPE 3
+#define YogiMPI_ERR_TAG 4
+#define YogiMPI_ERR_COMM 5
+#define YogiMPI_ERR_RANK 6
+#define YogiMPI_ERR_REQUEST 7
+#define YogiMPI_ERR_ROOT 8
+#define YogiMPI_ERR_GROUP 9
+#define YogiMPI_ERR_OP 10
+#define YogiMPI_ERR_TOPOLOGY 11
+#define YogiMPI_ERR_DIMS 12
+#define YogiMPI_ERR_ARG 13
+#define YogiMPI_ERR_UNKNOWN 14
+#define YogiMPI_ERR_TRUNCATE 15
+#define YogiMPI_ERR_OTHER 16
+#define YogiMPI_ERR_INTERN 17
+#define YogiMPI_ERR_PENDING 18
+#define YogiMPI_ERR_IN_STATUS 19
+
+/* Part 2 for MPI I/O error constants */
+
+#define YogiMPI_ERR_FILE 20
+#define YogiMPI_ERR_NOT_SAME 21
+#define YogiMPI_ERR_AMODE 22
+#define YogiMPI_ERR_UNSUPPORTED_DATAREP 23
+#define YogiMPI_ERR_UNSUPPORTED_OPERATION 24
+#define YogiMPI_ERR_NO_SUCH_FILE 25
+#define YogiMPI_ERR_FILE_EXISTS 26
+#define YogiMPI_ERR_BAD_FILE 27
+#define YogiMPI_ERR_ACCESS 28
+#define YogiMPI_ERR_NO_SPACE 29
+#define YogiMPI_ERR_QUOTA 30
+#define YogiMPI_ERR_READ_ONLY 31
+#define YogiMPI_ERR_FILE_IN_USE 32
+#define YogiMPI_ERR_DUP_DATAREP 33
+#define YogiMPI_ERR_CONVERSION 34
+#define YogiMPI_ERR_IO 35
+
+#define YogiMPI_ERR_INFO 36
+#define YogiMPI_ERR_INFO_KEY 37
+#define YogiMPI_ERR_INFO_VALUE 38
+#define YogiMPI_ERR_INFO_NOKEY 39
+#define YogiMPI_ERR_NAME 40
+#define YogiMPI_ERR_NO_MEM 41
+#define YogiMPI_ERR_PORT 42
+#define YogiMPI_ERR_SERVICE 43
+#define YogiMPI_ERR_SPAWN 44
+#define YogiMPI_ERR_WIN 45
+#define YogiMPI_ERR_KEYVAL 46
+#define YogiMPI_ERR_BASE 47
+#define YogiMPI_ERR_LOCKTYPE 48
+#define YogiMPI_ERR_RMA_CONFLICT 49
+#define YogiMPI_ERR_RMA_SYNC 50
+#define YogiMPI_ERR_SIZE 51
+#define YogiMPI_ERR_DISP 52
+#define YogiMPI_ERR_ASSERT 53
+
+#define YogiMPI_ERR_LASTCODE 54
+
+/* Assorted constants (both C and Fortran) */
+
+/* Recommended that MPI_BOTTOM be zero address */
+#define YogiMPI_BOTTOM (void*)0
+
+#define YogiMPI_PROC_NULL -2
+#define YogiMPI_ROOT -6
+#define YogiMPI_ANY_SOURCE -3
+/* ANY_TAG should not overlap with any valid tag */
+#define YogiMPI_ANY_TAG -4
+/* UNDEFINED should not overlap with any valid rank */
+#define YogiMPI_UNDEFINED -5
+#define YogiMPI_BSEND_OVERHEAD 512
+#define YogiMPI_KEYVAL_INVALID -7
+
+/* Dist graph create constants */
+#define YogiMPI_WEIGHTS_EMPTY (int*)2
+#define YogiMPI_UNWEIGHTED (int*)3
+
+/* MPI asserts for one-sided communication.  Supports bitwise OR. */
+#define YogiMPI_MODE_NOCHECK 1024
+#define YogiMPI_MODE_NOSTORE 2048
+#define YogiMPI_MODE_NOPUT 4096
+#define YogiMPI_MODE_NOPRECEDE 8192
+#define YogiMPI_MODE_NOSUCCEED 16384
+
+/* Seeking constants. */
+#define YogiMPI_SEEK_SET 50
+#define YogiMPI_SEEK_CUR 55
+#define YogiMPI_SEEK_END 60
+
+/* typeclasses */
+#define YogiMPI_TYPECLASS_REAL 1
+#define YogiMPI_TYPECLASS_INTEGER 2
+#define YogiMPI_TYPECLASS_COMPLEX 3
+
+/* MPI I/O permission modes.  Supports bitwise ops. 2*/
+#define YogiMPI_MODE_RDONLY 2
+#define YogiMPI_MODE_RDWR 8
+#define YogiMPI_MODE_WRONLY 4
+#define YogiMPI_MODE_CREATE 1
+#define YogiMPI_MODE_EXCL 64
+#define YogiMPI_MODE_DELETE_ON_CLOSE 16
+#define YogiMPI_MODE_UNIQUE_OPEN 32
+#define YogiMPI_MODE_SEQUENTIAL 256
+#define YogiMPI_MODE_APPEND 128
+
+/* Special displacement constant for certain sequential files. */
+#define YogiMPI_DISPLACEMENT_CURRENT -54278278
+
+/* MPI_Info have key and value length constants.  Pick conservative values
+   that accommodate OpenMPI and MPICH derivatives. */
+#define YogiMPI_MAX_INFO_KEY 32
+#define YogiMPI_MAX_INFO_VAL 256
+
+/* Subarray and darray constructor constants.  Mimics the MPICH header file */
+#define YogiMPI_ORDER_C              56
+#define YogiMPI_ORDER_FORTRAN        57
+#define YogiMPI_DISTRIBUTE_BLOCK    121
+#define YogiMPI_DISTRIBUTE_CYCLIC   122
+#define YogiMPI_DISTRIBUTE_NONE     123
+#define YogiMPI_DISTRIBUTE_DFLT_DARG -49767
+
+/* The MPI-standard requires that the user provides an array of at least the
+ * size equal to MAX_PROCESSOR_NAME.
+ * However, YogiMPI will always return a null-terminated string. Therefore the
+ * array has maximally MAX_PROCESSOR_NAME-1 useful characters. A
+ * null-terminator will thus be at the index MAX_PROCESSOR_NAME-1 or before.
+ * If the underlying MPI implementation returns strings that are longer than
+ * YogiMPI_MAX_PROCESSOR_NAME-1, the string will be truncated.
+ */
+#define YogiMPI_MAX_PROCESSOR_NAME 32
+#define YogiMPI_MAX_ERROR_STRING 32
+#define YogiMPI_MAX_PORT_NAME 512
+#define YogiMPI_MAX_OBJECT_NAME 64
+#define YogiMPI_MAX_DATAREP_STRING 64
+
+/* Elementary datatypes (C) */
+#define YogiMPI_CHAR 1
+#define YogiMPI_SHORT 2
+#define YogiMPI_INT 3
+#define YogiMPI_LONG 4
+#define YogiMPI_UNSIGNED_CHAR 5
+#define YogiMPI_UNSIGNED_SHORT 6
+#define YogiMPI_UNSIGNED 7
+#define YogiMPI_UNSIGNED_LONG 8
+#define YogiMPI_FLOAT 9
+#define YogiMPI_DOUBLE 10
+#define YogiMPI_LONG_DOUBLE 11
+#define YogiMPI_BYTE 12
+#define YogiMPI_PACKED 13
+
+/* Datatypes for reduction functions (C) */
+
+#define YogiMPI_FLOAT_INT 14
+#define YogiMPI_DOUBLE_INT 15
+#define YogiMPI_LONG_INT 16
+#define YogiMPI_2INT 17
+#define YogiMPI_SHORT_INT 18
+#define YogiMPI_LONG_DOUBLE_INT 19
+
+/* Optional datatypes (C) */
+#define YogiMPI_LONG_LONG_INT 20
+#define YogiMPI_INT32_T 21
+#define YogiMPI_INT64_T 22
+
+/* Make LONG_LONG a LONG_LONG_INT */
+#define YogiMPI_LONG_LONG 20
+
+/* Non-standard datatypes that are often in MPI implementations,
+   so include them here.  Some of these are normally Fortran-only, but
+   a few misbehaving (but required) C applications demand their presence. */
+#define YogiMPI_COMPLEX 23
+#define YogiMPI_DOUBLE_COMPLEX 24
+#define YogiMPI_LOGICAL 25
+#define YogiMPI_2REAL 26
+#define YogiMPI_2DOUBLE_PRECISION 27
+#define YogiMPI_2INTEGER 28
+#define YogiMPI_INTEGER1 29
+#define YogiMPI_INTEGER2 30
+#define YogiMPI_INTEGER4 31
+#define YogiMPI_INTEGER8 32
+#define YogiMPI_REAL4 33
+#define YogiMPI_REAL8 34
+#define YogiMPI_UNSIGNED_LONG_LONG 35
+
+/* Some Fortran-only definitions that end up matching byte-sizes with standard
+   C types (at least on standard x86_64) */
+#define YogiMPI_CHARACTER 1
+#define YogiMPI_INTEGER 3
+#define YogiMPI_REAL 33
+#define YogiMPI_DOUBLE_PRECISION 10
+
+/* Special datatypes for constructing derived datatypes */
+#define YogiMPI_LB 36
+#define YogiMPI_UB 37
+
+#define YogiMPI_SIGNED_CHAR 38
+#define YogiMPI_WCHAR 39
+
+/* C99 types */
+#define YogiMPI_C_BOOL 40
+#define YogiMPI_C_FLOAT_COMPLEX 41
+#define YogiMPI_C_COMPLEX 42
+#define YogiMPI_C_DOUBLE_COMPLEX 43
+#define YogiMPI_C_LONG_DOUBLE_COMPLEX 44
+
+/* MPI 2.2 types that are needed for MPI I/O */
+#define YogiMPI_AINT 45
+#define YogiMPI_OFFSET 46
+
+/* These should probably be with the above "Optional datatypes (C)", */
+/* but they were added later so putting them here to avoid reordering the list. */
+#define YogiMPI_INT8_T 47
+#define YogiMPI_INT16_T 48
+
+/* MPI 3 defined C++ types */
+#if YogiMPI_VERSION == 3
+#define YogiMPI_CXX_BOOL 49
+#define YogiMPI_CXX_FLOAT_COMPLEX 50
+#define YogiMPI_CXX_DOUBLE_COMPLEX 51
+#define YogiMPI_CXX_LONG_DOUBLE_COMPLEX 52
+#endif
+
+/* MPI Unsigned Integer Types. */
+/* I kept breaking things when I tried to weave these in earlier */
+#define YogiMPI_UINT8_T 53
+#define YogiMPI_UINT16_T 54
+#define YogiMPI_UINT32_T 55
+#define YogiMPI_UINT64_T 56
+
+#if YogiMPI_VERSION == 3
+#define YogiMPI_COUNT 57
+#endif
+
+/* reserved communicators (C and Fortran) */
+#define YogiMPI_COMM_WORLD 1
+#define YogiMPI_COMM_SELF 2
+
+/* results of communicator and group comparisons */
+#define YogiMPI_IDENT 0
+#define YogiMPI_CONGRUENT 1
+#define YogiMPI_SIMILAR 2
+#define YogiMPI_UNEQUAL 3
+
+/* environmental inquiry keys (C and Fortran) */
+#define YogiMPI_TAG_UB -8
+#define YogiMPI_IO -9
+#define YogiMPI_HOST -10
+#define YogiMPI_WTIME_IS_GLOBAL -11
+#define YogiMPI_APPNUM -12
+
+/* Predefined MPI_Win attributes */
+#define YogiMPI_WIN_BASE -13
+#define YogiMPI_WIN_SIZE -14
+#define YogiMPI_WIN_DISP_UNIT -15
+
+/* collective operations (C and Fortran) */
+#define YogiMPI_MAX 1
+#define YogiMPI_MIN 2
+#define YogiMPI_SUM 3
+#define YogiMPI_PROD 4
+#define YogiMPI_MAXLOC 5
+#define YogiMPI_MINLOC 6
+#define YogiMPI_BAND 7
+#define YogiMPI_BOR 8
+#define YogiMPI_BXOR 9
+#define YogiMPI_LAND 10
+#define YogiMPI_LOR 11
+#define YogiMPI_LXOR 12
+#define YogiMPI_REPLACE 13
+#if YogiMPI_VERSION == 3
+#define YogiMPI_NO_OP 14
+#endif
+
+/* Null handles */
+#define YogiMPI_GROUP_NULL 0
+#define YogiMPI_COMM_NULL 0
+#define YogiMPI_DATATYPE_NULL 0
+#define YogiMPI_REQUEST_NULL 0
+#define YogiMPI_OP_NULL 0
+#define YogiMPI_INFO_NULL 0
+#define YogiMPI_FILE_NULL 0
+#define YogiMPI_ERRHANDLER_NULL 0
+#define YogiMPI_WIN_NULL 0
+#if YogiMPI_VERSION == 3
+#define YogiMPI_MESSAGE_NULL 0
+#endif
+
+/* Reserved MPI_Message values */
+#if YogiMPI_VERSION == 3
+#define YogiMPI_MESSAGE_NO_PROC 1
+#endif
+
+/* Predefined error handlers */
+#define YogiMPI_ERRORS_ARE_FATAL 1
+#define YogiMPI_ERRORS_RETURN 2
+
+/* Empty group */
+#define YogiMPI_GROUP_EMPTY 1
+
+/* Version info */
+#define YogiMPI_MAX_LIBRARY_VERSION_STRING 8192
+
+/* For supported thread levels */
+#define YogiMPI_THREAD_SINGLE 0
+#define YogiMPI_THREAD_FUNNELED 1
+#define YogiMPI_THREAD_SERIALIZED 2
+#define YogiMPI_THREAD_MULTIPLE 3
+
+/* Lock type constants */
+#define YogiMPI_LOCK_EXCLUSIVE  234
+#define YogiMPI_LOCK_SHARED     235
+
+/* Topology test constants */
+#define YogiMPI_GRAPH 1
+#define YogiMPI_CART 2
+#define YogiMPI_DIST_GRAPH 3
+
+/* MPI Combiner state constants */
+#define YogiMPI_COMBINER_NAMED 1
+#define YogiMPI_COMBINER_DUP 2
+#define YogiMPI_COMBINER_CONTIGUOUS 3
+#define YogiMPI_COMBINER_VECTOR 4
+#define YogiMPI_COMBINER_HVECTOR_INTEGER 5
+#define YogiMPI_COMBINER_HVECTOR 6
+#define YogiMPI_COMBINER_INDEXED 7
+#define YogiMPI_COMBINER_HINDEXED_INTEGER 8
+#define YogiMPI_COMBINER_HINDEXED 9
+#define YogiMPI_COMBINER_INDEXED_BLOCK 10
+#define YogiMPI_COMBINER_STRUCT_INTEGER 12
+#define YogiMPI_COMBINER_STRUCT 13
+#define YogiMPI_COMBINER_SUBARRAY 14
+#define YogiMPI_COMBINER_DARRAY 15
+#define YogiMPI_COMBINER_F90_REAL 16
+#define YogiMPI_COMBINER_F90_COMPLEX 17
+#define YogiMPI_COMBINER_F90_INTEGER 18
+#define YogiMPI_COMBINER_RESIZED 19
+
+/* predefined types for MPI_Comm_split_type */
+#define YogiMPI_COMM_TYPE_SHARED    1
+
+/* Don't return error codes */
+#define YogiMPI_ERRCODES_IGNORE ((int *) 0)
+
+/* Define structure for MPI_Status - hide real object inside as int array.
+   An MPI_Status may hold a size_t (Open MPI) or an MPI_Count.  The default
+   layout leaves realStatus 4-byte aligned, and YogiMPI hands MPI an
+   aligned copy when it needs one.  The aligned layout makes realStatus
+   long longs, padded by reserved, so MPI can always write in place. */
+struct YogiMPI_Status
+{
+  int MPI_SOURCE;
+  int MPI_TAG;
+  int MPI_ERROR;
+#if YogiMPI_STATUS_ALIGNED
+  int reserved;
+  long long realStatus[MAX_STATUS_SIZE / 2];
+#else
+  int realStatus[MAX_STATUS_SIZE];
+#endif
+};
+
+typedef struct YogiMPI_Status YogiMPI_Status;
+static YogiMPI_Status * const YogiMPI_STATUS_IGNORE = 0;
+static YogiMPI_Status * const YogiMPI_STATUSES_IGNORE = 0;
+
+/*
+ * MPI_Aint is implementation dependent.  Pick a long long for it locally and
+ * then cast to the actual type within the function.  In some instances
+ * casting may not be necessary, which can be determined at runtime.
+ */
+typedef long long YogiMPI_Aint;
+
+/* MPI_Offset is implementation dependent.  Pick a long long for it locally and
+ * then cast to the actual type within the function.  In some instances
+ * casting may not be necessary, which can be determined at runtime.
+ */
+typedef long long YogiMPI_Offset;
+
+/* MPI_Fint is implementation dependent.  Pick an int for it locally and
+ * then cast to the actual type within the function.  In some instances
+ * casting may not be necessary, which can be determined at runtime.
+ */
+typedef int YogiMPI_Fint;
+
+#if YogiMPI_VERSION == 3
+
+/* MPI_Count is implementation dependent. Pick a long long int for it locally
+ * and then cast to the actual type within the function.  In some instances
+ * casting may not be necessary, which can be determined at runtime.
+ */
+typedef long long YogiMPI_Count;
+
+#endif
+
+static void * const YogiMPI_IN_PLACE = (void *)-1;
+
+/* Prototype function pointers for MPI. */
+typedef void YogiMPI_User_function(void *invec, void *inoutvec,
+                               int *len, YogiMPI_Datatype *datatype);
+
+/* Note that we don't define extra stuff like other MPI implementations.
+ * This gets converted internally to the implementation's varargs function
+ * pointer version.
+ */
+typedef void YogiMPI_Comm_errhandler_function(YogiMPI_Comm *, int *);
+
+typedef int YogiMPI_Copy_function(YogiMPI_Comm oldcomm, int keyval,
+                                  void *extra_state, void *attribute_val_in,
+                                  void *attribute_val_out, int *flag);
+
+typedef int YogiMPI_Delete_function(YogiMPI_Comm comm, int keyval,
+                                    void *attribute_val, void *extra_state);
+
+typedef void YogiMPI_Handler_function(YogiMPI_Comm *, int *, ... );
+
+typedef int YogiMPI_Type_copy_attr_function(YogiMPI_Datatype, int, void *,
+                                            void *, void *, int *);
+
+typedef int YogiMPI_Type_delete_attr_function(YogiMPI_Datatype, int, void *,
+                                              void *);
+
+typedef int YogiMPI_Win_copy_attr_function(YogiMPI_Win, int, void *, void *,
+                                           void *, int *);
+
+typedef int YogiMPI_Win_delete_attr_function(YogiMPI_Win, int, void *, void *);
+
+typedef void YogiMPI_File_errhandler_function(YogiMPI_File *, int *, ...);
+
+typedef void YogiMPI_Win_errhandler_function(YogiMPI_Win *, int *, ...);
+
+typedef int YogiMPI_Grequest_cancel_function(void *, int);
+
+typedef int YogiMPI_Grequest_free_function(void *);
+
+typedef int YogiMPI_Grequest_query_function(void *, YogiMPI_Status *);
+
+typedef int YogiMPI_Datarep_conversion_function(void *, YogiMPI_Datatype, int,
+                                                void *, YogiMPI_Offset, void *);
+
+typedef int YogiMPI_Datarep_extent_function(YogiMPI_Datatype datatype,
+                                            YogiMPI_Aint *, void *);
+
+typedef int YogiMPI_Comm_copy_attr_function(YogiMPI_Comm oldcomm,
+                                            int comm_keyval,
+                                            void *extra_state,
+                                            void *attribute_val_in,
+                                            void *attribute_val_out, int *flag);
+
+typedef int YogiMPI_Comm_delete_attr_function(YogiMPI_Comm comm,
+                                              int comm_keyval,
+                                              void *attribute_val,
+                                              void *extra_state);
+
+#define YogiMPI_CONVERSION_FN_NULL ((MPI_Datarep_conversion_function *)0)
+#define YogiMPI_NULL_COPY_FN   ((YogiMPI_Copy_function *)0)
+#define YogiMPI_DUP_FN  ((YogiMPI_Copy_function *)-1)
+#define YogiMPI_NULL_DELETE_FN ((YogiMPI_Delete_function *)0)
+#define YogiMPI_COMM_NULL_COPY_FN   ((YogiMPI_Comm_copy_attr_function *)0)
+#define YogiMPI_COMM_DUP_FN  ((YogiMPI_Comm_copy_attr_function *)-1)
+#define YogiMPI_COMM_NULL_DELETE_FN ((YogiMPI_Comm_delete_attr_function *)0)
+#define YogiMPI_WIN_NULL_COPY_FN ((YogiMPI_Win_copy_attr_function*)0)
+#define YogiMPI_WIN_NULL_DELETE_FN ((YogiMPI_Win_delete_attr_function*)0)
+#define YogiMPI_WIN_DUP_FN   ((YogiMPI_Win_copy_attr_function*)MPI_DUP_FN)
+
+/* Until we properly use lambdas and do auto-magic with function pointers,
+   users must doctor their own functions that are supplied to YogiMPI. The
+   below perform common tasks used in the functions to convert MPI arguments.
+*/
+
+int Yogi_ResolveErrorCode(int *error);
+YogiMPI_Datatype Yogi_ResolveDatatype(void *input_pointer);
+YogiMPI_Comm Yogi_ResolveComm(void *input_pointer);
+YogiMPI_Offset Yogi_ResolveOffset(void *input_pointer);
+YogiMPI_Win Yogi_ResolveWin(void *input_pointer);
+YogiMPI_File Yogi_ResolveFile(void *input_pointer);
+YogiMPI_Aint Yogi_ResolveAint(void *input_pointer);
+
+/* A couple of functions to take Fortran MPI objects and yogify them. */
+YogiMPI_Comm Yogi_ResolveFortranComm(int fortran_comm);
+YogiMPI_Group Yogi_ResolveFortranGroup(int fortran_group);
+
+int YogiMPI_Comm_spawn(const char *command, char *argv[], int maxprocs, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm *intercomm, int array_of_errcodes[]);
+
+int YogiMPI_Init(int* argc, char ***argv);
+
+int YogiMPI_Init_thread(int* argc, char*** argv, int required, int* provided);
+
+int YogiMPI_Error_class(int errorcode, int* errorclass);
+
+int YogiMPI_Error_string(int errorcode, char* string, int* resultlen);
+
+int YogiMPI_Finalize(void);
+
+int YogiMPI_Get_processor_name(char* name, int* resultlen);
+
+int YogiMPI_Type_get_contents(YogiMPI_Datatype datatype, int max_integers,
+                              int max_addresses, int max_datatypes,
+                              int array_of_integers[],
+                              YogiMPI_Aint array_of_addresses[],
+                              YogiMPI_Datatype array_of_datatypes[]);
+
+int YogiMPI_Type_create_darray(int size, int rank, int ndims, int array_of_gsizes[], int array_of_distribs[], int array_of_dargs[], int array_of_psizes[], int order, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+double YogiMPI_Wtick(void);
+
+double YogiMPI_Wtime(void);
+
+/* Converter functions between Fortran and C - really not needed since we
+   have a single ABI, but provided. */
+YogiMPI_Fint YogiMPI_Comm_c2f(YogiMPI_Comm comm);
+YogiMPI_Comm YogiMPI_Comm_f2c(YogiMPI_Fint comm);
+YogiMPI_Fint YogiMPI_Errhandler_c2f(YogiMPI_Errhandler err);
+YogiMPI_Errhandler YogiMPI_Errhandler_f2c(YogiMPI_Fint err);
+YogiMPI_Fint YogiMPI_File_c2f(YogiMPI_File file);
+YogiMPI_File YogiMPI_File_f2c(YogiMPI_Fint file);
+YogiMPI_Fint YogiMPI_Group_c2f(YogiMPI_Group group);
+YogiMPI_Group YogiMPI_Group_f2c(YogiMPI_Fint group);
+YogiMPI_Fint YogiMPI_Info_c2f(YogiMPI_Info info);
+YogiMPI_Info YogiMPI_Info_f2c(YogiMPI_Fint info);
+YogiMPI_Fint YogiMPI_Op_c2f(YogiMPI_Op op);
+YogiMPI_Op YogiMPI_Op_f2c(YogiMPI_Fint op);
+YogiMPI_Fint YogiMPI_Request_c2f(YogiMPI_Request request);
+YogiMPI_Request YogiMPI_Request_f2c(YogiMPI_Fint request);
+int YogiMPI_Status_f2c(const YogiMPI_Fint *f_status, YogiMPI_Status *c_status);
+int YogiMPI_Status_c2f(const YogiMPI_Status *c_status, YogiMPI_Fint *f_status);
+YogiMPI_Fint YogiMPI_Type_c2f(YogiMPI_Datatype datatype);
+YogiMPI_Datatype YogiMPI_Type_f2c(YogiMPI_Fint datatype);
+YogiMPI_Fint YogiMPI_Win_c2f(YogiMPI_Win win);
+YogiMPI_Win YogiMPI_Win_f2c(YogiMPI_Fint win);
+
+/*
+ * YogiMPI extensions.  These are not part of MPI and have no MPI_ names;
+ * applications call them as they are.
+ */
+
+/* Handle classes for YogiX_Pool_stats */
+#define YogiX_POOL_COMM        0
+#define YogiX_POOL_DATATYPE    1
+#define YogiX_POOL_REQUEST     2
+#define YogiX_POOL_OP          3
+#define YogiX_POOL_GROUP       4
+#define YogiX_POOL_INFO        5
+#define YogiX_POOL_ERRHANDLER  6
+#define YogiX_POOL_WIN         7
+#define YogiX_POOL_FILE        8
+#define YogiX_POOL_MESSAGE     9
+#define YogiX_NUM_POOLS        10
+
+/* Occupancy of the handle pool for one class of handle.  Predefined
+   handles are not counted. */
+struct YogiX_Pool_info
+{
+  const char *name;       /* The handle class, e.g. "comm" */
+  long long live;         /* Handles in use now */
+  long long high_water;   /* Most handles in use at once */
+  long long capacity;     /* Slots allocated, constants included */
+  long long inserts;      /* Handles created so far */
+  long long removes;      /* Handles freed so far */
+  double insert_rate;     /* Handles created per second so far */
+  double remove_rate;     /* Handles freed per second so far */
+};
+
+typedef struct YogiX_Pool_info YogiX_Pool_info;
+
+/* Fills info for handle_class.  Returns YogiMPI_ERR_ARG for an unknown
+   class, or MPI_Message pools in MPI 2 builds. */
+int YogiX_Pool_stats(int handle_class, YogiX_Pool_info *info);
+
+/* MPI_Startall followed by MPI_Waitall on the same persistent requests,
+   with their handles converted once for both.  A set started again from
+   the same array reuses the earlier conversion.  array_of_statuses may be
+   YogiMPI_STATUSES_IGNORE. */
+int YogiX_Startall_waitall(int count, YogiMPI_Request array_of_requests[],
+                           YogiMPI_Status array_of_statuses[]);
+
+/* Completion queues.  Requests added to a queue belong to it: their
+   handles are set to YogiMPI_REQUEST_NULL, and each finished request is
+   reported once, by the id it was added with, from YogiX_Cq_poll or
+   YogiX_Cq_wait.  Polling costs the MPI library's Testsome over the
+   pending requests, but YogiMPI only converts the ones that finished.
+   Persistent requests cannot be added. */
+typedef int YogiX_Cq;
+#define YogiX_CQ_NULL (-1)
+
+int YogiX_Cq_create(YogiX_Cq *cq);
+int YogiX_Cq_add(YogiX_Cq cq, int count, YogiMPI_Request array_of_requests[],
+                 const int array_of_ids[]);
+/* Reports up to maxcount finished requests in array_of_ids and
+   array_of_statuses (which may be YogiMPI_STATUSES_IGNORE).  *outcount is
+   0 if none has finished, and YogiMPI_UNDEFINED if the queue is empty.
+   YogiX_Cq_wait blocks until at least one has finished. */
+int YogiX_Cq_poll(YogiX_Cq cq, int maxcount, int *outcount, int array_of_ids[],
+                  YogiMPI_Status array_of_statuses[]);
+int YogiX_Cq_wait(YogiX_Cq cq, int maxcount, int *outcount, int array_of_ids[],
+                  YogiMPI_Status array_of_statuses[]);
+/* Requests added and not yet reported. */
+int YogiX_Cq_pending(YogiX_Cq cq, int *count);
+/* Returns YogiMPI_ERR_PENDING, and keeps the queue, while requests are
+   pending; otherwise sets *cq to YogiX_CQ_NULL. */
+int YogiX_Cq_free(YogiX_Cq *cq);
+
+/* Plans: an Allreduce or Alltoallv set up once and started many times.
+   The init calls check and convert every argument and copy the count and
+   displacement arrays (sized by the communicator), so a start costs no
+   conversion.  When MPI has persistent collectives (MPI 4, or Open MPI's
+   MPIX extension) the plan is one; the info key yogimpi_persistent=false
+   asks for replay instead, as do YogiMPI's own collectives.  Otherwise
+   each start replays the nonblocking call.  The buffers and the
+   communicator must outlive the plan. */
+typedef int YogiX_Plan;
+#define YogiX_PLAN_NULL (-1)
+
+int YogiX_Allreduce_init(const void *sendbuf, void *recvbuf, int count,
+                         YogiMPI_Datatype datatype, YogiMPI_Op op,
+                         YogiMPI_Comm comm, YogiMPI_Info info,
+                         YogiX_Plan *plan);
+int YogiX_Alltoallv_init(const void *sendbuf, const int sendcounts[],
+                         const int sdispls[], YogiMPI_Datatype sendtype,
+                         void *recvbuf, const int recvcounts[],
+                         const int rdispls[], YogiMPI_Datatype recvtype,
+                         YogiMPI_Comm comm, YogiMPI_Info info,
+                         YogiX_Plan *plan);
+/* Starts the collective and sets *request, which completes with the
+   usual Wait and Test calls and must not be freed.  A persistent plan
+   hands out the same request each time.  Start again only once the last
+   start has completed.  A NULL request runs the collective to completion
+   instead. */
+int YogiX_Start(YogiX_Plan plan, YogiMPI_Request *request);
+/* Frees a plan whose last start has completed, and sets *plan to
+   YogiX_PLAN_NULL. */
+int YogiX_Plan_free(YogiX_Plan *plan);
+
+
+/* Begin function prototypes. */
+int YogiMPI_Abort(YogiMPI_Comm comm, int errorcode);
+
+int YogiMPI_Accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win);
+
+int YogiMPI_Add_error_class(int* errorclass);
+
+int YogiMPI_Add_error_code(int errorclass, int* errorcode);
+
+int YogiMPI_Add_error_string(int errorcode, const char* string);
+
+int YogiMPI_Address(const void* location, YogiMPI_Aint* address);
+
+int YogiMPI_Allgather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Allgatherv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* displs, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Alloc_mem(YogiMPI_Aint size, YogiMPI_Info info, void* baseptr);
+
+int YogiMPI_Allreduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm);
+
+int YogiMPI_Alltoall(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Alltoallw(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtypes[], void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm);
+
+int YogiMPI_Attr_delete(YogiMPI_Comm comm, int keyval);
+
+int YogiMPI_Attr_get(YogiMPI_Comm comm, int keyval, void* attribute_val, int* flag);
+
+int YogiMPI_Attr_put(YogiMPI_Comm comm, int keyval, void* attribute_val);
+
+int YogiMPI_Barrier(YogiMPI_Comm comm);
+
+int YogiMPI_Bcast(void* buffer, int count, YogiMPI_Datatype datatype, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Bsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm);
+
+int YogiMPI_Bsend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Buffer_attach(void* buffer, int size);
+
+int YogiMPI_Buffer_detach(void* buffer_addr, int* size);
+
+int YogiMPI_Cancel(YogiMPI_Request* request);
+
+int YogiMPI_Cart_coords(YogiMPI_Comm comm, int rank, int maxdims, int coords[]);
+
+int YogiMPI_Cart_create(YogiMPI_Comm comm_old, int ndims, int dims[], int periods[], int reorder, YogiMPI_Comm* comm_cart);
+
+int YogiMPI_Cart_get(YogiMPI_Comm comm, int maxdims, int dims[], int periods[], int coords[]);
+
+int YogiMPI_Cart_map(YogiMPI_Comm comm, int ndims, int dims[], int periods[], int* newrank);
+
+int YogiMPI_Cart_rank(YogiMPI_Comm comm, int coords[], int* rank);
+
+int YogiMPI_Cart_shift(YogiMPI_Comm comm, int direction, int disp, int* rank_source, int* rank_dest);
+
+int YogiMPI_Cart_sub(YogiMPI_Comm comm, int remain_dims[], YogiMPI_Comm* newcomm);
+
+int YogiMPI_Cartdim_get(YogiMPI_Comm comm, int* ndims);
+
+int YogiMPI_Close_port(const char* port_name);
+
+int YogiMPI_Comm_accept(const char* port_name, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_call_errhandler(YogiMPI_Comm comm, int errorcode);
+
+int YogiMPI_Comm_compare(YogiMPI_Comm comm1, YogiMPI_Comm comm2, int* result);
+
+int YogiMPI_Comm_connect(const char* port_name, YogiMPI_Info info, int root, YogiMPI_Comm comm, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_create(YogiMPI_Comm comm, YogiMPI_Group group, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_create_errhandler(YogiMPI_Comm_errhandler_function* comm_errhandler_fn, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Comm_create_group(YogiMPI_Comm comm, YogiMPI_Group group, int tag, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_create_keyval(YogiMPI_Comm_copy_attr_function* comm_copy_attr_fn, YogiMPI_Comm_delete_attr_function* comm_delete_attr_fn, int* comm_keyval, void* extra_state);
+
+int YogiMPI_Comm_delete_attr(YogiMPI_Comm comm, int comm_keyval);
+
+int YogiMPI_Comm_disconnect(YogiMPI_Comm* comm);
+
+int YogiMPI_Comm_dup(YogiMPI_Comm comm, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_dup_with_info(YogiMPI_Comm comm, YogiMPI_Info info, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_free(YogiMPI_Comm* comm);
+
+int YogiMPI_Comm_free_keyval(int* comm_keyval);
+
+int YogiMPI_Comm_get_attr(YogiMPI_Comm comm, int comm_keyval, void* attribute_val, int* flag);
+
+int YogiMPI_Comm_get_errhandler(YogiMPI_Comm comm, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Comm_get_info(YogiMPI_Comm comm, YogiMPI_Info* info_used);
+
+int YogiMPI_Comm_get_name(YogiMPI_Comm comm, char* comm_name, int* resultlen);
+
+int YogiMPI_Comm_get_parent(YogiMPI_Comm* parent);
+
+int YogiMPI_Comm_group(YogiMPI_Comm comm, YogiMPI_Group* group);
+
+int YogiMPI_Comm_idup(YogiMPI_Comm comm, YogiMPI_Comm* newcomm, YogiMPI_Request* request);
+
+int YogiMPI_Comm_join(int fd, YogiMPI_Comm* intercomm);
+
+int YogiMPI_Comm_rank(YogiMPI_Comm comm, int* rank);
+
+int YogiMPI_Comm_remote_group(YogiMPI_Comm comm, YogiMPI_Group* group);
+
+int YogiMPI_Comm_remote_size(YogiMPI_Comm comm, int* size);
+
+int YogiMPI_Comm_set_attr(YogiMPI_Comm comm, int comm_keyval, void* attribute_val);
+
+int YogiMPI_Comm_set_errhandler(YogiMPI_Comm comm, YogiMPI_Errhandler errhandler);
+
+int YogiMPI_Comm_set_info(YogiMPI_Comm comm, YogiMPI_Info info);
+
+int YogiMPI_Comm_set_name(YogiMPI_Comm comm, const char* comm_name);
+
+int YogiMPI_Comm_size(YogiMPI_Comm comm, int* size);
+
+int YogiMPI_Comm_split(YogiMPI_Comm comm, int color, int key, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_split_type(YogiMPI_Comm comm, int split_type, int key, YogiMPI_Info info, YogiMPI_Comm* newcomm);
+
+int YogiMPI_Comm_test_inter(YogiMPI_Comm comm, int* flag);
+
+int YogiMPI_Compare_and_swap(const void* origin_addr, const void* compare_addr, void* result_addr, YogiMPI_Datatype datatype, int target_rank, YogiMPI_Aint target_disp, YogiMPI_Win win);
+
+int YogiMPI_Dims_create(int nnodes, int ndims, int dims[]);
+
+int YogiMPI_Dist_graph_create(YogiMPI_Comm comm_old, int n, const int sources[], const int degrees[], const int destinations[], const int weights[], YogiMPI_Info info, int reorder, YogiMPI_Comm* comm_dist_graph);
+
+int YogiMPI_Dist_graph_create_adjacent(YogiMPI_Comm comm_old, int indegree, const int sources[], const int sourceweights[], int outdegree, const int destinations[], const int destweights[], YogiMPI_Info info, int reorder, YogiMPI_Comm* comm_dist_graph);
+
+int YogiMPI_Dist_graph_neighbors(YogiMPI_Comm comm, int maxindegree, int sources[], int sourceweights[], int maxoutdegree, int destinations[], int destweights[]);
+
+int YogiMPI_Dist_graph_neighbors_count(YogiMPI_Comm comm, int* indegree, int* outdegree, int* weighted);
+
+int YogiMPI_Errhandler_create(YogiMPI_Handler_function* function, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Errhandler_free(YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Errhandler_get(YogiMPI_Comm comm, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Errhandler_set(YogiMPI_Comm comm, YogiMPI_Errhandler errhandler);
+
+int YogiMPI_Exscan(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm);
+
+int YogiMPI_Fetch_and_op(const void* origin_addr, void* result_addr, YogiMPI_Datatype datatype, int target_rank, YogiMPI_Aint target_disp, YogiMPI_Op op, YogiMPI_Win win);
+
+int YogiMPI_File_call_errhandler(YogiMPI_File fh, int errorcode);
+
+int YogiMPI_File_close(YogiMPI_File* fh);
+
+int YogiMPI_File_create_errhandler(YogiMPI_File_errhandler_function* file_errhandler_fn, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_File_delete(const char* filename, YogiMPI_Info info);
+
+int YogiMPI_File_get_amode(YogiMPI_File fh, int* amode);
+
+int YogiMPI_File_get_atomicity(YogiMPI_File fh, int* flag);
+
+int YogiMPI_File_get_byte_offset(YogiMPI_File fh, YogiMPI_Offset offset, YogiMPI_Offset* disp);
+
+int YogiMPI_File_get_errhandler(YogiMPI_File file, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_File_get_group(YogiMPI_File fh, YogiMPI_Group* group);
+
+int YogiMPI_File_get_info(YogiMPI_File fh, YogiMPI_Info* info_used);
+
+int YogiMPI_File_get_position(YogiMPI_File fh, YogiMPI_Offset* offset);
+
+int YogiMPI_File_get_position_shared(YogiMPI_File fh, YogiMPI_Offset* offset);
+
+int YogiMPI_File_get_size(YogiMPI_File fh, YogiMPI_Offset* size);
+
+int YogiMPI_File_get_type_extent(YogiMPI_File fh, YogiMPI_Datatype datatype, YogiMPI_Aint* extent);
+
+int YogiMPI_File_get_view(YogiMPI_File fh, YogiMPI_Offset* disp, YogiMPI_Datatype* etype, YogiMPI_Datatype* filetype, char* datarep);
+
+int YogiMPI_File_iread(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_iread_at(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_iread_shared(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_iwrite(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_iwrite_at(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_iwrite_shared(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Request* request);
+
+int YogiMPI_File_open(YogiMPI_Comm comm, const char* filename, int amode, YogiMPI_Info info, YogiMPI_File* fh);
+
+int YogiMPI_File_preallocate(YogiMPI_File fh, YogiMPI_Offset size);
+
+int YogiMPI_File_read(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_read_all(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_read_all_begin(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_read_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_read_at(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_read_at_all(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_read_at_all_begin(YogiMPI_File fh, YogiMPI_Offset offset, void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_read_at_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_read_ordered(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_read_ordered_begin(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_read_ordered_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_read_shared(YogiMPI_File fh, void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_seek(YogiMPI_File fh, YogiMPI_Offset offset, int whence);
+
+int YogiMPI_File_seek_shared(YogiMPI_File fh, YogiMPI_Offset offset, int whence);
+
+int YogiMPI_File_set_atomicity(YogiMPI_File fh, int flag);
+
+int YogiMPI_File_set_errhandler(YogiMPI_File file, YogiMPI_Errhandler errhandler);
+
+int YogiMPI_File_set_info(YogiMPI_File fh, YogiMPI_Info info);
+
+int YogiMPI_File_set_size(YogiMPI_File fh, YogiMPI_Offset size);
+
+int YogiMPI_File_set_view(YogiMPI_File fh, YogiMPI_Offset disp, YogiMPI_Datatype etype, YogiMPI_Datatype filetype, const char* datarep, YogiMPI_Info info);
+
+int YogiMPI_File_sync(YogiMPI_File fh);
+
+int YogiMPI_File_write(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_write_all(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_write_all_begin(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_write_all_end(YogiMPI_File fh, void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_write_at(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_write_at_all(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_write_at_all_begin(YogiMPI_File fh, YogiMPI_Offset offset, const void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_write_at_all_end(YogiMPI_File fh, const void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_write_ordered(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_File_write_ordered_begin(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype);
+
+int YogiMPI_File_write_ordered_end(YogiMPI_File fh, const void* buf, YogiMPI_Status* status);
+
+int YogiMPI_File_write_shared(YogiMPI_File fh, const void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Status* status);
+
+int YogiMPI_Finalized(int* flag);
+
+int YogiMPI_Free_mem(void* base);
+
+int YogiMPI_Gather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Gatherv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, const int* recvcounts, const int* displs, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Get(void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win);
+
+int YogiMPI_Get_accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, void* result_addr, int result_count, YogiMPI_Datatype result_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win);
+
+int YogiMPI_Get_address(const void* location, YogiMPI_Aint* address);
+
+int YogiMPI_Get_count(const YogiMPI_Status* status, YogiMPI_Datatype datatype, int* count);
+
+int YogiMPI_Get_elements(const YogiMPI_Status* status, YogiMPI_Datatype datatype, int* count);
+
+int YogiMPI_Get_elements_x(const YogiMPI_Status* status, YogiMPI_Datatype datatype, YogiMPI_Count* count);
+
+int YogiMPI_Get_library_version(char* version, int* resultlen);
+
+int YogiMPI_Get_version(int* version, int* subversion);
+
+int YogiMPI_Graph_create(YogiMPI_Comm comm_old, int nnodes, int indx[], int edges[], int reorder, YogiMPI_Comm* comm_graph);
+
+int YogiMPI_Graph_get(YogiMPI_Comm comm, int maxindex, int maxedges, int indx[], int edges[]);
+
+int YogiMPI_Graph_map(YogiMPI_Comm comm, int nnodes, int indx[], int edges[], int* newrank);
+
+int YogiMPI_Graph_neighbors(YogiMPI_Comm comm, int rank, int maxneighbors, int neighbors[]);
+
+int YogiMPI_Graph_neighbors_count(YogiMPI_Comm comm, int rank, int* nneighbors);
+
+int YogiMPI_Graphdims_get(YogiMPI_Comm comm, int* nnodes, int* nedges);
+
+int YogiMPI_Grequest_complete(YogiMPI_Request request);
+
+int YogiMPI_Grequest_start(YogiMPI_Grequest_query_function* query_fn, YogiMPI_Grequest_free_function* free_fn, YogiMPI_Grequest_cancel_function* cancel_fn, void* extra_state, YogiMPI_Request* request);
+
+int YogiMPI_Group_compare(YogiMPI_Group group1, YogiMPI_Group group2, int* result);
+
+int YogiMPI_Group_difference(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_excl(YogiMPI_Group group, int n, const int ranks[], YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_free(YogiMPI_Group* group);
+
+int YogiMPI_Group_incl(YogiMPI_Group group, int n, const int ranks[], YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_intersection(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_range_excl(YogiMPI_Group group, int n, int ranges[][3], YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_range_incl(YogiMPI_Group group, int n, int ranges[][3], YogiMPI_Group* newgroup);
+
+int YogiMPI_Group_rank(YogiMPI_Group group, int* rank);
+
+int YogiMPI_Group_size(YogiMPI_Group group, int* size);
+
+int YogiMPI_Group_translate_ranks(YogiMPI_Group group1, int n, const int ranks1[], YogiMPI_Group group2, int ranks2[]);
+
+int YogiMPI_Group_union(YogiMPI_Group group1, YogiMPI_Group group2, YogiMPI_Group* newgroup);
+
+int YogiMPI_Iallgather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Iallgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Iallreduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ialltoall(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ialltoallv(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ialltoallw(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtypes[], void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ibarrier(YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ibcast(void* buffer, int count, YogiMPI_Datatype datatype, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ibsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Iexscan(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Igather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Igatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Improbe(int source, int tag, YogiMPI_Comm comm, int* flag, YogiMPI_Message* message, YogiMPI_Status* status);
+
+int YogiMPI_Imrecv(void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Message* message, YogiMPI_Request* request);
+
+int YogiMPI_Ineighbor_allgather(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ineighbor_allgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ineighbor_alltoall(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ineighbor_alltoallv(void* sendbuf, int sendcounts[], int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ineighbor_alltoallw(const void* sendbuf, const int sendcounts[], const YogiMPI_Aint sdispls[], const YogiMPI_Datatype sendtypes[], void* recvbuf, const int recvcounts[], const YogiMPI_Aint rdispls[], const YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Info_create(YogiMPI_Info* info);
+
+int YogiMPI_Info_delete(YogiMPI_Info info, const char* key);
+
+int YogiMPI_Info_dup(YogiMPI_Info info, YogiMPI_Info* newinfo);
+
+int YogiMPI_Info_free(YogiMPI_Info* info);
+
+int YogiMPI_Info_get(YogiMPI_Info info, const char* key, int valuelen, char* value, int* flag);
+
+int YogiMPI_Info_get_nkeys(YogiMPI_Info info, int* nkeys);
+
+int YogiMPI_Info_get_nthkey(YogiMPI_Info info, int n, char* key);
+
+int YogiMPI_Info_get_valuelen(YogiMPI_Info info, const char* key, int* valuelen, int* flag);
+
+int YogiMPI_Info_set(YogiMPI_Info info, const char* key, const char* value);
+
+int YogiMPI_Initialized(int* flag);
+
+int YogiMPI_Intercomm_create(YogiMPI_Comm local_comm, int local_leader, YogiMPI_Comm peer_comm, int remote_leader, int tag, YogiMPI_Comm* newintercomm);
+
+int YogiMPI_Intercomm_merge(YogiMPI_Comm intercomm, int high, YogiMPI_Comm* newintracomm);
+
+int YogiMPI_Iprobe(int source, int tag, YogiMPI_Comm comm, int* flag, YogiMPI_Status* status);
+
+int YogiMPI_Irecv(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ireduce(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ireduce_scatter(void* sendbuf, void* recvbuf, int recvcounts[], YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Ireduce_scatter_block(void* sendbuf, void* recvbuf, int recvcount, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Irsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Is_thread_main(int* flag);
+
+int YogiMPI_Iscan(void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Iscatter(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Iscatterv(void* sendbuf, int sendcounts[], int displs[], YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Isend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Issend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Keyval_create(YogiMPI_Copy_function* copy_fn, YogiMPI_Delete_function* delete_fn, int* keyval, void* extra_state);
+
+int YogiMPI_Keyval_free(int* keyval);
+
+int YogiMPI_Lookup_name(char* service_name, YogiMPI_Info info, char* port_name);
+
+int YogiMPI_Mprobe(int source, int tag, YogiMPI_Comm comm, YogiMPI_Message* message, YogiMPI_Status* status);
+
+int YogiMPI_Mrecv(void* buf, int count, YogiMPI_Datatype datatype, YogiMPI_Message* message, YogiMPI_Status* status);
+
+int YogiMPI_Neighbor_allgather(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Neighbor_allgatherv(void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcounts[], int displs[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Neighbor_alltoall(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Neighbor_alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], YogiMPI_Datatype sendtype, void* recvbuf, const int recvcounts[], const int rdispls[], YogiMPI_Datatype recvtype, YogiMPI_Comm comm);
+
+int YogiMPI_Neighbor_alltoallw(const void* sendbuf, const int sendcounts[], const YogiMPI_Aint sdispls[], const YogiMPI_Datatype sendtypes[], void* recvbuf, const int recvcounts[], const YogiMPI_Aint rdispls[], const YogiMPI_Datatype recvtypes[], YogiMPI_Comm comm);
+
+int YogiMPI_Op_commutative(YogiMPI_Op op, int* commute);
+
+int YogiMPI_Op_create(YogiMPI_User_function* user_fn, int commute, YogiMPI_Op* op);
+
+int YogiMPI_Op_free(YogiMPI_Op* op);
+
+int YogiMPI_Open_port(YogiMPI_Info info, char* port_name);
+
+int YogiMPI_Pack(const void* inbuf, int incount, YogiMPI_Datatype datatype, void* outbuf, int outsize, int* position, YogiMPI_Comm comm);
+
+int YogiMPI_Pack_external(char* datarep, void* inbuf, int incount, YogiMPI_Datatype datatype, void* outbuf, YogiMPI_Aint outsize, YogiMPI_Aint* position);
+
+int YogiMPI_Pack_external_size(char* datarep, int incount, YogiMPI_Datatype datatype, YogiMPI_Aint* size);
+
+int YogiMPI_Pack_size(int incount, YogiMPI_Datatype datatype, YogiMPI_Comm comm, int* size);
+
+int YogiMPI_Pcontrol(int level);
+
+int YogiMPI_Probe(int source, int tag, YogiMPI_Comm comm, YogiMPI_Status* status);
+
+int YogiMPI_Publish_name(const char* service_name, YogiMPI_Info info, const char* port_name);
+
+int YogiMPI_Put(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win);
+
+int YogiMPI_Query_thread(int* provided);
+
+int YogiMPI_Raccumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win, YogiMPI_Request* request);
+
+int YogiMPI_Recv(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Status* status);
+
+int YogiMPI_Recv_init(void* buf, int count, YogiMPI_Datatype datatype, int source, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Reduce(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Reduce_local(const void* inbuf, void* inoutbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op);
+
+int YogiMPI_Reduce_scatter(const void* sendbuf, void* recvbuf, int recvcounts[], YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm);
+
+int YogiMPI_Reduce_scatter_block(void* sendbuf, void* recvbuf, int recvcount, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm);
+
+int YogiMPI_Register_datarep(const char* datarep, YogiMPI_Datarep_conversion_function* read_conversion_fn, YogiMPI_Datarep_conversion_function* write_conversion_fn, YogiMPI_Datarep_extent_function* dtype_file_extent_fn, void* extra_state);
+
+int YogiMPI_Request_free(YogiMPI_Request* request);
+
+int YogiMPI_Request_get_status(YogiMPI_Request request, int* flag, YogiMPI_Status* status);
+
+int YogiMPI_Rget(void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win, YogiMPI_Request* request);
+
+int YogiMPI_Rget_accumulate(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, void* result_addr, int result_count, YogiMPI_Datatype result_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Op op, YogiMPI_Win win, YogiMPI_Request* request);
+
+int YogiMPI_Rput(const void* origin_addr, int origin_count, YogiMPI_Datatype origin_datatype, int target_rank, YogiMPI_Aint target_disp, int target_count, YogiMPI_Datatype target_datatype, YogiMPI_Win win, YogiMPI_Request* request);
+
+int YogiMPI_Rsend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm);
+
+int YogiMPI_Rsend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Scan(const void* sendbuf, void* recvbuf, int count, YogiMPI_Datatype datatype, YogiMPI_Op op, YogiMPI_Comm comm);
+
+int YogiMPI_Scatter(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Scatterv(const void* sendbuf, const int* sendcounts, const int* displs, YogiMPI_Datatype sendtype, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int root, YogiMPI_Comm comm);
+
+int YogiMPI_Send(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm);
+
+int YogiMPI_Send_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Sendrecv(const void* sendbuf, int sendcount, YogiMPI_Datatype sendtype, int dest, int sendtag, void* recvbuf, int recvcount, YogiMPI_Datatype recvtype, int source, int recvtag, YogiMPI_Comm comm, YogiMPI_Status* status);
+
+int YogiMPI_Sendrecv_replace(void* buf, int count, YogiMPI_Datatype datatype, int dest, int sendtag, int source, int recvtag, YogiMPI_Comm comm, YogiMPI_Status* status);
+
+int YogiMPI_Ssend(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm);
+
+int YogiMPI_Ssend_init(const void* buf, int count, YogiMPI_Datatype datatype, int dest, int tag, YogiMPI_Comm comm, YogiMPI_Request* request);
+
+int YogiMPI_Start(YogiMPI_Request* request);
+
+int YogiMPI_Startall(int count, YogiMPI_Request array_of_requests[]);
+
+int YogiMPI_Status_set_cancelled(YogiMPI_Status* status, int flag);
+
+int YogiMPI_Status_set_elements(YogiMPI_Status* status, YogiMPI_Datatype datatype, int count);
+
+int YogiMPI_Status_set_elements_x(YogiMPI_Status* status, YogiMPI_Datatype datatype, YogiMPI_Count count);
+
+int YogiMPI_Test(YogiMPI_Request* request, int* flag, YogiMPI_Status* status);
+
+int YogiMPI_Test_cancelled(const YogiMPI_Status* status, int* flag);
+
+int YogiMPI_Testall(int count, YogiMPI_Request array_of_requests[], int* flag, YogiMPI_Status array_of_statuses[]);
+
+int YogiMPI_Testany(int count, YogiMPI_Request array_of_requests[], int* indx, int* flag, YogiMPI_Status* status);
+
+int YogiMPI_Testsome(int incount, YogiMPI_Request array_of_requests[], int* outcount, int array_of_indices[], YogiMPI_Status array_of_statuses[]);
+
+int YogiMPI_Topo_test(YogiMPI_Comm comm, int* status);
+
+int YogiMPI_Type_commit(YogiMPI_Datatype* datatype);
+
+int YogiMPI_Type_contiguous(int count, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_hindexed(int count, int array_of_blocklengths[], YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_hindexed_block(int count, int blocklength, YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_hvector(int count, int blocklength, YogiMPI_Aint stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_indexed_block(int count, int blocklength, int array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_keyval(YogiMPI_Type_copy_attr_function* type_copy_attr_fn, YogiMPI_Type_delete_attr_function* type_delete_attr_fn, int* type_keyval, void* extra_state);
+
+int YogiMPI_Type_create_resized(YogiMPI_Datatype oldtype, YogiMPI_Aint lb, YogiMPI_Aint extent, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_struct(int count, int array_of_blocklengths[], YogiMPI_Aint array_of_displacements[], YogiMPI_Datatype array_of_types[], YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_create_subarray(int ndims, int array_of_sizes[], int array_of_subsizes[], int array_of_starts[], int order, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_delete_attr(YogiMPI_Datatype datatype, int type_keyval);
+
+int YogiMPI_Type_dup(YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* extent);
+
+int YogiMPI_Type_free(YogiMPI_Datatype* datatype);
+
+int YogiMPI_Type_free_keyval(int* type_keyval);
+
+int YogiMPI_Type_get_attr(YogiMPI_Datatype datatype, int type_keyval, void* attribute_val, int* flag);
+
+int YogiMPI_Type_get_envelope(YogiMPI_Datatype datatype, int* num_integers, int* num_addresses, int* num_datatypes, int* combiner);
+
+int YogiMPI_Type_get_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* lb, YogiMPI_Aint* extent);
+
+int YogiMPI_Type_get_extent_x(YogiMPI_Datatype datatype, YogiMPI_Count* lb, YogiMPI_Count* extent);
+
+int YogiMPI_Type_get_name(YogiMPI_Datatype datatype, char* type_name, int* resultlen);
+
+int YogiMPI_Type_get_true_extent(YogiMPI_Datatype datatype, YogiMPI_Aint* true_lb, YogiMPI_Aint* true_extent);
+
+int YogiMPI_Type_get_true_extent_x(YogiMPI_Datatype datatype, YogiMPI_Count* true_lb, YogiMPI_Count* true_extent);
+
+int YogiMPI_Type_hindexed(int count, int* array_of_blocklengths, YogiMPI_Aint* array_of_displacements, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_hvector(int count, int blocklength, YogiMPI_Aint stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_indexed(int count, const int array_of_blocklengths[], const int array_of_displacements[], YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_lb(YogiMPI_Datatype datatype, YogiMPI_Aint* displacement);
+
+int YogiMPI_Type_match_size(int typeclass, int size, YogiMPI_Datatype* datatype);
+
+int YogiMPI_Type_set_attr(YogiMPI_Datatype datatype, int type_keyval, void* attribute_val);
+
+int YogiMPI_Type_set_name(YogiMPI_Datatype datatype, const char* type_name);
+
+int YogiMPI_Type_size(YogiMPI_Datatype datatype, int* size);
+
+int YogiMPI_Type_size_x(YogiMPI_Datatype datatype, YogiMPI_Count* size);
+
+int YogiMPI_Type_struct(int count, int* array_of_blocklengths, const YogiMPI_Aint* array_of_displacements, const YogiMPI_Datatype* array_of_types, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Type_ub(YogiMPI_Datatype datatype, YogiMPI_Aint* displacement);
+
+int YogiMPI_Type_vector(int count, int blocklength, int stride, YogiMPI_Datatype oldtype, YogiMPI_Datatype* newtype);
+
+int YogiMPI_Unpack(const void* inbuf, int insize, int* position, void* outbuf, int outcount, YogiMPI_Datatype datatype, YogiMPI_Comm comm);
+
+int YogiMPI_Unpack_external(char* datarep, void* inbuf, YogiMPI_Aint insize, YogiMPI_Aint* position, void* outbuf, int outcount, YogiMPI_Datatype datatype);
+
+int YogiMPI_Unpublish_name(const char* service_name, YogiMPI_Info info, const char* port_name);
+
+int YogiMPI_Wait(YogiMPI_Request* request, YogiMPI_Status* status);
+
+int YogiMPI_Waitall(int count, YogiMPI_Request array_of_requests[], YogiMPI_Status array_of_statuses[]);
+
+int YogiMPI_Waitany(int count, YogiMPI_Request array_of_requests[], int* indx, YogiMPI_Status* status);
+
+int YogiMPI_Waitsome(int incount, YogiMPI_Request array_of_requests[], int* outcount, int array_of_indices[], YogiMPI_Status array_of_statuses[]);
+
+int YogiMPI_Win_allocate(YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, void* baseptr, YogiMPI_Win* win);
+
+int YogiMPI_Win_allocate_shared(YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, void* baseptr, YogiMPI_Win* win);
+
+int YogiMPI_Win_attach(YogiMPI_Win win, void* base, YogiMPI_Aint size);
+
+int YogiMPI_Win_call_errhandler(YogiMPI_Win win, int errorcode);
+
+int YogiMPI_Win_complete(YogiMPI_Win win);
+
+int YogiMPI_Win_create(void* base, YogiMPI_Aint size, int disp_unit, YogiMPI_Info info, YogiMPI_Comm comm, YogiMPI_Win* win);
+
+int YogiMPI_Win_create_dynamic(YogiMPI_Info info, YogiMPI_Comm comm, YogiMPI_Win* win);
+
+int YogiMPI_Win_create_errhandler(YogiMPI_Win_errhandler_function* win_errhandler_fn, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Win_create_keyval(YogiMPI_Win_copy_attr_function* win_copy_attr_fn, YogiMPI_Win_delete_attr_function* win_delete_attr_fn, int* win_keyval, void* extra_state);
+
+int YogiMPI_Win_delete_attr(YogiMPI_Win win, int win_keyval);
+
+int YogiMPI_Win_detach(YogiMPI_Win win, const void* base);
+
+int YogiMPI_Win_fence(int assert, YogiMPI_Win win);
+
+int YogiMPI_Win_flush(int rank, YogiMPI_Win win);
+
+int YogiMPI_Win_flush_all(YogiMPI_Win win);
+
+int YogiMPI_Win_flush_local(int rank, YogiMPI_Win win);
+
+int YogiMPI_Win_flush_local_all(YogiMPI_Win win);
+
+int YogiMPI_Win_free(YogiMPI_Win* win);
+
+int YogiMPI_Win_free_keyval(int* win_keyval);
+
+int YogiMPI_Win_get_attr(YogiMPI_Win win, int win_keyval, void* attribute_val, int* flag);
+
+int YogiMPI_Win_get_errhandler(YogiMPI_Win win, YogiMPI_Errhandler* errhandler);
+
+int YogiMPI_Win_get_group(YogiMPI_Win win, YogiMPI_Group* group);
+
+int YogiMPI_Win_get_info(YogiMPI_Win win, YogiMPI_Info* info_used);
+
+int YogiMPI_Win_get_name(YogiMPI_Win win, char* win_name, int* resultlen);
+
+int YogiMPI_Win_lock(int lock_type, int rank, int assert, YogiMPI_Win win);
+
+int YogiMPI_Win_lock_all(int assert, YogiMPI_Win win);
+
+int YogiMPI_Win_post(YogiMPI_Group group, int assert, YogiMPI_Win win);
+
+int YogiMPI_Win_set_attr(YogiMPI_Win win, int win_keyval, void* attribute_val);
+
+int YogiMPI_Win_set_errhandler(YogiMPI_Win win, YogiMPI_Errhandler errhandler);
+
+int YogiMPI_Win_set_info(YogiMPI_Win win, YogiMPI_Info info);
+
+int YogiMPI_Win_set_name(YogiMPI_Win win, const char* win_name);
+
+int YogiMPI_Win_shared_query(YogiMPI_Win win, int rank, YogiMPI_Aint* size, int* disp_unit, void* baseptr);
+
+int YogiMPI_Win_start(YogiMPI_Group group, int assert, YogiMPI_Win win);
+
+int YogiMPI_Win_sync(YogiMPI_Win win);
+
+int YogiMPI_Win_test(YogiMPI_Win win, int* flag);
+
+int YogiMPI_Win_unlock(int rank, YogiMPI_Win win);
+
+int YogiMPI_Win_unlock_all(YogiMPI_Win win);
+
+int YogiMPI_Win_wait(YogiMPI_Win win);
+
+
+/* End function prototypes. */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* YOGIMPI_H */
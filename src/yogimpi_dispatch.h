@@ -0,0 +1,1104 @@
+#ifndef _yogimpi_dispatch_included_
+#define _yogimpi_dispatch_included_
+
+/*
+ * Dispatch table for a YogiMPI built with -DYOGI_DISPATCH.  Every MPI
+ * function YogiMPI calls is redirected through a table of function pointers
+ * that are looked up with dlsym the first time each one is called, in the
+ * library named by YMPI_LOADLIBRARY (or the one linked in, when unset).  The
+ * backend can then be changed at run time without relinking, as long as it
+ * has the ABI of the mpi.h YogiMPI was built against.
+ *
+ * Include only after mpi.h.  Generated by generate_wrap.py.
+ */
+
+#include <atomic>
+
+typedef decltype(&::MPI_Init) YogiFn_MPI_Init;
+typedef decltype(&::MPI_Init_thread) YogiFn_MPI_Init_thread;
+typedef decltype(&::MPI_Finalize) YogiFn_MPI_Finalize;
+typedef decltype(&::MPI_Error_class) YogiFn_MPI_Error_class;
+typedef decltype(&::MPI_Error_string) YogiFn_MPI_Error_string;
+typedef decltype(&::MPI_Get_processor_name) YogiFn_MPI_Get_processor_name;
+typedef decltype(&::MPI_Type_get_contents) YogiFn_MPI_Type_get_contents;
+typedef decltype(&::MPI_Type_create_darray) YogiFn_MPI_Type_create_darray;
+typedef decltype(&::MPI_Wtick) YogiFn_MPI_Wtick;
+typedef decltype(&::MPI_Wtime) YogiFn_MPI_Wtime;
+typedef decltype(&::MPI_Comm_f2c) YogiFn_MPI_Comm_f2c;
+typedef decltype(&::MPI_Group_f2c) YogiFn_MPI_Group_f2c;
+typedef decltype(&::MPI_Comm_spawn) YogiFn_MPI_Comm_spawn;
+typedef decltype(&::MPI_Abort) YogiFn_MPI_Abort;
+typedef decltype(&::MPI_Accumulate) YogiFn_MPI_Accumulate;
+typedef decltype(&::MPI_Add_error_class) YogiFn_MPI_Add_error_class;
+typedef decltype(&::MPI_Add_error_code) YogiFn_MPI_Add_error_code;
+typedef decltype(&::MPI_Add_error_string) YogiFn_MPI_Add_error_string;
+typedef decltype(&::MPI_Address) YogiFn_MPI_Address;
+typedef decltype(&::MPI_Allgather) YogiFn_MPI_Allgather;
+typedef decltype(&::MPI_Allgatherv) YogiFn_MPI_Allgatherv;
+typedef decltype(&::MPI_Alloc_mem) YogiFn_MPI_Alloc_mem;
+typedef decltype(&::MPI_Allreduce) YogiFn_MPI_Allreduce;
+typedef decltype(&::MPI_Alltoall) YogiFn_MPI_Alltoall;
+typedef decltype(&::MPI_Alltoallv) YogiFn_MPI_Alltoallv;
+typedef decltype(&::MPI_Alltoallw) YogiFn_MPI_Alltoallw;
+typedef decltype(&::MPI_Attr_delete) YogiFn_MPI_Attr_delete;
+typedef decltype(&::MPI_Attr_get) YogiFn_MPI_Attr_get;
+typedef decltype(&::MPI_Attr_put) YogiFn_MPI_Attr_put;
+typedef decltype(&::MPI_Barrier) YogiFn_MPI_Barrier;
+typedef decltype(&::MPI_Bcast) YogiFn_MPI_Bcast;
+typedef decltype(&::MPI_Bsend) YogiFn_MPI_Bsend;
+typedef decltype(&::MPI_Bsend_init) YogiFn_MPI_Bsend_init;
+typedef decltype(&::MPI_Buffer_attach) YogiFn_MPI_Buffer_attach;
+typedef decltype(&::MPI_Buffer_detach) YogiFn_MPI_Buffer_detach;
+typedef decltype(&::MPI_Cancel) YogiFn_MPI_Cancel;
+typedef decltype(&::MPI_Cart_coords) YogiFn_MPI_Cart_coords;
+typedef decltype(&::MPI_Cart_create) YogiFn_MPI_Cart_create;
+typedef decltype(&::MPI_Cart_get) YogiFn_MPI_Cart_get;
+typedef decltype(&::MPI_Cart_map) YogiFn_MPI_Cart_map;
+typedef decltype(&::MPI_Cart_rank) YogiFn_MPI_Cart_rank;
+typedef decltype(&::MPI_Cart_shift) YogiFn_MPI_Cart_shift;
+typedef decltype(&::MPI_Cart_sub) YogiFn_MPI_Cart_sub;
+typedef decltype(&::MPI_Cartdim_get) YogiFn_MPI_Cartdim_get;
+typedef decltype(&::MPI_Close_port) YogiFn_MPI_Close_port;
+typedef decltype(&::MPI_Comm_accept) YogiFn_MPI_Comm_accept;
+typedef decltype(&::MPI_Comm_call_errhandler) YogiFn_MPI_Comm_call_errhandler;
+typedef decltype(&::MPI_Comm_compare) YogiFn_MPI_Comm_compare;
+typedef decltype(&::MPI_Comm_connect) YogiFn_MPI_Comm_connect;
+typedef decltype(&::MPI_Comm_create) YogiFn_MPI_Comm_create;
+typedef decltype(&::MPI_Comm_create_errhandler) YogiFn_MPI_Comm_create_errhandler;
+typedef decltype(&::MPI_Comm_create_group) YogiFn_MPI_Comm_create_group;
+typedef decltype(&::MPI_Comm_create_keyval) YogiFn_MPI_Comm_create_keyval;
+typedef decltype(&::MPI_Comm_delete_attr) YogiFn_MPI_Comm_delete_attr;
+typedef decltype(&::MPI_Comm_disconnect) YogiFn_MPI_Comm_disconnect;
+typedef decltype(&::MPI_Comm_dup) YogiFn_MPI_Comm_dup;
+typedef decltype(&::MPI_Comm_dup_with_info) YogiFn_MPI_Comm_dup_with_info;
+typedef decltype(&::MPI_Comm_free) YogiFn_MPI_Comm_free;
+typedef decltype(&::MPI_Comm_free_keyval) YogiFn_MPI_Comm_free_keyval;
+typedef decltype(&::MPI_Comm_get_attr) YogiFn_MPI_Comm_get_attr;
+typedef decltype(&::MPI_Comm_get_errhandler) YogiFn_MPI_Comm_get_errhandler;
+typedef decltype(&::MPI_Comm_get_info) YogiFn_MPI_Comm_get_info;
+typedef decltype(&::MPI_Comm_get_name) YogiFn_MPI_Comm_get_name;
+typedef decltype(&::MPI_Comm_get_parent) YogiFn_MPI_Comm_get_parent;
+typedef decltype(&::MPI_Comm_group) YogiFn_MPI_Comm_group;
+typedef decltype(&::MPI_Comm_idup) YogiFn_MPI_Comm_idup;
+typedef decltype(&::MPI_Comm_join) YogiFn_MPI_Comm_join;
+typedef decltype(&::MPI_Comm_rank) YogiFn_MPI_Comm_rank;
+typedef decltype(&::MPI_Comm_remote_group) YogiFn_MPI_Comm_remote_group;
+typedef decltype(&::MPI_Comm_remote_size) YogiFn_MPI_Comm_remote_size;
+typedef decltype(&::MPI_Comm_set_attr) YogiFn_MPI_Comm_set_attr;
+typedef decltype(&::MPI_Comm_set_errhandler) YogiFn_MPI_Comm_set_errhandler;
+typedef decltype(&::MPI_Comm_set_info) YogiFn_MPI_Comm_set_info;
+typedef decltype(&::MPI_Comm_set_name) YogiFn_MPI_Comm_set_name;
+typedef decltype(&::MPI_Comm_size) YogiFn_MPI_Comm_size;
+typedef decltype(&::MPI_Comm_split) YogiFn_MPI_Comm_split;
+typedef decltype(&::MPI_Comm_split_type) YogiFn_MPI_Comm_split_type;
+typedef decltype(&::MPI_Comm_test_inter) YogiFn_MPI_Comm_test_inter;
+typedef decltype(&::MPI_Compare_and_swap) YogiFn_MPI_Compare_and_swap;
+typedef decltype(&::MPI_Dims_create) YogiFn_MPI_Dims_create;
+typedef decltype(&::MPI_Dist_graph_create) YogiFn_MPI_Dist_graph_create;
+typedef decltype(&::MPI_Dist_graph_create_adjacent) YogiFn_MPI_Dist_graph_create_adjacent;
+typedef decltype(&::MPI_Dist_graph_neighbors) YogiFn_MPI_Dist_graph_neighbors;
+typedef decltype(&::MPI_Dist_graph_neighbors_count) YogiFn_MPI_Dist_graph_neighbors_count;
+typedef decltype(&::MPI_Errhandler_create) YogiFn_MPI_Errhandler_create;
+typedef decltype(&::MPI_Errhandler_free) YogiFn_MPI_Errhandler_free;
+typedef decltype(&::MPI_Errhandler_get) YogiFn_MPI_Errhandler_get;
+typedef decltype(&::MPI_Errhandler_set) YogiFn_MPI_Errhandler_set;
+typedef decltype(&::MPI_Exscan) YogiFn_MPI_Exscan;
+typedef decltype(&::MPI_Fetch_and_op) YogiFn_MPI_Fetch_and_op;
+typedef decltype(&::MPI_File_call_errhandler) YogiFn_MPI_File_call_errhandler;
+typedef decltype(&::MPI_File_close) YogiFn_MPI_File_close;
+typedef decltype(&::MPI_File_create_errhandler) YogiFn_MPI_File_create_errhandler;
+typedef decltype(&::MPI_File_delete) YogiFn_MPI_File_delete;
+typedef decltype(&::MPI_File_get_amode) YogiFn_MPI_File_get_amode;
+typedef decltype(&::MPI_File_get_atomicity) YogiFn_MPI_File_get_atomicity;
+typedef decltype(&::MPI_File_get_byte_offset) YogiFn_MPI_File_get_byte_offset;
+typedef decltype(&::MPI_File_get_errhandler) YogiFn_MPI_File_get_errhandler;
+typedef decltype(&::MPI_File_get_group) YogiFn_MPI_File_get_group;
+typedef decltype(&::MPI_File_get_info) YogiFn_MPI_File_get_info;
+typedef decltype(&::MPI_File_get_position) YogiFn_MPI_File_get_position;
+typedef decltype(&::MPI_File_get_position_shared) YogiFn_MPI_File_get_position_shared;
+typedef decltype(&::MPI_File_get_size) YogiFn_MPI_File_get_size;
+typedef decltype(&::MPI_File_get_type_extent) YogiFn_MPI_File_get_type_extent;
+typedef decltype(&::MPI_File_get_view) YogiFn_MPI_File_get_view;
+typedef decltype(&::MPI_File_iread) YogiFn_MPI_File_iread;
+typedef decltype(&::MPI_File_iread_at) YogiFn_MPI_File_iread_at;
+typedef decltype(&::MPI_File_iread_shared) YogiFn_MPI_File_iread_shared;
+typedef decltype(&::MPI_File_iwrite) YogiFn_MPI_File_iwrite;
+typedef decltype(&::MPI_File_iwrite_at) YogiFn_MPI_File_iwrite_at;
+typedef decltype(&::MPI_File_iwrite_shared) YogiFn_MPI_File_iwrite_shared;
+typedef decltype(&::MPI_File_open) YogiFn_MPI_File_open;
+typedef decltype(&::MPI_File_preallocate) YogiFn_MPI_File_preallocate;
+typedef decltype(&::MPI_File_read) YogiFn_MPI_File_read;
+typedef decltype(&::MPI_File_read_all) YogiFn_MPI_File_read_all;
+typedef decltype(&::MPI_File_read_all_begin) YogiFn_MPI_File_read_all_begin;
+typedef decltype(&::MPI_File_read_all_end) YogiFn_MPI_File_read_all_end;
+typedef decltype(&::MPI_File_read_at) YogiFn_MPI_File_read_at;
+typedef decltype(&::MPI_File_read_at_all) YogiFn_MPI_File_read_at_all;
+typedef decltype(&::MPI_File_read_at_all_begin) YogiFn_MPI_File_read_at_all_begin;
+typedef decltype(&::MPI_File_read_at_all_end) YogiFn_MPI_File_read_at_all_end;
+typedef decltype(&::MPI_File_read_ordered) YogiFn_MPI_File_read_ordered;
+typedef decltype(&::MPI_File_read_ordered_begin) YogiFn_MPI_File_read_ordered_begin;
+typedef decltype(&::MPI_File_read_ordered_end) YogiFn_MPI_File_read_ordered_end;
+typedef decltype(&::MPI_File_read_shared) YogiFn_MPI_File_read_shared;
+typedef decltype(&::MPI_File_seek) YogiFn_MPI_File_seek;
+typedef decltype(&::MPI_File_seek_shared) YogiFn_MPI_File_seek_shared;
+typedef decltype(&::MPI_File_set_atomicity) YogiFn_MPI_File_set_atomicity;
+typedef decltype(&::MPI_File_set_errhandler) YogiFn_MPI_File_set_errhandler;
+typedef decltype(&::MPI_File_set_info) YogiFn_MPI_File_set_info;
+typedef decltype(&::MPI_File_set_size) YogiFn_MPI_File_set_size;
+typedef decltype(&::MPI_File_set_view) YogiFn_MPI_File_set_view;
+typedef decltype(&::MPI_File_sync) YogiFn_MPI_File_sync;
+typedef decltype(&::MPI_File_write) YogiFn_MPI_File_write;
+typedef decltype(&::MPI_File_write_all) YogiFn_MPI_File_write_all;
+typedef decltype(&::MPI_File_write_all_begin) YogiFn_MPI_File_write_all_begin;
+typedef decltype(&::MPI_File_write_all_end) YogiFn_MPI_File_write_all_end;
+typedef decltype(&::MPI_File_write_at) YogiFn_MPI_File_write_at;
+typedef decltype(&::MPI_File_write_at_all) YogiFn_MPI_File_write_at_all;
+typedef decltype(&::MPI_File_write_at_all_begin) YogiFn_MPI_File_write_at_all_begin;
+typedef decltype(&::MPI_File_write_at_all_end) YogiFn_MPI_File_write_at_all_end;
+typedef decltype(&::MPI_File_write_ordered) YogiFn_MPI_File_write_ordered;
+typedef decltype(&::MPI_File_write_ordered_begin) YogiFn_MPI_File_write_ordered_begin;
+typedef decltype(&::MPI_File_write_ordered_end) YogiFn_MPI_File_write_ordered_end;
+typedef decltype(&::MPI_File_write_shared) YogiFn_MPI_File_write_shared;
+typedef decltype(&::MPI_Finalized) YogiFn_MPI_Finalized;
+typedef decltype(&::MPI_Free_mem) YogiFn_MPI_Free_mem;
+typedef decltype(&::MPI_Gather) YogiFn_MPI_Gather;
+typedef decltype(&::MPI_Gatherv) YogiFn_MPI_Gatherv;
+typedef decltype(&::MPI_Get) YogiFn_MPI_Get;
+typedef decltype(&::MPI_Get_accumulate) YogiFn_MPI_Get_accumulate;
+typedef decltype(&::MPI_Get_address) YogiFn_MPI_Get_address;
+typedef decltype(&::MPI_Get_count) YogiFn_MPI_Get_count;
+typedef decltype(&::MPI_Get_elements) YogiFn_MPI_Get_elements;
+typedef decltype(&::MPI_Get_elements_x) YogiFn_MPI_Get_elements_x;
+typedef decltype(&::MPI_Get_library_version) YogiFn_MPI_Get_library_version;
+typedef decltype(&::MPI_Get_version) YogiFn_MPI_Get_version;
+typedef decltype(&::MPI_Graph_create) YogiFn_MPI_Graph_create;
+typedef decltype(&::MPI_Graph_get) YogiFn_MPI_Graph_get;
+typedef decltype(&::MPI_Graph_map) YogiFn_MPI_Graph_map;
+typedef decltype(&::MPI_Graph_neighbors) YogiFn_MPI_Graph_neighbors;
+typedef decltype(&::MPI_Graph_neighbors_count) YogiFn_MPI_Graph_neighbors_count;
+typedef decltype(&::MPI_Graphdims_get) YogiFn_MPI_Graphdims_get;
+typedef decltype(&::MPI_Grequest_complete) YogiFn_MPI_Grequest_complete;
+typedef decltype(&::MPI_Grequest_start) YogiFn_MPI_Grequest_start;
+typedef decltype(&::MPI_Group_compare) YogiFn_MPI_Group_compare;
+typedef decltype(&::MPI_Group_difference) YogiFn_MPI_Group_difference;
+typedef decltype(&::MPI_Group_excl) YogiFn_MPI_Group_excl;
+typedef decltype(&::MPI_Group_free) YogiFn_MPI_Group_free;
+typedef decltype(&::MPI_Group_incl) YogiFn_MPI_Group_incl;
+typedef decltype(&::MPI_Group_intersection) YogiFn_MPI_Group_intersection;
+typedef decltype(&::MPI_Group_range_excl) YogiFn_MPI_Group_range_excl;
+typedef decltype(&::MPI_Group_range_incl) YogiFn_MPI_Group_range_incl;
+typedef decltype(&::MPI_Group_rank) YogiFn_MPI_Group_rank;
+typedef decltype(&::MPI_Group_size) YogiFn_MPI_Group_size;
+typedef decltype(&::MPI_Group_translate_ranks) YogiFn_MPI_Group_translate_ranks;
+typedef decltype(&::MPI_Group_union) YogiFn_MPI_Group_union;
+typedef decltype(&::MPI_Iallgather) YogiFn_MPI_Iallgather;
+typedef decltype(&::MPI_Iallgatherv) YogiFn_MPI_Iallgatherv;
+typedef decltype(&::MPI_Iallreduce) YogiFn_MPI_Iallreduce;
+typedef decltype(&::MPI_Ialltoall) YogiFn_MPI_Ialltoall;
+typedef decltype(&::MPI_Ialltoallv) YogiFn_MPI_Ialltoallv;
+typedef decltype(&::MPI_Ialltoallw) YogiFn_MPI_Ialltoallw;
+typedef decltype(&::MPI_Ibarrier) YogiFn_MPI_Ibarrier;
+typedef decltype(&::MPI_Ibcast) YogiFn_MPI_Ibcast;
+typedef decltype(&::MPI_Ibsend) YogiFn_MPI_Ibsend;
+typedef decltype(&::MPI_Iexscan) YogiFn_MPI_Iexscan;
+typedef decltype(&::MPI_Igather) YogiFn_MPI_Igather;
+typedef decltype(&::MPI_Igatherv) YogiFn_MPI_Igatherv;
+typedef decltype(&::MPI_Improbe) YogiFn_MPI_Improbe;
+typedef decltype(&::MPI_Imrecv) YogiFn_MPI_Imrecv;
+typedef decltype(&::MPI_Ineighbor_allgather) YogiFn_MPI_Ineighbor_allgather;
+typedef decltype(&::MPI_Ineighbor_allgatherv) YogiFn_MPI_Ineighbor_allgatherv;
+typedef decltype(&::MPI_Ineighbor_alltoall) YogiFn_MPI_Ineighbor_alltoall;
+typedef decltype(&::MPI_Ineighbor_alltoallv) YogiFn_MPI_Ineighbor_alltoallv;
+typedef decltype(&::MPI_Ineighbor_alltoallw) YogiFn_MPI_Ineighbor_alltoallw;
+typedef decltype(&::MPI_Info_create) YogiFn_MPI_Info_create;
+typedef decltype(&::MPI_Info_delete) YogiFn_MPI_Info_delete;
+typedef decltype(&::MPI_Info_dup) YogiFn_MPI_Info_dup;
+typedef decltype(&::MPI_Info_free) YogiFn_MPI_Info_free;
+typedef decltype(&::MPI_Info_get) YogiFn_MPI_Info_get;
+typedef decltype(&::MPI_Info_get_nkeys) YogiFn_MPI_Info_get_nkeys;
+typedef decltype(&::MPI_Info_get_nthkey) YogiFn_MPI_Info_get_nthkey;
+typedef decltype(&::MPI_Info_get_valuelen) YogiFn_MPI_Info_get_valuelen;
+typedef decltype(&::MPI_Info_set) YogiFn_MPI_Info_set;
+typedef decltype(&::MPI_Initialized) YogiFn_MPI_Initialized;
+typedef decltype(&::MPI_Intercomm_create) YogiFn_MPI_Intercomm_create;
+typedef decltype(&::MPI_Intercomm_merge) YogiFn_MPI_Intercomm_merge;
+typedef decltype(&::MPI_Iprobe) YogiFn_MPI_Iprobe;
+typedef decltype(&::MPI_Irecv) YogiFn_MPI_Irecv;
+typedef decltype(&::MPI_Ireduce) YogiFn_MPI_Ireduce;
+typedef decltype(&::MPI_Ireduce_scatter) YogiFn_MPI_Ireduce_scatter;
+typedef decltype(&::MPI_Ireduce_scatter_block) YogiFn_MPI_Ireduce_scatter_block;
+typedef decltype(&::MPI_Irsend) YogiFn_MPI_Irsend;
+typedef decltype(&::MPI_Is_thread_main) YogiFn_MPI_Is_thread_main;
+typedef decltype(&::MPI_Iscan) YogiFn_MPI_Iscan;
+typedef decltype(&::MPI_Iscatter) YogiFn_MPI_Iscatter;
+typedef decltype(&::MPI_Iscatterv) YogiFn_MPI_Iscatterv;
+typedef decltype(&::MPI_Isend) YogiFn_MPI_Isend;
+typedef decltype(&::MPI_Issend) YogiFn_MPI_Issend;
+typedef decltype(&::MPI_Keyval_create) YogiFn_MPI_Keyval_create;
+typedef decltype(&::MPI_Keyval_free) YogiFn_MPI_Keyval_free;
+typedef decltype(&::MPI_Lookup_name) YogiFn_MPI_Lookup_name;
+typedef decltype(&::MPI_Mprobe) YogiFn_MPI_Mprobe;
+typedef decltype(&::MPI_Mrecv) YogiFn_MPI_Mrecv;
+typedef decltype(&::MPI_Neighbor_allgather) YogiFn_MPI_Neighbor_allgather;
+typedef decltype(&::MPI_Neighbor_allgatherv) YogiFn_MPI_Neighbor_allgatherv;
+typedef decltype(&::MPI_Neighbor_alltoall) YogiFn_MPI_Neighbor_alltoall;
+typedef decltype(&::MPI_Neighbor_alltoallv) YogiFn_MPI_Neighbor_alltoallv;
+typedef decltype(&::MPI_Neighbor_alltoallw) YogiFn_MPI_Neighbor_alltoallw;
+typedef decltype(&::MPI_Op_commutative) YogiFn_MPI_Op_commutative;
+typedef decltype(&::MPI_Op_create) YogiFn_MPI_Op_create;
+typedef decltype(&::MPI_Op_free) YogiFn_MPI_Op_free;
+typedef decltype(&::MPI_Open_port) YogiFn_MPI_Open_port;
+typedef decltype(&::MPI_Pack) YogiFn_MPI_Pack;
+typedef decltype(&::MPI_Pack_external) YogiFn_MPI_Pack_external;
+typedef decltype(&::MPI_Pack_external_size) YogiFn_MPI_Pack_external_size;
+typedef decltype(&::MPI_Pack_size) YogiFn_MPI_Pack_size;
+typedef decltype(&::MPI_Pcontrol) YogiFn_MPI_Pcontrol;
+typedef decltype(&::MPI_Probe) YogiFn_MPI_Probe;
+typedef decltype(&::MPI_Publish_name) YogiFn_MPI_Publish_name;
+typedef decltype(&::MPI_Put) YogiFn_MPI_Put;
+typedef decltype(&::MPI_Query_thread) YogiFn_MPI_Query_thread;
+typedef decltype(&::MPI_Raccumulate) YogiFn_MPI_Raccumulate;
+typedef decltype(&::MPI_Recv) YogiFn_MPI_Recv;
+typedef decltype(&::MPI_Recv_init) YogiFn_MPI_Recv_init;
+typedef decltype(&::MPI_Reduce) YogiFn_MPI_Reduce;
+typedef decltype(&::MPI_Reduce_local) YogiFn_MPI_Reduce_local;
+typedef decltype(&::MPI_Reduce_scatter) YogiFn_MPI_Reduce_scatter;
+typedef decltype(&::MPI_Reduce_scatter_block) YogiFn_MPI_Reduce_scatter_block;
+typedef decltype(&::MPI_Register_datarep) YogiFn_MPI_Register_datarep;
+typedef decltype(&::MPI_Request_free) YogiFn_MPI_Request_free;
+typedef decltype(&::MPI_Request_get_status) YogiFn_MPI_Request_get_status;
+typedef decltype(&::MPI_Rget) YogiFn_MPI_Rget;
+typedef decltype(&::MPI_Rget_accumulate) YogiFn_MPI_Rget_accumulate;
+typedef decltype(&::MPI_Rput) YogiFn_MPI_Rput;
+typedef decltype(&::MPI_Rsend) YogiFn_MPI_Rsend;
+typedef decltype(&::MPI_Rsend_init) YogiFn_MPI_Rsend_init;
+typedef decltype(&::MPI_Scan) YogiFn_MPI_Scan;
+typedef decltype(&::MPI_Scatter) YogiFn_MPI_Scatter;
+typedef decltype(&::MPI_Scatterv) YogiFn_MPI_Scatterv;
+typedef decltype(&::MPI_Send) YogiFn_MPI_Send;
+typedef decltype(&::MPI_Send_init) YogiFn_MPI_Send_init;
+typedef decltype(&::MPI_Sendrecv) YogiFn_MPI_Sendrecv;
+typedef decltype(&::MPI_Sendrecv_replace) YogiFn_MPI_Sendrecv_replace;
+typedef decltype(&::MPI_Ssend) YogiFn_MPI_Ssend;
+typedef decltype(&::MPI_Ssend_init) YogiFn_MPI_Ssend_init;
+typedef decltype(&::MPI_Start) YogiFn_MPI_Start;
+typedef decltype(&::MPI_Startall) YogiFn_MPI_Startall;
+typedef decltype(&::MPI_Status_set_cancelled) YogiFn_MPI_Status_set_cancelled;
+typedef decltype(&::MPI_Status_set_elements) YogiFn_MPI_Status_set_elements;
+typedef decltype(&::MPI_Status_set_elements_x) YogiFn_MPI_Status_set_elements_x;
+typedef decltype(&::MPI_Test) YogiFn_MPI_Test;
+typedef decltype(&::MPI_Test_cancelled) YogiFn_MPI_Test_cancelled;
+typedef decltype(&::MPI_Testall) YogiFn_MPI_Testall;
+typedef decltype(&::MPI_Testany) YogiFn_MPI_Testany;
+typedef decltype(&::MPI_Testsome) YogiFn_MPI_Testsome;
+typedef decltype(&::MPI_Topo_test) YogiFn_MPI_Topo_test;
+typedef decltype(&::MPI_Type_commit) YogiFn_MPI_Type_commit;
+typedef decltype(&::MPI_Type_contiguous) YogiFn_MPI_Type_contiguous;
+typedef decltype(&::MPI_Type_create_hindexed) YogiFn_MPI_Type_create_hindexed;
+typedef decltype(&::MPI_Type_create_hindexed_block) YogiFn_MPI_Type_create_hindexed_block;
+typedef decltype(&::MPI_Type_create_hvector) YogiFn_MPI_Type_create_hvector;
+typedef decltype(&::MPI_Type_create_indexed_block) YogiFn_MPI_Type_create_indexed_block;
+typedef decltype(&::MPI_Type_create_keyval) YogiFn_MPI_Type_create_keyval;
+typedef decltype(&::MPI_Type_create_resized) YogiFn_MPI_Type_create_resized;
+typedef decltype(&::MPI_Type_create_struct) YogiFn_MPI_Type_create_struct;
+typedef decltype(&::MPI_Type_create_subarray) YogiFn_MPI_Type_create_subarray;
+typedef decltype(&::MPI_Type_delete_attr) YogiFn_MPI_Type_delete_attr;
+typedef decltype(&::MPI_Type_dup) YogiFn_MPI_Type_dup;
+typedef decltype(&::MPI_Type_extent) YogiFn_MPI_Type_extent;
+typedef decltype(&::MPI_Type_free) YogiFn_MPI_Type_free;
+typedef decltype(&::MPI_Type_free_keyval) YogiFn_MPI_Type_free_keyval;
+typedef decltype(&::MPI_Type_get_attr) YogiFn_MPI_Type_get_attr;
+typedef decltype(&::MPI_Type_get_envelope) YogiFn_MPI_Type_get_envelope;
+typedef decltype(&::MPI_Type_get_extent) YogiFn_MPI_Type_get_extent;
+typedef decltype(&::MPI_Type_get_extent_x) YogiFn_MPI_Type_get_extent_x;
+typedef decltype(&::MPI_Type_get_name) YogiFn_MPI_Type_get_name;
+typedef decltype(&::MPI_Type_get_true_extent) YogiFn_MPI_Type_get_true_extent;
+typedef decltype(&::MPI_Type_get_true_extent_x) YogiFn_MPI_Type_get_true_extent_x;
+typedef decltype(&::MPI_Type_hindexed) YogiFn_MPI_Type_hindexed;
+typedef decltype(&::MPI_Type_hvector) YogiFn_MPI_Type_hvector;
+typedef decltype(&::MPI_Type_indexed) YogiFn_MPI_Type_indexed;
+typedef decltype(&::MPI_Type_lb) YogiFn_MPI_Type_lb;
+typedef decltype(&::MPI_Type_match_size) YogiFn_MPI_Type_match_size;
+typedef decltype(&::MPI_Type_set_attr) YogiFn_MPI_Type_set_attr;
+typedef decltype(&::MPI_Type_set_name) YogiFn_MPI_Type_set_name;
+typedef decltype(&::MPI_Type_size) YogiFn_MPI_Type_size;
+typedef decltype(&::MPI_Type_size_x) YogiFn_MPI_Type_size_x;
+typedef decltype(&::MPI_Type_struct) YogiFn_MPI_Type_struct;
+typedef decltype(&::MPI_Type_ub) YogiFn_MPI_Type_ub;
+typedef decltype(&::MPI_Type_vector) YogiFn_MPI_Type_vector;
+typedef decltype(&::MPI_Unpack) YogiFn_MPI_Unpack;
+typedef decltype(&::MPI_Unpack_external) YogiFn_MPI_Unpack_external;
+typedef decltype(&::MPI_Unpublish_name) YogiFn_MPI_Unpublish_name;
+typedef decltype(&::MPI_Wait) YogiFn_MPI_Wait;
+typedef decltype(&::MPI_Waitall) YogiFn_MPI_Waitall;
+typedef decltype(&::MPI_Waitany) YogiFn_MPI_Waitany;
+typedef decltype(&::MPI_Waitsome) YogiFn_MPI_Waitsome;
+typedef decltype(&::MPI_Win_allocate) YogiFn_MPI_Win_allocate;
+typedef decltype(&::MPI_Win_allocate_shared) YogiFn_MPI_Win_allocate_shared;
+typedef decltype(&::MPI_Win_attach) YogiFn_MPI_Win_attach;
+typedef decltype(&::MPI_Win_call_errhandler) YogiFn_MPI_Win_call_errhandler;
+typedef decltype(&::MPI_Win_complete) YogiFn_MPI_Win_complete;
+typedef decltype(&::MPI_Win_create) YogiFn_MPI_Win_create;
+typedef decltype(&::MPI_Win_create_dynamic) YogiFn_MPI_Win_create_dynamic;
+typedef decltype(&::MPI_Win_create_errhandler) YogiFn_MPI_Win_create_errhandler;
+typedef decltype(&::MPI_Win_create_keyval) YogiFn_MPI_Win_create_keyval;
+typedef decltype(&::MPI_Win_delete_attr) YogiFn_MPI_Win_delete_attr;
+typedef decltype(&::MPI_Win_detach) YogiFn_MPI_Win_detach;
+typedef decltype(&::MPI_Win_fence) YogiFn_MPI_Win_fence;
+typedef decltype(&::MPI_Win_flush) YogiFn_MPI_Win_flush;
+typedef decltype(&::MPI_Win_flush_all) YogiFn_MPI_Win_flush_all;
+typedef decltype(&::MPI_Win_flush_local) YogiFn_MPI_Win_flush_local;
+typedef decltype(&::MPI_Win_flush_local_all) YogiFn_MPI_Win_flush_local_all;
+typedef decltype(&::MPI_Win_free) YogiFn_MPI_Win_free;
+typedef decltype(&::MPI_Win_free_keyval) YogiFn_MPI_Win_free_keyval;
+typedef decltype(&::MPI_Win_get_attr) YogiFn_MPI_Win_get_attr;
+typedef decltype(&::MPI_Win_get_errhandler) YogiFn_MPI_Win_get_errhandler;
+typedef decltype(&::MPI_Win_get_group) YogiFn_MPI_Win_get_group;
+typedef decltype(&::MPI_Win_get_info) YogiFn_MPI_Win_get_info;
+typedef decltype(&::MPI_Win_get_name) YogiFn_MPI_Win_get_name;
+typedef decltype(&::MPI_Win_lock) YogiFn_MPI_Win_lock;
+typedef decltype(&::MPI_Win_lock_all) YogiFn_MPI_Win_lock_all;
+typedef decltype(&::MPI_Win_post) YogiFn_MPI_Win_post;
+typedef decltype(&::MPI_Win_set_attr) YogiFn_MPI_Win_set_attr;
+typedef decltype(&::MPI_Win_set_errhandler) YogiFn_MPI_Win_set_errhandler;
+typedef decltype(&::MPI_Win_set_info) YogiFn_MPI_Win_set_info;
+typedef decltype(&::MPI_Win_set_name) YogiFn_MPI_Win_set_name;
+typedef decltype(&::MPI_Win_shared_query) YogiFn_MPI_Win_shared_query;
+typedef decltype(&::MPI_Win_start) YogiFn_MPI_Win_start;
+typedef decltype(&::MPI_Win_sync) YogiFn_MPI_Win_sync;
+typedef decltype(&::MPI_Win_test) YogiFn_MPI_Win_test;
+typedef decltype(&::MPI_Win_unlock) YogiFn_MPI_Win_unlock;
+typedef decltype(&::MPI_Win_unlock_all) YogiFn_MPI_Win_unlock_all;
+typedef decltype(&::MPI_Win_wait) YogiFn_MPI_Win_wait;
+
+enum YogiSymbolId {
+    YOGI_SYM_MPI_Init,
+    YOGI_SYM_MPI_Init_thread,
+    YOGI_SYM_MPI_Finalize,
+    YOGI_SYM_MPI_Error_class,
+    YOGI_SYM_MPI_Error_string,
+    YOGI_SYM_MPI_Get_processor_name,
+    YOGI_SYM_MPI_Type_get_contents,
+    YOGI_SYM_MPI_Type_create_darray,
+    YOGI_SYM_MPI_Wtick,
+    YOGI_SYM_MPI_Wtime,
+    YOGI_SYM_MPI_Comm_f2c,
+    YOGI_SYM_MPI_Group_f2c,
+    YOGI_SYM_MPI_Comm_spawn,
+    YOGI_SYM_MPI_Abort,
+    YOGI_SYM_MPI_Accumulate,
+    YOGI_SYM_MPI_Add_error_class,
+    YOGI_SYM_MPI_Add_error_code,
+    YOGI_SYM_MPI_Add_error_string,
+    YOGI_SYM_MPI_Address,
+    YOGI_SYM_MPI_Allgather,
+    YOGI_SYM_MPI_Allgatherv,
+    YOGI_SYM_MPI_Alloc_mem,
+    YOGI_SYM_MPI_Allreduce,
+    YOGI_SYM_MPI_Alltoall,
+    YOGI_SYM_MPI_Alltoallv,
+    YOGI_SYM_MPI_Alltoallw,
+    YOGI_SYM_MPI_Attr_delete,
+    YOGI_SYM_MPI_Attr_get,
+    YOGI_SYM_MPI_Attr_put,
+    YOGI_SYM_MPI_Barrier,
+    YOGI_SYM_MPI_Bcast,
+    YOGI_SYM_MPI_Bsend,
+    YOGI_SYM_MPI_Bsend_init,
+    YOGI_SYM_MPI_Buffer_attach,
+    YOGI_SYM_MPI_Buffer_detach,
+    YOGI_SYM_MPI_Cancel,
+    YOGI_SYM_MPI_Cart_coords,
+    YOGI_SYM_MPI_Cart_create,
+    YOGI_SYM_MPI_Cart_get,
+    YOGI_SYM_MPI_Cart_map,
+    YOGI_SYM_MPI_Cart_rank,
+    YOGI_SYM_MPI_Cart_shift,
+    YOGI_SYM_MPI_Cart_sub,
+    YOGI_SYM_MPI_Cartdim_get,
+    YOGI_SYM_MPI_Close_port,
+    YOGI_SYM_MPI_Comm_accept,
+    YOGI_SYM_MPI_Comm_call_errhandler,
+    YOGI_SYM_MPI_Comm_compare,
+    YOGI_SYM_MPI_Comm_connect,
+    YOGI_SYM_MPI_Comm_create,
+    YOGI_SYM_MPI_Comm_create_errhandler,
+    YOGI_SYM_MPI_Comm_create_group,
+    YOGI_SYM_MPI_Comm_create_keyval,
+    YOGI_SYM_MPI_Comm_delete_attr,
+    YOGI_SYM_MPI_Comm_disconnect,
+    YOGI_SYM_MPI_Comm_dup,
+    YOGI_SYM_MPI_Comm_dup_with_info,
+    YOGI_SYM_MPI_Comm_free,
+    YOGI_SYM_MPI_Comm_free_keyval,
+    YOGI_SYM_MPI_Comm_get_attr,
+    YOGI_SYM_MPI_Comm_get_errhandler,
+    YOGI_SYM_MPI_Comm_get_info,
+    YOGI_SYM_MPI_Comm_get_name,
+    YOGI_SYM_MPI_Comm_get_parent,
+    YOGI_SYM_MPI_Comm_group,
+    YOGI_SYM_MPI_Comm_idup,
+    YOGI_SYM_MPI_Comm_join,
+    YOGI_SYM_MPI_Comm_rank,
+    YOGI_SYM_MPI_Comm_remote_group,
+    YOGI_SYM_MPI_Comm_remote_size,
+    YOGI_SYM_MPI_Comm_set_attr,
+    YOGI_SYM_MPI_Comm_set_errhandler,
+    YOGI_SYM_MPI_Comm_set_info,
+    YOGI_SYM_MPI_Comm_set_name,
+    YOGI_SYM_MPI_Comm_size,
+    YOGI_SYM_MPI_Comm_split,
+    YOGI_SYM_MPI_Comm_split_type,
+    YOGI_SYM_MPI_Comm_test_inter,
+    YOGI_SYM_MPI_Compare_and_swap,
+    YOGI_SYM_MPI_Dims_create,
+    YOGI_SYM_MPI_Dist_graph_create,
+    YOGI_SYM_MPI_Dist_graph_create_adjacent,
+    YOGI_SYM_MPI_Dist_graph_neighbors,
+    YOGI_SYM_MPI_Dist_graph_neighbors_count,
+    YOGI_SYM_MPI_Errhandler_create,
+    YOGI_SYM_MPI_Errhandler_free,
+    YOGI_SYM_MPI_Errhandler_get,
+    YOGI_SYM_MPI_Errhandler_set,
+    YOGI_SYM_MPI_Exscan,
+    YOGI_SYM_MPI_Fetch_and_op,
+    YOGI_SYM_MPI_File_call_errhandler,
+    YOGI_SYM_MPI_File_close,
+    YOGI_SYM_MPI_File_create_errhandler,
+    YOGI_SYM_MPI_File_delete,
+    YOGI_SYM_MPI_File_get_amode,
+    YOGI_SYM_MPI_File_get_atomicity,
+    YOGI_SYM_MPI_File_get_byte_offset,
+    YOGI_SYM_MPI_File_get_errhandler,
+    YOGI_SYM_MPI_File_get_group,
+    YOGI_SYM_MPI_File_get_info,
+    YOGI_SYM_MPI_File_get_position,
+    YOGI_SYM_MPI_File_get_position_shared,
+    YOGI_SYM_MPI_File_get_size,
+    YOGI_SYM_MPI_File_get_type_extent,
+    YOGI_SYM_MPI_File_get_view,
+    YOGI_SYM_MPI_File_iread,
+    YOGI_SYM_MPI_File_iread_at,
+    YOGI_SYM_MPI_File_iread_shared,
+    YOGI_SYM_MPI_File_iwrite,
+    YOGI_SYM_MPI_File_iwrite_at,
+    YOGI_SYM_MPI_File_iwrite_shared,
+    YOGI_SYM_MPI_File_open,
+    YOGI_SYM_MPI_File_preallocate,
+    YOGI_SYM_MPI_File_read,
+    YOGI_SYM_MPI_File_read_all,
+    YOGI_SYM_MPI_File_read_all_begin,
+    YOGI_SYM_MPI_File_read_all_end,
+    YOGI_SYM_MPI_File_read_at,
+    YOGI_SYM_MPI_File_read_at_all,
+    YOGI_SYM_MPI_File_read_at_all_begin,
+    YOGI_SYM_MPI_File_read_at_all_end,
+    YOGI_SYM_MPI_File_read_ordered,
+    YOGI_SYM_MPI_File_read_ordered_begin,
+    YOGI_SYM_MPI_File_read_ordered_end,
+    YOGI_SYM_MPI_File_read_shared,
+    YOGI_SYM_MPI_File_seek,
+    YOGI_SYM_MPI_File_seek_shared,
+    YOGI_SYM_MPI_File_set_atomicity,
+    YOGI_SYM_MPI_File_set_errhandler,
+    YOGI_SYM_MPI_File_set_info,
+    YOGI_SYM_MPI_File_set_size,
+    YOGI_SYM_MPI_File_set_view,
+    YOGI_SYM_MPI_File_sync,
+    YOGI_SYM_MPI_File_write,
+    YOGI_SYM_MPI_File_write_all,
+    YOGI_SYM_MPI_File_write_all_begin,
+    YOGI_SYM_MPI_File_write_all_end,
+    YOGI_SYM_MPI_File_write_at,
+    YOGI_SYM_MPI_File_write_at_all,
+    YOGI_SYM_MPI_File_write_at_all_begin,
+    YOGI_SYM_MPI_File_write_at_all_end,
+    YOGI_SYM_MPI_File_write_ordered,
+    YOGI_SYM_MPI_File_write_ordered_begin,
+    YOGI_SYM_MPI_File_write_ordered_end,
+    YOGI_SYM_MPI_File_write_shared,
+    YOGI_SYM_MPI_Finalized,
+    YOGI_SYM_MPI_Free_mem,
+    YOGI_SYM_MPI_Gather,
+    YOGI_SYM_MPI_Gatherv,
+    YOGI_SYM_MPI_Get,
+    YOGI_SYM_MPI_Get_accumulate,
+    YOGI_SYM_MPI_Get_address,
+    YOGI_SYM_MPI_Get_count,
+    YOGI_SYM_MPI_Get_elements,
+    YOGI_SYM_MPI_Get_elements_x,
+    YOGI_SYM_MPI_Get_library_version,
+    YOGI_SYM_MPI_Get_version,
+    YOGI_SYM_MPI_Graph_create,
+    YOGI_SYM_MPI_Graph_get,
+    YOGI_SYM_MPI_Graph_map,
+    YOGI_SYM_MPI_Graph_neighbors,
+    YOGI_SYM_MPI_Graph_neighbors_count,
+    YOGI_SYM_MPI_Graphdims_get,
+    YOGI_SYM_MPI_Grequest_complete,
+    YOGI_SYM_MPI_Grequest_start,
+    YOGI_SYM_MPI_Group_compare,
+    YOGI_SYM_MPI_Group_difference,
+    YOGI_SYM_MPI_Group_excl,
+    YOGI_SYM_MPI_Group_free,
+    YOGI_SYM_MPI_Group_incl,
+    YOGI_SYM_MPI_Group_intersection,
+    YOGI_SYM_MPI_Group_range_excl,
+    YOGI_SYM_MPI_Group_range_incl,
+    YOGI_SYM_MPI_Group_rank,
+    YOGI_SYM_MPI_Group_size,
+    YOGI_SYM_MPI_Group_translate_ranks,
+    YOGI_SYM_MPI_Group_union,
+    YOGI_SYM_MPI_Iallgather,
+    YOGI_SYM_MPI_Iallgatherv,
+    YOGI_SYM_MPI_Iallreduce,
+    YOGI_SYM_MPI_Ialltoall,
+    YOGI_SYM_MPI_Ialltoallv,
+    YOGI_SYM_MPI_Ialltoallw,
+    YOGI_SYM_MPI_Ibarrier,
+    YOGI_SYM_MPI_Ibcast,
+    YOGI_SYM_MPI_Ibsend,
+    YOGI_SYM_MPI_Iexscan,
+    YOGI_SYM_MPI_Igather,
+    YOGI_SYM_MPI_Igatherv,
+    YOGI_SYM_MPI_Improbe,
+    YOGI_SYM_MPI_Imrecv,
+    YOGI_SYM_MPI_Ineighbor_allgather,
+    YOGI_SYM_MPI_Ineighbor_allgatherv,
+    YOGI_SYM_MPI_Ineighbor_alltoall,
+    YOGI_SYM_MPI_Ineighbor_alltoallv,
+    YOGI_SYM_MPI_Ineighbor_alltoallw,
+    YOGI_SYM_MPI_Info_create,
+    YOGI_SYM_MPI_Info_delete,
+    YOGI_SYM_MPI_Info_dup,
+    YOGI_SYM_MPI_Info_free,
+    YOGI_SYM_MPI_Info_get,
+    YOGI_SYM_MPI_Info_get_nkeys,
+    YOGI_SYM_MPI_Info_get_nthkey,
+    YOGI_SYM_MPI_Info_get_valuelen,
+    YOGI_SYM_MPI_Info_set,
+    YOGI_SYM_MPI_Initialized,
+    YOGI_SYM_MPI_Intercomm_create,
+    YOGI_SYM_MPI_Intercomm_merge,
+    YOGI_SYM_MPI_Iprobe,
+    YOGI_SYM_MPI_Irecv,
+    YOGI_SYM_MPI_Ireduce,
+    YOGI_SYM_MPI_Ireduce_scatter,
+    YOGI_SYM_MPI_Ireduce_scatter_block,
+    YOGI_SYM_MPI_Irsend,
+    YOGI_SYM_MPI_Is_thread_main,
+    YOGI_SYM_MPI_Iscan,
+    YOGI_SYM_MPI_Iscatter,
+    YOGI_SYM_MPI_Iscatterv,
+    YOGI_SYM_MPI_Isend,
+    YOGI_SYM_MPI_Issend,
+    YOGI_SYM_MPI_Keyval_create,
+    YOGI_SYM_MPI_Keyval_free,
+    YOGI_SYM_MPI_Lookup_name,
+    YOGI_SYM_MPI_Mprobe,
+    YOGI_SYM_MPI_Mrecv,
+    YOGI_SYM_MPI_Neighbor_allgather,
+    YOGI_SYM_MPI_Neighbor_allgatherv,
+    YOGI_SYM_MPI_Neighbor_alltoall,
+    YOGI_SYM_MPI_Neighbor_alltoallv,
+    YOGI_SYM_MPI_Neighbor_alltoallw,
+    YOGI_SYM_MPI_Op_commutative,
+    YOGI_SYM_MPI_Op_create,
+    YOGI_SYM_MPI_Op_free,
+    YOGI_SYM_MPI_Open_port,
+    YOGI_SYM_MPI_Pack,
+    YOGI_SYM_MPI_Pack_external,
+    YOGI_SYM_MPI_Pack_external_size,
+    YOGI_SYM_MPI_Pack_size,
+    YOGI_SYM_MPI_Pcontrol,
+    YOGI_SYM_MPI_Probe,
+    YOGI_SYM_MPI_Publish_name,
+    YOGI_SYM_MPI_Put,
+    YOGI_SYM_MPI_Query_thread,
+    YOGI_SYM_MPI_Raccumulate,
+    YOGI_SYM_MPI_Recv,
+    YOGI_SYM_MPI_Recv_init,
+    YOGI_SYM_MPI_Reduce,
+    YOGI_SYM_MPI_Reduce_local,
+    YOGI_SYM_MPI_Reduce_scatter,
+    YOGI_SYM_MPI_Reduce_scatter_block,
+    YOGI_SYM_MPI_Register_datarep,
+    YOGI_SYM_MPI_Request_free,
+    YOGI_SYM_MPI_Request_get_status,
+    YOGI_SYM_MPI_Rget,
+    YOGI_SYM_MPI_Rget_accumulate,
+    YOGI_SYM_MPI_Rput,
+    YOGI_SYM_MPI_Rsend,
+    YOGI_SYM_MPI_Rsend_init,
+    YOGI_SYM_MPI_Scan,
+    YOGI_SYM_MPI_Scatter,
+    YOGI_SYM_MPI_Scatterv,
+    YOGI_SYM_MPI_Send,
+    YOGI_SYM_MPI_Send_init,
+    YOGI_SYM_MPI_Sendrecv,
+    YOGI_SYM_MPI_Sendrecv_replace,
+    YOGI_SYM_MPI_Ssend,
+    YOGI_SYM_MPI_Ssend_init,
+    YOGI_SYM_MPI_Start,
+    YOGI_SYM_MPI_Startall,
+    YOGI_SYM_MPI_Status_set_cancelled,
+    YOGI_SYM_MPI_Status_set_elements,
+    YOGI_SYM_MPI_Status_set_elements_x,
+    YOGI_SYM_MPI_Test,
+    YOGI_SYM_MPI_Test_cancelled,
+    YOGI_SYM_MPI_Testall,
+    YOGI_SYM_MPI_Testany,
+    YOGI_SYM_MPI_Testsome,
+    YOGI_SYM_MPI_Topo_test,
+    YOGI_SYM_MPI_Type_commit,
+    YOGI_SYM_MPI_Type_contiguous,
+    YOGI_SYM_MPI_Type_create_hindexed,
+    YOGI_SYM_MPI_Type_create_hindexed_block,
+    YOGI_SYM_MPI_Type_create_hvector,
+    YOGI_SYM_MPI_Type_create_indexed_block,
+    YOGI_SYM_MPI_Type_create_keyval,
+    YOGI_SYM_MPI_Type_create_resized,
+    YOGI_SYM_MPI_Type_create_struct,
+    YOGI_SYM_MPI_Type_create_subarray,
+    YOGI_SYM_MPI_Type_delete_attr,
+    YOGI_SYM_MPI_Type_dup,
+    YOGI_SYM_MPI_Type_extent,
+    YOGI_SYM_MPI_Type_free,
+    YOGI_SYM_MPI_Type_free_keyval,
+    YOGI_SYM_MPI_Type_get_attr,
+    YOGI_SYM_MPI_Type_get_envelope,
+    YOGI_SYM_MPI_Type_get_extent,
+    YOGI_SYM_MPI_Type_get_extent_x,
+    YOGI_SYM_MPI_Type_get_name,
+    YOGI_SYM_MPI_Type_get_true_extent,
+    YOGI_SYM_MPI_Type_get_true_extent_x,
+    YOGI_SYM_MPI_Type_hindexed,
+    YOGI_SYM_MPI_Type_hvector,
+    YOGI_SYM_MPI_Type_indexed,
+    YOGI_SYM_MPI_Type_lb,
+    YOGI_SYM_MPI_Type_match_size,
+    YOGI_SYM_MPI_Type_set_attr,
+    YOGI_SYM_MPI_Type_set_name,
+    YOGI_SYM_MPI_Type_size,
+    YOGI_SYM_MPI_Type_size_x,
+    YOGI_SYM_MPI_Type_struct,
+    YOGI_SYM_MPI_Type_ub,
+    YOGI_SYM_MPI_Type_vector,
+    YOGI_SYM_MPI_Unpack,
+    YOGI_SYM_MPI_Unpack_external,
+    YOGI_SYM_MPI_Unpublish_name,
+    YOGI_SYM_MPI_Wait,
+    YOGI_SYM_MPI_Waitall,
+    YOGI_SYM_MPI_Waitany,
+    YOGI_SYM_MPI_Waitsome,
+    YOGI_SYM_MPI_Win_allocate,
+    YOGI_SYM_MPI_Win_allocate_shared,
+    YOGI_SYM_MPI_Win_attach,
+    YOGI_SYM_MPI_Win_call_errhandler,
+    YOGI_SYM_MPI_Win_complete,
+    YOGI_SYM_MPI_Win_create,
+    YOGI_SYM_MPI_Win_create_dynamic,
+    YOGI_SYM_MPI_Win_create_errhandler,
+    YOGI_SYM_MPI_Win_create_keyval,
+    YOGI_SYM_MPI_Win_delete_attr,
+    YOGI_SYM_MPI_Win_detach,
+    YOGI_SYM_MPI_Win_fence,
+    YOGI_SYM_MPI_Win_flush,
+    YOGI_SYM_MPI_Win_flush_all,
+    YOGI_SYM_MPI_Win_flush_local,
+    YOGI_SYM_MPI_Win_flush_local_all,
+    YOGI_SYM_MPI_Win_free,
+    YOGI_SYM_MPI_Win_free_keyval,
+    YOGI_SYM_MPI_Win_get_attr,
+    YOGI_SYM_MPI_Win_get_errhandler,
+    YOGI_SYM_MPI_Win_get_group,
+    YOGI_SYM_MPI_Win_get_info,
+    YOGI_SYM_MPI_Win_get_name,
+    YOGI_SYM_MPI_Win_lock,
+    YOGI_SYM_MPI_Win_lock_all,
+    YOGI_SYM_MPI_Win_post,
+    YOGI_SYM_MPI_Win_set_attr,
+    YOGI_SYM_MPI_Win_set_errhandler,
+    YOGI_SYM_MPI_Win_set_info,
+    YOGI_SYM_MPI_Win_set_name,
+    YOGI_SYM_MPI_Win_shared_query,
+    YOGI_SYM_MPI_Win_start,
+    YOGI_SYM_MPI_Win_sync,
+    YOGI_SYM_MPI_Win_test,
+    YOGI_SYM_MPI_Win_unlock,
+    YOGI_SYM_MPI_Win_unlock_all,
+    YOGI_SYM_MPI_Win_wait,
+    YOGI_NUM_SYMBOLS
+};
+
+
+extern std::atomic<void *> yogiSymbols[YOGI_NUM_SYMBOLS];
+
+/* Looks up symbol id by name, stores it in the table, and returns it. */
+void * yogiResolveSymbol(int id, const char *name);
+
+inline void * yogiSymbol(int id, const char *name) {
+    void *fn = yogiSymbols[id].load(std::memory_order_acquire);
+    if (fn != NULL) return fn;
+    return yogiResolveSymbol(id, name);
+}
+
+#define MPI_Init ((YogiFn_MPI_Init) yogiSymbol(YOGI_SYM_MPI_Init, "MPI_Init"))
+#define MPI_Init_thread ((YogiFn_MPI_Init_thread) yogiSymbol(YOGI_SYM_MPI_Init_thread, "MPI_Init_thread"))
+#define MPI_Finalize ((YogiFn_MPI_Finalize) yogiSymbol(YOGI_SYM_MPI_Finalize, "MPI_Finalize"))
+#define MPI_Error_class ((YogiFn_MPI_Error_class) yogiSymbol(YOGI_SYM_MPI_Error_class, "MPI_Error_class"))
+#define MPI_Error_string ((YogiFn_MPI_Error_string) yogiSymbol(YOGI_SYM_MPI_Error_string, "MPI_Error_string"))
+#define MPI_Get_processor_name ((YogiFn_MPI_Get_processor_name) yogiSymbol(YOGI_SYM_MPI_Get_processor_name, "MPI_Get_processor_name"))
+#define MPI_Type_get_contents ((YogiFn_MPI_Type_get_contents) yogiSymbol(YOGI_SYM_MPI_Type_get_contents, "MPI_Type_get_contents"))
+#define MPI_Type_create_darray ((YogiFn_MPI_Type_create_darray) yogiSymbol(YOGI_SYM_MPI_Type_create_darray, "MPI_Type_create_darray"))
+#define MPI_Wtick ((YogiFn_MPI_Wtick) yogiSymbol(YOGI_SYM_MPI_Wtick, "MPI_Wtick"))
+#define MPI_Wtime ((YogiFn_MPI_Wtime) yogiSymbol(YOGI_SYM_MPI_Wtime, "MPI_Wtime"))
+#define MPI_Comm_f2c ((YogiFn_MPI_Comm_f2c) yogiSymbol(YOGI_SYM_MPI_Comm_f2c, "MPI_Comm_f2c"))
+#define MPI_Group_f2c ((YogiFn_MPI_Group_f2c) yogiSymbol(YOGI_SYM_MPI_Group_f2c, "MPI_Group_f2c"))
+#define MPI_Comm_spawn ((YogiFn_MPI_Comm_spawn) yogiSymbol(YOGI_SYM_MPI_Comm_spawn, "MPI_Comm_spawn"))
+#define MPI_Abort ((YogiFn_MPI_Abort) yogiSymbol(YOGI_SYM_MPI_Abort, "MPI_Abort"))
+#define MPI_Accumulate ((YogiFn_MPI_Accumulate) yogiSymbol(YOGI_SYM_MPI_Accumulate, "MPI_Accumulate"))
+#define MPI_Add_error_class ((YogiFn_MPI_Add_error_class) yogiSymbol(YOGI_SYM_MPI_Add_error_class, "MPI_Add_error_class"))
+#define MPI_Add_error_code ((YogiFn_MPI_Add_error_code) yogiSymbol(YOGI_SYM_MPI_Add_error_code, "MPI_Add_error_code"))
+#define MPI_Add_error_string ((YogiFn_MPI_Add_error_string) yogiSymbol(YOGI_SYM_MPI_Add_error_string, "MPI_Add_error_string"))
+#define MPI_Address ((YogiFn_MPI_Address) yogiSymbol(YOGI_SYM_MPI_Address, "MPI_Address"))
+#define MPI_Allgather ((YogiFn_MPI_Allgather) yogiSymbol(YOGI_SYM_MPI_Allgather, "MPI_Allgather"))
+#define MPI_Allgatherv ((YogiFn_MPI_Allgatherv) yogiSymbol(YOGI_SYM_MPI_Allgatherv, "MPI_Allgatherv"))
+#define MPI_Alloc_mem ((YogiFn_MPI_Alloc_mem) yogiSymbol(YOGI_SYM_MPI_Alloc_mem, "MPI_Alloc_mem"))
+#define MPI_Allreduce ((YogiFn_MPI_Allreduce) yogiSymbol(YOGI_SYM_MPI_Allreduce, "MPI_Allreduce"))
+#define MPI_Alltoall ((YogiFn_MPI_Alltoall) yogiSymbol(YOGI_SYM_MPI_Alltoall, "MPI_Alltoall"))
+#define MPI_Alltoallv ((YogiFn_MPI_Alltoallv) yogiSymbol(YOGI_SYM_MPI_Alltoallv, "MPI_Alltoallv"))
+#define MPI_Alltoallw ((YogiFn_MPI_Alltoallw) yogiSymbol(YOGI_SYM_MPI_Alltoallw, "MPI_Alltoallw"))
+#define MPI_Attr_delete ((YogiFn_MPI_Attr_delete) yogiSymbol(YOGI_SYM_MPI_Attr_delete, "MPI_Attr_delete"))
+#define MPI_Attr_get ((YogiFn_MPI_Attr_get) yogiSymbol(YOGI_SYM_MPI_Attr_get, "MPI_Attr_get"))
+#define MPI_Attr_put ((YogiFn_MPI_Attr_put) yogiSymbol(YOGI_SYM_MPI_Attr_put, "MPI_Attr_put"))
+#define MPI_Barrier ((YogiFn_MPI_Barrier) yogiSymbol(YOGI_SYM_MPI_Barrier, "MPI_Barrier"))
+#define MPI_Bcast ((YogiFn_MPI_Bcast) yogiSymbol(YOGI_SYM_MPI_Bcast, "MPI_Bcast"))
+#define MPI_Bsend ((YogiFn_MPI_Bsend) yogiSymbol(YOGI_SYM_MPI_Bsend, "MPI_Bsend"))
+#define MPI_Bsend_init ((YogiFn_MPI_Bsend_init) yogiSymbol(YOGI_SYM_MPI_Bsend_init, "MPI_Bsend_init"))
+#define MPI_Buffer_attach ((YogiFn_MPI_Buffer_attach) yogiSymbol(YOGI_SYM_MPI_Buffer_attach, "MPI_Buffer_attach"))
+#define MPI_Buffer_detach ((YogiFn_MPI_Buffer_detach) yogiSymbol(YOGI_SYM_MPI_Buffer_detach, "MPI_Buffer_detach"))
+#define MPI_Cancel ((YogiFn_MPI_Cancel) yogiSymbol(YOGI_SYM_MPI_Cancel, "MPI_Cancel"))
+#define MPI_Cart_coords ((YogiFn_MPI_Cart_coords) yogiSymbol(YOGI_SYM_MPI_Cart_coords, "MPI_Cart_coords"))
+#define MPI_Cart_create ((YogiFn_MPI_Cart_create) yogiSymbol(YOGI_SYM_MPI_Cart_create, "MPI_Cart_create"))
+#define MPI_Cart_get ((YogiFn_MPI_Cart_get) yogiSymbol(YOGI_SYM_MPI_Cart_get, "MPI_Cart_get"))
+#define MPI_Cart_map ((YogiFn_MPI_Cart_map) yogiSymbol(YOGI_SYM_MPI_Cart_map, "MPI_Cart_map"))
+#define MPI_Cart_rank ((YogiFn_MPI_Cart_rank) yogiSymbol(YOGI_SYM_MPI_Cart_rank, "MPI_Cart_rank"))
+#define MPI_Cart_shift ((YogiFn_MPI_Cart_shift) yogiSymbol(YOGI_SYM_MPI_Cart_shift, "MPI_Cart_shift"))
+#define MPI_Cart_sub ((YogiFn_MPI_Cart_sub) yogiSymbol(YOGI_SYM_MPI_Cart_sub, "MPI_Cart_sub"))
+#define MPI_Cartdim_get ((YogiFn_MPI_Cartdim_get) yogiSymbol(YOGI_SYM_MPI_Cartdim_get, "MPI_Cartdim_get"))
+#define MPI_Close_port ((YogiFn_MPI_Close_port) yogiSymbol(YOGI_SYM_MPI_Close_port, "MPI_Close_port"))
+#define MPI_Comm_accept ((YogiFn_MPI_Comm_accept) yogiSymbol(YOGI_SYM_MPI_Comm_accept, "MPI_Comm_accept"))
+#define MPI_Comm_call_errhandler ((YogiFn_MPI_Comm_call_errhandler) yogiSymbol(YOGI_SYM_MPI_Comm_call_errhandler, "MPI_Comm_call_errhandler"))
+#define MPI_Comm_compare ((YogiFn_MPI_Comm_compare) yogiSymbol(YOGI_SYM_MPI_Comm_compare, "MPI_Comm_compare"))
+#define MPI_Comm_connect ((YogiFn_MPI_Comm_connect) yogiSymbol(YOGI_SYM_MPI_Comm_connect, "MPI_Comm_connect"))
+#define MPI_Comm_create ((YogiFn_MPI_Comm_create) yogiSymbol(YOGI_SYM_MPI_Comm_create, "MPI_Comm_create"))
+#define MPI_Comm_create_errhandler ((YogiFn_MPI_Comm_create_errhandler) yogiSymbol(YOGI_SYM_MPI_Comm_create_errhandler, "MPI_Comm_create_errhandler"))
+#define MPI_Comm_create_group ((YogiFn_MPI_Comm_create_group) yogiSymbol(YOGI_SYM_MPI_Comm_create_group, "MPI_Comm_create_group"))
+#define MPI_Comm_create_keyval ((YogiFn_MPI_Comm_create_keyval) yogiSymbol(YOGI_SYM_MPI_Comm_create_keyval, "MPI_Comm_create_keyval"))
+#define MPI_Comm_delete_attr ((YogiFn_MPI_Comm_delete_attr) yogiSymbol(YOGI_SYM_MPI_Comm_delete_attr, "MPI_Comm_delete_attr"))
+#define MPI_Comm_disconnect ((YogiFn_MPI_Comm_disconnect) yogiSymbol(YOGI_SYM_MPI_Comm_disconnect, "MPI_Comm_disconnect"))
+#define MPI_Comm_dup ((YogiFn_MPI_Comm_dup) yogiSymbol(YOGI_SYM_MPI_Comm_dup, "MPI_Comm_dup"))
+#define MPI_Comm_dup_with_info ((YogiFn_MPI_Comm_dup_with_info) yogiSymbol(YOGI_SYM_MPI_Comm_dup_with_info, "MPI_Comm_dup_with_info"))
+#define MPI_Comm_free ((YogiFn_MPI_Comm_free) yogiSymbol(YOGI_SYM_MPI_Comm_free, "MPI_Comm_free"))
+#define MPI_Comm_free_keyval ((YogiFn_MPI_Comm_free_keyval) yogiSymbol(YOGI_SYM_MPI_Comm_free_keyval, "MPI_Comm_free_keyval"))
+#define MPI_Comm_get_attr ((YogiFn_MPI_Comm_get_attr) yogiSymbol(YOGI_SYM_MPI_Comm_get_attr, "MPI_Comm_get_attr"))
+#define MPI_Comm_get_errhandler ((YogiFn_MPI_Comm_get_errhandler) yogiSymbol(YOGI_SYM_MPI_Comm_get_errhandler, "MPI_Comm_get_errhandler"))
+#define MPI_Comm_get_info ((YogiFn_MPI_Comm_get_info) yogiSymbol(YOGI_SYM_MPI_Comm_get_info, "MPI_Comm_get_info"))
+#define MPI_Comm_get_name ((YogiFn_MPI_Comm_get_name) yogiSymbol(YOGI_SYM_MPI_Comm_get_name, "MPI_Comm_get_name"))
+#define MPI_Comm_get_parent ((YogiFn_MPI_Comm_get_parent) yogiSymbol(YOGI_SYM_MPI_Comm_get_parent, "MPI_Comm_get_parent"))
+#define MPI_Comm_group ((YogiFn_MPI_Comm_group) yogiSymbol(YOGI_SYM_MPI_Comm_group, "MPI_Comm_group"))
+#define MPI_Comm_idup ((YogiFn_MPI_Comm_idup) yogiSymbol(YOGI_SYM_MPI_Comm_idup, "MPI_Comm_idup"))
+#define MPI_Comm_join ((YogiFn_MPI_Comm_join) yogiSymbol(YOGI_SYM_MPI_Comm_join, "MPI_Comm_join"))
+#define MPI_Comm_rank ((YogiFn_MPI_Comm_rank) yogiSymbol(YOGI_SYM_MPI_Comm_rank, "MPI_Comm_rank"))
+#define MPI_Comm_remote_group ((YogiFn_MPI_Comm_remote_group) yogiSymbol(YOGI_SYM_MPI_Comm_remote_group, "MPI_Comm_remote_group"))
+#define MPI_Comm_remote_size ((YogiFn_MPI_Comm_remote_size) yogiSymbol(YOGI_SYM_MPI_Comm_remote_size, "MPI_Comm_remote_size"))
+#define MPI_Comm_set_attr ((YogiFn_MPI_Comm_set_attr) yogiSymbol(YOGI_SYM_MPI_Comm_set_attr, "MPI_Comm_set_attr"))
+#define MPI_Comm_set_errhandler ((YogiFn_MPI_Comm_set_errhandler) yogiSymbol(YOGI_SYM_MPI_Comm_set_errhandler, "MPI_Comm_set_errhandler"))
+#define MPI_Comm_set_info ((YogiFn_MPI_Comm_set_info) yogiSymbol(YOGI_SYM_MPI_Comm_set_info, "MPI_Comm_set_info"))
+#define MPI_Comm_set_name ((YogiFn_MPI_Comm_set_name) yogiSymbol(YOGI_SYM_MPI_Comm_set_name, "MPI_Comm_set_name"))
+#define MPI_Comm_size ((YogiFn_MPI_Comm_size) yogiSymbol(YOGI_SYM_MPI_Comm_size, "MPI_Comm_size"))
+#define MPI_Comm_split ((YogiFn_MPI_Comm_split) yogiSymbol(YOGI_SYM_MPI_Comm_split, "MPI_Comm_split"))
+#define MPI_Comm_split_type ((YogiFn_MPI_Comm_split_type) yogiSymbol(YOGI_SYM_MPI_Comm_split_type, "MPI_Comm_split_type"))
+#define MPI_Comm_test_inter ((YogiFn_MPI_Comm_test_inter) yogiSymbol(YOGI_SYM_MPI_Comm_test_inter, "MPI_Comm_test_inter"))
+#define MPI_Compare_and_swap ((YogiFn_MPI_Compare_and_swap) yogiSymbol(YOGI_SYM_MPI_Compare_and_swap, "MPI_Compare_and_swap"))
+#define MPI_Dims_create ((YogiFn_MPI_Dims_create) yogiSymbol(YOGI_SYM_MPI_Dims_create, "MPI_Dims_create"))
+#define MPI_Dist_graph_create ((YogiFn_MPI_Dist_graph_create) yogiSymbol(YOGI_SYM_MPI_Dist_graph_create, "MPI_Dist_graph_create"))
+#define MPI_Dist_graph_create_adjacent ((YogiFn_MPI_Dist_graph_create_adjacent) yogiSymbol(YOGI_SYM_MPI_Dist_graph_create_adjacent, "MPI_Dist_graph_create_adjacent"))
+#define MPI_Dist_graph_neighbors ((YogiFn_MPI_Dist_graph_neighbors) yogiSymbol(YOGI_SYM_MPI_Dist_graph_neighbors, "MPI_Dist_graph_neighbors"))
+#define MPI_Dist_graph_neighbors_count ((YogiFn_MPI_Dist_graph_neighbors_count) yogiSymbol(YOGI_SYM_MPI_Dist_graph_neighbors_count, "MPI_Dist_graph_neighbors_count"))
+#define MPI_Errhandler_create ((YogiFn_MPI_Errhandler_create) yogiSymbol(YOGI_SYM_MPI_Errhandler_create, "MPI_Errhandler_create"))
+#define MPI_Errhandler_free ((YogiFn_MPI_Errhandler_free) yogiSymbol(YOGI_SYM_MPI_Errhandler_free, "MPI_Errhandler_free"))
+#define MPI_Errhandler_get ((YogiFn_MPI_Errhandler_get) yogiSymbol(YOGI_SYM_MPI_Errhandler_get, "MPI_Errhandler_get"))
+#define MPI_Errhandler_set ((YogiFn_MPI_Errhandler_set) yogiSymbol(YOGI_SYM_MPI_Errhandler_set, "MPI_Errhandler_set"))
+#define MPI_Exscan ((YogiFn_MPI_Exscan) yogiSymbol(YOGI_SYM_MPI_Exscan, "MPI_Exscan"))
+#define MPI_Fetch_and_op ((YogiFn_MPI_Fetch_and_op) yogiSymbol(YOGI_SYM_MPI_Fetch_and_op, "MPI_Fetch_and_op"))
+#define MPI_File_call_errhandler ((YogiFn_MPI_File_call_errhandler) yogiSymbol(YOGI_SYM_MPI_File_call_errhandler, "MPI_File_call_errhandler"))
+#define MPI_File_close ((YogiFn_MPI_File_close) yogiSymbol(YOGI_SYM_MPI_File_close, "MPI_File_close"))
+#define MPI_File_create_errhandler ((YogiFn_MPI_File_create_errhandler) yogiSymbol(YOGI_SYM_MPI_File_create_errhandler, "MPI_File_create_errhandler"))
+#define MPI_File_delete ((YogiFn_MPI_File_delete) yogiSymbol(YOGI_SYM_MPI_File_delete, "MPI_File_delete"))
+#define MPI_File_get_amode ((YogiFn_MPI_File_get_amode) yogiSymbol(YOGI_SYM_MPI_File_get_amode, "MPI_File_get_amode"))
+#define MPI_File_get_atomicity ((YogiFn_MPI_File_get_atomicity) yogiSymbol(YOGI_SYM_MPI_File_get_atomicity, "MPI_File_get_atomicity"))
+#define MPI_File_get_byte_offset ((YogiFn_MPI_File_get_byte_offset) yogiSymbol(YOGI_SYM_MPI_File_get_byte_offset, "MPI_File_get_byte_offset"))
+#define MPI_File_get_errhandler ((YogiFn_MPI_File_get_errhandler) yogiSymbol(YOGI_SYM_MPI_File_get_errhandler, "MPI_File_get_errhandler"))
+#define MPI_File_get_group ((YogiFn_MPI_File_get_group) yogiSymbol(YOGI_SYM_MPI_File_get_group, "MPI_File_get_group"))
+#define MPI_File_get_info ((YogiFn_MPI_File_get_info) yogiSymbol(YOGI_SYM_MPI_File_get_info, "MPI_File_get_info"))
+#define MPI_File_get_position ((YogiFn_MPI_File_get_position) yogiSymbol(YOGI_SYM_MPI_File_get_position, "MPI_File_get_position"))
+#define MPI_File_get_position_shared ((YogiFn_MPI_File_get_position_shared) yogiSymbol(YOGI_SYM_MPI_File_get_position_shared, "MPI_File_get_position_shared"))
+#define MPI_File_get_size ((YogiFn_MPI_File_get_size) yogiSymbol(YOGI_SYM_MPI_File_get_size, "MPI_File_get_size"))
+#define MPI_File_get_type_extent ((YogiFn_MPI_File_get_type_extent) yogiSymbol(YOGI_SYM_MPI_File_get_type_extent, "MPI_File_get_type_extent"))
+#define MPI_File_get_view ((YogiFn_MPI_File_get_view) yogiSymbol(YOGI_SYM_MPI_File_get_view, "MPI_File_get_view"))
+#define MPI_File_iread ((YogiFn_MPI_File_iread) yogiSymbol(YOGI_SYM_MPI_File_iread, "MPI_File_iread"))
+#define MPI_File_iread_at ((YogiFn_MPI_File_iread_at) yogiSymbol(YOGI_SYM_MPI_File_iread_at, "MPI_File_iread_at"))
+#define MPI_File_iread_shared ((YogiFn_MPI_File_iread_shared) yogiSymbol(YOGI_SYM_MPI_File_iread_shared, "MPI_File_iread_shared"))
+#define MPI_File_iwrite ((YogiFn_MPI_File_iwrite) yogiSymbol(YOGI_SYM_MPI_File_iwrite, "MPI_File_iwrite"))
+#define MPI_File_iwrite_at ((YogiFn_MPI_File_iwrite_at) yogiSymbol(YOGI_SYM_MPI_File_iwrite_at, "MPI_File_iwrite_at"))
+#define MPI_File_iwrite_shared ((YogiFn_MPI_File_iwrite_shared) yogiSymbol(YOGI_SYM_MPI_File_iwrite_shared, "MPI_File_iwrite_shared"))
+#define MPI_File_open ((YogiFn_MPI_File_open) yogiSymbol(YOGI_SYM_MPI_File_open, "MPI_File_open"))
+#define MPI_File_preallocate ((YogiFn_MPI_File_preallocate) yogiSymbol(YOGI_SYM_MPI_File_preallocate, "MPI_File_preallocate"))
+#define MPI_File_read ((YogiFn_MPI_File_read) yogiSymbol(YOGI_SYM_MPI_File_read, "MPI_File_read"))
+#define MPI_File_read_all ((YogiFn_MPI_File_read_all) yogiSymbol(YOGI_SYM_MPI_File_read_all, "MPI_File_read_all"))
+#define MPI_File_read_all_begin ((YogiFn_MPI_File_read_all_begin) yogiSymbol(YOGI_SYM_MPI_File_read_all_begin, "MPI_File_read_all_begin"))
+#define MPI_File_read_all_end ((YogiFn_MPI_File_read_all_end) yogiSymbol(YOGI_SYM_MPI_File_read_all_end, "MPI_File_read_all_end"))
+#define MPI_File_read_at ((YogiFn_MPI_File_read_at) yogiSymbol(YOGI_SYM_MPI_File_read_at, "MPI_File_read_at"))
+#define MPI_File_read_at_all ((YogiFn_MPI_File_read_at_all) yogiSymbol(YOGI_SYM_MPI_File_read_at_all, "MPI_File_read_at_all"))
+#define MPI_File_read_at_all_begin ((YogiFn_MPI_File_read_at_all_begin) yogiSymbol(YOGI_SYM_MPI_File_read_at_all_begin, "MPI_File_read_at_all_begin"))
+#define MPI_File_read_at_all_end ((YogiFn_MPI_File_read_at_all_end) yogiSymbol(YOGI_SYM_MPI_File_read_at_all_end, "MPI_File_read_at_all_end"))
+#define MPI_File_read_ordered ((YogiFn_MPI_File_read_ordered) yogiSymbol(YOGI_SYM_MPI_File_read_ordered, "MPI_File_read_ordered"))
+#define MPI_File_read_ordered_begin ((YogiFn_MPI_File_read_ordered_begin) yogiSymbol(YOGI_SYM_MPI_File_read_ordered_begin, "MPI_File_read_ordered_begin"))
+#define MPI_File_read_ordered_end ((YogiFn_MPI_File_read_ordered_end) yogiSymbol(YOGI_SYM_MPI_File_read_ordered_end, "MPI_File_read_ordered_end"))
+#define MPI_File_read_shared ((YogiFn_MPI_File_read_shared) yogiSymbol(YOGI_SYM_MPI_File_read_shared, "MPI_File_read_shared"))
+#define MPI_File_seek ((YogiFn_MPI_File_seek) yogiSymbol(YOGI_SYM_MPI_File_seek, "MPI_File_seek"))
+#define MPI_File_seek_shared ((YogiFn_MPI_File_seek_shared) yogiSymbol(YOGI_SYM_MPI_File_seek_shared, "MPI_File_seek_shared"))
+#define MPI_File_set_atomicity ((YogiFn_MPI_File_set_atomicity) yogiSymbol(YOGI_SYM_MPI_File_set_atomicity, "MPI_File_set_atomicity"))
+#define MPI_File_set_errhandler ((YogiFn_MPI_File_set_errhandler) yogiSymbol(YOGI_SYM_MPI_File_set_errhandler, "MPI_File_set_errhandler"))
+#define MPI_File_set_info ((YogiFn_MPI_File_set_info) yogiSymbol(YOGI_SYM_MPI_File_set_info, "MPI_File_set_info"))
+#define MPI_File_set_size ((YogiFn_MPI_File_set_size) yogiSymbol(YOGI_SYM_MPI_File_set_size, "MPI_File_set_size"))
+#define MPI_File_set_view ((YogiFn_MPI_File_set_view) yogiSymbol(YOGI_SYM_MPI_File_set_view, "MPI_File_set_view"))
+#define MPI_File_sync ((YogiFn_MPI_File_sync) yogiSymbol(YOGI_SYM_MPI_File_sync, "MPI_File_sync"))
+#define MPI_File_write ((YogiFn_MPI_File_write) yogiSymbol(YOGI_SYM_MPI_File_write, "MPI_File_write"))
+#define MPI_File_write_all ((YogiFn_MPI_File_write_all) yogiSymbol(YOGI_SYM_MPI_File_write_all, "MPI_File_write_all"))
+#define MPI_File_write_all_begin ((YogiFn_MPI_File_write_all_begin) yogiSymbol(YOGI_SYM_MPI_File_write_all_begin, "MPI_File_write_all_begin"))
+#define MPI_File_write_all_end ((YogiFn_MPI_File_write_all_end) yogiSymbol(YOGI_SYM_MPI_File_write_all_end, "MPI_File_write_all_end"))
+#define MPI_File_write_at ((YogiFn_MPI_File_write_at) yogiSymbol(YOGI_SYM_MPI_File_write_at, "MPI_File_write_at"))
+#define MPI_File_write_at_all ((YogiFn_MPI_File_write_at_all) yogiSymbol(YOGI_SYM_MPI_File_write_at_all, "MPI_File_write_at_all"))
+#define MPI_File_write_at_all_begin ((YogiFn_MPI_File_write_at_all_begin) yogiSymbol(YOGI_SYM_MPI_File_write_at_all_begin, "MPI_File_write_at_all_begin"))
+#define MPI_File_write_at_all_end ((YogiFn_MPI_File_write_at_all_end) yogiSymbol(YOGI_SYM_MPI_File_write_at_all_end, "MPI_File_write_at_all_end"))
+#define MPI_File_write_ordered ((YogiFn_MPI_File_write_ordered) yogiSymbol(YOGI_SYM_MPI_File_write_ordered, "MPI_File_write_ordered"))
+#define MPI_File_write_ordered_begin ((YogiFn_MPI_File_write_ordered_begin) yogiSymbol(YOGI_SYM_MPI_File_write_ordered_begin, "MPI_File_write_ordered_begin"))
+#define MPI_File_write_ordered_end ((YogiFn_MPI_File_write_ordered_end) yogiSymbol(YOGI_SYM_MPI_File_write_ordered_end, "MPI_File_write_ordered_end"))
+#define MPI_File_write_shared ((YogiFn_MPI_File_write_shared) yogiSymbol(YOGI_SYM_MPI_File_write_shared, "MPI_File_write_shared"))
+#define MPI_Finalized ((YogiFn_MPI_Finalized) yogiSymbol(YOGI_SYM_MPI_Finalized, "MPI_Finalized"))
+#define MPI_Free_mem ((YogiFn_MPI_Free_mem) yogiSymbol(YOGI_SYM_MPI_Free_mem, "MPI_Free_mem"))
+#define MPI_Gather ((YogiFn_MPI_Gather) yogiSymbol(YOGI_SYM_MPI_Gather, "MPI_Gather"))
+#define MPI_Gatherv ((YogiFn_MPI_Gatherv) yogiSymbol(YOGI_SYM_MPI_Gatherv, "MPI_Gatherv"))
+#define MPI_Get ((YogiFn_MPI_Get) yogiSymbol(YOGI_SYM_MPI_Get, "MPI_Get"))
+#define MPI_Get_accumulate ((YogiFn_MPI_Get_accumulate) yogiSymbol(YOGI_SYM_MPI_Get_accumulate, "MPI_Get_accumulate"))
+#define MPI_Get_address ((YogiFn_MPI_Get_address) yogiSymbol(YOGI_SYM_MPI_Get_address, "MPI_Get_address"))
+#define MPI_Get_count ((YogiFn_MPI_Get_count) yogiSymbol(YOGI_SYM_MPI_Get_count, "MPI_Get_count"))
+#define MPI_Get_elements ((YogiFn_MPI_Get_elements) yogiSymbol(YOGI_SYM_MPI_Get_elements, "MPI_Get_elements"))
+#define MPI_Get_elements_x ((YogiFn_MPI_Get_elements_x) yogiSymbol(YOGI_SYM_MPI_Get_elements_x, "MPI_Get_elements_x"))
+#define MPI_Get_library_version ((YogiFn_MPI_Get_library_version) yogiSymbol(YOGI_SYM_MPI_Get_library_version, "MPI_Get_library_version"))
+#define MPI_Get_version ((YogiFn_MPI_Get_version) yogiSymbol(YOGI_SYM_MPI_Get_version, "MPI_Get_version"))
+#define MPI_Graph_create ((YogiFn_MPI_Graph_create) yogiSymbol(YOGI_SYM_MPI_Graph_create, "MPI_Graph_create"))
+#define MPI_Graph_get ((YogiFn_MPI_Graph_get) yogiSymbol(YOGI_SYM_MPI_Graph_get, "MPI_Graph_get"))
+#define MPI_Graph_map ((YogiFn_MPI_Graph_map) yogiSymbol(YOGI_SYM_MPI_Graph_map, "MPI_Graph_map"))
+#define MPI_Graph_neighbors ((YogiFn_MPI_Graph_neighbors) yogiSymbol(YOGI_SYM_MPI_Graph_neighbors, "MPI_Graph_neighbors"))
+#define MPI_Graph_neighbors_count ((YogiFn_MPI_Graph_neighbors_count) yogiSymbol(YOGI_SYM_MPI_Graph_neighbors_count, "MPI_Graph_neighbors_count"))
+#define MPI_Graphdims_get ((YogiFn_MPI_Graphdims_get) yogiSymbol(YOGI_SYM_MPI_Graphdims_get, "MPI_Graphdims_get"))
+#define MPI_Grequest_complete ((YogiFn_MPI_Grequest_complete) yogiSymbol(YOGI_SYM_MPI_Grequest_complete, "MPI_Grequest_complete"))
+#define MPI_Grequest_start ((YogiFn_MPI_Grequest_start) yogiSymbol(YOGI_SYM_MPI_Grequest_start, "MPI_Grequest_start"))
+#define MPI_Group_compare ((YogiFn_MPI_Group_compare) yogiSymbol(YOGI_SYM_MPI_Group_compare, "MPI_Group_compare"))
+#define MPI_Group_difference ((YogiFn_MPI_Group_difference) yogiSymbol(YOGI_SYM_MPI_Group_difference, "MPI_Group_difference"))
+#define MPI_Group_excl ((YogiFn_MPI_Group_excl) yogiSymbol(YOGI_SYM_MPI_Group_excl, "MPI_Group_excl"))
+#define MPI_Group_free ((YogiFn_MPI_Group_free) yogiSymbol(YOGI_SYM_MPI_Group_free, "MPI_Group_free"))
+#define MPI_Group_incl ((YogiFn_MPI_Group_incl) yogiSymbol(YOGI_SYM_MPI_Group_incl, "MPI_Group_incl"))
+#define MPI_Group_intersection ((YogiFn_MPI_Group_intersection) yogiSymbol(YOGI_SYM_MPI_Group_intersection, "MPI_Group_intersection"))
+#define MPI_Group_range_excl ((YogiFn_MPI_Group_range_excl) yogiSymbol(YOGI_SYM_MPI_Group_range_excl, "MPI_Group_range_excl"))
+#define MPI_Group_range_incl ((YogiFn_MPI_Group_range_incl) yogiSymbol(YOGI_SYM_MPI_Group_range_incl, "MPI_Group_range_incl"))
+#define MPI_Group_rank ((YogiFn_MPI_Group_rank) yogiSymbol(YOGI_SYM_MPI_Group_rank, "MPI_Group_rank"))
+#define MPI_Group_size ((YogiFn_MPI_Group_size) yogiSymbol(YOGI_SYM_MPI_Group_size, "MPI_Group_size"))
+#define MPI_Group_translate_ranks ((YogiFn_MPI_Group_translate_ranks) yogiSymbol(YOGI_SYM_MPI_Group_translate_ranks, "MPI_Group_translate_ranks"))
+#define MPI_Group_union ((YogiFn_MPI_Group_union) yogiSymbol(YOGI_SYM_MPI_Group_union, "MPI_Group_union"))
+#define MPI_Iallgather ((YogiFn_MPI_Iallgather) yogiSymbol(YOGI_SYM_MPI_Iallgather, "MPI_Iallgather"))
+#define MPI_Iallgatherv ((YogiFn_MPI_Iallgatherv) yogiSymbol(YOGI_SYM_MPI_Iallgatherv, "MPI_Iallgatherv"))
+#define MPI_Iallreduce ((YogiFn_MPI_Iallreduce) yogiSymbol(YOGI_SYM_MPI_Iallreduce, "MPI_Iallreduce"))
+#define MPI_Ialltoall ((YogiFn_MPI_Ialltoall) yogiSymbol(YOGI_SYM_MPI_Ialltoall, "MPI_Ialltoall"))
+#define MPI_Ialltoallv ((YogiFn_MPI_Ialltoallv) yogiSymbol(YOGI_SYM_MPI_Ialltoallv, "MPI_Ialltoallv"))
+#define MPI_Ialltoallw ((YogiFn_MPI_Ialltoallw) yogiSymbol(YOGI_SYM_MPI_Ialltoallw, "MPI_Ialltoallw"))
+#define MPI_Ibarrier ((YogiFn_MPI_Ibarrier) yogiSymbol(YOGI_SYM_MPI_Ibarrier, "MPI_Ibarrier"))
+#define MPI_Ibcast ((YogiFn_MPI_Ibcast) yogiSymbol(YOGI_SYM_MPI_Ibcast, "MPI_Ibcast"))
+#define MPI_Ibsend ((YogiFn_MPI_Ibsend) yogiSymbol(YOGI_SYM_MPI_Ibsend, "MPI_Ibsend"))
+#define MPI_Iexscan ((YogiFn_MPI_Iexscan) yogiSymbol(YOGI_SYM_MPI_Iexscan, "MPI_Iexscan"))
+#define MPI_Igather ((YogiFn_MPI_Igather) yogiSymbol(YOGI_SYM_MPI_Igather, "MPI_Igather"))
+#define MPI_Igatherv ((YogiFn_MPI_Igatherv) yogiSymbol(YOGI_SYM_MPI_Igatherv, "MPI_Igatherv"))
+#define MPI_Improbe ((YogiFn_MPI_Improbe) yogiSymbol(YOGI_SYM_MPI_Improbe, "MPI_Improbe"))
+#define MPI_Imrecv ((YogiFn_MPI_Imrecv) yogiSymbol(YOGI_SYM_MPI_Imrecv, "MPI_Imrecv"))
+#define MPI_Ineighbor_allgather ((YogiFn_MPI_Ineighbor_allgather) yogiSymbol(YOGI_SYM_MPI_Ineighbor_allgather, "MPI_Ineighbor_allgather"))
+#define MPI_Ineighbor_allgatherv ((YogiFn_MPI_Ineighbor_allgatherv) yogiSymbol(YOGI_SYM_MPI_Ineighbor_allgatherv, "MPI_Ineighbor_allgatherv"))
+#define MPI_Ineighbor_alltoall ((YogiFn_MPI_Ineighbor_alltoall) yogiSymbol(YOGI_SYM_MPI_Ineighbor_alltoall, "MPI_Ineighbor_alltoall"))
+#define MPI_Ineighbor_alltoallv ((YogiFn_MPI_Ineighbor_alltoallv) yogiSymbol(YOGI_SYM_MPI_Ineighbor_alltoallv, "MPI_Ineighbor_alltoallv"))
+#define MPI_Ineighbor_alltoallw ((YogiFn_MPI_Ineighbor_alltoallw) yogiSymbol(YOGI_SYM_MPI_Ineighbor_alltoallw, "MPI_Ineighbor_alltoallw"))
+#define MPI_Info_create ((YogiFn_MPI_Info_create) yogiSymbol(YOGI_SYM_MPI_Info_create, "MPI_Info_create"))
+#define MPI_Info_delete ((YogiFn_MPI_Info_delete) yogiSymbol(YOGI_SYM_MPI_Info_delete, "MPI_Info_delete"))
+#define MPI_Info_dup ((YogiFn_MPI_Info_dup) yogiSymbol(YOGI_SYM_MPI_Info_dup, "MPI_Info_dup"))
+#define MPI_Info_free ((YogiFn_MPI_Info_free) yogiSymbol(YOGI_SYM_MPI_Info_free, "MPI_Info_free"))
+#define MPI_Info_get ((YogiFn_MPI_Info_get) yogiSymbol(YOGI_SYM_MPI_Info_get, "MPI_Info_get"))
+#define MPI_Info_get_nkeys ((YogiFn_MPI_Info_get_nkeys) yogiSymbol(YOGI_SYM_MPI_Info_get_nkeys, "MPI_Info_get_nkeys"))
+#define MPI_Info_get_nthkey ((YogiFn_MPI_Info_get_nthkey) yogiSymbol(YOGI_SYM_MPI_Info_get_nthkey, "MPI_Info_get_nthkey"))
+#define MPI_Info_get_valuelen ((YogiFn_MPI_Info_get_valuelen) yogiSymbol(YOGI_SYM_MPI_Info_get_valuelen, "MPI_Info_get_valuelen"))
+#define MPI_Info_set ((YogiFn_MPI_Info_set) yogiSymbol(YOGI_SYM_MPI_Info_set, "MPI_Info_set"))
+#define MPI_Initialized ((YogiFn_MPI_Initialized) yogiSymbol(YOGI_SYM_MPI_Initialized, "MPI_Initialized"))
+#define MPI_Intercomm_create ((YogiFn_MPI_Intercomm_create) yogiSymbol(YOGI_SYM_MPI_Intercomm_create, "MPI_Intercomm_create"))
+#define MPI_Intercomm_merge ((YogiFn_MPI_Intercomm_merge) yogiSymbol(YOGI_SYM_MPI_Intercomm_merge, "MPI_Intercomm_merge"))
+#define MPI_Iprobe ((YogiFn_MPI_Iprobe) yogiSymbol(YOGI_SYM_MPI_Iprobe, "MPI_Iprobe"))
+#define MPI_Irecv ((YogiFn_MPI_Irecv) yogiSymbol(YOGI_SYM_MPI_Irecv, "MPI_Irecv"))
+#define MPI_Ireduce ((YogiFn_MPI_Ireduce) yogiSymbol(YOGI_SYM_MPI_Ireduce, "MPI_Ireduce"))
+#define MPI_Ireduce_scatter ((YogiFn_MPI_Ireduce_scatter) yogiSymbol(YOGI_SYM_MPI_Ireduce_scatter, "MPI_Ireduce_scatter"))
+#define MPI_Ireduce_scatter_block ((YogiFn_MPI_Ireduce_scatter_block) yogiSymbol(YOGI_SYM_MPI_Ireduce_scatter_block, "MPI_Ireduce_scatter_block"))
+#define MPI_Irsend ((YogiFn_MPI_Irsend) yogiSymbol(YOGI_SYM_MPI_Irsend, "MPI_Irsend"))
+#define MPI_Is_thread_main ((YogiFn_MPI_Is_thread_main) yogiSymbol(YOGI_SYM_MPI_Is_thread_main, "MPI_Is_thread_main"))
+#define MPI_Iscan ((YogiFn_MPI_Iscan) yogiSymbol(YOGI_SYM_MPI_Iscan, "MPI_Iscan"))
+#define MPI_Iscatter ((YogiFn_MPI_Iscatter) yogiSymbol(YOGI_SYM_MPI_Iscatter, "MPI_Iscatter"))
+#define MPI_Iscatterv ((YogiFn_MPI_Iscatterv) yogiSymbol(YOGI_SYM_MPI_Iscatterv, "MPI_Iscatterv"))
+#define MPI_Isend ((YogiFn_MPI_Isend) yogiSymbol(YOGI_SYM_MPI_Isend, "MPI_Isend"))
+#define MPI_Issend ((YogiFn_MPI_Issend) yogiSymbol(YOGI_SYM_MPI_Issend, "MPI_Issend"))
+#define MPI_Keyval_create ((YogiFn_MPI_Keyval_create) yogiSymbol(YOGI_SYM_MPI_Keyval_create, "MPI_Keyval_create"))
+#define MPI_Keyval_free ((YogiFn_MPI_Keyval_free) yogiSymbol(YOGI_SYM_MPI_Keyval_free, "MPI_Keyval_free"))
+#define MPI_Lookup_name ((YogiFn_MPI_Lookup_name) yogiSymbol(YOGI_SYM_MPI_Lookup_name, "MPI_Lookup_name"))
+#define MPI_Mprobe ((YogiFn_MPI_Mprobe) yogiSymbol(YOGI_SYM_MPI_Mprobe, "MPI_Mprobe"))
+#define MPI_Mrecv ((YogiFn_MPI_Mrecv) yogiSymbol(YOGI_SYM_MPI_Mrecv, "MPI_Mrecv"))
+#define MPI_Neighbor_allgather ((YogiFn_MPI_Neighbor_allgather) yogiSymbol(YOGI_SYM_MPI_Neighbor_allgather, "MPI_Neighbor_allgather"))
+#define MPI_Neighbor_allgatherv ((YogiFn_MPI_Neighbor_allgatherv) yogiSymbol(YOGI_SYM_MPI_Neighbor_allgatherv, "MPI_Neighbor_allgatherv"))
+#define MPI_Neighbor_alltoall ((YogiFn_MPI_Neighbor_alltoall) yogiSymbol(YOGI_SYM_MPI_Neighbor_alltoall, "MPI_Neighbor_alltoall"))
+#define MPI_Neighbor_alltoallv ((YogiFn_MPI_Neighbor_alltoallv) yogiSymbol(YOGI_SYM_MPI_Neighbor_alltoallv, "MPI_Neighbor_alltoallv"))
+#define MPI_Neighbor_alltoallw ((YogiFn_MPI_Neighbor_alltoallw) yogiSymbol(YOGI_SYM_MPI_Neighbor_alltoallw, "MPI_Neighbor_alltoallw"))
+#define MPI_Op_commutative ((YogiFn_MPI_Op_commutative) yogiSymbol(YOGI_SYM_MPI_Op_commutative, "MPI_Op_commutative"))
+#define MPI_Op_create ((YogiFn_MPI_Op_create) yogiSymbol(YOGI_SYM_MPI_Op_create, "MPI_Op_create"))
+#define MPI_Op_free ((YogiFn_MPI_Op_free) yogiSymbol(YOGI_SYM_MPI_Op_free, "MPI_Op_free"))
+#define MPI_Open_port ((YogiFn_MPI_Open_port) yogiSymbol(YOGI_SYM_MPI_Open_port, "MPI_Open_port"))
+#define MPI_Pack ((YogiFn_MPI_Pack) yogiSymbol(YOGI_SYM_MPI_Pack, "MPI_Pack"))
+#define MPI_Pack_external ((YogiFn_MPI_Pack_external) yogiSymbol(YOGI_SYM_MPI_Pack_external, "MPI_Pack_external"))
+#define MPI_Pack_external_size ((YogiFn_MPI_Pack_external_size) yogiSymbol(YOGI_SYM_MPI_Pack_external_size, "MPI_Pack_external_size"))
+#define MPI_Pack_size ((YogiFn_MPI_Pack_size) yogiSymbol(YOGI_SYM_MPI_Pack_size, "MPI_Pack_size"))
+#define MPI_Pcontrol ((YogiFn_MPI_Pcontrol) yogiSymbol(YOGI_SYM_MPI_Pcontrol, "MPI_Pcontrol"))
+#define MPI_Probe ((YogiFn_MPI_Probe) yogiSymbol(YOGI_SYM_MPI_Probe, "MPI_Probe"))
+#define MPI_Publish_name ((YogiFn_MPI_Publish_name) yogiSymbol(YOGI_SYM_MPI_Publish_name, "MPI_Publish_name"))
+#define MPI_Put ((YogiFn_MPI_Put) yogiSymbol(YOGI_SYM_MPI_Put, "MPI_Put"))
+#define MPI_Query_thread ((YogiFn_MPI_Query_thread) yogiSymbol(YOGI_SYM_MPI_Query_thread, "MPI_Query_thread"))
+#define MPI_Raccumulate ((YogiFn_MPI_Raccumulate) yogiSymbol(YOGI_SYM_MPI_Raccumulate, "MPI_Raccumulate"))
+#define MPI_Recv ((YogiFn_MPI_Recv) yogiSymbol(YOGI_SYM_MPI_Recv, "MPI_Recv"))
+#define MPI_Recv_init ((YogiFn_MPI_Recv_init) yogiSymbol(YOGI_SYM_MPI_Recv_init, "MPI_Recv_init"))
+#define MPI_Reduce ((YogiFn_MPI_Reduce) yogiSymbol(YOGI_SYM_MPI_Reduce, "MPI_Reduce"))
+#define MPI_Reduce_local ((YogiFn_MPI_Reduce_local) yogiSymbol(YOGI_SYM_MPI_Reduce_local, "MPI_Reduce_local"))
+#define MPI_Reduce_scatter ((YogiFn_MPI_Reduce_scatter) yogiSymbol(YOGI_SYM_MPI_Reduce_scatter, "MPI_Reduce_scatter"))
+#define MPI_Reduce_scatter_block ((YogiFn_MPI_Reduce_scatter_block) yogiSymbol(YOGI_SYM_MPI_Reduce_scatter_block, "MPI_Reduce_scatter_block"))
+#define MPI_Register_datarep ((YogiFn_MPI_Register_datarep) yogiSymbol(YOGI_SYM_MPI_Register_datarep, "MPI_Register_datarep"))
+#define MPI_Request_free ((YogiFn_MPI_Request_free) yogiSymbol(YOGI_SYM_MPI_Request_free, "MPI_Request_free"))
+#define MPI_Request_get_status ((YogiFn_MPI_Request_get_status) yogiSymbol(YOGI_SYM_MPI_Request_get_status, "MPI_Request_get_status"))
+#define MPI_Rget ((YogiFn_MPI_Rget) yogiSymbol(YOGI_SYM_MPI_Rget, "MPI_Rget"))
+#define MPI_Rget_accumulate ((YogiFn_MPI_Rget_accumulate) yogiSymbol(YOGI_SYM_MPI_Rget_accumulate, "MPI_Rget_accumulate"))
+#define MPI_Rput ((YogiFn_MPI_Rput) yogiSymbol(YOGI_SYM_MPI_Rput, "MPI_Rput"))
+#define MPI_Rsend ((YogiFn_MPI_Rsend) yogiSymbol(YOGI_SYM_MPI_Rsend, "MPI_Rsend"))
+#define MPI_Rsend_init ((YogiFn_MPI_Rsend_init) yogiSymbol(YOGI_SYM_MPI_Rsend_init, "MPI_Rsend_init"))
+#define MPI_Scan ((YogiFn_MPI_Scan) yogiSymbol(YOGI_SYM_MPI_Scan, "MPI_Scan"))
+#define MPI_Scatter ((YogiFn_MPI_Scatter) yogiSymbol(YOGI_SYM_MPI_Scatter, "MPI_Scatter"))
+#define MPI_Scatterv ((YogiFn_MPI_Scatterv) yogiSymbol(YOGI_SYM_MPI_Scatterv, "MPI_Scatterv"))
+#define MPI_Send ((YogiFn_MPI_Send) yogiSymbol(YOGI_SYM_MPI_Send, "MPI_Send"))
+#define MPI_Send_init ((YogiFn_MPI_Send_init) yogiSymbol(YOGI_SYM_MPI_Send_init, "MPI_Send_init"))
+#define MPI_Sendrecv ((YogiFn_MPI_Sendrecv) yogiSymbol(YOGI_SYM_MPI_Sendrecv, "MPI_Sendrecv"))
+#define MPI_Sendrecv_replace ((YogiFn_MPI_Sendrecv_replace) yogiSymbol(YOGI_SYM_MPI_Sendrecv_replace, "MPI_Sendrecv_replace"))
+#define MPI_Ssend ((YogiFn_MPI_Ssend) yogiSymbol(YOGI_SYM_MPI_Ssend, "MPI_Ssend"))
+#define MPI_Ssend_init ((YogiFn_MPI_Ssend_init) yogiSymbol(YOGI_SYM_MPI_Ssend_init, "MPI_Ssend_init"))
+#define MPI_Start ((YogiFn_MPI_Start) yogiSymbol(YOGI_SYM_MPI_Start, "MPI_Start"))
+#define MPI_Startall ((YogiFn_MPI_Startall) yogiSymbol(YOGI_SYM_MPI_Startall, "MPI_Startall"))
+#define MPI_Status_set_cancelled ((YogiFn_MPI_Status_set_cancelled) yogiSymbol(YOGI_SYM_MPI_Status_set_cancelled, "MPI_Status_set_cancelled"))
+#define MPI_Status_set_elements ((YogiFn_MPI_Status_set_elements) yogiSymbol(YOGI_SYM_MPI_Status_set_elements, "MPI_Status_set_elements"))
+#define MPI_Status_set_elements_x ((YogiFn_MPI_Status_set_elements_x) yogiSymbol(YOGI_SYM_MPI_Status_set_elements_x, "MPI_Status_set_elements_x"))
+#define MPI_Test ((YogiFn_MPI_Test) yogiSymbol(YOGI_SYM_MPI_Test, "MPI_Test"))
+#define MPI_Test_cancelled ((YogiFn_MPI_Test_cancelled) yogiSymbol(YOGI_SYM_MPI_Test_cancelled, "MPI_Test_cancelled"))
+#define MPI_Testall ((YogiFn_MPI_Testall) yogiSymbol(YOGI_SYM_MPI_Testall, "MPI_Testall"))
+#define MPI_Testany ((YogiFn_MPI_Testany) yogiSymbol(YOGI_SYM_MPI_Testany, "MPI_Testany"))
+#define MPI_Testsome ((YogiFn_MPI_Testsome) yogiSymbol(YOGI_SYM_MPI_Testsome, "MPI_Testsome"))
+#define MPI_Topo_test ((YogiFn_MPI_Topo_test) yogiSymbol(YOGI_SYM_MPI_Topo_test, "MPI_Topo_test"))
+#define MPI_Type_commit ((YogiFn_MPI_Type_commit) yogiSymbol(YOGI_SYM_MPI_Type_commit, "MPI_Type_commit"))
+#define MPI_Type_contiguous ((YogiFn_MPI_Type_contiguous) yogiSymbol(YOGI_SYM_MPI_Type_contiguous, "MPI_Type_contiguous"))
+#define MPI_Type_create_hindexed ((YogiFn_MPI_Type_create_hindexed) yogiSymbol(YOGI_SYM_MPI_Type_create_hindexed, "MPI_Type_create_hindexed"))
+#define MPI_Type_create_hindexed_block ((YogiFn_MPI_Type_create_hindexed_block) yogiSymbol(YOGI_SYM_MPI_Type_create_hindexed_block, "MPI_Type_create_hindexed_block"))
+#define MPI_Type_create_hvector ((YogiFn_MPI_Type_create_hvector) yogiSymbol(YOGI_SYM_MPI_Type_create_hvector, "MPI_Type_create_hvector"))
+#define MPI_Type_create_indexed_block ((YogiFn_MPI_Type_create_indexed_block) yogiSymbol(YOGI_SYM_MPI_Type_create_indexed_block, "MPI_Type_create_indexed_block"))
+#define MPI_Type_create_keyval ((YogiFn_MPI_Type_create_keyval) yogiSymbol(YOGI_SYM_MPI_Type_create_keyval, "MPI_Type_create_keyval"))
+#define MPI_Type_create_resized ((YogiFn_MPI_Type_create_resized) yogiSymbol(YOGI_SYM_MPI_Type_create_resized, "MPI_Type_create_resized"))
+#define MPI_Type_create_struct ((YogiFn_MPI_Type_create_struct) yogiSymbol(YOGI_SYM_MPI_Type_create_struct, "MPI_Type_create_struct"))
+#define MPI_Type_create_subarray ((YogiFn_MPI_Type_create_subarray) yogiSymbol(YOGI_SYM_MPI_Type_create_subarray, "MPI_Type_create_subarray"))
+#define MPI_Type_delete_attr ((YogiFn_MPI_Type_delete_attr) yogiSymbol(YOGI_SYM_MPI_Type_delete_attr, "MPI_Type_delete_attr"))
+#define MPI_Type_dup ((YogiFn_MPI_Type_dup) yogiSymbol(YOGI_SYM_MPI_Type_dup, "MPI_Type_dup"))
+#define MPI_Type_extent ((YogiFn_MPI_Type_extent) yogiSymbol(YOGI_SYM_MPI_Type_extent, "MPI_Type_extent"))
+#define MPI_Type_free ((YogiFn_MPI_Type_free) yogiSymbol(YOGI_SYM_MPI_Type_free, "MPI_Type_free"))
+#define MPI_Type_free_keyval ((YogiFn_MPI_Type_free_keyval) yogiSymbol(YOGI_SYM_MPI_Type_free_keyval, "MPI_Type_free_keyval"))
+#define MPI_Type_get_attr ((YogiFn_MPI_Type_get_attr) yogiSymbol(YOGI_SYM_MPI_Type_get_attr, "MPI_Type_get_attr"))
+#define MPI_Type_get_envelope ((YogiFn_MPI_Type_get_envelope) yogiSymbol(YOGI_SYM_MPI_Type_get_envelope, "MPI_Type_get_envelope"))
+#define MPI_Type_get_extent ((YogiFn_MPI_Type_get_extent) yogiSymbol(YOGI_SYM_MPI_Type_get_extent, "MPI_Type_get_extent"))
+#define MPI_Type_get_extent_x ((YogiFn_MPI_Type_get_extent_x) yogiSymbol(YOGI_SYM_MPI_Type_get_extent_x, "MPI_Type_get_extent_x"))
+#define MPI_Type_get_name ((YogiFn_MPI_Type_get_name) yogiSymbol(YOGI_SYM_MPI_Type_get_name, "MPI_Type_get_name"))
+#define MPI_Type_get_true_extent ((YogiFn_MPI_Type_get_true_extent) yogiSymbol(YOGI_SYM_MPI_Type_get_true_extent, "MPI_Type_get_true_extent"))
+#define MPI_Type_get_true_extent_x ((YogiFn_MPI_Type_get_true_extent_x) yogiSymbol(YOGI_SYM_MPI_Type_get_true_extent_x, "MPI_Type_get_true_extent_x"))
+#define MPI_Type_hindexed ((YogiFn_MPI_Type_hindexed) yogiSymbol(YOGI_SYM_MPI_Type_hindexed, "MPI_Type_hindexed"))
+#define MPI_Type_hvector ((YogiFn_MPI_Type_hvector) yogiSymbol(YOGI_SYM_MPI_Type_hvector, "MPI_Type_hvector"))
+#define MPI_Type_indexed ((YogiFn_MPI_Type_indexed) yogiSymbol(YOGI_SYM_MPI_Type_indexed, "MPI_Type_indexed"))
+#define MPI_Type_lb ((YogiFn_MPI_Type_lb) yogiSymbol(YOGI_SYM_MPI_Type_lb, "MPI_Type_lb"))
+#define MPI_Type_match_size ((YogiFn_MPI_Type_match_size) yogiSymbol(YOGI_SYM_MPI_Type_match_size, "MPI_Type_match_size"))
+#define MPI_Type_set_attr ((YogiFn_MPI_Type_set_attr) yogiSymbol(YOGI_SYM_MPI_Type_set_attr, "MPI_Type_set_attr"))
+#define MPI_Type_set_name ((YogiFn_MPI_Type_set_name) yogiSymbol(YOGI_SYM_MPI_Type_set_name, "MPI_Type_set_name"))
+#define MPI_Type_size ((YogiFn_MPI_Type_size) yogiSymbol(YOGI_SYM_MPI_Type_size, "MPI_Type_size"))
+#define MPI_Type_size_x ((YogiFn_MPI_Type_size_x) yogiSymbol(YOGI_SYM_MPI_Type_size_x, "MPI_Type_size_x"))
+#define MPI_Type_struct ((YogiFn_MPI_Type_struct) yogiSymbol(YOGI_SYM_MPI_Type_struct, "MPI_Type_struct"))
+#define MPI_Type_ub ((YogiFn_MPI_Type_ub) yogiSymbol(YOGI_SYM_MPI_Type_ub, "MPI_Type_ub"))
+#define MPI_Type_vector ((YogiFn_MPI_Type_vector) yogiSymbol(YOGI_SYM_MPI_Type_vector, "MPI_Type_vector"))
+#define MPI_Unpack ((YogiFn_MPI_Unpack) yogiSymbol(YOGI_SYM_MPI_Unpack, "MPI_Unpack"))
+#define MPI_Unpack_external ((YogiFn_MPI_Unpack_external) yogiSymbol(YOGI_SYM_MPI_Unpack_external, "MPI_Unpack_external"))
+#define MPI_Unpublish_name ((YogiFn_MPI_Unpublish_name) yogiSymbol(YOGI_SYM_MPI_Unpublish_name, "MPI_Unpublish_name"))
+#define MPI_Wait ((YogiFn_MPI_Wait) yogiSymbol(YOGI_SYM_MPI_Wait, "MPI_Wait"))
+#define MPI_Waitall ((YogiFn_MPI_Waitall) yogiSymbol(YOGI_SYM_MPI_Waitall, "MPI_Waitall"))
+#define MPI_Waitany ((YogiFn_MPI_Waitany) yogiSymbol(YOGI_SYM_MPI_Waitany, "MPI_Waitany"))
+#define MPI_Waitsome ((YogiFn_MPI_Waitsome) yogiSymbol(YOGI_SYM_MPI_Waitsome, "MPI_Waitsome"))
+#define MPI_Win_allocate ((YogiFn_MPI_Win_allocate) yogiSymbol(YOGI_SYM_MPI_Win_allocate, "MPI_Win_allocate"))
+#define MPI_Win_allocate_shared ((YogiFn_MPI_Win_allocate_shared) yogiSymbol(YOGI_SYM_MPI_Win_allocate_shared, "MPI_Win_allocate_shared"))
+#define MPI_Win_attach ((YogiFn_MPI_Win_attach) yogiSymbol(YOGI_SYM_MPI_Win_attach, "MPI_Win_attach"))
+#define MPI_Win_call_errhandler ((YogiFn_MPI_Win_call_errhandler) yogiSymbol(YOGI_SYM_MPI_Win_call_errhandler, "MPI_Win_call_errhandler"))
+#define MPI_Win_complete ((YogiFn_MPI_Win_complete) yogiSymbol(YOGI_SYM_MPI_Win_complete, "MPI_Win_complete"))
+#define MPI_Win_create ((YogiFn_MPI_Win_create) yogiSymbol(YOGI_SYM_MPI_Win_create, "MPI_Win_create"))
+#define MPI_Win_create_dynamic ((YogiFn_MPI_Win_create_dynamic) yogiSymbol(YOGI_SYM_MPI_Win_create_dynamic, "MPI_Win_create_dynamic"))
+#define MPI_Win_create_errhandler ((YogiFn_MPI_Win_create_errhandler) yogiSymbol(YOGI_SYM_MPI_Win_create_errhandler, "MPI_Win_create_errhandler"))
+#define MPI_Win_create_keyval ((YogiFn_MPI_Win_create_keyval) yogiSymbol(YOGI_SYM_MPI_Win_create_keyval, "MPI_Win_create_keyval"))
+#define MPI_Win_delete_attr ((YogiFn_MPI_Win_delete_attr) yogiSymbol(YOGI_SYM_MPI_Win_delete_attr, "MPI_Win_delete_attr"))
+#define MPI_Win_detach ((YogiFn_MPI_Win_detach) yogiSymbol(YOGI_SYM_MPI_Win_detach, "MPI_Win_detach"))
+#define MPI_Win_fence ((YogiFn_MPI_Win_fence) yogiSymbol(YOGI_SYM_MPI_Win_fence, "MPI_Win_fence"))
+#define MPI_Win_flush ((YogiFn_MPI_Win_flush) yogiSymbol(YOGI_SYM_MPI_Win_flush, "MPI_Win_flush"))
+#define MPI_Win_flush_all ((YogiFn_MPI_Win_flush_all) yogiSymbol(YOGI_SYM_MPI_Win_flush_all, "MPI_Win_flush_all"))
+#define MPI_Win_flush_local ((YogiFn_MPI_Win_flush_local) yogiSymbol(YOGI_SYM_MPI_Win_flush_local, "MPI_Win_flush_local"))
+#define MPI_Win_flush_local_all ((YogiFn_MPI_Win_flush_local_all) yogiSymbol(YOGI_SYM_MPI_Win_flush_local_all, "MPI_Win_flush_local_all"))
+#define MPI_Win_free ((YogiFn_MPI_Win_free) yogiSymbol(YOGI_SYM_MPI_Win_free, "MPI_Win_free"))
+#define MPI_Win_free_keyval ((YogiFn_MPI_Win_free_keyval) yogiSymbol(YOGI_SYM_MPI_Win_free_keyval, "MPI_Win_free_keyval"))
+#define MPI_Win_get_attr ((YogiFn_MPI_Win_get_attr) yogiSymbol(YOGI_SYM_MPI_Win_get_attr, "MPI_Win_get_attr"))
+#define MPI_Win_get_errhandler ((YogiFn_MPI_Win_get_errhandler) yogiSymbol(YOGI_SYM_MPI_Win_get_errhandler, "MPI_Win_get_errhandler"))
+#define MPI_Win_get_group ((YogiFn_MPI_Win_get_group) yogiSymbol(YOGI_SYM_MPI_Win_get_group, "MPI_Win_get_group"))
+#define MPI_Win_get_info ((YogiFn_MPI_Win_get_info) yogiSymbol(YOGI_SYM_MPI_Win_get_info, "MPI_Win_get_info"))
+#define MPI_Win_get_name ((YogiFn_MPI_Win_get_name) yogiSymbol(YOGI_SYM_MPI_Win_get_name, "MPI_Win_get_name"))
+#define MPI_Win_lock ((YogiFn_MPI_Win_lock) yogiSymbol(YOGI_SYM_MPI_Win_lock, "MPI_Win_lock"))
+#define MPI_Win_lock_all ((YogiFn_MPI_Win_lock_all) yogiSymbol(YOGI_SYM_MPI_Win_lock_all, "MPI_Win_lock_all"))
+#define MPI_Win_post ((YogiFn_MPI_Win_post) yogiSymbol(YOGI_SYM_MPI_Win_post, "MPI_Win_post"))
+#define MPI_Win_set_attr ((YogiFn_MPI_Win_set_attr) yogiSymbol(YOGI_SYM_MPI_Win_set_attr, "MPI_Win_set_attr"))
+#define MPI_Win_set_errhandler ((YogiFn_MPI_Win_set_errhandler) yogiSymbol(YOGI_SYM_MPI_Win_set_errhandler, "MPI_Win_set_errhandler"))
+#define MPI_Win_set_info ((YogiFn_MPI_Win_set_info) yogiSymbol(YOGI_SYM_MPI_Win_set_info, "MPI_Win_set_info"))
+#define MPI_Win_set_name ((YogiFn_MPI_Win_set_name) yogiSymbol(YOGI_SYM_MPI_Win_set_name, "MPI_Win_set_name"))
+#define MPI_Win_shared_query ((YogiFn_MPI_Win_shared_query) yogiSymbol(YOGI_SYM_MPI_Win_shared_query, "MPI_Win_shared_query"))
+#define MPI_Win_start ((YogiFn_MPI_Win_start) yogiSymbol(YOGI_SYM_MPI_Win_start, "MPI_Win_start"))
+#define MPI_Win_sync ((YogiFn_MPI_Win_sync) yogiSymbol(YOGI_SYM_MPI_Win_sync, "MPI_Win_sync"))
+#define MPI_Win_test ((YogiFn_MPI_Win_test) yogiSymbol(YOGI_SYM_MPI_Win_test, "MPI_Win_test"))
+#define MPI_Win_unlock ((YogiFn_MPI_Win_unlock) yogiSymbol(YOGI_SYM_MPI_Win_unlock, "MPI_Win_unlock"))
+#define MPI_Win_unlock_all ((YogiFn_MPI_Win_unlock_all) yogiSymbol(YOGI_SYM_MPI_Win_unlock_all, "MPI_Win_unlock_all"))
+#define MPI_Win_wait ((YogiFn_MPI_Win_wait) yogiSymbol(YOGI_SYM_MPI_Win_wait, "MPI_Win_wait"))
+
+
+#endif
@@ -0,0 +1,1816 @@
+/* File to bind YogiMPI C functions to Fortran. */
+
+#include "yogimpi.h"
+#include <cstring>
+
+/* Copies a character array from Fortran into one that has a null terminator.
+   The C character array is allocated on the heap. */
+static char * copy_and_add_null_terminator(char *f_string, int slen) {
+    char * c_string = new char[slen + 1];
+    std::strncpy(c_string, f_string, slen);
+    c_string[slen] = '\0';
+    return c_string;
+}
+
+/* Allocates a character array in C of a specified size, plus adds one more
+   for another null terminator.  Does no copying.  The C character array is
+   allocated on the heap. */
+static char * allocate_and_add_null_terminator(char *f_string, int slen) {
+    char * c_string = new char[slen + 1];
+    c_string[slen] = '\0';
+    return c_string;
+}
+
+/* Copies a C character array with a null terminator back into a Fortran
+   character array (in-place), removing the null terminator.
+   @param f_string The Fortran character array to which contents are copied.
+   @param c_string The C string from which to copy.
+   @param slen The original size of the Fortran character array. */
+void copy_without_null_terminator(char *f_string, char *c_string, int slen) {
+    int clen = std::strlen(c_string);
+    if (clen < slen) {
+        std::strncpy(f_string, c_string, clen);
+        // Pad remaining spaces in Fortran string
+        int toPad = slen - clen;
+        int i;
+        for (i = clen; i < slen - 1; i++) {
+            f_string[i] = ' ';
+        }
+    }
+    else std::strncpy(f_string, c_string, slen);
+}
+
+extern "C" {
+
+/* Define how the C functions will appear to Fortran.  Typically this is all
+   lowercase, with an additional underscore at the end. */
+
+/* Access common block data from Fortran to determine the address of the
+   MPI_STATUS_IGNORE and MPI_STATUSES_IGNORE. */
+
+extern struct {
+    YogiMPI_Status fignore;
+    YogiMPI_Status fignore_array;
+} ympi1_;
+
+extern struct {
+    int in_place;
+    int bottom;
+} ympi2_;
+
+/* Compares an integer pointer from Fortran to those defined in common blocks
+   for YogiMPI_STATUS_IGNORE and YogiMPI_STATUSES_IGNORE in Fortran.  Returns
+   the original pointer address or a suitable IGNORE value in C. */
+static YogiMPI_Status * check_status_ignore(YogiMPI_Status *fort_status) {
+    if ((void *)fort_status == (void *)&(ympi1_.fignore)) {
+        return YogiMPI_STATUS_IGNORE;
+    }
+    if ((void *)fort_status == (void *)&(ympi1_.fignore_array)) {
+        return YogiMPI_STATUSES_IGNORE;
+    }
+    return fort_status;
+}
+
+/* Compares an integer pointer from Fortran to those defined in common blocks
+   for YogiMPI_BOTTOM and YogiMPI_IN_PLACE. Returns either the original pointer
+   address or one of the two pointer constants in C. */
+static void * check_ptr_constant(void *fort_loc) {
+    if (fort_loc == (void *)&(ympi2_.bottom)) {
+        return YogiMPI_BOTTOM;
+    }
+    else if (fort_loc == (void *)&(ympi2_.in_place)) {
+        return YogiMPI_IN_PLACE;
+    }
+    return fort_loc;
+}
+
+#define YOGIBRIDGE_INIT yogibridge_init_
+#define YOGIBRIDGE_INIT_THREAD yogibridge_init_thread_
+#define YOGIBRIDGE_FINALIZE yogibridge_finalize_
+#define YOGIBRIDGE_GET_PROCESSOR_NAME yogibridge_get_processor_name_
+#define YOGIBRIDGE_ERROR_STRING yogibridge_error_string_
+#define YOG_WTIME yog_wtime_
+#define YOG_WTICK yog_wtick_
+
+#define YOGIBRIDGE_ABORT yogibridge_abort_
+#define YOGIBRIDGE_ACCUMULATE yogibridge_accumulate_
+#define YOGIBRIDGE_ADD_ERROR_CLASS yogibridge_add_error_class_
+#define YOGIBRIDGE_ADD_ERROR_CODE yogibridge_add_error_code_
+#define YOGIBRIDGE_ADD_ERROR_STRING yogibridge_add_error_string_
+#define YOGIBRIDGE_ADDRESS yogibridge_address_
+#define YOGIBRIDGE_ALLGATHER yogibridge_allgather_
+#define YOGIBRIDGE_ALLGATHERV yogibridge_allgatherv_
+#define YOGIBRIDGE_ALLOC_MEM yogibridge_alloc_mem_
+#define YOGIBRIDGE_ALLREDUCE yogibridge_allreduce_
+#define YOGIBRIDGE_ALLTOALL yogibridge_alltoall_
+#define YOGIBRIDGE_ALLTOALLV yogibridge_alltoallv_
+#define YOGIBRIDGE_ALLTOALLW yogibridge_alltoallw_
+#define YOGIBRIDGE_ATTR_DELETE yogibridge_attr_delete_
+#define YOGIBRIDGE_ATTR_GET yogibridge_attr_get_
+#define YOGIBRIDGE_ATTR_PUT yogibridge_attr_put_
+#define YOGIBRIDGE_BARRIER yogibridge_barrier_
+#define YOGIBRIDGE_BCAST yogibridge_bcast_
+#define YOGIBRIDGE_BSEND yogibridge_bsend_
+#define YOGIBRIDGE_BSEND_INIT yogibridge_bsend_init_
+#define YOGIBRIDGE_BUFFER_ATTACH yogibridge_buffer_attach_
+#define YOGIBRIDGE_BUFFER_DETACH yogibridge_buffer_detach_
+#define YOGIBRIDGE_CANCEL yogibridge_cancel_
+#define YOGIBRIDGE_CART_COORDS yogibridge_cart_coords_
+#define YOGIBRIDGE_CART_CREATE yogibridge_cart_create_
+#define YOGIBRIDGE_CART_GET yogibridge_cart_get_
+#define YOGIBRIDGE_CART_MAP yogibridge_cart_map_
+#define YOGIBRIDGE_CART_RANK yogibridge_cart_rank_
+#define YOGIBRIDGE_CART_SHIFT yogibridge_cart_shift_
+#define YOGIBRIDGE_CART_SUB yogibridge_cart_sub_
+#define YOGIBRIDGE_CARTDIM_GET yogibridge_cartdim_get_
+#define YOGIBRIDGE_CLOSE_PORT yogibridge_close_port_
+#define YOGIBRIDGE_COMM_ACCEPT yogibridge_comm_accept_
+#define YOGIBRIDGE_COMM_CALL_ERRHANDLER yogibridge_comm_call_errhandler_
+#define YOGIBRIDGE_COMM_COMPARE yogibridge_comm_compare_
+#define YOGIBRIDGE_COMM_CONNECT yogibridge_comm_connect_
+#define YOGIBRIDGE_COMM_CREATE yogibridge_comm_create_
+#define YOGIBRIDGE_COMM_CREATE_GROUP yogibridge_comm_create_group_
+#define YOGIBRIDGE_COMM_DELETE_ATTR yogibridge_comm_delete_attr_
+#define YOGIBRIDGE_COMM_DISCONNECT yogibridge_comm_disconnect_
+#define YOGIBRIDGE_COMM_DUP yogibridge_comm_dup_
+#define YOGIBRIDGE_COMM_DUP_WITH_INFO yogibridge_comm_dup_with_info_
+#define YOGIBRIDGE_COMM_FREE yogibridge_comm_free_
+#define YOGIBRIDGE_COMM_FREE_KEYVAL yogibridge_comm_free_keyval_
+#define YOGIBRIDGE_COMM_GET_ATTR yogibridge_comm_get_attr_
+#define YOGIBRIDGE_COMM_GET_ERRHANDLER yogibridge_comm_get_errhandler_
+#define YOGIBRIDGE_COMM_GET_INFO yogibridge_comm_get_info_
+#define YOGIBRIDGE_COMM_GET_NAME yogibridge_comm_get_name_
+#define YOGIBRIDGE_COMM_GET_PARENT yogibridge_comm_get_parent_
+#define YOGIBRIDGE_COMM_GROUP yogibridge_comm_group_
+#define YOGIBRIDGE_COMM_IDUP yogibridge_comm_idup_
+#define YOGIBRIDGE_COMM_JOIN yogibridge_comm_join_
+#define YOGIBRIDGE_COMM_RANK yogibridge_comm_rank_
+#define YOGIBRIDGE_COMM_REMOTE_GROUP yogibridge_comm_remote_group_
+#define YOGIBRIDGE_COMM_REMOTE_SIZE yogibridge_comm_remote_size_
+#define YOGIBRIDGE_COMM_SET_ATTR yogibridge_comm_set_attr_
+#define YOGIBRIDGE_COMM_SET_ERRHANDLER yogibridge_comm_set_errhandler_
+#define YOGIBRIDGE_COMM_SET_INFO yogibridge_comm_set_info_
+#define YOGIBRIDGE_COMM_SET_NAME yogibridge_comm_set_name_
+#define YOGIBRIDGE_COMM_SIZE yogibridge_comm_size_
+#define YOGIBRIDGE_COMM_SPLIT yogibridge_comm_split_
+#define YOGIBRIDGE_COMM_SPLIT_TYPE yogibridge_comm_split_type_
+#define YOGIBRIDGE_COMM_TEST_INTER yogibridge_comm_test_inter_
+#define YOGIBRIDGE_COMPARE_AND_SWAP yogibridge_compare_and_swap_
+#define YOGIBRIDGE_DIMS_CREATE yogibridge_dims_create_
+#define YOGIBRIDGE_DIST_GRAPH_CREATE yogibridge_dist_graph_create_
+#define YOGIBRIDGE_DIST_GRAPH_CREATE_ADJACENT yogibridge_dist_graph_create_adjacent_
+#define YOGIBRIDGE_DIST_GRAPH_NEIGHBORS yogibridge_dist_graph_neighbors_
+#define YOGIBRIDGE_DIST_GRAPH_NEIGHBORS_COUNT yogibridge_dist_graph_neighbors_count_
+#define YOGIBRIDGE_ERRHANDLER_FREE yogibridge_errhandler_free_
+#define YOGIBRIDGE_ERRHANDLER_GET yogibridge_errhandler_get_
+#define YOGIBRIDGE_ERRHANDLER_SET yogibridge_errhandler_set_
+#define YOGIBRIDGE_EXSCAN yogibridge_exscan_
+#define YOGIBRIDGE_FETCH_AND_OP yogibridge_fetch_and_op_
+#define YOGIBRIDGE_FILE_CALL_ERRHANDLER yogibridge_file_call_errhandler_
+#define YOGIBRIDGE_FILE_CLOSE yogibridge_file_close_
+#define YOGIBRIDGE_FILE_DELETE yogibridge_file_delete_
+#define YOGIBRIDGE_FILE_GET_AMODE yogibridge_file_get_amode_
+#define YOGIBRIDGE_FILE_GET_ATOMICITY yogibridge_file_get_atomicity_
+#define YOGIBRIDGE_FILE_GET_BYTE_OFFSET yogibridge_file_get_byte_offset_
+#define YOGIBRIDGE_FILE_GET_ERRHANDLER yogibridge_file_get_errhandler_
+#define YOGIBRIDGE_FILE_GET_GROUP yogibridge_file_get_group_
+#define YOGIBRIDGE_FILE_GET_INFO yogibridge_file_get_info_
+#define YOGIBRIDGE_FILE_GET_POSITION yogibridge_file_get_position_
+#define YOGIBRIDGE_FILE_GET_POSITION_SHARED yogibridge_file_get_position_shared_
+#define YOGIBRIDGE_FILE_GET_SIZE yogibridge_file_get_size_
+#define YOGIBRIDGE_FILE_GET_TYPE_EXTENT yogibridge_file_get_type_extent_
+#define YOGIBRIDGE_FILE_GET_VIEW yogibridge_file_get_view_
+#define YOGIBRIDGE_FILE_IREAD yogibridge_file_iread_
+#define YOGIBRIDGE_FILE_IREAD_AT yogibridge_file_iread_at_
+#define YOGIBRIDGE_FILE_IREAD_SHARED yogibridge_file_iread_shared_
+#define YOGIBRIDGE_FILE_IWRITE yogibridge_file_iwrite_
+#define YOGIBRIDGE_FILE_IWRITE_AT yogibridge_file_iwrite_at_
+#define YOGIBRIDGE_FILE_IWRITE_SHARED yogibridge_file_iwrite_shared_
+#define YOGIBRIDGE_FILE_OPEN yogibridge_file_open_
+#define YOGIBRIDGE_FILE_PREALLOCATE yogibridge_file_preallocate_
+#define YOGIBRIDGE_FILE_READ yogibridge_file_read_
+#define YOGIBRIDGE_FILE_READ_ALL yogibridge_file_read_all_
+#define YOGIBRIDGE_FILE_READ_ALL_BEGIN yogibridge_file_read_all_begin_
+#define YOGIBRIDGE_FILE_READ_ALL_END yogibridge_file_read_all_end_
+#define YOGIBRIDGE_FILE_READ_AT yogibridge_file_read_at_
+#define YOGIBRIDGE_FILE_READ_AT_ALL yogibridge_file_read_at_all_
+#define YOGIBRIDGE_FILE_READ_AT_ALL_BEGIN yogibridge_file_read_at_all_begin_
+#define YOGIBRIDGE_FILE_READ_AT_ALL_END yogibridge_file_read_at_all_end_
+#define YOGIBRIDGE_FILE_READ_ORDERED yogibridge_file_read_ordered_
+#define YOGIBRIDGE_FILE_READ_ORDERED_BEGIN yogibridge_file_read_ordered_begin_
+#define YOGIBRIDGE_FILE_READ_ORDERED_END yogibridge_file_read_ordered_end_
+#define YOGIBRIDGE_FILE_READ_SHARED yogibridge_file_read_shared_
+#define YOGIBRIDGE_FILE_SEEK yogibridge_file_seek_
+#define YOGIBRIDGE_FILE_SEEK_SHARED yogibridge_file_seek_shared_
+#define YOGIBRIDGE_FILE_SET_ATOMICITY yogibridge_file_set_atomicity_
+#define YOGIBRIDGE_FILE_SET_ERRHANDLER yogibridge_file_set_errhandler_
+#define YOGIBRIDGE_FILE_SET_INFO yogibridge_file_set_info_
+#define YOGIBRIDGE_FILE_SET_SIZE yogibridge_file_set_size_
+#define YOGIBRIDGE_FILE_SET_VIEW yogibridge_file_set_view_
+#define YOGIBRIDGE_FILE_SYNC yogibridge_file_sync_
+#define YOGIBRIDGE_FILE_WRITE yogibridge_file_write_
+#define YOGIBRIDGE_FILE_WRITE_ALL yogibridge_file_write_all_
+#define YOGIBRIDGE_FILE_WRITE_ALL_BEGIN yogibridge_file_write_all_begin_
+#define YOGIBRIDGE_FILE_WRITE_ALL_END yogibridge_file_write_all_end_
+#define YOGIBRIDGE_FILE_WRITE_AT yogibridge_file_write_at_
+#define YOGIBRIDGE_FILE_WRITE_AT_ALL yogibridge_file_write_at_all_
+#define YOGIBRIDGE_FILE_WRITE_AT_ALL_BEGIN yogibridge_file_write_at_all_begin_
+#define YOGIBRIDGE_FILE_WRITE_AT_ALL_END yogibridge_file_write_at_all_end_
+#define YOGIBRIDGE_FILE_WRITE_ORDERED yogibridge_file_write_ordered_
+#define YOGIBRIDGE_FILE_WRITE_ORDERED_BEGIN yogibridge_file_write_ordered_begin_
+#define YOGIBRIDGE_FILE_WRITE_ORDERED_END yogibridge_file_write_ordered_end_
+#define YOGIBRIDGE_FILE_WRITE_SHARED yogibridge_file_write_shared_
+#define YOGIBRIDGE_FINALIZED yogibridge_finalized_
+#define YOGIBRIDGE_FREE_MEM yogibridge_free_mem_
+#define YOGIBRIDGE_GATHER yogibridge_gather_
+#define YOGIBRIDGE_GATHERV yogibridge_gatherv_
+#define YOGIBRIDGE_GET yogibridge_get_
+#define YOGIBRIDGE_GET_ACCUMULATE yogibridge_get_accumulate_
+#define YOGIBRIDGE_GET_ADDRESS yogibridge_get_address_
+#define YOGIBRIDGE_GET_COUNT yogibridge_get_count_
+#define YOGIBRIDGE_GET_ELEMENTS yogibridge_get_elements_
+#define YOGIBRIDGE_GET_LIBRARY_VERSION yogibridge_get_library_version_
+#define YOGIBRIDGE_GET_VERSION yogibridge_get_version_
+#define YOGIBRIDGE_GRAPH_CREATE yogibridge_graph_create_
+#define YOGIBRIDGE_GRAPH_GET yogibridge_graph_get_
+#define YOGIBRIDGE_GRAPH_MAP yogibridge_graph_map_
+#define YOGIBRIDGE_GRAPH_NEIGHBORS yogibridge_graph_neighbors_
+#define YOGIBRIDGE_GRAPH_NEIGHBORS_COUNT yogibridge_graph_neighbors_count_
+#define YOGIBRIDGE_GRAPHDIMS_GET yogibridge_graphdims_get_
+#define YOGIBRIDGE_GREQUEST_COMPLETE yogibridge_grequest_complete_
+#define YOGIBRIDGE_GROUP_COMPARE yogibridge_group_compare_
+#define YOGIBRIDGE_GROUP_DIFFERENCE yogibridge_group_difference_
+#define YOGIBRIDGE_GROUP_EXCL yogibridge_group_excl_
+#define YOGIBRIDGE_GROUP_FREE yogibridge_group_free_
+#define YOGIBRIDGE_GROUP_INCL yogibridge_group_incl_
+#define YOGIBRIDGE_GROUP_INTERSECTION yogibridge_group_intersection_
+#define YOGIBRIDGE_GROUP_RANK yogibridge_group_rank_
+#define YOGIBRIDGE_GROUP_SIZE yogibridge_group_size_
+#define YOGIBRIDGE_GROUP_TRANSLATE_RANKS yogibridge_group_translate_ranks_
+#define YOGIBRIDGE_GROUP_UNION yogibridge_group_union_
+#define YOGIBRIDGE_IALLGATHER yogibridge_iallgather_
+#define YOGIBRIDGE_IALLGATHERV yogibridge_iallgatherv_
+#define YOGIBRIDGE_IALLREDUCE yogibridge_iallreduce_
+#define YOGIBRIDGE_IALLTOALL yogibridge_ialltoall_
+#define YOGIBRIDGE_IALLTOALLV yogibridge_ialltoallv_
+#define YOGIBRIDGE_IALLTOALLW yogibridge_ialltoallw_
+#define YOGIBRIDGE_IBARRIER yogibridge_ibarrier_
+#define YOGIBRIDGE_IBCAST yogibridge_ibcast_
+#define YOGIBRIDGE_IBSEND yogibridge_ibsend_
+#define YOGIBRIDGE_IEXSCAN yogibridge_iexscan_
+#define YOGIBRIDGE_IGATHER yogibridge_igather_
+#define YOGIBRIDGE_IGATHERV yogibridge_igatherv_
+#define YOGIBRIDGE_INEIGHBOR_ALLGATHER yogibridge_ineighbor_allgather_
+#define YOGIBRIDGE_INEIGHBOR_ALLGATHERV yogibridge_ineighbor_allgatherv_
+#define YOGIBRIDGE_INEIGHBOR_ALLTOALL yogibridge_ineighbor_alltoall_
+#define YOGIBRIDGE_INEIGHBOR_ALLTOALLV yogibridge_ineighbor_alltoallv_
+#define YOGIBRIDGE_INEIGHBOR_ALLTOALLW yogibridge_ineighbor_alltoallw_
+#define YOGIBRIDGE_INFO_CREATE yogibridge_info_create_
+#define YOGIBRIDGE_INFO_DELETE yogibridge_info_delete_
+#define YOGIBRIDGE_INFO_DUP yogibridge_info_dup_
+#define YOGIBRIDGE_INFO_FREE yogibridge_info_free_
+#define YOGIBRIDGE_INFO_GET yogibridge_info_get_
+#define YOGIBRIDGE_INFO_GET_NKEYS yogibridge_info_get_nkeys_
+#define YOGIBRIDGE_INFO_GET_NTHKEY yogibridge_info_get_nthkey_
+#define YOGIBRIDGE_INFO_GET_VALUELEN yogibridge_info_get_valuelen_
+#define YOGIBRIDGE_INFO_SET yogibridge_info_set_
+#define YOGIBRIDGE_INITIALIZED yogibridge_initialized_
+#define YOGIBRIDGE_INTERCOMM_CREATE yogibridge_intercomm_create_
+#define YOGIBRIDGE_INTERCOMM_MERGE yogibridge_intercomm_merge_
+#define YOGIBRIDGE_IPROBE yogibridge_iprobe_
+#define YOGIBRIDGE_IRECV yogibridge_irecv_
+#define YOGIBRIDGE_IREDUCE yogibridge_ireduce_
+#define YOGIBRIDGE_IREDUCE_SCATTER yogibridge_ireduce_scatter_
+#define YOGIBRIDGE_IREDUCE_SCATTER_BLOCK yogibridge_ireduce_scatter_block_
+#define YOGIBRIDGE_IRSEND yogibridge_irsend_
+#define YOGIBRIDGE_IS_THREAD_MAIN yogibridge_is_thread_main_
+#define YOGIBRIDGE_ISCAN yogibridge_iscan_
+#define YOGIBRIDGE_ISCATTER yogibridge_iscatter_
+#define YOGIBRIDGE_ISCATTERV yogibridge_iscatterv_
+#define YOGIBRIDGE_ISEND yogibridge_isend_
+#define YOGIBRIDGE_ISSEND yogibridge_issend_
+#define YOGIBRIDGE_KEYVAL_FREE yogibridge_keyval_free_
+#define YOGIBRIDGE_LOOKUP_NAME yogibridge_lookup_name_
+#define YOGIBRIDGE_NEIGHBOR_ALLGATHER yogibridge_neighbor_allgather_
+#define YOGIBRIDGE_NEIGHBOR_ALLGATHERV yogibridge_neighbor_allgatherv_
+#define YOGIBRIDGE_NEIGHBOR_ALLTOALL yogibridge_neighbor_alltoall_
+#define YOGIBRIDGE_NEIGHBOR_ALLTOALLV yogibridge_neighbor_alltoallv_
+#define YOGIBRIDGE_NEIGHBOR_ALLTOALLW yogibridge_neighbor_alltoallw_
+#define YOGIBRIDGE_OP_COMMUTATIVE yogibridge_op_commutative_
+#define YOGIBRIDGE_OP_FREE yogibridge_op_free_
+#define YOGIBRIDGE_OPEN_PORT yogibridge_open_port_
+#define YOGIBRIDGE_PACK yogibridge_pack_
+#define YOGIBRIDGE_PACK_EXTERNAL yogibridge_pack_external_
+#define YOGIBRIDGE_PACK_EXTERNAL_SIZE yogibridge_pack_external_size_
+#define YOGIBRIDGE_PACK_SIZE yogibridge_pack_size_
+#define YOGIBRIDGE_PCONTROL yogibridge_pcontrol_
+#define YOGIBRIDGE_PROBE yogibridge_probe_
+#define YOGIBRIDGE_PUBLISH_NAME yogibridge_publish_name_
+#define YOGIBRIDGE_PUT yogibridge_put_
+#define YOGIBRIDGE_QUERY_THREAD yogibridge_query_thread_
+#define YOGIBRIDGE_RACCUMULATE yogibridge_raccumulate_
+#define YOGIBRIDGE_RECV yogibridge_recv_
+#define YOGIBRIDGE_RECV_INIT yogibridge_recv_init_
+#define YOGIBRIDGE_REDUCE yogibridge_reduce_
+#define YOGIBRIDGE_REDUCE_LOCAL yogibridge_reduce_local_
+#define YOGIBRIDGE_REDUCE_SCATTER yogibridge_reduce_scatter_
+#define YOGIBRIDGE_REDUCE_SCATTER_BLOCK yogibridge_reduce_scatter_block_
+#define YOGIBRIDGE_REQUEST_FREE yogibridge_request_free_
+#define YOGIBRIDGE_REQUEST_GET_STATUS yogibridge_request_get_status_
+#define YOGIBRIDGE_RGET yogibridge_rget_
+#define YOGIBRIDGE_RGET_ACCUMULATE yogibridge_rget_accumulate_
+#define YOGIBRIDGE_RPUT yogibridge_rput_
+#define YOGIBRIDGE_RSEND yogibridge_rsend_
+#define YOGIBRIDGE_RSEND_INIT yogibridge_rsend_init_
+#define YOGIBRIDGE_SCAN yogibridge_scan_
+#define YOGIBRIDGE_SCATTER yogibridge_scatter_
+#define YOGIBRIDGE_SCATTERV yogibridge_scatterv_
+#define YOGIBRIDGE_SEND yogibridge_send_
+#define YOGIBRIDGE_SEND_INIT yogibridge_send_init_
+#define YOGIBRIDGE_SENDRECV yogibridge_sendrecv_
+#define YOGIBRIDGE_SENDRECV_REPLACE yogibridge_sendrecv_replace_
+#define YOGIBRIDGE_SSEND yogibridge_ssend_
+#define YOGIBRIDGE_SSEND_INIT yogibridge_ssend_init_
+#define YOGIBRIDGE_START yogibridge_start_
+#define YOGIBRIDGE_STARTALL yogibridge_startall_
+#define YOGIBRIDGE_STATUS_SET_CANCELLED yogibridge_status_set_cancelled_
+#define YOGIBRIDGE_STATUS_SET_ELEMENTS yogibridge_status_set_elements_
+#define YOGIBRIDGE_TEST yogibridge_test_
+#define YOGIBRIDGE_TEST_CANCELLED yogibridge_test_cancelled_
+#define YOGIBRIDGE_TESTALL yogibridge_testall_
+#define YOGIBRIDGE_TESTANY yogibridge_testany_
+#define YOGIBRIDGE_TESTSOME yogibridge_testsome_
+#define YOGIBRIDGE_TOPO_TEST yogibridge_topo_test_
+#define YOGIBRIDGE_TYPE_COMMIT yogibridge_type_commit_
+#define YOGIBRIDGE_TYPE_CONTIGUOUS yogibridge_type_contiguous_
+#define YOGIBRIDGE_TYPE_CREATE_HINDEXED yogibridge_type_create_hindexed_
+#define YOGIBRIDGE_TYPE_CREATE_HINDEXED_BLOCK yogibridge_type_create_hindexed_block_
+#define YOGIBRIDGE_TYPE_CREATE_HVECTOR yogibridge_type_create_hvector_
+#define YOGIBRIDGE_TYPE_CREATE_INDEXED_BLOCK yogibridge_type_create_indexed_block_
+#define YOGIBRIDGE_TYPE_CREATE_RESIZED yogibridge_type_create_resized_
+#define YOGIBRIDGE_TYPE_CREATE_STRUCT yogibridge_type_create_struct_
+#define YOGIBRIDGE_TYPE_CREATE_SUBARRAY yogibridge_type_create_subarray_
+#define YOGIBRIDGE_TYPE_DELETE_ATTR yogibridge_type_delete_attr_
+#define YOGIBRIDGE_TYPE_DUP yogibridge_type_dup_
+#define YOGIBRIDGE_TYPE_EXTENT yogibridge_type_extent_
+#define YOGIBRIDGE_TYPE_FREE yogibridge_type_free_
+#define YOGIBRIDGE_TYPE_FREE_KEYVAL yogibridge_type_free_keyval_
+#define YOGIBRIDGE_TYPE_GET_ATTR yogibridge_type_get_attr_
+#define YOGIBRIDGE_TYPE_GET_ENVELOPE yogibridge_type_get_envelope_
+#define YOGIBRIDGE_TYPE_GET_EXTENT yogibridge_type_get_extent_
+#define YOGIBRIDGE_TYPE_GET_NAME yogibridge_type_get_name_
+#define YOGIBRIDGE_TYPE_GET_TRUE_EXTENT yogibridge_type_get_true_extent_
+#define YOGIBRIDGE_TYPE_HINDEXED yogibridge_type_hindexed_
+#define YOGIBRIDGE_TYPE_HVECTOR yogibridge_type_hvector_
+#define YOGIBRIDGE_TYPE_INDEXED yogibridge_type_indexed_
+#define YOGIBRIDGE_TYPE_LB yogibridge_type_lb_
+#define YOGIBRIDGE_TYPE_MATCH_SIZE yogibridge_type_match_size_
+#define YOGIBRIDGE_TYPE_SET_ATTR yogibridge_type_set_attr_
+#define YOGIBRIDGE_TYPE_SET_NAME yogibridge_type_set_name_
+#define YOGIBRIDGE_TYPE_SIZE yogibridge_type_size_
+#define YOGIBRIDGE_TYPE_STRUCT yogibridge_type_struct_
+#define YOGIBRIDGE_TYPE_UB yogibridge_type_ub_
+#define YOGIBRIDGE_TYPE_VECTOR yogibridge_type_vector_
+#define YOGIBRIDGE_UNPACK yogibridge_unpack_
+#define YOGIBRIDGE_UNPACK_EXTERNAL yogibridge_unpack_external_
+#define YOGIBRIDGE_UNPUBLISH_NAME yogibridge_unpublish_name_
+#define YOGIBRIDGE_WAIT yogibridge_wait_
+#define YOGIBRIDGE_WAITALL yogibridge_waitall_
+#define YOGIBRIDGE_WAITANY yogibridge_waitany_
+#define YOGIBRIDGE_WAITSOME yogibridge_waitsome_
+#define YOGIBRIDGE_WIN_ALLOCATE yogibridge_win_allocate_
+#define YOGIBRIDGE_WIN_ALLOCATE_SHARED yogibridge_win_allocate_shared_
+#define YOGIBRIDGE_WIN_ATTACH yogibridge_win_attach_
+#define YOGIBRIDGE_WIN_CALL_ERRHANDLER yogibridge_win_call_errhandler_
+#define YOGIBRIDGE_WIN_COMPLETE yogibridge_win_complete_
+#define YOGIBRIDGE_WIN_CREATE yogibridge_win_create_
+#define YOGIBRIDGE_WIN_CREATE_DYNAMIC yogibridge_win_create_dynamic_
+#define YOGIBRIDGE_WIN_DELETE_ATTR yogibridge_win_delete_attr_
+#define YOGIBRIDGE_WIN_DETACH yogibridge_win_detach_
+#define YOGIBRIDGE_WIN_FENCE yogibridge_win_fence_
+#define YOGIBRIDGE_WIN_FLUSH yogibridge_win_flush_
+#define YOGIBRIDGE_WIN_FLUSH_ALL yogibridge_win_flush_all_
+#define YOGIBRIDGE_WIN_FLUSH_LOCAL yogibridge_win_flush_local_
+#define YOGIBRIDGE_WIN_FLUSH_LOCAL_ALL yogibridge_win_flush_local_all_
+#define YOGIBRIDGE_WIN_FREE yogibridge_win_free_
+#define YOGIBRIDGE_WIN_FREE_KEYVAL yogibridge_win_free_keyval_
+#define YOGIBRIDGE_WIN_GET_ATTR yogibridge_win_get_attr_
+#define YOGIBRIDGE_WIN_GET_ERRHANDLER yogibridge_win_get_errhandler_
+#define YOGIBRIDGE_WIN_GET_GROUP yogibridge_win_get_group_
+#define YOGIBRIDGE_WIN_GET_INFO yogibridge_win_get_info_
+#define YOGIBRIDGE_WIN_GET_NAME yogibridge_win_get_name_
+#define YOGIBRIDGE_WIN_LOCK yogibridge_win_lock_
+#define YOGIBRIDGE_WIN_LOCK_ALL yogibridge_win_lock_all_
+#define YOGIBRIDGE_WIN_POST yogibridge_win_post_
+#define YOGIBRIDGE_WIN_SET_ATTR yogibridge_win_set_attr_
+#define YOGIBRIDGE_WIN_SET_ERRHANDLER yogibridge_win_set_errhandler_
+#define YOGIBRIDGE_WIN_SET_INFO yogibridge_win_set_info_
+#define YOGIBRIDGE_WIN_SET_NAME yogibridge_win_set_name_
+#define YOGIBRIDGE_WIN_SHARED_QUERY yogibridge_win_shared_query_
+#define YOGIBRIDGE_WIN_START yogibridge_win_start_
+#define YOGIBRIDGE_WIN_SYNC yogibridge_win_sync_
+#define YOGIBRIDGE_WIN_TEST yogibridge_win_test_
+#define YOGIBRIDGE_WIN_UNLOCK yogibridge_win_unlock_
+#define YOGIBRIDGE_WIN_UNLOCK_ALL yogibridge_win_unlock_all_
+#define YOGIBRIDGE_WIN_WAIT yogibridge_win_wait_
+
+
+/* TODO: Add MPI_Comm_spawn support */
+
+void YOGIBRIDGE_INIT(int *ierror)
+{
+    *ierror = YogiMPI_Init(NULL, NULL);
+}
+
+void YOGIBRIDGE_INIT_THREAD(int *required, int *provided, int *ierror) {
+    *ierror = YogiMPI_Init_thread(NULL, NULL, *required, provided);
+}
+
+void YOGIBRIDGE_FINALIZE(int *ierror)
+{
+    *ierror = YogiMPI_Finalize();
+}
+
+void YOGIBRIDGE_GET_PROCESSOR_NAME(char *name, int *resultlen, int *ierror,
+                                        int name_len) {
+    char *interimName = copy_and_add_null_terminator(name, name_len);
+    *ierror = YogiMPI_Get_processor_name(interimName, resultlen);
+    if (*resultlen > name_len) *resultlen = name_len;
+    std::strncpy(name, interimName, name_len);
+}
+
+void YOGIBRIDGE_ERROR_STRING(int *errorcode, char *string, int *resultlen, int *ierr, int string_len) {
+    char * conv_string = allocate_and_add_null_terminator(string, string_len);
+    *ierr = YogiMPI_Error_string(*errorcode, conv_string, resultlen);
+    copy_without_null_terminator(string, conv_string, string_len);
+    delete[] conv_string;
+}
+
+double YOG_WTIME() {
+    return YogiMPI_Wtime();
+}
+
+double YOG_WTICK() {
+    return YogiMPI_Wtick();
+}
+
+void YOGIBRIDGE_ABORT(YogiMPI_Comm *comm, int *errorcode, int *ierr) {
+    *ierr = YogiMPI_Abort(*comm, *errorcode);
+}
+
+void YOGIBRIDGE_ACCUMULATE(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Op *op, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Accumulate(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *op, *win);
+}
+
+void YOGIBRIDGE_ADD_ERROR_CLASS(int *errorclass, int *ierr) {
+    *ierr = YogiMPI_Add_error_class(errorclass);
+}
+
+void YOGIBRIDGE_ADD_ERROR_CODE(int *errorclass, int *errorcode, int *ierr) {
+    *ierr = YogiMPI_Add_error_code(*errorclass, errorcode);
+}
+
+void YOGIBRIDGE_ADD_ERROR_STRING(int *errorcode, char *string, int *ierr, int string_len) {
+    char * conv_string = copy_and_add_null_terminator(string, string_len);
+    *ierr = YogiMPI_Add_error_string(*errorcode, conv_string);
+    delete[] conv_string;
+}
+
+void YOGIBRIDGE_ADDRESS(void *location, YogiMPI_Aint *address, int *ierr) {
+    *ierr = YogiMPI_Address(location, address);
+}
+
+void YOGIBRIDGE_ALLGATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Allgather(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_ALLGATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Allgatherv(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_ALLOC_MEM(YogiMPI_Aint *size, YogiMPI_Info *info, void *baseptr, int *ierr) {
+    *ierr = YogiMPI_Alloc_mem(*size, *info, baseptr);
+}
+
+void YOGIBRIDGE_ALLREDUCE(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Allreduce(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm);
+}
+
+void YOGIBRIDGE_ALLTOALL(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Alltoall(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_ALLTOALLV(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Alltoallv(check_ptr_constant(sendbuf), sendcounts, sdispls, *sendtype, recvbuf, recvcounts, rdispls, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_ALLTOALLW(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtypes, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtypes, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Alltoallw(check_ptr_constant(sendbuf), sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, *comm);
+}
+
+void YOGIBRIDGE_ATTR_DELETE(YogiMPI_Comm *comm, int *keyval, int *ierr) {
+    *ierr = YogiMPI_Attr_delete(*comm, *keyval);
+}
+
+void YOGIBRIDGE_ATTR_GET(YogiMPI_Comm *comm, int *keyval, void *attribute_val, int *flag, int *ierr) {
+    *ierr = YogiMPI_Attr_get(*comm, *keyval, attribute_val, flag);
+}
+
+void YOGIBRIDGE_ATTR_PUT(YogiMPI_Comm *comm, int *keyval, void *attribute_val, int *ierr) {
+    *ierr = YogiMPI_Attr_put(*comm, *keyval, attribute_val);
+}
+
+void YOGIBRIDGE_BARRIER(YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Barrier(*comm);
+}
+
+void YOGIBRIDGE_BCAST(void *buffer, int *count, YogiMPI_Datatype *datatype, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Bcast(buffer, *count, *datatype, *root, *comm);
+}
+
+void YOGIBRIDGE_BSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Bsend(buf, *count, *datatype, *dest, *tag, *comm);
+}
+
+void YOGIBRIDGE_BSEND_INIT(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Bsend_init(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_BUFFER_ATTACH(void *buffer, int *size, int *ierr) {
+    *ierr = YogiMPI_Buffer_attach(buffer, *size);
+}
+
+void YOGIBRIDGE_BUFFER_DETACH(void *buffer_addr, int *size, int *ierr) {
+    *ierr = YogiMPI_Buffer_detach(buffer_addr, size);
+}
+
+void YOGIBRIDGE_CANCEL(YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Cancel(request);
+}
+
+void YOGIBRIDGE_CART_COORDS(YogiMPI_Comm *comm, int *rank, int *maxdims, int *coords, int *ierr) {
+    *ierr = YogiMPI_Cart_coords(*comm, *rank, *maxdims, coords);
+}
+
+void YOGIBRIDGE_CART_CREATE(YogiMPI_Comm *comm_old, int *ndims, int *dims, int *periods, int *reorder, YogiMPI_Comm *comm_cart, int *ierr) {
+    *ierr = YogiMPI_Cart_create(*comm_old, *ndims, dims, periods, *reorder, comm_cart);
+}
+
+void YOGIBRIDGE_CART_GET(YogiMPI_Comm *comm, int *maxdims, int *dims, int *periods, int *coords, int *ierr) {
+    *ierr = YogiMPI_Cart_get(*comm, *maxdims, dims, periods, coords);
+}
+
+void YOGIBRIDGE_CART_MAP(YogiMPI_Comm *comm, int *ndims, int *dims, int *periods, int *newrank, int *ierr) {
+    *ierr = YogiMPI_Cart_map(*comm, *ndims, dims, periods, newrank);
+}
+
+void YOGIBRIDGE_CART_RANK(YogiMPI_Comm *comm, int *coords, int *rank, int *ierr) {
+    *ierr = YogiMPI_Cart_rank(*comm, coords, rank);
+}
+
+void YOGIBRIDGE_CART_SHIFT(YogiMPI_Comm *comm, int *direction, int *disp, int *rank_source, int *rank_dest, int *ierr) {
+    *ierr = YogiMPI_Cart_shift(*comm, *direction, *disp, rank_source, rank_dest);
+}
+
+void YOGIBRIDGE_CART_SUB(YogiMPI_Comm *comm, int *remain_dims, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Cart_sub(*comm, remain_dims, newcomm);
+}
+
+void YOGIBRIDGE_CARTDIM_GET(YogiMPI_Comm *comm, int *ndims, int *ierr) {
+    *ierr = YogiMPI_Cartdim_get(*comm, ndims);
+}
+
+void YOGIBRIDGE_CLOSE_PORT(char *port_name, int *ierr, int port_name_len) {
+    char * conv_port_name = copy_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Close_port(conv_port_name);
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_COMM_ACCEPT(char *port_name, YogiMPI_Info *info, int *root, YogiMPI_Comm *comm, YogiMPI_Comm *newcomm, int *ierr, int port_name_len) {
+    char * conv_port_name = copy_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Comm_accept(conv_port_name, *info, *root, *comm, newcomm);
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_COMM_CALL_ERRHANDLER(YogiMPI_Comm *comm, int *errorcode, int *ierr) {
+    *ierr = YogiMPI_Comm_call_errhandler(*comm, *errorcode);
+}
+
+void YOGIBRIDGE_COMM_COMPARE(YogiMPI_Comm *comm1, YogiMPI_Comm *comm2, int *result, int *ierr) {
+    *ierr = YogiMPI_Comm_compare(*comm1, *comm2, result);
+}
+
+void YOGIBRIDGE_COMM_CONNECT(char *port_name, YogiMPI_Info *info, int *root, YogiMPI_Comm *comm, YogiMPI_Comm *newcomm, int *ierr, int port_name_len) {
+    char * conv_port_name = copy_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Comm_connect(conv_port_name, *info, *root, *comm, newcomm);
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_COMM_CREATE(YogiMPI_Comm *comm, YogiMPI_Group *group, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_create(*comm, *group, newcomm);
+}
+
+void YOGIBRIDGE_COMM_CREATE_GROUP(YogiMPI_Comm *comm, YogiMPI_Group *group, int *tag, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_create_group(*comm, *group, *tag, newcomm);
+}
+
+void YOGIBRIDGE_COMM_DELETE_ATTR(YogiMPI_Comm *comm, int *comm_keyval, int *ierr) {
+    *ierr = YogiMPI_Comm_delete_attr(*comm, *comm_keyval);
+}
+
+void YOGIBRIDGE_COMM_DISCONNECT(YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Comm_disconnect(comm);
+}
+
+void YOGIBRIDGE_COMM_DUP(YogiMPI_Comm *comm, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_dup(*comm, newcomm);
+}
+
+void YOGIBRIDGE_COMM_DUP_WITH_INFO(YogiMPI_Comm *comm, YogiMPI_Info *info, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_dup_with_info(*comm, *info, newcomm);
+}
+
+void YOGIBRIDGE_COMM_FREE(YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Comm_free(comm);
+}
+
+void YOGIBRIDGE_COMM_FREE_KEYVAL(int *comm_keyval, int *ierr) {
+    *ierr = YogiMPI_Comm_free_keyval(comm_keyval);
+}
+
+void YOGIBRIDGE_COMM_GET_ATTR(YogiMPI_Comm *comm, int *comm_keyval, void *attribute_val, int *flag, int *ierr) {
+    *ierr = YogiMPI_Comm_get_attr(*comm, *comm_keyval, attribute_val, flag);
+}
+
+void YOGIBRIDGE_COMM_GET_ERRHANDLER(YogiMPI_Comm *comm, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Comm_get_errhandler(*comm, errhandler);
+}
+
+void YOGIBRIDGE_COMM_GET_INFO(YogiMPI_Comm *comm, YogiMPI_Info *info_used, int *ierr) {
+    *ierr = YogiMPI_Comm_get_info(*comm, info_used);
+}
+
+void YOGIBRIDGE_COMM_GET_NAME(YogiMPI_Comm *comm, char *comm_name, int *resultlen, int *ierr, int comm_name_len) {
+    char * conv_comm_name = allocate_and_add_null_terminator(comm_name, comm_name_len);
+    *ierr = YogiMPI_Comm_get_name(*comm, conv_comm_name, resultlen);
+    copy_without_null_terminator(comm_name, conv_comm_name, comm_name_len);
+    delete[] conv_comm_name;
+}
+
+void YOGIBRIDGE_COMM_GET_PARENT(YogiMPI_Comm *parent, int *ierr) {
+    *ierr = YogiMPI_Comm_get_parent(parent);
+}
+
+void YOGIBRIDGE_COMM_GROUP(YogiMPI_Comm *comm, YogiMPI_Group *group, int *ierr) {
+    *ierr = YogiMPI_Comm_group(*comm, group);
+}
+
+void YOGIBRIDGE_COMM_IDUP(YogiMPI_Comm *comm, YogiMPI_Comm *newcomm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Comm_idup(*comm, newcomm, request);
+}
+
+void YOGIBRIDGE_COMM_JOIN(int *fd, YogiMPI_Comm *intercomm, int *ierr) {
+    *ierr = YogiMPI_Comm_join(*fd, intercomm);
+}
+
+void YOGIBRIDGE_COMM_RANK(YogiMPI_Comm *comm, int *rank, int *ierr) {
+    *ierr = YogiMPI_Comm_rank(*comm, rank);
+}
+
+void YOGIBRIDGE_COMM_REMOTE_GROUP(YogiMPI_Comm *comm, YogiMPI_Group *group, int *ierr) {
+    *ierr = YogiMPI_Comm_remote_group(*comm, group);
+}
+
+void YOGIBRIDGE_COMM_REMOTE_SIZE(YogiMPI_Comm *comm, int *size, int *ierr) {
+    *ierr = YogiMPI_Comm_remote_size(*comm, size);
+}
+
+void YOGIBRIDGE_COMM_SET_ATTR(YogiMPI_Comm *comm, int *comm_keyval, void *attribute_val, int *ierr) {
+    *ierr = YogiMPI_Comm_set_attr(*comm, *comm_keyval, attribute_val);
+}
+
+void YOGIBRIDGE_COMM_SET_ERRHANDLER(YogiMPI_Comm *comm, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Comm_set_errhandler(*comm, *errhandler);
+}
+
+void YOGIBRIDGE_COMM_SET_INFO(YogiMPI_Comm *comm, YogiMPI_Info *info, int *ierr) {
+    *ierr = YogiMPI_Comm_set_info(*comm, *info);
+}
+
+void YOGIBRIDGE_COMM_SET_NAME(YogiMPI_Comm *comm, char *comm_name, int *ierr, int comm_name_len) {
+    char * conv_comm_name = copy_and_add_null_terminator(comm_name, comm_name_len);
+    *ierr = YogiMPI_Comm_set_name(*comm, conv_comm_name);
+    delete[] conv_comm_name;
+}
+
+void YOGIBRIDGE_COMM_SIZE(YogiMPI_Comm *comm, int *size, int *ierr) {
+    *ierr = YogiMPI_Comm_size(*comm, size);
+}
+
+void YOGIBRIDGE_COMM_SPLIT(YogiMPI_Comm *comm, int *color, int *key, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_split(*comm, *color, *key, newcomm);
+}
+
+void YOGIBRIDGE_COMM_SPLIT_TYPE(YogiMPI_Comm *comm, int *split_type, int *key, YogiMPI_Info *info, YogiMPI_Comm *newcomm, int *ierr) {
+    *ierr = YogiMPI_Comm_split_type(*comm, *split_type, *key, *info, newcomm);
+}
+
+void YOGIBRIDGE_COMM_TEST_INTER(YogiMPI_Comm *comm, int *flag, int *ierr) {
+    *ierr = YogiMPI_Comm_test_inter(*comm, flag);
+}
+
+void YOGIBRIDGE_COMPARE_AND_SWAP(void *origin_addr, void *compare_addr, void *result_addr, YogiMPI_Datatype *datatype, int *target_rank, YogiMPI_Aint *target_disp, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Compare_and_swap(origin_addr, compare_addr, result_addr, *datatype, *target_rank, *target_disp, *win);
+}
+
+void YOGIBRIDGE_DIMS_CREATE(int *nnodes, int *ndims, int *dims, int *ierr) {
+    *ierr = YogiMPI_Dims_create(*nnodes, *ndims, dims);
+}
+
+void YOGIBRIDGE_DIST_GRAPH_CREATE(YogiMPI_Comm *comm_old, int *n, int *sources, int *degrees, int *destinations, int *weights, YogiMPI_Info *info, int *reorder, YogiMPI_Comm *comm_dist_graph, int *ierr) {
+    *ierr = YogiMPI_Dist_graph_create(*comm_old, *n, sources, degrees, destinations, weights, *info, *reorder, comm_dist_graph);
+}
+
+void YOGIBRIDGE_DIST_GRAPH_CREATE_ADJACENT(YogiMPI_Comm *comm_old, int *indegree, int *sources, int *sourceweights, int *outdegree, int *destinations, int *destweights, YogiMPI_Info *info, int *reorder, YogiMPI_Comm *comm_dist_graph, int *ierr) {
+    *ierr = YogiMPI_Dist_graph_create_adjacent(*comm_old, *indegree, sources, sourceweights, *outdegree, destinations, destweights, *info, *reorder, comm_dist_graph);
+}
+
+void YOGIBRIDGE_DIST_GRAPH_NEIGHBORS(YogiMPI_Comm *comm, int *maxindegree, int *sources, int *sourceweights, int *maxoutdegree, int *destinations, int *destweights, int *ierr) {
+    *ierr = YogiMPI_Dist_graph_neighbors(*comm, *maxindegree, sources, sourceweights, *maxoutdegree, destinations, destweights);
+}
+
+void YOGIBRIDGE_DIST_GRAPH_NEIGHBORS_COUNT(YogiMPI_Comm *comm, int *indegree, int *outdegree, int *weighted, int *ierr) {
+    *ierr = YogiMPI_Dist_graph_neighbors_count(*comm, indegree, outdegree, weighted);
+}
+
+void YOGIBRIDGE_ERRHANDLER_FREE(YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Errhandler_free(errhandler);
+}
+
+void YOGIBRIDGE_ERRHANDLER_GET(YogiMPI_Comm *comm, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Errhandler_get(*comm, errhandler);
+}
+
+void YOGIBRIDGE_ERRHANDLER_SET(YogiMPI_Comm *comm, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Errhandler_set(*comm, *errhandler);
+}
+
+void YOGIBRIDGE_EXSCAN(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Exscan(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm);
+}
+
+void YOGIBRIDGE_FETCH_AND_OP(void *origin_addr, void *result_addr, YogiMPI_Datatype *datatype, int *target_rank, YogiMPI_Aint *target_disp, YogiMPI_Op *op, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Fetch_and_op(origin_addr, result_addr, *datatype, *target_rank, *target_disp, *op, *win);
+}
+
+void YOGIBRIDGE_FILE_CALL_ERRHANDLER(YogiMPI_File *fh, int *errorcode, int *ierr) {
+    *ierr = YogiMPI_File_call_errhandler(*fh, *errorcode);
+}
+
+void YOGIBRIDGE_FILE_CLOSE(YogiMPI_File *fh, int *ierr) {
+    *ierr = YogiMPI_File_close(fh);
+}
+
+void YOGIBRIDGE_FILE_DELETE(char *filename, YogiMPI_Info *info, int *ierr, int filename_len) {
+    char * conv_filename = copy_and_add_null_terminator(filename, filename_len);
+    *ierr = YogiMPI_File_delete(conv_filename, *info);
+    delete[] conv_filename;
+}
+
+void YOGIBRIDGE_FILE_GET_AMODE(YogiMPI_File *fh, int *amode, int *ierr) {
+    *ierr = YogiMPI_File_get_amode(*fh, amode);
+}
+
+void YOGIBRIDGE_FILE_GET_ATOMICITY(YogiMPI_File *fh, int *flag, int *ierr) {
+    *ierr = YogiMPI_File_get_atomicity(*fh, flag);
+}
+
+void YOGIBRIDGE_FILE_GET_BYTE_OFFSET(YogiMPI_File *fh, YogiMPI_Offset *offset, YogiMPI_Offset *disp, int *ierr) {
+    *ierr = YogiMPI_File_get_byte_offset(*fh, *offset, disp);
+}
+
+void YOGIBRIDGE_FILE_GET_ERRHANDLER(YogiMPI_File *file, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_File_get_errhandler(*file, errhandler);
+}
+
+void YOGIBRIDGE_FILE_GET_GROUP(YogiMPI_File *fh, YogiMPI_Group *group, int *ierr) {
+    *ierr = YogiMPI_File_get_group(*fh, group);
+}
+
+void YOGIBRIDGE_FILE_GET_INFO(YogiMPI_File *fh, YogiMPI_Info *info_used, int *ierr) {
+    *ierr = YogiMPI_File_get_info(*fh, info_used);
+}
+
+void YOGIBRIDGE_FILE_GET_POSITION(YogiMPI_File *fh, YogiMPI_Offset *offset, int *ierr) {
+    *ierr = YogiMPI_File_get_position(*fh, offset);
+}
+
+void YOGIBRIDGE_FILE_GET_POSITION_SHARED(YogiMPI_File *fh, YogiMPI_Offset *offset, int *ierr) {
+    *ierr = YogiMPI_File_get_position_shared(*fh, offset);
+}
+
+void YOGIBRIDGE_FILE_GET_SIZE(YogiMPI_File *fh, YogiMPI_Offset *size, int *ierr) {
+    *ierr = YogiMPI_File_get_size(*fh, size);
+}
+
+void YOGIBRIDGE_FILE_GET_TYPE_EXTENT(YogiMPI_File *fh, YogiMPI_Datatype *datatype, YogiMPI_Aint *extent, int *ierr) {
+    *ierr = YogiMPI_File_get_type_extent(*fh, *datatype, extent);
+}
+
+void YOGIBRIDGE_FILE_GET_VIEW(YogiMPI_File *fh, YogiMPI_Offset *disp, YogiMPI_Datatype *etype, YogiMPI_Datatype *filetype, char *datarep, int *ierr, int datarep_len) {
+    char * conv_datarep = allocate_and_add_null_terminator(datarep, datarep_len);
+    *ierr = YogiMPI_File_get_view(*fh, disp, etype, filetype, conv_datarep);
+    copy_without_null_terminator(datarep, conv_datarep, datarep_len);
+    delete[] conv_datarep;
+}
+
+void YOGIBRIDGE_FILE_IREAD(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iread(*fh, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_IREAD_AT(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iread_at(*fh, *offset, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_IREAD_SHARED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iread_shared(*fh, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_IWRITE(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iwrite(*fh, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_IWRITE_AT(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iwrite_at(*fh, *offset, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_IWRITE_SHARED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_File_iwrite_shared(*fh, buf, *count, *datatype, request);
+}
+
+void YOGIBRIDGE_FILE_OPEN(YogiMPI_Comm *comm, char *filename, int *amode, YogiMPI_Info *info, YogiMPI_File *fh, int *ierr, int filename_len) {
+    char * conv_filename = copy_and_add_null_terminator(filename, filename_len);
+    *ierr = YogiMPI_File_open(*comm, conv_filename, *amode, *info, fh);
+    delete[] conv_filename;
+}
+
+void YOGIBRIDGE_FILE_PREALLOCATE(YogiMPI_File *fh, YogiMPI_Offset *size, int *ierr) {
+    *ierr = YogiMPI_File_preallocate(*fh, *size);
+}
+
+void YOGIBRIDGE_FILE_READ(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_ALL(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_all(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_ALL_BEGIN(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_read_all_begin(*fh, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_READ_ALL_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_all_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_AT(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_at(*fh, *offset, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_AT_ALL(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_at_all(*fh, *offset, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_AT_ALL_BEGIN(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_read_at_all_begin(*fh, *offset, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_READ_AT_ALL_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_at_all_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_ORDERED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_ordered(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_ORDERED_BEGIN(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_read_ordered_begin(*fh, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_READ_ORDERED_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_ordered_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_READ_SHARED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_read_shared(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_SEEK(YogiMPI_File *fh, YogiMPI_Offset *offset, int *whence, int *ierr) {
+    *ierr = YogiMPI_File_seek(*fh, *offset, *whence);
+}
+
+void YOGIBRIDGE_FILE_SEEK_SHARED(YogiMPI_File *fh, YogiMPI_Offset *offset, int *whence, int *ierr) {
+    *ierr = YogiMPI_File_seek_shared(*fh, *offset, *whence);
+}
+
+void YOGIBRIDGE_FILE_SET_ATOMICITY(YogiMPI_File *fh, int *flag, int *ierr) {
+    *ierr = YogiMPI_File_set_atomicity(*fh, *flag);
+}
+
+void YOGIBRIDGE_FILE_SET_ERRHANDLER(YogiMPI_File *file, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_File_set_errhandler(*file, *errhandler);
+}
+
+void YOGIBRIDGE_FILE_SET_INFO(YogiMPI_File *fh, YogiMPI_Info *info, int *ierr) {
+    *ierr = YogiMPI_File_set_info(*fh, *info);
+}
+
+void YOGIBRIDGE_FILE_SET_SIZE(YogiMPI_File *fh, YogiMPI_Offset *size, int *ierr) {
+    *ierr = YogiMPI_File_set_size(*fh, *size);
+}
+
+void YOGIBRIDGE_FILE_SET_VIEW(YogiMPI_File *fh, YogiMPI_Offset *disp, YogiMPI_Datatype *etype, YogiMPI_Datatype *filetype, char *datarep, YogiMPI_Info *info, int *ierr, int datarep_len) {
+    char * conv_datarep = copy_and_add_null_terminator(datarep, datarep_len);
+    *ierr = YogiMPI_File_set_view(*fh, *disp, *etype, *filetype, conv_datarep, *info);
+    delete[] conv_datarep;
+}
+
+void YOGIBRIDGE_FILE_SYNC(YogiMPI_File *fh, int *ierr) {
+    *ierr = YogiMPI_File_sync(*fh);
+}
+
+void YOGIBRIDGE_FILE_WRITE(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_ALL(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_all(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_ALL_BEGIN(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_write_all_begin(*fh, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_WRITE_ALL_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_all_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_AT(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_at(*fh, *offset, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_AT_ALL(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_at_all(*fh, *offset, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_AT_ALL_BEGIN(YogiMPI_File *fh, YogiMPI_Offset *offset, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_write_at_all_begin(*fh, *offset, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_WRITE_AT_ALL_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_at_all_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_ORDERED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_ordered(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_ORDERED_BEGIN(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_File_write_ordered_begin(*fh, buf, *count, *datatype);
+}
+
+void YOGIBRIDGE_FILE_WRITE_ORDERED_END(YogiMPI_File *fh, void *buf, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_ordered_end(*fh, buf, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FILE_WRITE_SHARED(YogiMPI_File *fh, void *buf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_File_write_shared(*fh, buf, *count, *datatype, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_FINALIZED(int *flag, int *ierr) {
+    *ierr = YogiMPI_Finalized(flag);
+}
+
+void YOGIBRIDGE_FREE_MEM(void *base, int *ierr) {
+    *ierr = YogiMPI_Free_mem(base);
+}
+
+void YOGIBRIDGE_GATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Gather(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *root, *comm);
+}
+
+void YOGIBRIDGE_GATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Gatherv(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *root, *comm);
+}
+
+void YOGIBRIDGE_GET(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Get(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *win);
+}
+
+void YOGIBRIDGE_GET_ACCUMULATE(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, void *result_addr, int *result_count, YogiMPI_Datatype *result_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Op *op, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Get_accumulate(origin_addr, *origin_count, *origin_datatype, result_addr, *result_count, *result_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *op, *win);
+}
+
+void YOGIBRIDGE_GET_ADDRESS(void *location, YogiMPI_Aint *address, int *ierr) {
+    *ierr = YogiMPI_Get_address(location, address);
+}
+
+void YOGIBRIDGE_GET_COUNT(YogiMPI_Status *status, YogiMPI_Datatype *datatype, int *count, int *ierr) {
+    *ierr = YogiMPI_Get_count(status, *datatype, count);
+}
+
+void YOGIBRIDGE_GET_ELEMENTS(YogiMPI_Status *status, YogiMPI_Datatype *datatype, int *count, int *ierr) {
+    *ierr = YogiMPI_Get_elements(status, *datatype, count);
+}
+
+void YOGIBRIDGE_GET_LIBRARY_VERSION(char *version, int *resultlen, int *ierr, int version_len) {
+    char * conv_version = allocate_and_add_null_terminator(version, version_len);
+    *ierr = YogiMPI_Get_library_version(conv_version, resultlen);
+    copy_without_null_terminator(version, conv_version, version_len);
+    delete[] conv_version;
+}
+
+void YOGIBRIDGE_GET_VERSION(int *version, int *subversion, int *ierr) {
+    *ierr = YogiMPI_Get_version(version, subversion);
+}
+
+void YOGIBRIDGE_GRAPH_CREATE(YogiMPI_Comm *comm_old, int *nnodes, int *indx, int *edges, int *reorder, YogiMPI_Comm *comm_graph, int *ierr) {
+    *ierr = YogiMPI_Graph_create(*comm_old, *nnodes, indx, edges, *reorder, comm_graph);
+}
+
+void YOGIBRIDGE_GRAPH_GET(YogiMPI_Comm *comm, int *maxindex, int *maxedges, int *indx, int *edges, int *ierr) {
+    *ierr = YogiMPI_Graph_get(*comm, *maxindex, *maxedges, indx, edges);
+}
+
+void YOGIBRIDGE_GRAPH_MAP(YogiMPI_Comm *comm, int *nnodes, int *indx, int *edges, int *newrank, int *ierr) {
+    *ierr = YogiMPI_Graph_map(*comm, *nnodes, indx, edges, newrank);
+}
+
+void YOGIBRIDGE_GRAPH_NEIGHBORS(YogiMPI_Comm *comm, int *rank, int *maxneighbors, int *neighbors, int *ierr) {
+    *ierr = YogiMPI_Graph_neighbors(*comm, *rank, *maxneighbors, neighbors);
+}
+
+void YOGIBRIDGE_GRAPH_NEIGHBORS_COUNT(YogiMPI_Comm *comm, int *rank, int *nneighbors, int *ierr) {
+    *ierr = YogiMPI_Graph_neighbors_count(*comm, *rank, nneighbors);
+}
+
+void YOGIBRIDGE_GRAPHDIMS_GET(YogiMPI_Comm *comm, int *nnodes, int *nedges, int *ierr) {
+    *ierr = YogiMPI_Graphdims_get(*comm, nnodes, nedges);
+}
+
+void YOGIBRIDGE_GREQUEST_COMPLETE(YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Grequest_complete(*request);
+}
+
+void YOGIBRIDGE_GROUP_COMPARE(YogiMPI_Group *group1, YogiMPI_Group *group2, int *result, int *ierr) {
+    *ierr = YogiMPI_Group_compare(*group1, *group2, result);
+}
+
+void YOGIBRIDGE_GROUP_DIFFERENCE(YogiMPI_Group *group1, YogiMPI_Group *group2, YogiMPI_Group *newgroup, int *ierr) {
+    *ierr = YogiMPI_Group_difference(*group1, *group2, newgroup);
+}
+
+void YOGIBRIDGE_GROUP_EXCL(YogiMPI_Group *group, int *n, int *ranks, YogiMPI_Group *newgroup, int *ierr) {
+    *ierr = YogiMPI_Group_excl(*group, *n, ranks, newgroup);
+}
+
+void YOGIBRIDGE_GROUP_FREE(YogiMPI_Group *group, int *ierr) {
+    *ierr = YogiMPI_Group_free(group);
+}
+
+void YOGIBRIDGE_GROUP_INCL(YogiMPI_Group *group, int *n, int *ranks, YogiMPI_Group *newgroup, int *ierr) {
+    *ierr = YogiMPI_Group_incl(*group, *n, ranks, newgroup);
+}
+
+void YOGIBRIDGE_GROUP_INTERSECTION(YogiMPI_Group *group1, YogiMPI_Group *group2, YogiMPI_Group *newgroup, int *ierr) {
+    *ierr = YogiMPI_Group_intersection(*group1, *group2, newgroup);
+}
+
+void YOGIBRIDGE_GROUP_RANK(YogiMPI_Group *group, int *rank, int *ierr) {
+    *ierr = YogiMPI_Group_rank(*group, rank);
+}
+
+void YOGIBRIDGE_GROUP_SIZE(YogiMPI_Group *group, int *size, int *ierr) {
+    *ierr = YogiMPI_Group_size(*group, size);
+}
+
+void YOGIBRIDGE_GROUP_TRANSLATE_RANKS(YogiMPI_Group *group1, int *n, int *ranks1, YogiMPI_Group *group2, int *ranks2, int *ierr) {
+    *ierr = YogiMPI_Group_translate_ranks(*group1, *n, ranks1, *group2, ranks2);
+}
+
+void YOGIBRIDGE_GROUP_UNION(YogiMPI_Group *group1, YogiMPI_Group *group2, YogiMPI_Group *newgroup, int *ierr) {
+    *ierr = YogiMPI_Group_union(*group1, *group2, newgroup);
+}
+
+void YOGIBRIDGE_IALLGATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iallgather(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_IALLGATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iallgatherv(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_IALLREDUCE(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iallreduce(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm, request);
+}
+
+void YOGIBRIDGE_IALLTOALL(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ialltoall(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_IALLTOALLV(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ialltoallv(check_ptr_constant(sendbuf), sendcounts, sdispls, *sendtype, recvbuf, recvcounts, rdispls, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_IALLTOALLW(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtypes, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtypes, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ialltoallw(check_ptr_constant(sendbuf), sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, *comm, request);
+}
+
+void YOGIBRIDGE_IBARRIER(YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ibarrier(*comm, request);
+}
+
+void YOGIBRIDGE_IBCAST(void *buffer, int *count, YogiMPI_Datatype *datatype, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ibcast(buffer, *count, *datatype, *root, *comm, request);
+}
+
+void YOGIBRIDGE_IBSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ibsend(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_IEXSCAN(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iexscan(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm, request);
+}
+
+void YOGIBRIDGE_IGATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Igather(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *root, *comm, request);
+}
+
+void YOGIBRIDGE_IGATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Igatherv(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *root, *comm, request);
+}
+
+void YOGIBRIDGE_INEIGHBOR_ALLGATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ineighbor_allgather(sendbuf, *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_INEIGHBOR_ALLGATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ineighbor_allgatherv(sendbuf, *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_INEIGHBOR_ALLTOALL(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ineighbor_alltoall(sendbuf, *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_INEIGHBOR_ALLTOALLV(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, *sendtype, recvbuf, recvcounts, rdispls, *recvtype, *comm, request);
+}
+
+void YOGIBRIDGE_INEIGHBOR_ALLTOALLW(void *sendbuf, int *sendcounts, YogiMPI_Aint *sdispls, YogiMPI_Datatype *sendtypes, void *recvbuf, int *recvcounts, YogiMPI_Aint *rdispls, YogiMPI_Datatype *recvtypes, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ineighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, *comm, request);
+}
+
+void YOGIBRIDGE_INFO_CREATE(YogiMPI_Info *info, int *ierr) {
+    *ierr = YogiMPI_Info_create(info);
+}
+
+void YOGIBRIDGE_INFO_DELETE(YogiMPI_Info *info, char *key, int *ierr, int key_len) {
+    char * conv_key = copy_and_add_null_terminator(key, key_len);
+    *ierr = YogiMPI_Info_delete(*info, conv_key);
+    delete[] conv_key;
+}
+
+void YOGIBRIDGE_INFO_DUP(YogiMPI_Info *info, YogiMPI_Info *newinfo, int *ierr) {
+    *ierr = YogiMPI_Info_dup(*info, newinfo);
+}
+
+void YOGIBRIDGE_INFO_FREE(YogiMPI_Info *info, int *ierr) {
+    *ierr = YogiMPI_Info_free(info);
+}
+
+void YOGIBRIDGE_INFO_GET(YogiMPI_Info *info, char *key, int *valuelen, char *value, int *flag, int *ierr, int key_len, int value_len) {
+    char * conv_key = copy_and_add_null_terminator(key, key_len);
+    char * conv_value = allocate_and_add_null_terminator(value, value_len);
+    *ierr = YogiMPI_Info_get(*info, conv_key, *valuelen, conv_value, flag);
+    delete[] conv_key;
+    copy_without_null_terminator(value, conv_value, value_len);
+    delete[] conv_value;
+}
+
+void YOGIBRIDGE_INFO_GET_NKEYS(YogiMPI_Info *info, int *nkeys, int *ierr) {
+    *ierr = YogiMPI_Info_get_nkeys(*info, nkeys);
+}
+
+void YOGIBRIDGE_INFO_GET_NTHKEY(YogiMPI_Info *info, int *n, char *key, int *ierr, int key_len) {
+    char * conv_key = allocate_and_add_null_terminator(key, key_len);
+    *ierr = YogiMPI_Info_get_nthkey(*info, *n, conv_key);
+    copy_without_null_terminator(key, conv_key, key_len);
+    delete[] conv_key;
+}
+
+void YOGIBRIDGE_INFO_GET_VALUELEN(YogiMPI_Info *info, char *key, int *valuelen, int *flag, int *ierr, int key_len) {
+    char * conv_key = copy_and_add_null_terminator(key, key_len);
+    *ierr = YogiMPI_Info_get_valuelen(*info, conv_key, valuelen, flag);
+    delete[] conv_key;
+}
+
+void YOGIBRIDGE_INFO_SET(YogiMPI_Info *info, char *key, char *value, int *ierr, int key_len, int value_len) {
+    char * conv_key = copy_and_add_null_terminator(key, key_len);
+    char * conv_value = copy_and_add_null_terminator(value, value_len);
+    *ierr = YogiMPI_Info_set(*info, conv_key, conv_value);
+    delete[] conv_key;
+    delete[] conv_value;
+}
+
+void YOGIBRIDGE_INITIALIZED(int *flag, int *ierr) {
+    *ierr = YogiMPI_Initialized(flag);
+}
+
+void YOGIBRIDGE_INTERCOMM_CREATE(YogiMPI_Comm *local_comm, int *local_leader, YogiMPI_Comm *peer_comm, int *remote_leader, int *tag, YogiMPI_Comm *newintercomm, int *ierr) {
+    *ierr = YogiMPI_Intercomm_create(*local_comm, *local_leader, *peer_comm, *remote_leader, *tag, newintercomm);
+}
+
+void YOGIBRIDGE_INTERCOMM_MERGE(YogiMPI_Comm *intercomm, int *high, YogiMPI_Comm *newintracomm, int *ierr) {
+    *ierr = YogiMPI_Intercomm_merge(*intercomm, *high, newintracomm);
+}
+
+void YOGIBRIDGE_IPROBE(int *source, int *tag, YogiMPI_Comm *comm, int *flag, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Iprobe(*source, *tag, *comm, flag, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_IRECV(void *buf, int *count, YogiMPI_Datatype *datatype, int *source, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Irecv(buf, *count, *datatype, *source, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_IREDUCE(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ireduce(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *root, *comm, request);
+}
+
+void YOGIBRIDGE_IREDUCE_SCATTER(void *sendbuf, void *recvbuf, int *recvcounts, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ireduce_scatter(check_ptr_constant(sendbuf), recvbuf, recvcounts, *datatype, *op, *comm, request);
+}
+
+void YOGIBRIDGE_IREDUCE_SCATTER_BLOCK(void *sendbuf, void *recvbuf, int *recvcount, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ireduce_scatter_block(check_ptr_constant(sendbuf), recvbuf, *recvcount, *datatype, *op, *comm, request);
+}
+
+void YOGIBRIDGE_IRSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Irsend(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_IS_THREAD_MAIN(int *flag, int *ierr) {
+    *ierr = YogiMPI_Is_thread_main(flag);
+}
+
+void YOGIBRIDGE_ISCAN(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iscan(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm, request);
+}
+
+void YOGIBRIDGE_ISCATTER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iscatter(sendbuf, *sendcount, *sendtype, check_ptr_constant(recvbuf), *recvcount, *recvtype, *root, *comm, request);
+}
+
+void YOGIBRIDGE_ISCATTERV(void *sendbuf, int *sendcounts, int *displs, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Iscatterv(sendbuf, sendcounts, displs, *sendtype, check_ptr_constant(recvbuf), *recvcount, *recvtype, *root, *comm, request);
+}
+
+void YOGIBRIDGE_ISEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Isend(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_ISSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Issend(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_KEYVAL_FREE(int *keyval, int *ierr) {
+    *ierr = YogiMPI_Keyval_free(keyval);
+}
+
+void YOGIBRIDGE_LOOKUP_NAME(char *service_name, YogiMPI_Info *info, char *port_name, int *ierr, int service_name_len, int port_name_len) {
+    char * conv_service_name = copy_and_add_null_terminator(service_name, service_name_len);
+    char * conv_port_name = allocate_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Lookup_name(conv_service_name, *info, conv_port_name);
+    delete[] conv_service_name;
+    copy_without_null_terminator(port_name, conv_port_name, port_name_len);
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_NEIGHBOR_ALLGATHER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Neighbor_allgather(sendbuf, *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_NEIGHBOR_ALLGATHERV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *displs, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Neighbor_allgatherv(sendbuf, *sendcount, *sendtype, recvbuf, recvcounts, displs, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_NEIGHBOR_ALLTOALL(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Neighbor_alltoall(sendbuf, *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_NEIGHBOR_ALLTOALLV(void *sendbuf, int *sendcounts, int *sdispls, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcounts, int *rdispls, YogiMPI_Datatype *recvtype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, *sendtype, recvbuf, recvcounts, rdispls, *recvtype, *comm);
+}
+
+void YOGIBRIDGE_NEIGHBOR_ALLTOALLW(void *sendbuf, int *sendcounts, YogiMPI_Aint *sdispls, YogiMPI_Datatype *sendtypes, void *recvbuf, int *recvcounts, YogiMPI_Aint *rdispls, YogiMPI_Datatype *recvtypes, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Neighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, *comm);
+}
+
+void YOGIBRIDGE_OP_COMMUTATIVE(YogiMPI_Op *op, int *commute, int *ierr) {
+    *ierr = YogiMPI_Op_commutative(*op, commute);
+}
+
+void YOGIBRIDGE_OP_FREE(YogiMPI_Op *op, int *ierr) {
+    *ierr = YogiMPI_Op_free(op);
+}
+
+void YOGIBRIDGE_OPEN_PORT(YogiMPI_Info *info, char *port_name, int *ierr, int port_name_len) {
+    char * conv_port_name = allocate_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Open_port(*info, conv_port_name);
+    copy_without_null_terminator(port_name, conv_port_name, port_name_len);
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_PACK(void *inbuf, int *incount, YogiMPI_Datatype *datatype, void *outbuf, int *outsize, int *position, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Pack(inbuf, *incount, *datatype, outbuf, *outsize, position, *comm);
+}
+
+void YOGIBRIDGE_PACK_EXTERNAL(char *datarep, void *inbuf, int *incount, YogiMPI_Datatype *datatype, void *outbuf, YogiMPI_Aint *outsize, YogiMPI_Aint *position, int *ierr, int datarep_len) {
+    char * conv_datarep = copy_and_add_null_terminator(datarep, datarep_len);
+    *ierr = YogiMPI_Pack_external(conv_datarep, inbuf, *incount, *datatype, outbuf, *outsize, position);
+    delete[] conv_datarep;
+}
+
+void YOGIBRIDGE_PACK_EXTERNAL_SIZE(char *datarep, int *incount, YogiMPI_Datatype *datatype, YogiMPI_Aint *size, int *ierr, int datarep_len) {
+    char * conv_datarep = copy_and_add_null_terminator(datarep, datarep_len);
+    *ierr = YogiMPI_Pack_external_size(conv_datarep, *incount, *datatype, size);
+    delete[] conv_datarep;
+}
+
+void YOGIBRIDGE_PACK_SIZE(int *incount, YogiMPI_Datatype *datatype, YogiMPI_Comm *comm, int *size, int *ierr) {
+    *ierr = YogiMPI_Pack_size(*incount, *datatype, *comm, size);
+}
+
+void YOGIBRIDGE_PCONTROL(int *level, int *ierr) {
+    *ierr = YogiMPI_Pcontrol(*level);
+}
+
+void YOGIBRIDGE_PROBE(int *source, int *tag, YogiMPI_Comm *comm, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Probe(*source, *tag, *comm, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_PUBLISH_NAME(char *service_name, YogiMPI_Info *info, char *port_name, int *ierr, int service_name_len, int port_name_len) {
+    char * conv_service_name = copy_and_add_null_terminator(service_name, service_name_len);
+    char * conv_port_name = copy_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Publish_name(conv_service_name, *info, conv_port_name);
+    delete[] conv_service_name;
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_PUT(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Put(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *win);
+}
+
+void YOGIBRIDGE_QUERY_THREAD(int *provided, int *ierr) {
+    *ierr = YogiMPI_Query_thread(provided);
+}
+
+void YOGIBRIDGE_RACCUMULATE(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Op *op, YogiMPI_Win *win, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Raccumulate(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *op, *win, request);
+}
+
+void YOGIBRIDGE_RECV(void *buf, int *count, YogiMPI_Datatype *datatype, int *source, int *tag, YogiMPI_Comm *comm, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Recv(buf, *count, *datatype, *source, *tag, *comm, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_RECV_INIT(void *buf, int *count, YogiMPI_Datatype *datatype, int *source, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Recv_init(buf, *count, *datatype, *source, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_REDUCE(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Reduce(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *root, *comm);
+}
+
+void YOGIBRIDGE_REDUCE_LOCAL(void *inbuf, void *inoutbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, int *ierr) {
+    *ierr = YogiMPI_Reduce_local(inbuf, inoutbuf, *count, *datatype, *op);
+}
+
+void YOGIBRIDGE_REDUCE_SCATTER(void *sendbuf, void *recvbuf, int *recvcounts, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Reduce_scatter(check_ptr_constant(sendbuf), recvbuf, recvcounts, *datatype, *op, *comm);
+}
+
+void YOGIBRIDGE_REDUCE_SCATTER_BLOCK(void *sendbuf, void *recvbuf, int *recvcount, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Reduce_scatter_block(check_ptr_constant(sendbuf), recvbuf, *recvcount, *datatype, *op, *comm);
+}
+
+void YOGIBRIDGE_REQUEST_FREE(YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Request_free(request);
+}
+
+void YOGIBRIDGE_REQUEST_GET_STATUS(YogiMPI_Request *request, int *flag, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Request_get_status(*request, flag, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_RGET(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Win *win, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Rget(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *win, request);
+}
+
+void YOGIBRIDGE_RGET_ACCUMULATE(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, void *result_addr, int *result_count, YogiMPI_Datatype *result_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Op *op, YogiMPI_Win *win, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Rget_accumulate(origin_addr, *origin_count, *origin_datatype, result_addr, *result_count, *result_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *op, *win, request);
+}
+
+void YOGIBRIDGE_RPUT(void *origin_addr, int *origin_count, YogiMPI_Datatype *origin_datatype, int *target_rank, YogiMPI_Aint *target_disp, int *target_count, YogiMPI_Datatype *target_datatype, YogiMPI_Win *win, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Rput(origin_addr, *origin_count, *origin_datatype, *target_rank, *target_disp, *target_count, *target_datatype, *win, request);
+}
+
+void YOGIBRIDGE_RSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Rsend(buf, *count, *datatype, *dest, *tag, *comm);
+}
+
+void YOGIBRIDGE_RSEND_INIT(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Rsend_init(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_SCAN(void *sendbuf, void *recvbuf, int *count, YogiMPI_Datatype *datatype, YogiMPI_Op *op, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Scan(check_ptr_constant(sendbuf), recvbuf, *count, *datatype, *op, *comm);
+}
+
+void YOGIBRIDGE_SCATTER(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Scatter(check_ptr_constant(sendbuf), *sendcount, *sendtype, recvbuf, *recvcount, *recvtype, *root, *comm);
+}
+
+void YOGIBRIDGE_SCATTERV(void *sendbuf, int *sendcounts, int *displs, YogiMPI_Datatype *sendtype, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *root, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Scatterv(check_ptr_constant(sendbuf), sendcounts, displs, *sendtype, recvbuf, *recvcount, *recvtype, *root, *comm);
+}
+
+void YOGIBRIDGE_SEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Send(buf, *count, *datatype, *dest, *tag, *comm);
+}
+
+void YOGIBRIDGE_SEND_INIT(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Send_init(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_SENDRECV(void *sendbuf, int *sendcount, YogiMPI_Datatype *sendtype, int *dest, int *sendtag, void *recvbuf, int *recvcount, YogiMPI_Datatype *recvtype, int *source, int *recvtag, YogiMPI_Comm *comm, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Sendrecv(sendbuf, *sendcount, *sendtype, *dest, *sendtag, recvbuf, *recvcount, *recvtype, *source, *recvtag, *comm, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_SENDRECV_REPLACE(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *sendtag, int *source, int *recvtag, YogiMPI_Comm *comm, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Sendrecv_replace(buf, *count, *datatype, *dest, *sendtag, *source, *recvtag, *comm, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_SSEND(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Ssend(buf, *count, *datatype, *dest, *tag, *comm);
+}
+
+void YOGIBRIDGE_SSEND_INIT(void *buf, int *count, YogiMPI_Datatype *datatype, int *dest, int *tag, YogiMPI_Comm *comm, YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Ssend_init(buf, *count, *datatype, *dest, *tag, *comm, request);
+}
+
+void YOGIBRIDGE_START(YogiMPI_Request *request, int *ierr) {
+    *ierr = YogiMPI_Start(request);
+}
+
+void YOGIBRIDGE_STARTALL(int *count, YogiMPI_Request *array_of_requests, int *ierr) {
+    *ierr = YogiMPI_Startall(*count, array_of_requests);
+}
+
+void YOGIBRIDGE_STATUS_SET_CANCELLED(YogiMPI_Status *status, int *flag, int *ierr) {
+    *ierr = YogiMPI_Status_set_cancelled(status, *flag);
+}
+
+void YOGIBRIDGE_STATUS_SET_ELEMENTS(YogiMPI_Status *status, YogiMPI_Datatype *datatype, int *count, int *ierr) {
+    *ierr = YogiMPI_Status_set_elements(status, *datatype, *count);
+}
+
+void YOGIBRIDGE_TEST(YogiMPI_Request *request, int *flag, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Test(request, flag, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_TEST_CANCELLED(YogiMPI_Status *status, int *flag, int *ierr) {
+    *ierr = YogiMPI_Test_cancelled(status, flag);
+}
+
+void YOGIBRIDGE_TESTALL(int *count, YogiMPI_Request *array_of_requests, int *flag, YogiMPI_Status *array_of_statuses, int *ierr) {
+    *ierr = YogiMPI_Testall(*count, array_of_requests, flag, check_status_ignore(array_of_statuses));
+}
+
+void YOGIBRIDGE_TESTANY(int *count, YogiMPI_Request *array_of_requests, int *indx, int *flag, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Testany(*count, array_of_requests, indx, flag, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_TESTSOME(int *incount, YogiMPI_Request *array_of_requests, int *outcount, int *array_of_indices, YogiMPI_Status *array_of_statuses, int *ierr) {
+    *ierr = YogiMPI_Testsome(*incount, array_of_requests, outcount, array_of_indices, check_status_ignore(array_of_statuses));
+}
+
+void YOGIBRIDGE_TOPO_TEST(YogiMPI_Comm *comm, int *status, int *ierr) {
+    *ierr = YogiMPI_Topo_test(*comm, status);
+}
+
+void YOGIBRIDGE_TYPE_COMMIT(YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_Type_commit(datatype);
+}
+
+void YOGIBRIDGE_TYPE_CONTIGUOUS(int *count, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_contiguous(*count, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_HINDEXED(int *count, int *array_of_blocklengths, YogiMPI_Aint *array_of_displacements, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_hindexed(*count, array_of_blocklengths, array_of_displacements, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_HINDEXED_BLOCK(int *count, int *blocklength, YogiMPI_Aint *array_of_displacements, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_hindexed_block(*count, *blocklength, array_of_displacements, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_HVECTOR(int *count, int *blocklength, YogiMPI_Aint *stride, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_hvector(*count, *blocklength, *stride, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_INDEXED_BLOCK(int *count, int *blocklength, int *array_of_displacements, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_indexed_block(*count, *blocklength, array_of_displacements, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_RESIZED(YogiMPI_Datatype *oldtype, YogiMPI_Aint *lb, YogiMPI_Aint *extent, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_resized(*oldtype, *lb, *extent, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_STRUCT(int *count, int *array_of_blocklengths, YogiMPI_Aint *array_of_displacements, YogiMPI_Datatype *array_of_types, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_struct(*count, array_of_blocklengths, array_of_displacements, array_of_types, newtype);
+}
+
+void YOGIBRIDGE_TYPE_CREATE_SUBARRAY(int *ndims, int *array_of_sizes, int *array_of_subsizes, int *array_of_starts, int *order, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_create_subarray(*ndims, array_of_sizes, array_of_subsizes, array_of_starts, *order, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_DELETE_ATTR(YogiMPI_Datatype *datatype, int *type_keyval, int *ierr) {
+    *ierr = YogiMPI_Type_delete_attr(*datatype, *type_keyval);
+}
+
+void YOGIBRIDGE_TYPE_DUP(YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_dup(*oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_EXTENT(YogiMPI_Datatype *datatype, YogiMPI_Aint *extent, int *ierr) {
+    *ierr = YogiMPI_Type_extent(*datatype, extent);
+}
+
+void YOGIBRIDGE_TYPE_FREE(YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_Type_free(datatype);
+}
+
+void YOGIBRIDGE_TYPE_FREE_KEYVAL(int *type_keyval, int *ierr) {
+    *ierr = YogiMPI_Type_free_keyval(type_keyval);
+}
+
+void YOGIBRIDGE_TYPE_GET_ATTR(YogiMPI_Datatype *datatype, int *type_keyval, void *attribute_val, int *flag, int *ierr) {
+    *ierr = YogiMPI_Type_get_attr(*datatype, *type_keyval, attribute_val, flag);
+}
+
+void YOGIBRIDGE_TYPE_GET_ENVELOPE(YogiMPI_Datatype *datatype, int *num_integers, int *num_addresses, int *num_datatypes, int *combiner, int *ierr) {
+    *ierr = YogiMPI_Type_get_envelope(*datatype, num_integers, num_addresses, num_datatypes, combiner);
+}
+
+void YOGIBRIDGE_TYPE_GET_EXTENT(YogiMPI_Datatype *datatype, YogiMPI_Aint *lb, YogiMPI_Aint *extent, int *ierr) {
+    *ierr = YogiMPI_Type_get_extent(*datatype, lb, extent);
+}
+
+void YOGIBRIDGE_TYPE_GET_NAME(YogiMPI_Datatype *datatype, char *type_name, int *resultlen, int *ierr, int type_name_len) {
+    char * conv_type_name = allocate_and_add_null_terminator(type_name, type_name_len);
+    *ierr = YogiMPI_Type_get_name(*datatype, conv_type_name, resultlen);
+    copy_without_null_terminator(type_name, conv_type_name, type_name_len);
+    delete[] conv_type_name;
+}
+
+void YOGIBRIDGE_TYPE_GET_TRUE_EXTENT(YogiMPI_Datatype *datatype, YogiMPI_Aint *true_lb, YogiMPI_Aint *true_extent, int *ierr) {
+    *ierr = YogiMPI_Type_get_true_extent(*datatype, true_lb, true_extent);
+}
+
+void YOGIBRIDGE_TYPE_HINDEXED(int *count, int *array_of_blocklengths, YogiMPI_Aint *array_of_displacements, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_hindexed(*count, array_of_blocklengths, array_of_displacements, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_HVECTOR(int *count, int *blocklength, YogiMPI_Aint *stride, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_hvector(*count, *blocklength, *stride, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_INDEXED(int *count, int *array_of_blocklengths, int *array_of_displacements, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_indexed(*count, array_of_blocklengths, array_of_displacements, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_TYPE_LB(YogiMPI_Datatype *datatype, YogiMPI_Aint *displacement, int *ierr) {
+    *ierr = YogiMPI_Type_lb(*datatype, displacement);
+}
+
+void YOGIBRIDGE_TYPE_MATCH_SIZE(int *typeclass, int *size, YogiMPI_Datatype *datatype, int *ierr) {
+    *ierr = YogiMPI_Type_match_size(*typeclass, *size, datatype);
+}
+
+void YOGIBRIDGE_TYPE_SET_ATTR(YogiMPI_Datatype *datatype, int *type_keyval, void *attribute_val, int *ierr) {
+    *ierr = YogiMPI_Type_set_attr(*datatype, *type_keyval, attribute_val);
+}
+
+void YOGIBRIDGE_TYPE_SET_NAME(YogiMPI_Datatype *datatype, char *type_name, int *ierr, int type_name_len) {
+    char * conv_type_name = copy_and_add_null_terminator(type_name, type_name_len);
+    *ierr = YogiMPI_Type_set_name(*datatype, conv_type_name);
+    delete[] conv_type_name;
+}
+
+void YOGIBRIDGE_TYPE_SIZE(YogiMPI_Datatype *datatype, int *size, int *ierr) {
+    *ierr = YogiMPI_Type_size(*datatype, size);
+}
+
+void YOGIBRIDGE_TYPE_STRUCT(int *count, int *array_of_blocklengths, YogiMPI_Aint *array_of_displacements, YogiMPI_Datatype *array_of_types, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_struct(*count, array_of_blocklengths, array_of_displacements, array_of_types, newtype);
+}
+
+void YOGIBRIDGE_TYPE_UB(YogiMPI_Datatype *datatype, YogiMPI_Aint *displacement, int *ierr) {
+    *ierr = YogiMPI_Type_ub(*datatype, displacement);
+}
+
+void YOGIBRIDGE_TYPE_VECTOR(int *count, int *blocklength, int *stride, YogiMPI_Datatype *oldtype, YogiMPI_Datatype *newtype, int *ierr) {
+    *ierr = YogiMPI_Type_vector(*count, *blocklength, *stride, *oldtype, newtype);
+}
+
+void YOGIBRIDGE_UNPACK(void *inbuf, int *insize, int *position, void *outbuf, int *outcount, YogiMPI_Datatype *datatype, YogiMPI_Comm *comm, int *ierr) {
+    *ierr = YogiMPI_Unpack(inbuf, *insize, position, outbuf, *outcount, *datatype, *comm);
+}
+
+void YOGIBRIDGE_UNPACK_EXTERNAL(char *datarep, void *inbuf, YogiMPI_Aint *insize, YogiMPI_Aint *position, void *outbuf, int *outcount, YogiMPI_Datatype *datatype, int *ierr, int datarep_len) {
+    char * conv_datarep = copy_and_add_null_terminator(datarep, datarep_len);
+    *ierr = YogiMPI_Unpack_external(conv_datarep, inbuf, *insize, position, outbuf, *outcount, *datatype);
+    delete[] conv_datarep;
+}
+
+void YOGIBRIDGE_UNPUBLISH_NAME(char *service_name, YogiMPI_Info *info, char *port_name, int *ierr, int service_name_len, int port_name_len) {
+    char * conv_service_name = copy_and_add_null_terminator(service_name, service_name_len);
+    char * conv_port_name = copy_and_add_null_terminator(port_name, port_name_len);
+    *ierr = YogiMPI_Unpublish_name(conv_service_name, *info, conv_port_name);
+    delete[] conv_service_name;
+    delete[] conv_port_name;
+}
+
+void YOGIBRIDGE_WAIT(YogiMPI_Request *request, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Wait(request, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_WAITALL(int *count, YogiMPI_Request *array_of_requests, YogiMPI_Status *array_of_statuses, int *ierr) {
+    *ierr = YogiMPI_Waitall(*count, array_of_requests, check_status_ignore(array_of_statuses));
+}
+
+void YOGIBRIDGE_WAITANY(int *count, YogiMPI_Request *array_of_requests, int *indx, YogiMPI_Status *status, int *ierr) {
+    *ierr = YogiMPI_Waitany(*count, array_of_requests, indx, check_status_ignore(status));
+}
+
+void YOGIBRIDGE_WAITSOME(int *incount, YogiMPI_Request *array_of_requests, int *outcount, int *array_of_indices, YogiMPI_Status *array_of_statuses, int *ierr) {
+    *ierr = YogiMPI_Waitsome(*incount, array_of_requests, outcount, array_of_indices, check_status_ignore(array_of_statuses));
+}
+
+void YOGIBRIDGE_WIN_ALLOCATE(YogiMPI_Aint *size, int *disp_unit, YogiMPI_Info *info, YogiMPI_Comm *comm, void *baseptr, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_allocate(*size, *disp_unit, *info, *comm, baseptr, win);
+}
+
+void YOGIBRIDGE_WIN_ALLOCATE_SHARED(YogiMPI_Aint *size, int *disp_unit, YogiMPI_Info *info, YogiMPI_Comm *comm, void *baseptr, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_allocate_shared(*size, *disp_unit, *info, *comm, baseptr, win);
+}
+
+void YOGIBRIDGE_WIN_ATTACH(YogiMPI_Win *win, void *base, YogiMPI_Aint *size, int *ierr) {
+    *ierr = YogiMPI_Win_attach(*win, base, *size);
+}
+
+void YOGIBRIDGE_WIN_CALL_ERRHANDLER(YogiMPI_Win *win, int *errorcode, int *ierr) {
+    *ierr = YogiMPI_Win_call_errhandler(*win, *errorcode);
+}
+
+void YOGIBRIDGE_WIN_COMPLETE(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_complete(*win);
+}
+
+void YOGIBRIDGE_WIN_CREATE(void *base, YogiMPI_Aint *size, int *disp_unit, YogiMPI_Info *info, YogiMPI_Comm *comm, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_create(base, *size, *disp_unit, *info, *comm, win);
+}
+
+void YOGIBRIDGE_WIN_CREATE_DYNAMIC(YogiMPI_Info *info, YogiMPI_Comm *comm, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_create_dynamic(*info, *comm, win);
+}
+
+void YOGIBRIDGE_WIN_DELETE_ATTR(YogiMPI_Win *win, int *win_keyval, int *ierr) {
+    *ierr = YogiMPI_Win_delete_attr(*win, *win_keyval);
+}
+
+void YOGIBRIDGE_WIN_DETACH(YogiMPI_Win *win, void *base, int *ierr) {
+    *ierr = YogiMPI_Win_detach(*win, base);
+}
+
+void YOGIBRIDGE_WIN_FENCE(int *assert, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_fence(*assert, *win);
+}
+
+void YOGIBRIDGE_WIN_FLUSH(int *rank, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_flush(*rank, *win);
+}
+
+void YOGIBRIDGE_WIN_FLUSH_ALL(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_flush_all(*win);
+}
+
+void YOGIBRIDGE_WIN_FLUSH_LOCAL(int *rank, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_flush_local(*rank, *win);
+}
+
+void YOGIBRIDGE_WIN_FLUSH_LOCAL_ALL(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_flush_local_all(*win);
+}
+
+void YOGIBRIDGE_WIN_FREE(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_free(win);
+}
+
+void YOGIBRIDGE_WIN_FREE_KEYVAL(int *win_keyval, int *ierr) {
+    *ierr = YogiMPI_Win_free_keyval(win_keyval);
+}
+
+void YOGIBRIDGE_WIN_GET_ATTR(YogiMPI_Win *win, int *win_keyval, void *attribute_val, int *flag, int *ierr) {
+    *ierr = YogiMPI_Win_get_attr(*win, *win_keyval, attribute_val, flag);
+}
+
+void YOGIBRIDGE_WIN_GET_ERRHANDLER(YogiMPI_Win *win, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Win_get_errhandler(*win, errhandler);
+}
+
+void YOGIBRIDGE_WIN_GET_GROUP(YogiMPI_Win *win, YogiMPI_Group *group, int *ierr) {
+    *ierr = YogiMPI_Win_get_group(*win, group);
+}
+
+void YOGIBRIDGE_WIN_GET_INFO(YogiMPI_Win *win, YogiMPI_Info *info_used, int *ierr) {
+    *ierr = YogiMPI_Win_get_info(*win, info_used);
+}
+
+void YOGIBRIDGE_WIN_GET_NAME(YogiMPI_Win *win, char *win_name, int *resultlen, int *ierr, int win_name_len) {
+    char * conv_win_name = allocate_and_add_null_terminator(win_name, win_name_len);
+    *ierr = YogiMPI_Win_get_name(*win, conv_win_name, resultlen);
+    copy_without_null_terminator(win_name, conv_win_name, win_name_len);
+    delete[] conv_win_name;
+}
+
+void YOGIBRIDGE_WIN_LOCK(int *lock_type, int *rank, int *assert, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_lock(*lock_type, *rank, *assert, *win);
+}
+
+void YOGIBRIDGE_WIN_LOCK_ALL(int *assert, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_lock_all(*assert, *win);
+}
+
+void YOGIBRIDGE_WIN_POST(YogiMPI_Group *group, int *assert, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_post(*group, *assert, *win);
+}
+
+void YOGIBRIDGE_WIN_SET_ATTR(YogiMPI_Win *win, int *win_keyval, void *attribute_val, int *ierr) {
+    *ierr = YogiMPI_Win_set_attr(*win, *win_keyval, attribute_val);
+}
+
+void YOGIBRIDGE_WIN_SET_ERRHANDLER(YogiMPI_Win *win, YogiMPI_Errhandler *errhandler, int *ierr) {
+    *ierr = YogiMPI_Win_set_errhandler(*win, *errhandler);
+}
+
+void YOGIBRIDGE_WIN_SET_INFO(YogiMPI_Win *win, YogiMPI_Info *info, int *ierr) {
+    *ierr = YogiMPI_Win_set_info(*win, *info);
+}
+
+void YOGIBRIDGE_WIN_SET_NAME(YogiMPI_Win *win, char *win_name, int *ierr, int win_name_len) {
+    char * conv_win_name = copy_and_add_null_terminator(win_name, win_name_len);
+    *ierr = YogiMPI_Win_set_name(*win, conv_win_name);
+    delete[] conv_win_name;
+}
+
+void YOGIBRIDGE_WIN_SHARED_QUERY(YogiMPI_Win *win, int *rank, YogiMPI_Aint *size, int *disp_unit, void *baseptr, int *ierr) {
+    *ierr = YogiMPI_Win_shared_query(*win, *rank, size, disp_unit, baseptr);
+}
+
+void YOGIBRIDGE_WIN_START(YogiMPI_Group *group, int *assert, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_start(*group, *assert, *win);
+}
+
+void YOGIBRIDGE_WIN_SYNC(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_sync(*win);
+}
+
+void YOGIBRIDGE_WIN_TEST(YogiMPI_Win *win, int *flag, int *ierr) {
+    *ierr = YogiMPI_Win_test(*win, flag);
+}
+
+void YOGIBRIDGE_WIN_UNLOCK(int *rank, YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_unlock(*rank, *win);
+}
+
+void YOGIBRIDGE_WIN_UNLOCK_ALL(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_unlock_all(*win);
+}
+
+void YOGIBRIDGE_WIN_WAIT(YogiMPI_Win *win, int *ierr) {
+    *ierr = YogiMPI_Win_wait(*win);
+}
+
+
+
+}
@@ -0,0 +1,3995 @@
+subroutine Yog_Init(ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Init(ierr)
+end subroutine Yog_Init
+
+
+subroutine Yog_Init_thread(required, provided, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: required
+    integer, intent(out) :: provided
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Init_thread(required, provided, ierr)
+end subroutine
+
+subroutine Yog_Finalize(ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Finalize(ierr)
+end subroutine Yog_Finalize
+
+subroutine Yog_Get_processor_name(name, resultlen, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(out) :: name
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_processor_name(name, resultlen, ierr)
+end subroutine Yog_Get_processor_name
+
+subroutine Yog_Error_string(errorcode, string, resultlen, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: errorcode
+    character(len=*), intent(out) :: string
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Error_string(errorcode, string, resultlen, ierr)
+end subroutine Yog_Error_string
+
+subroutine Yog_Abort(comm, errorcode, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: errorcode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Abort(comm, errorcode, ierr)
+end subroutine Yog_Abort
+
+subroutine Yog_Accumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Accumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win, ierr)
+end subroutine Yog_Accumulate
+
+subroutine Yog_Add_error_class(errorclass, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: errorclass
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Add_error_class(errorclass, ierr)
+end subroutine Yog_Add_error_class
+
+subroutine Yog_Add_error_code(errorclass, errorcode, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: errorclass
+    integer, intent(out) :: errorcode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Add_error_code(errorclass, errorcode, ierr)
+end subroutine Yog_Add_error_code
+
+subroutine Yog_Add_error_string(errorcode, string, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: errorcode
+    character(len=*), intent(in) :: string
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Add_error_string(errorcode, string, ierr)
+end subroutine Yog_Add_error_string
+
+subroutine Yog_Address(location, address, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: location
+    integer(Yog_INTEGER_KIND), intent(out) :: address
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Address(location, address, ierr)
+end subroutine Yog_Address
+
+subroutine Yog_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+end subroutine Yog_Allgather
+
+subroutine Yog_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts
+    integer, intent(in) :: displs
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, ierr)
+end subroutine Yog_Allgatherv
+
+subroutine Yog_Alloc_mem(size, info, baseptr, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: size
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: baseptr
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Alloc_mem(size, info, baseptr, ierr)
+end subroutine Yog_Alloc_mem
+
+subroutine Yog_Allreduce(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Allreduce(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+end subroutine Yog_Allreduce
+
+subroutine Yog_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+end subroutine Yog_Alltoall
+
+subroutine Yog_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts
+    integer, intent(in) :: sdispls
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts
+    integer, intent(in) :: rdispls
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, ierr)
+end subroutine Yog_Alltoallv
+
+subroutine Yog_Alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtypes(*)
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtypes(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, ierr)
+end subroutine Yog_Alltoallw
+
+subroutine Yog_Attr_delete(comm, keyval, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Attr_delete(comm, keyval, ierr)
+end subroutine Yog_Attr_delete
+
+subroutine Yog_Attr_get(comm, keyval, attribute_val, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: keyval
+    integer, intent(out) :: attribute_val
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Attr_get(comm, keyval, attribute_val, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Attr_get
+
+subroutine Yog_Attr_put(comm, keyval, attribute_val, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: keyval
+    integer, intent(in) :: attribute_val
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Attr_put(comm, keyval, attribute_val, ierr)
+end subroutine Yog_Attr_put
+
+subroutine Yog_Barrier(comm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Barrier(comm, ierr)
+end subroutine Yog_Barrier
+
+subroutine Yog_Bcast(buffer, count, datatype, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buffer
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Bcast(buffer, count, datatype, root, comm, ierr)
+end subroutine Yog_Bcast
+
+subroutine Yog_Bsend(buf, count, datatype, dest, tag, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Bsend(buf, count, datatype, dest, tag, comm, ierr)
+end subroutine Yog_Bsend
+
+subroutine Yog_Bsend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Bsend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Bsend_init
+
+subroutine Yog_Buffer_attach(buffer, size, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buffer
+    integer, intent(in) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Buffer_attach(buffer, size, ierr)
+end subroutine Yog_Buffer_attach
+
+subroutine Yog_Buffer_detach(buffer_addr, size, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: buffer_addr
+    integer, intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Buffer_detach(buffer_addr, size, ierr)
+end subroutine Yog_Buffer_detach
+
+subroutine Yog_Cancel(request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cancel(request, ierr)
+end subroutine Yog_Cancel
+
+subroutine Yog_Cart_coords(comm, rank, maxdims, coords, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: rank
+    integer, intent(in) :: maxdims
+    integer, intent(out) :: coords(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_coords(comm, rank, maxdims, coords, ierr)
+end subroutine Yog_Cart_coords
+
+subroutine Yog_Cart_create(comm_old, ndims, dims, periods, reorder, comm_cart, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm_old
+    integer, intent(in) :: ndims
+    integer, intent(in) :: dims(*)
+    integer, intent(in) :: periods(*)
+    integer, intent(in) :: reorder
+    integer(Yog_INTEGER_KIND), intent(out) :: comm_cart
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_create(comm_old, ndims, dims, periods, reorder, comm_cart, ierr)
+end subroutine Yog_Cart_create
+
+subroutine Yog_Cart_get(comm, maxdims, dims, periods, coords, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: maxdims
+    integer, intent(out) :: dims(*)
+    integer, intent(out) :: periods(*)
+    integer, intent(out) :: coords(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_get(comm, maxdims, dims, periods, coords, ierr)
+end subroutine Yog_Cart_get
+
+subroutine Yog_Cart_map(comm, ndims, dims, periods, newrank, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: ndims
+    integer, intent(in) :: dims(*)
+    integer, intent(in) :: periods(*)
+    integer, intent(out) :: newrank
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_map(comm, ndims, dims, periods, newrank, ierr)
+end subroutine Yog_Cart_map
+
+subroutine Yog_Cart_rank(comm, coords, rank, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: coords(*)
+    integer, intent(out) :: rank
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_rank(comm, coords, rank, ierr)
+end subroutine Yog_Cart_rank
+
+subroutine Yog_Cart_shift(comm, direction, disp, rank_source, rank_dest, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: direction
+    integer, intent(in) :: disp
+    integer, intent(out) :: rank_source
+    integer, intent(out) :: rank_dest
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_shift(comm, direction, disp, rank_source, rank_dest, ierr)
+end subroutine Yog_Cart_shift
+
+subroutine Yog_Cart_sub(comm, remain_dims, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: remain_dims(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cart_sub(comm, remain_dims, newcomm, ierr)
+end subroutine Yog_Cart_sub
+
+subroutine Yog_Cartdim_get(comm, ndims, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ndims
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Cartdim_get(comm, ndims, ierr)
+end subroutine Yog_Cartdim_get
+
+subroutine Yog_Close_port(port_name, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: port_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Close_port(port_name, ierr)
+end subroutine Yog_Close_port
+
+subroutine Yog_Comm_accept(port_name, info, root, comm, newcomm, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: port_name
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_accept(port_name, info, root, comm, newcomm, ierr)
+end subroutine Yog_Comm_accept
+
+subroutine Yog_Comm_call_errhandler(comm, errorcode, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: errorcode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_call_errhandler(comm, errorcode, ierr)
+end subroutine Yog_Comm_call_errhandler
+
+subroutine Yog_Comm_compare(comm1, comm2, result, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm1
+    integer(Yog_INTEGER_KIND), intent(in) :: comm2
+    integer, intent(out) :: result
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_compare(comm1, comm2, result, ierr)
+end subroutine Yog_Comm_compare
+
+subroutine Yog_Comm_connect(port_name, info, root, comm, newcomm, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: port_name
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_connect(port_name, info, root, comm, newcomm, ierr)
+end subroutine Yog_Comm_connect
+
+subroutine Yog_Comm_create(comm, group, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_create(comm, group, newcomm, ierr)
+end subroutine Yog_Comm_create
+
+subroutine Yog_Comm_create_group(comm, group, tag, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_create_group(comm, group, tag, newcomm, ierr)
+end subroutine Yog_Comm_create_group
+
+subroutine Yog_Comm_delete_attr(comm, comm_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: comm_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_delete_attr(comm, comm_keyval, ierr)
+end subroutine Yog_Comm_delete_attr
+
+subroutine Yog_Comm_disconnect(comm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(inout) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_disconnect(comm, ierr)
+end subroutine Yog_Comm_disconnect
+
+subroutine Yog_Comm_dup(comm, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_dup(comm, newcomm, ierr)
+end subroutine Yog_Comm_dup
+
+subroutine Yog_Comm_dup_with_info(comm, info, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_dup_with_info(comm, info, newcomm, ierr)
+end subroutine Yog_Comm_dup_with_info
+
+subroutine Yog_Comm_free(comm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_free(comm, ierr)
+end subroutine Yog_Comm_free
+
+subroutine Yog_Comm_free_keyval(comm_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(inout) :: comm_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_free_keyval(comm_keyval, ierr)
+end subroutine Yog_Comm_free_keyval
+
+subroutine Yog_Comm_get_attr(comm, comm_keyval, attribute_val, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: comm_keyval
+    integer, intent(out) :: attribute_val
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_get_attr(comm, comm_keyval, attribute_val, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Comm_get_attr
+
+subroutine Yog_Comm_get_errhandler(comm, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_get_errhandler(comm, errhandler, ierr)
+end subroutine Yog_Comm_get_errhandler
+
+subroutine Yog_Comm_get_info(comm, info_used, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: info_used
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_get_info(comm, info_used, ierr)
+end subroutine Yog_Comm_get_info
+
+subroutine Yog_Comm_get_name(comm, comm_name, resultlen, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    character(len=*), intent(out) :: comm_name
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_get_name(comm, comm_name, resultlen, ierr)
+end subroutine Yog_Comm_get_name
+
+subroutine Yog_Comm_get_parent(parent, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(out) :: parent
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_get_parent(parent, ierr)
+end subroutine Yog_Comm_get_parent
+
+subroutine Yog_Comm_group(comm, group, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: group
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_group(comm, group, ierr)
+end subroutine Yog_Comm_group
+
+subroutine Yog_Comm_idup(comm, newcomm, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_idup(comm, newcomm, request, ierr)
+end subroutine Yog_Comm_idup
+
+subroutine Yog_Comm_join(fd, intercomm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: fd
+    integer(Yog_INTEGER_KIND), intent(out) :: intercomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_join(fd, intercomm, ierr)
+end subroutine Yog_Comm_join
+
+subroutine Yog_Comm_rank(comm, rank, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: rank
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_rank(comm, rank, ierr)
+end subroutine Yog_Comm_rank
+
+subroutine Yog_Comm_remote_group(comm, group, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: group
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_remote_group(comm, group, ierr)
+end subroutine Yog_Comm_remote_group
+
+subroutine Yog_Comm_remote_size(comm, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_remote_size(comm, size, ierr)
+end subroutine Yog_Comm_remote_size
+
+subroutine Yog_Comm_set_attr(comm, comm_keyval, attribute_val, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: comm_keyval
+    integer, intent(in) :: attribute_val
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_set_attr(comm, comm_keyval, attribute_val, ierr)
+end subroutine Yog_Comm_set_attr
+
+subroutine Yog_Comm_set_errhandler(comm, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_set_errhandler(comm, errhandler, ierr)
+end subroutine Yog_Comm_set_errhandler
+
+subroutine Yog_Comm_set_info(comm, info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_set_info(comm, info, ierr)
+end subroutine Yog_Comm_set_info
+
+subroutine Yog_Comm_set_name(comm, comm_name, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    character(len=*), intent(in) :: comm_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_set_name(comm, comm_name, ierr)
+end subroutine Yog_Comm_set_name
+
+subroutine Yog_Comm_size(comm, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_size(comm, size, ierr)
+end subroutine Yog_Comm_size
+
+subroutine Yog_Comm_split(comm, color, key, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: color
+    integer, intent(in) :: key
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_split(comm, color, key, newcomm, ierr)
+end subroutine Yog_Comm_split
+
+subroutine Yog_Comm_split_type(comm, split_type, key, info, newcomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: split_type
+    integer, intent(in) :: key
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(out) :: newcomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_split_type(comm, split_type, key, info, newcomm, ierr)
+end subroutine Yog_Comm_split_type
+
+subroutine Yog_Comm_test_inter(comm, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Comm_test_inter(comm, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Comm_test_inter
+
+subroutine Yog_Compare_and_swap(origin_addr, compare_addr, result_addr, datatype, target_rank, target_disp, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: compare_addr
+    integer, intent(in) :: result_addr
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Compare_and_swap(origin_addr, compare_addr, result_addr, datatype, target_rank, target_disp, win, ierr)
+end subroutine Yog_Compare_and_swap
+
+subroutine Yog_Dims_create(nnodes, ndims, dims, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: nnodes
+    integer, intent(in) :: ndims
+    integer, intent(in) :: dims(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Dims_create(nnodes, ndims, dims, ierr)
+end subroutine Yog_Dims_create
+
+subroutine Yog_Dist_graph_create(comm_old, n, sources, degrees, destinations, weights, info, reorder, comm_dist_graph, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm_old
+    integer, intent(in) :: n
+    integer, intent(in) :: sources(*)
+    integer, intent(in) :: degrees(*)
+    integer, intent(in) :: destinations(*)
+    integer, intent(in) :: weights(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(in) :: reorder
+    integer(Yog_INTEGER_KIND), intent(out) :: comm_dist_graph
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Dist_graph_create(comm_old, n, sources, degrees, destinations, weights, info, reorder, comm_dist_graph, ierr)
+end subroutine Yog_Dist_graph_create
+
+subroutine Yog_Dist_graph_create_adjacent(comm_old, indegree, sources, sourceweights, outdegree, destinations, destweights, info, reorder, comm_dist_graph, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm_old
+    integer, intent(in) :: indegree
+    integer, intent(in) :: sources(*)
+    integer, intent(in) :: sourceweights(*)
+    integer, intent(in) :: outdegree
+    integer, intent(in) :: destinations(*)
+    integer, intent(in) :: destweights(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(in) :: reorder
+    integer(Yog_INTEGER_KIND), intent(out) :: comm_dist_graph
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Dist_graph_create_adjacent(comm_old, indegree, sources, sourceweights, outdegree, destinations, destweights, info, reorder, comm_dist_graph, ierr)
+end subroutine Yog_Dist_graph_create_adjacent
+
+subroutine Yog_Dist_graph_neighbors(comm, maxindegree, sources, sourceweights, maxoutdegree, destinations, destweights, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: maxindegree
+    integer, intent(out) :: sources(*)
+    integer, intent(out) :: sourceweights(*)
+    integer, intent(in) :: maxoutdegree
+    integer, intent(out) :: destinations(*)
+    integer, intent(out) :: destweights(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Dist_graph_neighbors(comm, maxindegree, sources, sourceweights, maxoutdegree, destinations, destweights, ierr)
+end subroutine Yog_Dist_graph_neighbors
+
+subroutine Yog_Dist_graph_neighbors_count(comm, indegree, outdegree, weighted, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: indegree
+    integer, intent(out) :: outdegree
+    integer, intent(out) :: weighted
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Dist_graph_neighbors_count(comm, indegree, outdegree, weighted, ierr)
+end subroutine Yog_Dist_graph_neighbors_count
+
+subroutine Yog_Errhandler_free(errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Errhandler_free(errhandler, ierr)
+end subroutine Yog_Errhandler_free
+
+subroutine Yog_Errhandler_get(comm, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Errhandler_get(comm, errhandler, ierr)
+end subroutine Yog_Errhandler_get
+
+subroutine Yog_Errhandler_set(comm, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(in) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Errhandler_set(comm, errhandler, ierr)
+end subroutine Yog_Errhandler_set
+
+subroutine Yog_Exscan(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Exscan(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+end subroutine Yog_Exscan
+
+subroutine Yog_Fetch_and_op(origin_addr, result_addr, datatype, target_rank, target_disp, op, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: result_addr
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Fetch_and_op(origin_addr, result_addr, datatype, target_rank, target_disp, op, win, ierr)
+end subroutine Yog_Fetch_and_op
+
+subroutine Yog_File_call_errhandler(fh, errorcode, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: errorcode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_call_errhandler(fh, errorcode, ierr)
+end subroutine Yog_File_call_errhandler
+
+subroutine Yog_File_close(fh, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_close(fh, ierr)
+end subroutine Yog_File_close
+
+subroutine Yog_File_delete(filename, info, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: filename
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_delete(filename, info, ierr)
+end subroutine Yog_File_delete
+
+subroutine Yog_File_get_amode(fh, amode, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: amode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_amode(fh, amode, ierr)
+end subroutine Yog_File_get_amode
+
+subroutine Yog_File_get_atomicity(fh, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_atomicity(fh, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_File_get_atomicity
+
+subroutine Yog_File_get_byte_offset(fh, offset, disp, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer(Yog_OFFSET_KIND), intent(out) :: disp
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_byte_offset(fh, offset, disp, ierr)
+end subroutine Yog_File_get_byte_offset
+
+subroutine Yog_File_get_errhandler(file, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: file
+    integer(Yog_INTEGER_KIND), intent(out) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_errhandler(file, errhandler, ierr)
+end subroutine Yog_File_get_errhandler
+
+subroutine Yog_File_get_group(fh, group, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_INTEGER_KIND), intent(out) :: group
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_group(fh, group, ierr)
+end subroutine Yog_File_get_group
+
+subroutine Yog_File_get_info(fh, info_used, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_INTEGER_KIND), intent(out) :: info_used
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_info(fh, info_used, ierr)
+end subroutine Yog_File_get_info
+
+subroutine Yog_File_get_position(fh, offset, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(out) :: offset
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_position(fh, offset, ierr)
+end subroutine Yog_File_get_position
+
+subroutine Yog_File_get_position_shared(fh, offset, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(out) :: offset
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_position_shared(fh, offset, ierr)
+end subroutine Yog_File_get_position_shared
+
+subroutine Yog_File_get_size(fh, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_size(fh, size, ierr)
+end subroutine Yog_File_get_size
+
+subroutine Yog_File_get_type_extent(fh, datatype, extent, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: extent
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_type_extent(fh, datatype, extent, ierr)
+end subroutine Yog_File_get_type_extent
+
+subroutine Yog_File_get_view(fh, disp, etype, filetype, datarep, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(out) :: disp
+    integer(Yog_INTEGER_KIND), intent(out) :: etype
+    integer(Yog_INTEGER_KIND), intent(out) :: filetype
+    character(len=*), intent(out) :: datarep
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_get_view(fh, disp, etype, filetype, datarep, ierr)
+end subroutine Yog_File_get_view
+
+subroutine Yog_File_iread(fh, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iread(fh, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iread
+
+subroutine Yog_File_iread_at(fh, offset, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iread_at(fh, offset, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iread_at
+
+subroutine Yog_File_iread_shared(fh, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iread_shared(fh, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iread_shared
+
+subroutine Yog_File_iwrite(fh, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iwrite(fh, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iwrite
+
+subroutine Yog_File_iwrite_at(fh, offset, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iwrite_at(fh, offset, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iwrite_at
+
+subroutine Yog_File_iwrite_shared(fh, buf, count, datatype, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_iwrite_shared(fh, buf, count, datatype, request, ierr)
+end subroutine Yog_File_iwrite_shared
+
+subroutine Yog_File_open(comm, filename, amode, info, fh, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    character(len=*), intent(in) :: filename
+    integer, intent(in) :: amode
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(out) :: fh
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_open(comm, filename, amode, info, fh, ierr)
+end subroutine Yog_File_open
+
+subroutine Yog_File_preallocate(fh, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_preallocate(fh, size, ierr)
+end subroutine Yog_File_preallocate
+
+subroutine Yog_File_read(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read
+
+subroutine Yog_File_read_all(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_all(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read_all
+
+subroutine Yog_File_read_all_begin(fh, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_all_begin(fh, buf, count, datatype, ierr)
+end subroutine Yog_File_read_all_begin
+
+subroutine Yog_File_read_all_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_all_end(fh, buf, status, ierr)
+end subroutine Yog_File_read_all_end
+
+subroutine Yog_File_read_at(fh, offset, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_at(fh, offset, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read_at
+
+subroutine Yog_File_read_at_all(fh, offset, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_at_all(fh, offset, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read_at_all
+
+subroutine Yog_File_read_at_all_begin(fh, offset, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_at_all_begin(fh, offset, buf, count, datatype, ierr)
+end subroutine Yog_File_read_at_all_begin
+
+subroutine Yog_File_read_at_all_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_at_all_end(fh, buf, status, ierr)
+end subroutine Yog_File_read_at_all_end
+
+subroutine Yog_File_read_ordered(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_ordered(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read_ordered
+
+subroutine Yog_File_read_ordered_begin(fh, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_ordered_begin(fh, buf, count, datatype, ierr)
+end subroutine Yog_File_read_ordered_begin
+
+subroutine Yog_File_read_ordered_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_ordered_end(fh, buf, status, ierr)
+end subroutine Yog_File_read_ordered_end
+
+subroutine Yog_File_read_shared(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_read_shared(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_read_shared
+
+subroutine Yog_File_seek(fh, offset, whence, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: whence
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_seek(fh, offset, whence, ierr)
+end subroutine Yog_File_seek
+
+subroutine Yog_File_seek_shared(fh, offset, whence, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: whence
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_seek_shared(fh, offset, whence, ierr)
+end subroutine Yog_File_seek_shared
+
+subroutine Yog_File_set_atomicity(fh, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    logical, intent(in) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    conv_flag = Yogi_LogicalToInteger(flag)
+    call YogiBridge_File_set_atomicity(fh, conv_flag, ierr)
+end subroutine Yog_File_set_atomicity
+
+subroutine Yog_File_set_errhandler(file, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: file
+    integer(Yog_INTEGER_KIND), intent(in) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_set_errhandler(file, errhandler, ierr)
+end subroutine Yog_File_set_errhandler
+
+subroutine Yog_File_set_info(fh, info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_set_info(fh, info, ierr)
+end subroutine Yog_File_set_info
+
+subroutine Yog_File_set_size(fh, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_set_size(fh, size, ierr)
+end subroutine Yog_File_set_size
+
+subroutine Yog_File_set_view(fh, disp, etype, filetype, datarep, info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: disp
+    integer(Yog_INTEGER_KIND), intent(in) :: etype
+    integer(Yog_INTEGER_KIND), intent(in) :: filetype
+    character(len=*), intent(in) :: datarep
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_set_view(fh, disp, etype, filetype, datarep, info, ierr)
+end subroutine Yog_File_set_view
+
+subroutine Yog_File_sync(fh, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_sync(fh, ierr)
+end subroutine Yog_File_sync
+
+subroutine Yog_File_write(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write
+
+subroutine Yog_File_write_all(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_all(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write_all
+
+subroutine Yog_File_write_all_begin(fh, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_all_begin(fh, buf, count, datatype, ierr)
+end subroutine Yog_File_write_all_begin
+
+subroutine Yog_File_write_all_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_all_end(fh, buf, status, ierr)
+end subroutine Yog_File_write_all_end
+
+subroutine Yog_File_write_at(fh, offset, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_at(fh, offset, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write_at
+
+subroutine Yog_File_write_at_all(fh, offset, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_at_all(fh, offset, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write_at_all
+
+subroutine Yog_File_write_at_all_begin(fh, offset, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer(Yog_OFFSET_KIND), intent(in) :: offset
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_at_all_begin(fh, offset, buf, count, datatype, ierr)
+end subroutine Yog_File_write_at_all_begin
+
+subroutine Yog_File_write_at_all_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_at_all_end(fh, buf, status, ierr)
+end subroutine Yog_File_write_at_all_end
+
+subroutine Yog_File_write_ordered(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_ordered(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write_ordered
+
+subroutine Yog_File_write_ordered_begin(fh, buf, count, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_ordered_begin(fh, buf, count, datatype, ierr)
+end subroutine Yog_File_write_ordered_begin
+
+subroutine Yog_File_write_ordered_end(fh, buf, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(out) :: buf
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_ordered_end(fh, buf, status, ierr)
+end subroutine Yog_File_write_ordered_end
+
+subroutine Yog_File_write_shared(fh, buf, count, datatype, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: fh
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_File_write_shared(fh, buf, count, datatype, status, ierr)
+end subroutine Yog_File_write_shared
+
+subroutine Yog_Finalized(flag, ierr)
+    use yogimpi
+    implicit none
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Finalized(conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Finalized
+
+subroutine Yog_Free_mem(base, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: base
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Free_mem(base, ierr)
+end subroutine Yog_Free_mem
+
+subroutine Yog_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+end subroutine Yog_Gather
+
+subroutine Yog_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts
+    integer, intent(in) :: displs
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, ierr)
+end subroutine Yog_Gatherv
+
+subroutine Yog_Get(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, ierr)
+end subroutine Yog_Get
+
+subroutine Yog_Get_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: result_addr
+    integer, intent(in) :: result_count
+    integer(Yog_INTEGER_KIND), intent(in) :: result_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win, ierr)
+end subroutine Yog_Get_accumulate
+
+subroutine Yog_Get_address(location, address, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: location
+    integer(Yog_INTEGER_KIND), intent(out) :: address
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_address(location, address, ierr)
+end subroutine Yog_Get_address
+
+subroutine Yog_Get_count(status, datatype, count, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: status
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: count
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_count(status, datatype, count, ierr)
+end subroutine Yog_Get_count
+
+subroutine Yog_Get_elements(status, datatype, count, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: status
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: count
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_elements(status, datatype, count, ierr)
+end subroutine Yog_Get_elements
+
+subroutine Yog_Get_library_version(version, resultlen, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(out) :: version
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_library_version(version, resultlen, ierr)
+end subroutine Yog_Get_library_version
+
+subroutine Yog_Get_version(version, subversion, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: version
+    integer, intent(out) :: subversion
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Get_version(version, subversion, ierr)
+end subroutine Yog_Get_version
+
+subroutine Yog_Graph_create(comm_old, nnodes, indx, edges, reorder, comm_graph, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm_old
+    integer, intent(in) :: nnodes
+    integer, intent(in) :: indx(*)
+    integer, intent(in) :: edges(*)
+    integer, intent(in) :: reorder
+    integer(Yog_INTEGER_KIND), intent(out) :: comm_graph
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graph_create(comm_old, nnodes, indx, edges, reorder, comm_graph, ierr)
+end subroutine Yog_Graph_create
+
+subroutine Yog_Graph_get(comm, maxindex, maxedges, indx, edges, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: maxindex
+    integer, intent(in) :: maxedges
+    integer, intent(out) :: indx(*)
+    integer, intent(out) :: edges(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graph_get(comm, maxindex, maxedges, indx, edges, ierr)
+end subroutine Yog_Graph_get
+
+subroutine Yog_Graph_map(comm, nnodes, indx, edges, newrank, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: nnodes
+    integer, intent(in) :: indx(*)
+    integer, intent(in) :: edges(*)
+    integer, intent(out) :: newrank
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graph_map(comm, nnodes, indx, edges, newrank, ierr)
+end subroutine Yog_Graph_map
+
+subroutine Yog_Graph_neighbors(comm, rank, maxneighbors, neighbors, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: rank
+    integer, intent(in) :: maxneighbors
+    integer, intent(out) :: neighbors(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graph_neighbors(comm, rank, maxneighbors, neighbors, ierr)
+end subroutine Yog_Graph_neighbors
+
+subroutine Yog_Graph_neighbors_count(comm, rank, nneighbors, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(in) :: rank
+    integer, intent(out) :: nneighbors
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graph_neighbors_count(comm, rank, nneighbors, ierr)
+end subroutine Yog_Graph_neighbors_count
+
+subroutine Yog_Graphdims_get(comm, nnodes, nedges, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: nnodes
+    integer, intent(out) :: nedges
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Graphdims_get(comm, nnodes, nedges, ierr)
+end subroutine Yog_Graphdims_get
+
+subroutine Yog_Grequest_complete(request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Grequest_complete(request, ierr)
+end subroutine Yog_Grequest_complete
+
+subroutine Yog_Group_compare(group1, group2, result, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group1
+    integer(Yog_INTEGER_KIND), intent(in) :: group2
+    integer, intent(out) :: result
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_compare(group1, group2, result, ierr)
+end subroutine Yog_Group_compare
+
+subroutine Yog_Group_difference(group1, group2, newgroup, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group1
+    integer(Yog_INTEGER_KIND), intent(in) :: group2
+    integer(Yog_INTEGER_KIND), intent(out) :: newgroup
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_difference(group1, group2, newgroup, ierr)
+end subroutine Yog_Group_difference
+
+subroutine Yog_Group_excl(group, n, ranks, newgroup, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: n
+    integer, intent(in) :: ranks(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: newgroup
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_excl(group, n, ranks, newgroup, ierr)
+end subroutine Yog_Group_excl
+
+subroutine Yog_Group_free(group, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_free(group, ierr)
+end subroutine Yog_Group_free
+
+subroutine Yog_Group_incl(group, n, ranks, newgroup, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: n
+    integer, intent(in) :: ranks(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: newgroup
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_incl(group, n, ranks, newgroup, ierr)
+end subroutine Yog_Group_incl
+
+subroutine Yog_Group_intersection(group1, group2, newgroup, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group1
+    integer(Yog_INTEGER_KIND), intent(in) :: group2
+    integer(Yog_INTEGER_KIND), intent(out) :: newgroup
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_intersection(group1, group2, newgroup, ierr)
+end subroutine Yog_Group_intersection
+
+subroutine Yog_Group_rank(group, rank, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(out) :: rank
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_rank(group, rank, ierr)
+end subroutine Yog_Group_rank
+
+subroutine Yog_Group_size(group, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_size(group, size, ierr)
+end subroutine Yog_Group_size
+
+subroutine Yog_Group_translate_ranks(group1, n, ranks1, group2, ranks2, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group1
+    integer, intent(in) :: n
+    integer, intent(in) :: ranks1(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: group2
+    integer, intent(out) :: ranks2(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_translate_ranks(group1, n, ranks1, group2, ranks2, ierr)
+end subroutine Yog_Group_translate_ranks
+
+subroutine Yog_Group_union(group1, group2, newgroup, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group1
+    integer(Yog_INTEGER_KIND), intent(in) :: group2
+    integer(Yog_INTEGER_KIND), intent(out) :: newgroup
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Group_union(group1, group2, newgroup, ierr)
+end subroutine Yog_Group_union
+
+subroutine Yog_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+end subroutine Yog_Iallgather
+
+subroutine Yog_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: displs(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request, ierr)
+end subroutine Yog_Iallgatherv
+
+subroutine Yog_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+end subroutine Yog_Iallreduce
+
+subroutine Yog_Ialltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ialltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+end subroutine Yog_Ialltoall
+
+subroutine Yog_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request, ierr)
+end subroutine Yog_Ialltoallv
+
+subroutine Yog_Ialltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtypes(*)
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtypes(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ialltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request, ierr)
+end subroutine Yog_Ialltoallw
+
+subroutine Yog_Ibarrier(comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ibarrier(comm, request, ierr)
+end subroutine Yog_Ibarrier
+
+subroutine Yog_Ibcast(buffer, count, datatype, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buffer
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ibcast(buffer, count, datatype, root, comm, request, ierr)
+end subroutine Yog_Ibcast
+
+subroutine Yog_Ibsend(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ibsend(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Ibsend
+
+subroutine Yog_Iexscan(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iexscan(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+end subroutine Yog_Iexscan
+
+subroutine Yog_Igather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Igather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+end subroutine Yog_Igather
+
+subroutine Yog_Igatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: displs(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Igatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, request, ierr)
+end subroutine Yog_Igatherv
+
+subroutine Yog_Ineighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ineighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+end subroutine Yog_Ineighbor_allgather
+
+subroutine Yog_Ineighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: displs(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ineighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request, ierr)
+end subroutine Yog_Ineighbor_allgatherv
+
+subroutine Yog_Ineighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ineighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request, ierr)
+end subroutine Yog_Ineighbor_alltoall
+
+subroutine Yog_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, request, ierr)
+end subroutine Yog_Ineighbor_alltoallv
+
+subroutine Yog_Ineighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtypes(*)
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtypes(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ineighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, request, ierr)
+end subroutine Yog_Ineighbor_alltoallw
+
+subroutine Yog_Info_create(info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(out) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_create(info, ierr)
+end subroutine Yog_Info_create
+
+subroutine Yog_Info_delete(info, key, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: key
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_delete(info, key, ierr)
+end subroutine Yog_Info_delete
+
+subroutine Yog_Info_dup(info, newinfo, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(out) :: newinfo
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_dup(info, newinfo, ierr)
+end subroutine Yog_Info_dup
+
+subroutine Yog_Info_free(info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_free(info, ierr)
+end subroutine Yog_Info_free
+
+subroutine Yog_Info_get(info, key, valuelen, value, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: key
+    integer, intent(in) :: valuelen
+    character(len=*), intent(out) :: value
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_get(info, key, valuelen, value, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Info_get
+
+subroutine Yog_Info_get_nkeys(info, nkeys, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: nkeys
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_get_nkeys(info, nkeys, ierr)
+end subroutine Yog_Info_get_nkeys
+
+subroutine Yog_Info_get_nthkey(info, n, key, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(in) :: n
+    character(len=*), intent(out) :: key
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_get_nthkey(info, n, key, ierr)
+end subroutine Yog_Info_get_nthkey
+
+subroutine Yog_Info_get_valuelen(info, key, valuelen, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: key
+    integer, intent(out) :: valuelen
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_get_valuelen(info, key, valuelen, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Info_get_valuelen
+
+subroutine Yog_Info_set(info, key, value, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: key
+    character(len=*), intent(in) :: value
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Info_set(info, key, value, ierr)
+end subroutine Yog_Info_set
+
+subroutine Yog_Initialized(flag, ierr)
+    use yogimpi
+    implicit none
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Initialized(conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Initialized
+
+subroutine Yog_Intercomm_create(local_comm, local_leader, peer_comm, remote_leader, tag, newintercomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: local_comm
+    integer, intent(in) :: local_leader
+    integer(Yog_INTEGER_KIND), intent(in) :: peer_comm
+    integer, intent(in) :: remote_leader
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(out) :: newintercomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Intercomm_create(local_comm, local_leader, peer_comm, remote_leader, tag, newintercomm, ierr)
+end subroutine Yog_Intercomm_create
+
+subroutine Yog_Intercomm_merge(intercomm, high, newintracomm, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: intercomm
+    integer, intent(in) :: high
+    integer(Yog_INTEGER_KIND), intent(out) :: newintracomm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Intercomm_merge(intercomm, high, newintracomm, ierr)
+end subroutine Yog_Intercomm_merge
+
+subroutine Yog_Iprobe(source, tag, comm, flag, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: source
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iprobe(source, tag, comm, conv_flag, status, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Iprobe
+
+subroutine Yog_Irecv(buf, count, datatype, source, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: source
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Irecv(buf, count, datatype, source, tag, comm, request, ierr)
+end subroutine Yog_Irecv
+
+subroutine Yog_Ireduce(sendbuf, recvbuf, count, datatype, op, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ireduce(sendbuf, recvbuf, count, datatype, op, root, comm, request, ierr)
+end subroutine Yog_Ireduce
+
+subroutine Yog_Ireduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ireduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm, request, ierr)
+end subroutine Yog_Ireduce_scatter
+
+subroutine Yog_Ireduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ireduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm, request, ierr)
+end subroutine Yog_Ireduce_scatter_block
+
+subroutine Yog_Irsend(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Irsend(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Irsend
+
+subroutine Yog_Is_thread_main(flag, ierr)
+    use yogimpi
+    implicit none
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Is_thread_main(conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Is_thread_main
+
+subroutine Yog_Iscan(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iscan(sendbuf, recvbuf, count, datatype, op, comm, request, ierr)
+end subroutine Yog_Iscan
+
+subroutine Yog_Iscatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iscatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+end subroutine Yog_Iscatter
+
+subroutine Yog_Iscatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: displs(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Iscatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, request, ierr)
+end subroutine Yog_Iscatterv
+
+subroutine Yog_Isend(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Isend(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Isend
+
+subroutine Yog_Issend(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Issend(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Issend
+
+subroutine Yog_Keyval_free(keyval, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(inout) :: keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Keyval_free(keyval, ierr)
+end subroutine Yog_Keyval_free
+
+subroutine Yog_Lookup_name(service_name, info, port_name, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: service_name
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(out) :: port_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Lookup_name(service_name, info, port_name, ierr)
+end subroutine Yog_Lookup_name
+
+subroutine Yog_Neighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Neighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+end subroutine Yog_Neighbor_allgather
+
+subroutine Yog_Neighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: displs(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Neighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, ierr)
+end subroutine Yog_Neighbor_allgatherv
+
+subroutine Yog_Neighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Neighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, ierr)
+end subroutine Yog_Neighbor_alltoall
+
+subroutine Yog_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer, intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer, intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm, ierr)
+end subroutine Yog_Neighbor_alltoallv
+
+subroutine Yog_Neighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtypes(*)
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: rdispls(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtypes(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Neighbor_alltoallw(sendbuf, sendcounts, sdispls, sendtypes, recvbuf, recvcounts, rdispls, recvtypes, comm, ierr)
+end subroutine Yog_Neighbor_alltoallw
+
+subroutine Yog_Op_commutative(op, commute, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer, intent(out) :: commute
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Op_commutative(op, commute, ierr)
+end subroutine Yog_Op_commutative
+
+subroutine Yog_Op_free(op, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Op_free(op, ierr)
+end subroutine Yog_Op_free
+
+subroutine Yog_Open_port(info, port_name, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(out) :: port_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Open_port(info, port_name, ierr)
+end subroutine Yog_Open_port
+
+subroutine Yog_Pack(inbuf, incount, datatype, outbuf, outsize, position, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: inbuf
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: outbuf
+    integer, intent(in) :: outsize
+    integer, intent(inout) :: position
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Pack(inbuf, incount, datatype, outbuf, outsize, position, comm, ierr)
+end subroutine Yog_Pack
+
+subroutine Yog_Pack_external(datarep, inbuf, incount, datatype, outbuf, outsize, position, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: datarep
+    integer, intent(in) :: inbuf
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: outbuf
+    integer(Yog_INTEGER_KIND), intent(in) :: outsize
+    integer(Yog_INTEGER_KIND), intent(inout) :: position
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Pack_external(datarep, inbuf, incount, datatype, outbuf, outsize, position, ierr)
+end subroutine Yog_Pack_external
+
+subroutine Yog_Pack_external_size(datarep, incount, datatype, size, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: datarep
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Pack_external_size(datarep, incount, datatype, size, ierr)
+end subroutine Yog_Pack_external_size
+
+subroutine Yog_Pack_size(incount, datatype, comm, size, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Pack_size(incount, datatype, comm, size, ierr)
+end subroutine Yog_Pack_size
+
+subroutine Yog_Pcontrol(level, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: level
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Pcontrol(level, ierr)
+end subroutine Yog_Pcontrol
+
+subroutine Yog_Probe(source, tag, comm, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: source
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Probe(source, tag, comm, status, ierr)
+end subroutine Yog_Probe
+
+subroutine Yog_Publish_name(service_name, info, port_name, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: service_name
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: port_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Publish_name(service_name, info, port_name, ierr)
+end subroutine Yog_Publish_name
+
+subroutine Yog_Put(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Put(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, ierr)
+end subroutine Yog_Put
+
+subroutine Yog_Query_thread(provided, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: provided
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Query_thread(provided, ierr)
+end subroutine Yog_Query_thread
+
+subroutine Yog_Raccumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Raccumulate(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request, ierr)
+end subroutine Yog_Raccumulate
+
+subroutine Yog_Recv(buf, count, datatype, source, tag, comm, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: source
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Recv(buf, count, datatype, source, tag, comm, status, ierr)
+end subroutine Yog_Recv
+
+subroutine Yog_Recv_init(buf, count, datatype, source, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(inout) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: source
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Recv_init(buf, count, datatype, source, tag, comm, request, ierr)
+end subroutine Yog_Recv_init
+
+subroutine Yog_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm, ierr)
+end subroutine Yog_Reduce
+
+subroutine Yog_Reduce_local(inbuf, inoutbuf, count, datatype, op, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: inbuf
+    integer, intent(out) :: inoutbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Reduce_local(inbuf, inoutbuf, count, datatype, op, ierr)
+end subroutine Yog_Reduce_local
+
+subroutine Yog_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcounts(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm, ierr)
+end subroutine Yog_Reduce_scatter
+
+subroutine Yog_Reduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Reduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm, ierr)
+end subroutine Yog_Reduce_scatter_block
+
+subroutine Yog_Request_free(request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(inout) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Request_free(request, ierr)
+end subroutine Yog_Request_free
+
+subroutine Yog_Request_get_status(request, flag, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Request_get_status(request, conv_flag, status, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Request_get_status
+
+subroutine Yog_Rget(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Rget(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request, ierr)
+end subroutine Yog_Rget
+
+subroutine Yog_Rget_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: result_addr
+    integer, intent(in) :: result_count
+    integer(Yog_INTEGER_KIND), intent(in) :: result_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Rget_accumulate(origin_addr, origin_count, origin_datatype, result_addr, result_count, result_datatype, target_rank, target_disp, target_count, target_datatype, op, win, request, ierr)
+end subroutine Yog_Rget_accumulate
+
+subroutine Yog_Rput(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: origin_addr
+    integer, intent(in) :: origin_count
+    integer(Yog_INTEGER_KIND), intent(in) :: origin_datatype
+    integer, intent(in) :: target_rank
+    integer(Yog_INTEGER_KIND), intent(in) :: target_disp
+    integer, intent(in) :: target_count
+    integer(Yog_INTEGER_KIND), intent(in) :: target_datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Rput(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype, win, request, ierr)
+end subroutine Yog_Rput
+
+subroutine Yog_Rsend(buf, count, datatype, dest, tag, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Rsend(buf, count, datatype, dest, tag, comm, ierr)
+end subroutine Yog_Rsend
+
+subroutine Yog_Rsend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Rsend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Rsend_init
+
+subroutine Yog_Scan(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: op
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Scan(sendbuf, recvbuf, count, datatype, op, comm, ierr)
+end subroutine Yog_Scan
+
+subroutine Yog_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+end subroutine Yog_Scatter
+
+subroutine Yog_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcounts
+    integer, intent(in) :: displs
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: root
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, ierr)
+end subroutine Yog_Scatterv
+
+subroutine Yog_Send(buf, count, datatype, dest, tag, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Send(buf, count, datatype, dest, tag, comm, ierr)
+end subroutine Yog_Send
+
+subroutine Yog_Send_init(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Send_init(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Send_init
+
+subroutine Yog_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag, comm, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: sendbuf
+    integer, intent(in) :: sendcount
+    integer(Yog_INTEGER_KIND), intent(in) :: sendtype
+    integer, intent(in) :: dest
+    integer, intent(in) :: sendtag
+    integer, intent(out) :: recvbuf
+    integer, intent(in) :: recvcount
+    integer(Yog_INTEGER_KIND), intent(in) :: recvtype
+    integer, intent(in) :: source
+    integer, intent(in) :: recvtag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag, comm, status, ierr)
+end subroutine Yog_Sendrecv
+
+subroutine Yog_Sendrecv_replace(buf, count, datatype, dest, sendtag, source, recvtag, comm, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(out) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: sendtag
+    integer, intent(in) :: source
+    integer, intent(in) :: recvtag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Sendrecv_replace(buf, count, datatype, dest, sendtag, source, recvtag, comm, status, ierr)
+end subroutine Yog_Sendrecv_replace
+
+subroutine Yog_Ssend(buf, count, datatype, dest, tag, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ssend(buf, count, datatype, dest, tag, comm, ierr)
+end subroutine Yog_Ssend
+
+subroutine Yog_Ssend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: buf
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: dest
+    integer, intent(in) :: tag
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Ssend_init(buf, count, datatype, dest, tag, comm, request, ierr)
+end subroutine Yog_Ssend_init
+
+subroutine Yog_Start(request, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Start(request, ierr)
+end subroutine Yog_Start
+
+subroutine Yog_Startall(count, array_of_requests, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Startall(count, array_of_requests, ierr)
+end subroutine Yog_Startall
+
+subroutine Yog_Status_set_cancelled(status, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(inout) :: status
+    logical, intent(in) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    conv_flag = Yogi_LogicalToInteger(flag)
+    call YogiBridge_Status_set_cancelled(status, conv_flag, ierr)
+end subroutine Yog_Status_set_cancelled
+
+subroutine Yog_Status_set_elements(status, datatype, count, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(inout) :: status
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: count
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Status_set_elements(status, datatype, count, ierr)
+end subroutine Yog_Status_set_elements
+
+subroutine Yog_Test(request, flag, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Test(request, conv_flag, status, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Test
+
+subroutine Yog_Test_cancelled(status, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: status
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Test_cancelled(status, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Test_cancelled
+
+subroutine Yog_Testall(count, array_of_requests, flag, array_of_statuses, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer(Yog_INTEGER_KIND), intent(out) :: array_of_statuses(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Testall(count, array_of_requests, conv_flag, array_of_statuses, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Testall
+
+subroutine Yog_Testany(count, array_of_requests, indx, flag, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer, intent(out) :: indx
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Testany(count, array_of_requests, indx, conv_flag, status, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Testany
+
+subroutine Yog_Testsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer, intent(out) :: outcount
+    integer, intent(out) :: array_of_indices(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: array_of_statuses(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Testsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses, ierr)
+end subroutine Yog_Testsome
+
+subroutine Yog_Topo_test(comm, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Topo_test(comm, status, ierr)
+end subroutine Yog_Topo_test
+
+subroutine Yog_Type_commit(datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_commit(datatype, ierr)
+end subroutine Yog_Type_commit
+
+subroutine Yog_Type_contiguous(count, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_contiguous(count, oldtype, newtype, ierr)
+end subroutine Yog_Type_contiguous
+
+subroutine Yog_Type_create_hindexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: array_of_blocklengths(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_hindexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+end subroutine Yog_Type_create_hindexed
+
+subroutine Yog_Type_create_hindexed_block(count, blocklength, array_of_displacements, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: blocklength
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_hindexed_block(count, blocklength, array_of_displacements, oldtype, newtype, ierr)
+end subroutine Yog_Type_create_hindexed_block
+
+subroutine Yog_Type_create_hvector(count, blocklength, stride, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: blocklength
+    integer(Yog_INTEGER_KIND), intent(in) :: stride
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_hvector(count, blocklength, stride, oldtype, newtype, ierr)
+end subroutine Yog_Type_create_hvector
+
+subroutine Yog_Type_create_indexed_block(count, blocklength, array_of_displacements, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: blocklength
+    integer, intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_indexed_block(count, blocklength, array_of_displacements, oldtype, newtype, ierr)
+end subroutine Yog_Type_create_indexed_block
+
+subroutine Yog_Type_create_resized(oldtype, lb, extent, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(in) :: lb
+    integer(Yog_INTEGER_KIND), intent(in) :: extent
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_resized(oldtype, lb, extent, newtype, ierr)
+end subroutine Yog_Type_create_resized
+
+subroutine Yog_Type_create_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: array_of_blocklengths(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_types(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, newtype, ierr)
+end subroutine Yog_Type_create_struct
+
+subroutine Yog_Type_create_subarray(ndims, array_of_sizes, array_of_subsizes, array_of_starts, order, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: ndims
+    integer, intent(in) :: array_of_sizes(*)
+    integer, intent(in) :: array_of_subsizes(*)
+    integer, intent(in) :: array_of_starts(*)
+    integer, intent(in) :: order
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_create_subarray(ndims, array_of_sizes, array_of_subsizes, array_of_starts, order, oldtype, newtype, ierr)
+end subroutine Yog_Type_create_subarray
+
+subroutine Yog_Type_delete_attr(datatype, type_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: type_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_delete_attr(datatype, type_keyval, ierr)
+end subroutine Yog_Type_delete_attr
+
+subroutine Yog_Type_dup(oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_dup(oldtype, newtype, ierr)
+end subroutine Yog_Type_dup
+
+subroutine Yog_Type_extent(datatype, extent, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: extent
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_extent(datatype, extent, ierr)
+end subroutine Yog_Type_extent
+
+subroutine Yog_Type_free(datatype, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_free(datatype, ierr)
+end subroutine Yog_Type_free
+
+subroutine Yog_Type_free_keyval(type_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: type_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_free_keyval(type_keyval, ierr)
+end subroutine Yog_Type_free_keyval
+
+subroutine Yog_Type_get_attr(datatype, type_keyval, attribute_val, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: type_keyval
+    integer, intent(out) :: attribute_val
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_get_attr(datatype, type_keyval, attribute_val, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Type_get_attr
+
+subroutine Yog_Type_get_envelope(datatype, num_integers, num_addresses, num_datatypes, combiner, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: num_integers
+    integer, intent(out) :: num_addresses
+    integer, intent(out) :: num_datatypes
+    integer, intent(out) :: combiner
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_get_envelope(datatype, num_integers, num_addresses, num_datatypes, combiner, ierr)
+end subroutine Yog_Type_get_envelope
+
+subroutine Yog_Type_get_extent(datatype, lb, extent, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: lb
+    integer(Yog_INTEGER_KIND), intent(out) :: extent
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_get_extent(datatype, lb, extent, ierr)
+end subroutine Yog_Type_get_extent
+
+subroutine Yog_Type_get_name(datatype, type_name, resultlen, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    character(len=*), intent(out) :: type_name
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_get_name(datatype, type_name, resultlen, ierr)
+end subroutine Yog_Type_get_name
+
+subroutine Yog_Type_get_true_extent(datatype, true_lb, true_extent, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: true_lb
+    integer(Yog_INTEGER_KIND), intent(out) :: true_extent
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_get_true_extent(datatype, true_lb, true_extent, ierr)
+end subroutine Yog_Type_get_true_extent
+
+subroutine Yog_Type_hindexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: array_of_blocklengths(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_hindexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+end subroutine Yog_Type_hindexed
+
+subroutine Yog_Type_hvector(count, blocklength, stride, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: blocklength
+    integer(Yog_INTEGER_KIND), intent(in) :: stride
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_hvector(count, blocklength, stride, oldtype, newtype, ierr)
+end subroutine Yog_Type_hvector
+
+subroutine Yog_Type_indexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: array_of_blocklengths(*)
+    integer, intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_indexed(count, array_of_blocklengths, array_of_displacements, oldtype, newtype, ierr)
+end subroutine Yog_Type_indexed
+
+subroutine Yog_Type_lb(datatype, displacement, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: displacement
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_lb(datatype, displacement, ierr)
+end subroutine Yog_Type_lb
+
+subroutine Yog_Type_match_size(typeclass, size, datatype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: typeclass
+    integer, intent(in) :: size
+    integer(Yog_INTEGER_KIND), intent(out) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_match_size(typeclass, size, datatype, ierr)
+end subroutine Yog_Type_match_size
+
+subroutine Yog_Type_set_attr(datatype, type_keyval, attribute_val, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(in) :: type_keyval
+    integer, intent(in) :: attribute_val
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_set_attr(datatype, type_keyval, attribute_val, ierr)
+end subroutine Yog_Type_set_attr
+
+subroutine Yog_Type_set_name(datatype, type_name, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    character(len=*), intent(in) :: type_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_set_name(datatype, type_name, ierr)
+end subroutine Yog_Type_set_name
+
+subroutine Yog_Type_size(datatype, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_size(datatype, size, ierr)
+end subroutine Yog_Type_size
+
+subroutine Yog_Type_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: array_of_blocklengths(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_displacements(*)
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_types(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, newtype, ierr)
+end subroutine Yog_Type_struct
+
+subroutine Yog_Type_ub(datatype, displacement, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(out) :: displacement
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_ub(datatype, displacement, ierr)
+end subroutine Yog_Type_ub
+
+subroutine Yog_Type_vector(count, blocklength, stride, oldtype, newtype, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer, intent(in) :: blocklength
+    integer, intent(in) :: stride
+    integer(Yog_INTEGER_KIND), intent(in) :: oldtype
+    integer(Yog_INTEGER_KIND), intent(out) :: newtype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Type_vector(count, blocklength, stride, oldtype, newtype, ierr)
+end subroutine Yog_Type_vector
+
+subroutine Yog_Unpack(inbuf, insize, position, outbuf, outcount, datatype, comm, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: inbuf
+    integer, intent(in) :: insize
+    integer, intent(in) :: position
+    integer, intent(out) :: outbuf
+    integer, intent(in) :: outcount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Unpack(inbuf, insize, position, outbuf, outcount, datatype, comm, ierr)
+end subroutine Yog_Unpack
+
+subroutine Yog_Unpack_external(datarep, inbuf, insize, position, outbuf, outcount, datatype, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: datarep
+    integer, intent(in) :: inbuf
+    integer(Yog_INTEGER_KIND), intent(in) :: insize
+    integer(Yog_INTEGER_KIND), intent(inout) :: position
+    integer, intent(in) :: outbuf
+    integer, intent(in) :: outcount
+    integer(Yog_INTEGER_KIND), intent(in) :: datatype
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Unpack_external(datarep, inbuf, insize, position, outbuf, outcount, datatype, ierr)
+end subroutine Yog_Unpack_external
+
+subroutine Yog_Unpublish_name(service_name, info, port_name, ierr)
+    use yogimpi
+    implicit none
+    character(len=*), intent(in) :: service_name
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    character(len=*), intent(in) :: port_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Unpublish_name(service_name, info, port_name, ierr)
+end subroutine Yog_Unpublish_name
+
+subroutine Yog_Wait(request, status, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: request
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Wait(request, status, ierr)
+end subroutine Yog_Wait
+
+subroutine Yog_Waitall(count, array_of_requests, array_of_statuses, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: array_of_statuses(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Waitall(count, array_of_requests, array_of_statuses, ierr)
+end subroutine Yog_Waitall
+
+subroutine Yog_Waitany(count, array_of_requests, indx, status, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: count
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer, intent(out) :: indx
+    integer(Yog_INTEGER_KIND), intent(out) :: status
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Waitany(count, array_of_requests, indx, status, ierr)
+end subroutine Yog_Waitany
+
+subroutine Yog_Waitsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: incount
+    integer(Yog_INTEGER_KIND), intent(in) :: array_of_requests(*)
+    integer, intent(out) :: outcount
+    integer, intent(out) :: array_of_indices(*)
+    integer(Yog_INTEGER_KIND), intent(out) :: array_of_statuses(*)
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Waitsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses, ierr)
+end subroutine Yog_Waitsome
+
+subroutine Yog_Win_allocate(size, disp_unit, info, comm, baseptr, win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: size
+    integer, intent(in) :: disp_unit
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: baseptr
+    integer(Yog_INTEGER_KIND), intent(out) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_allocate(size, disp_unit, info, comm, baseptr, win, ierr)
+end subroutine Yog_Win_allocate
+
+subroutine Yog_Win_allocate_shared(size, disp_unit, info, comm, baseptr, win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: size
+    integer, intent(in) :: disp_unit
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer, intent(out) :: baseptr
+    integer(Yog_INTEGER_KIND), intent(out) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_allocate_shared(size, disp_unit, info, comm, baseptr, win, ierr)
+end subroutine Yog_Win_allocate_shared
+
+subroutine Yog_Win_attach(win, base, size, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: base
+    integer(Yog_INTEGER_KIND), intent(in) :: size
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_attach(win, base, size, ierr)
+end subroutine Yog_Win_attach
+
+subroutine Yog_Win_call_errhandler(win, errorcode, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: errorcode
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_call_errhandler(win, errorcode, ierr)
+end subroutine Yog_Win_call_errhandler
+
+subroutine Yog_Win_complete(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_complete(win, ierr)
+end subroutine Yog_Win_complete
+
+subroutine Yog_Win_create(base, size, disp_unit, info, comm, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: base
+    integer(Yog_INTEGER_KIND), intent(in) :: size
+    integer, intent(in) :: disp_unit
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_create(base, size, disp_unit, info, comm, win, ierr)
+end subroutine Yog_Win_create
+
+subroutine Yog_Win_create_dynamic(info, comm, win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer(Yog_INTEGER_KIND), intent(in) :: comm
+    integer(Yog_INTEGER_KIND), intent(out) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_create_dynamic(info, comm, win, ierr)
+end subroutine Yog_Win_create_dynamic
+
+subroutine Yog_Win_delete_attr(win, win_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: win_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_delete_attr(win, win_keyval, ierr)
+end subroutine Yog_Win_delete_attr
+
+subroutine Yog_Win_detach(win, base, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: base
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_detach(win, base, ierr)
+end subroutine Yog_Win_detach
+
+subroutine Yog_Win_fence(assert, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: assert
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_fence(assert, win, ierr)
+end subroutine Yog_Win_fence
+
+subroutine Yog_Win_flush(rank, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: rank
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_flush(rank, win, ierr)
+end subroutine Yog_Win_flush
+
+subroutine Yog_Win_flush_all(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_flush_all(win, ierr)
+end subroutine Yog_Win_flush_all
+
+subroutine Yog_Win_flush_local(rank, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: rank
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_flush_local(rank, win, ierr)
+end subroutine Yog_Win_flush_local
+
+subroutine Yog_Win_flush_local_all(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_flush_local_all(win, ierr)
+end subroutine Yog_Win_flush_local_all
+
+subroutine Yog_Win_free(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_free(win, ierr)
+end subroutine Yog_Win_free
+
+subroutine Yog_Win_free_keyval(win_keyval, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: win_keyval
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_free_keyval(win_keyval, ierr)
+end subroutine Yog_Win_free_keyval
+
+subroutine Yog_Win_get_attr(win, win_keyval, attribute_val, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: win_keyval
+    integer, intent(out) :: attribute_val
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_get_attr(win, win_keyval, attribute_val, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Win_get_attr
+
+subroutine Yog_Win_get_errhandler(win, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_get_errhandler(win, errhandler, ierr)
+end subroutine Yog_Win_get_errhandler
+
+subroutine Yog_Win_get_group(win, group, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: group
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_get_group(win, group, ierr)
+end subroutine Yog_Win_get_group
+
+subroutine Yog_Win_get_info(win, info_used, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(out) :: info_used
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_get_info(win, info_used, ierr)
+end subroutine Yog_Win_get_info
+
+subroutine Yog_Win_get_name(win, win_name, resultlen, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    character(len=*), intent(out) :: win_name
+    integer, intent(out) :: resultlen
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_get_name(win, win_name, resultlen, ierr)
+end subroutine Yog_Win_get_name
+
+subroutine Yog_Win_lock(lock_type, rank, assert, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: lock_type
+    integer, intent(in) :: rank
+    integer, intent(in) :: assert
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_lock(lock_type, rank, assert, win, ierr)
+end subroutine Yog_Win_lock
+
+subroutine Yog_Win_lock_all(assert, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: assert
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_lock_all(assert, win, ierr)
+end subroutine Yog_Win_lock_all
+
+subroutine Yog_Win_post(group, assert, win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: assert
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_post(group, assert, win, ierr)
+end subroutine Yog_Win_post
+
+subroutine Yog_Win_set_attr(win, win_keyval, attribute_val, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: win_keyval
+    integer, intent(in) :: attribute_val
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_set_attr(win, win_keyval, attribute_val, ierr)
+end subroutine Yog_Win_set_attr
+
+subroutine Yog_Win_set_errhandler(win, errhandler, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(in) :: errhandler
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_set_errhandler(win, errhandler, ierr)
+end subroutine Yog_Win_set_errhandler
+
+subroutine Yog_Win_set_info(win, info, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer(Yog_INTEGER_KIND), intent(in) :: info
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_set_info(win, info, ierr)
+end subroutine Yog_Win_set_info
+
+subroutine Yog_Win_set_name(win, win_name, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    character(len=*), intent(in) :: win_name
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_set_name(win, win_name, ierr)
+end subroutine Yog_Win_set_name
+
+subroutine Yog_Win_shared_query(win, rank, size, disp_unit, baseptr, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(in) :: rank
+    integer(Yog_INTEGER_KIND), intent(out) :: size
+    integer, intent(out) :: disp_unit
+    integer, intent(out) :: baseptr
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_shared_query(win, rank, size, disp_unit, baseptr, ierr)
+end subroutine Yog_Win_shared_query
+
+subroutine Yog_Win_start(group, assert, win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: group
+    integer, intent(in) :: assert
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_start(group, assert, win, ierr)
+end subroutine Yog_Win_start
+
+subroutine Yog_Win_sync(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_sync(win, ierr)
+end subroutine Yog_Win_sync
+
+subroutine Yog_Win_test(win, flag, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    logical, intent(out) :: flag
+    integer :: conv_flag
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_test(win, conv_flag, ierr)
+    flag = Yogi_IntegerToLogical(conv_flag)
+end subroutine Yog_Win_test
+
+subroutine Yog_Win_unlock(rank, win, ierr)
+    use yogimpi
+    implicit none
+    integer, intent(in) :: rank
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_unlock(rank, win, ierr)
+end subroutine Yog_Win_unlock
+
+subroutine Yog_Win_unlock_all(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_unlock_all(win, ierr)
+end subroutine Yog_Win_unlock_all
+
+subroutine Yog_Win_wait(win, ierr)
+    use yogimpi
+    implicit none
+    integer(Yog_INTEGER_KIND), intent(in) :: win
+    integer, intent(out) :: ierr
+
+    call YogiBridge_Win_wait(win, ierr)
+end subroutine Yog_Win_wait
+
+
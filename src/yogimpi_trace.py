@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+Decodes the binary call traces written by a YogiMPI debug build (YDEBUG=1),
+one yogimpi.trace.<rank> file per rank.
+
+By default the records are printed as text, indented by call depth.  With
+--chrome, the traces of all the given ranks are combined into one Chrome
+trace-event JSON file, which chrome://tracing or Perfetto can display.
+There, each rank is a process and each thread a track.
+
+Usage:
+    yogimpi_trace.py yogimpi.trace.0
+    yogimpi_trace.py --chrome -o trace.json yogimpi.trace.*
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b'YOGITRC\0'
+# Header after the magic: format version, rank, record size, name count.
+HEADER = struct.Struct('=iiii')
+# timestamp, bytes, function, event, thread, callDepth, peer, tag, comm, error
+RECORD = struct.Struct('=qqiiiiiiii')
+ENTER_EVENT = 0
+
+class TraceFile(object):
+
+    def __init__(self, fileName):
+        self.fileName = fileName
+        with open(fileName, 'rb') as traceFile:
+            data = traceFile.read()
+        if data[:len(MAGIC)] != MAGIC:
+            raise ValueError(fileName + ' is not a YogiMPI trace.')
+        offset = len(MAGIC)
+        version, self.rank, recordSize, numNames = \
+            HEADER.unpack_from(data, offset)
+        offset += HEADER.size
+        if version != 1 or recordSize != RECORD.size:
+            raise ValueError(fileName + ': unsupported trace format.')
+        self.names = []
+        for i in range(numNames):
+            end = data.index(b'\0', offset)
+            self.names.append(data[offset:end].decode())
+            offset = end + 1
+        # A trace cut short by a crash may end in a partial record.
+        count = (len(data) - offset) // RECORD.size
+        self.records = [RECORD.unpack_from(data, offset + i * RECORD.size)
+                        for i in range(count)]
+
+    def name(self, function):
+        if 0 <= function < len(self.names):
+            return self.names[function]
+        return 'function ' + str(function)
+
+def writeText(trace, out):
+    out.write('# rank ' + str(trace.rank) + '\n')
+    for record in trace.records:
+        timestamp, nbytes, function, event, thread, depth, peer, tag, comm, \
+            error = record
+        line = '%14.6f t%-3d ' % (timestamp / 1e9, thread) + '  ' * depth
+        if event == ENTER_EVENT:
+            line += 'Entering ' + trace.name(function)
+            line += ' peer=%d tag=%d comm=%d' % (peer, tag, comm)
+        else:
+            line += 'Exiting ' + trace.name(function)
+            line += ' bytes=%d error=%d' % (nbytes, error)
+        out.write(line + '\n')
+
+def chromeEvents(trace):
+    events = []
+    for record in trace.records:
+        timestamp, nbytes, function, event, thread, depth, peer, tag, comm, \
+            error = record
+        anEvent = { 'name': trace.name(function), 'cat': 'MPI',
+                    'ts': timestamp / 1e3, 'pid': trace.rank,
+                    'tid': thread }
+        if event == ENTER_EVENT:
+            anEvent['ph'] = 'B'
+            anEvent['args'] = { 'peer': peer, 'tag': tag, 'comm': comm }
+        else:
+            anEvent['ph'] = 'E'
+            anEvent['args'] = { 'bytes': nbytes, 'error': error }
+        events.append(anEvent)
+    return events
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decode YogiMPI traces.')
+    parser.add_argument('tracefiles', nargs='+', help='yogimpi.trace.<rank>')
+    parser.add_argument('--chrome', action='store_true',
+                        help='Write Chrome trace-event JSON instead of text')
+    parser.add_argument('-o', '--output', help='Output file (default stdout)')
+    args = parser.parse_args()
+
+    out = sys.stdout
+    if args.output:
+        out = open(args.output, 'w')
+    traces = [TraceFile(aName) for aName in args.tracefiles]
+    if args.chrome:
+        events = []
+        for trace in traces:
+            events += chromeEvents(trace)
+        json.dump({ 'traceEvents': events, 'displayTimeUnit': 'ns' }, out)
+        out.write('\n')
+    else:
+        for trace in traces:
+            writeText(trace, out)
+    if out is not sys.stdout:
+        out.close()
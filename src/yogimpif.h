@@ -0,0 +1,354 @@
+!
+!                                  COPYRIGHT
+!
+! The following is a notice of limited availability of the code, and disclaimer
+! which must be included in the prologue of the code and in all source listings
+! of the code.
+!
+! Copyright Notice
+!  + 2002 University of Chicago
+!  + 2016 Stephen Adamec
+!
+! Permission is hereby granted to use, reproduce, prepare derivative works, and
+! to redistribute to others.  This software was authored by:
+!
+! Mathematics and Computer Science Division
+! Argonne National Laboratory, Argonne IL 60439
+!
+! (and)
+!
+! Department of Computer Science
+! University of Illinois at Urbana-Champaign
+!
+! (and)
+!
+! Stephen Adamec
+!
+!                              GOVERNMENT LICENSE
+!
+! Portions of this material resulted from work developed under a U.S.
+! Government Contract and are subject to the following license: the Government
+! is granted for itself and others acting on its behalf a paid-up, nonexclusive,
+! irrevocable worldwide license in this computer software to reproduce, prepare
+! derivative works, and perform publicly and display publicly.
+!
+!                                    DISCLAIMER
+!
+! This computer code material was prepared, in part, as an account of work
+! sponsored by an agency of the United States Government.  Neither the United
+! States, nor the University of Chicago, nor any of their employees, makes any
+! warranty express or implied, or assumes any legal liability or responsibility
+! for the accuracy, completeness, or usefulness of any information, apparatus,
+! product, or process disclosed, or represents that its use would not infringe
+! privately owned rights.
+!
+
+! Defined MPI constants for Fortran
+
+      character(*), parameter :: YOGIMPI_VERSION_STR= ''
+      integer, parameter :: YOG_VERSION = 3
+      integer, parameter :: YOG_SUBVERSION = 0
+      
+
+! Handle various byte counts in Fortran to match the C counterparts.  On most
+! modern Intel/AMD 64-bit systems these are 4 or 8 byte values.
+      integer, parameter :: YOG_INTEGER_KIND = 4
+      integer, parameter :: YOG_OFFSET_KIND = 8
+      integer, parameter :: YOG_ADDRESS_KIND = 8
+
+! return codes (both C and Fortran)
+      integer, parameter :: YOG_SUCCESS = 0
+      integer, parameter :: YOG_ERR_BUFFER = 1
+      integer, parameter :: YOG_ERR_COUNT = 2
+      integer, parameter :: YOG_ERR_TYPE = 3
+      integer, parameter :: YOG_ERR_TAG = 4
+      integer, parameter :: YOG_ERR_COMM = 5
+      integer, parameter :: YOG_ERR_RANK = 6
+      integer, parameter :: YOG_ERR_REQUEST = 7
+      integer, parameter :: YOG_ERR_ROOT = 8
+      integer, parameter :: YOG_ERR_GROUP = 9
+      integer, parameter :: YOG_ERR_OP = 10
+      integer, parameter :: YOG_ERR_TOPOLOGY = 11
+      integer, parameter :: YOG_ERR_DIMS = 12
+      integer, parameter :: YOG_ERR_ARG = 13
+      integer, parameter :: YOG_ERR_UNKNOWN = 14
+      integer, parameter :: YOG_ERR_TRUNCATE = 15
+      integer, parameter :: YOG_ERR_OTHER = 16
+      integer, parameter :: YOG_ERR_INTERN = 17
+      integer, parameter :: YOG_ERR_PENDING = 18
+      integer, parameter :: YOG_ERR_IN_STATUS = 19
+
+      integer, parameter :: YOG_ERR_FILE = 20
+      integer, parameter :: YOG_ERR_NOT_SAME = 21
+      integer, parameter :: YOG_ERR_AMODE = 22
+      integer, parameter :: YOG_ERR_UNSUPPORTED_DATAREP = 23
+      integer, parameter :: YOG_ERR_UNSUPPORTED_OPERATION = 24
+      integer, parameter :: YOG_ERR_NO_SUCH_FILE = 25
+      integer, parameter :: YOG_ERR_FILE_EXISTS = 26
+      integer, parameter :: YOG_ERR_BAD_FILE = 27
+      integer, parameter :: YOG_ERR_ACCESS = 28
+      integer, parameter :: YOG_ERR_NO_SPACE = 29
+      integer, parameter :: YOG_ERR_QUOTA = 30
+      integer, parameter :: YOG_ERR_READ_ONLY = 31
+      integer, parameter :: YOG_ERR_FILE_IN_USE = 32
+      integer, parameter :: YOG_ERR_DUP_DATAREP = 33
+      integer, parameter :: YOG_ERR_CONVERSION = 34
+      integer, parameter :: YOG_ERR_IO = 35
+      integer, parameter :: YOG_ERR_INFO = 36
+      integer, parameter :: YOG_ERR_INFO_KEY = 37
+      integer, parameter :: YOG_ERR_INFO_VALUE = 38
+      integer, parameter :: YOG_ERR_INFO_NOKEY = 39
+      integer, parameter :: YOG_ERR_NAME = 40
+      integer, parameter :: YOG_ERR_NO_MEM = 41
+      integer, parameter :: YOG_ERR_PORT = 42
+      integer, parameter :: YOG_ERR_SERVICE = 43
+      integer, parameter :: YOG_ERR_SPAWN = 44
+      integer, parameter :: YOG_ERR_WIN = 45
+      integer, parameter :: YOG_ERR_KEYVAL = 46
+      integer, parameter :: YOG_ERR_BASE = 47
+      integer, parameter :: YOG_ERR_LOCKTYPE = 48
+      integer, parameter :: YOG_ERR_RMA_CONFLICT = 49
+      integer, parameter :: YOG_ERR_RMA_SYNC = 50
+      integer, parameter :: YOG_ERR_SIZE = 51
+      integer, parameter :: YOG_ERR_DISP = 52
+      integer, parameter :: YOG_ERR_ASSERT = 53
+      integer, parameter :: YOG_ERR_LASTCODE = 54
+
+! Special case with MPI_BOTTOM
+      integer(YOG_INTEGER_KIND) :: YOG_BOTTOM
+
+! assorted constants (both C and Fortran)
+      integer, parameter :: YOG_PROC_NULL = -2
+      integer, parameter :: YOG_ROOT = -6
+      integer, parameter :: YOG_ANY_SOURCE = -3
+      integer, parameter :: YOG_ANY_TAG = -4
+      integer, parameter :: YOG_UNDEFINED = -5
+      integer, parameter :: YOG_BSEND_OVERHEAD = 512
+      integer, parameter :: YOG_KEYVAL_INVALID = -7
+
+! Graph creation constants.  These are pointer values in C, so they must go
+! within a common block.
+      integer(YOG_INTEGER_KIND) :: YOG_WEIGHTS_EMPTY
+      integer(YOG_INTEGER_KIND) :: YOG_UNWEIGHTED
+
+! MPI asserts for one-sided communication.  Supports bitwise ops.
+      integer, parameter :: YOG_MODE_NOCHECK = 1024
+      integer, parameter :: YOG_MODE_NOSTORE = 2048
+      integer, parameter :: YOG_MODE_NOPUT = 4096
+      integer, parameter :: YOG_MODE_NOPRECEDE = 8192
+      integer, parameter :: YOG_MODE_NOSUCCEED = 16384
+
+! Seeking constants.
+      integer, parameter :: YOG_SEEK_SET = 50
+      integer, parameter :: YOG_SEEK_CUR = 55
+      integer, parameter :: YOG_SEEK_END = 60
+
+! Typeclasses
+      integer, parameter :: YOG_TYPECLASS_REAL = 1
+      integer, parameter :: YOG_TYPECLASS_INTEGER = 2
+      integer, parameter :: YOG_TYPECLASS_COMPLEX = 3
+
+! MPI I/O permission modes.  Supports bitwise ops.
+      integer, parameter :: YOG_MODE_RDONLY = 2
+      integer, parameter :: YOG_MODE_RDWR = 8
+      integer, parameter :: YOG_MODE_WRONLY = 4
+      integer, parameter :: YOG_MODE_CREATE = 1
+      integer, parameter :: YOG_MODE_EXCL = 64
+      integer, parameter :: YOG_MODE_DELETE_ON_CLOSE = 16
+      integer, parameter :: YOG_MODE_UNIQUE_OPEN = 32
+      integer, parameter :: YOG_MODE_SEQUENTIAL = 256
+      integer, parameter :: YOG_MODE_APPEND = 128
+
+! Special displacement constant for certain sequential files.
+      integer, parameter :: YOG_DISPLACEMENT_CURRENT = -5427827
+
+! MPI_Info have key and value length constants.  Pick conservative values
+! that accommodate OpenMPI and MPICH derivatives.
+      integer, parameter :: YOG_MAX_INFO_KEY = 32
+      integer, parameter :: YOG_MAX_INFO_VAL = 256
+
+! Subarray and darray constructor constants.  Mimics the MPICH header file.
+      integer, parameter :: YOG_ORDER_C = 56
+      integer, parameter :: YOG_ORDER_FORTRAN = 57
+      integer, parameter :: YOG_DISTRIBUTE_BLOCK = 121
+      integer, parameter :: YOG_DISTRIBUTE_CYCLIC = 122
+      integer, parameter :: YOG_DISTRIBUTE_NONE = 123
+      integer, parameter :: YOG_DISTRIBUTE_DFLT_DARG = -49767
+
+! Maximum sizes for strings
+! This has to be one less than the value in C to account for null-terminated
+! strings.
+      integer, parameter :: YOG_MAX_PROCESSOR_NAME = 31
+      integer, parameter :: YOG_MAX_ERROR_STRING = 31
+      integer, parameter :: YOG_MAX_PORT_NAME = 511
+      integer, parameter :: YOG_MAX_OBJECT_NAME = 63
+      integer, parameter :: YOG_MAX_DATAREP_STRING = 63
+
+! elementary datatypes (Fortran)
+      integer, parameter :: YOG_CHARACTER = 1
+      integer, parameter :: YOG_INTEGER = 3
+      integer, parameter :: YOG_REAL = 9
+      integer, parameter :: YOG_DOUBLE_PRECISION = 10
+      integer, parameter :: YOG_BYTE = 12
+      integer, parameter :: YOG_PACKED = 13
+      integer, parameter :: YOG_COMPLEX = 23
+      integer, parameter :: YOG_DOUBLE_COMPLEX = 24
+      integer, parameter :: YOG_LOGICAL = 25
+
+! datatypes for reduction functions (Fortran)
+      integer, parameter :: YOG_2REAL = 26
+      integer, parameter :: YOG_2DOUBLE_PRECISION = 27
+      integer, parameter :: YOG_2INTEGER = 28
+
+! optional datatypes (Fortran)
+      integer, parameter :: YOG_INTEGER1 = 29
+      integer, parameter :: YOG_INTEGER2 = 30
+      integer, parameter :: YOG_INTEGER4 = 31
+      integer, parameter :: YOG_INTEGER8 = 32
+      integer, parameter :: YOG_REAL4 = 33
+      integer, parameter :: YOG_REAL8 = 34
+
+! Special datatypes for constructing derived datatypes
+      integer, parameter :: YOG_LB = 36
+      integer, parameter :: YOG_UB = 37
+
+! Extra datatypes defined in C but here (as specified by MPICH2)
+      integer, parameter :: YOG_WCHAR = 39
+      integer, parameter :: YOG_C_BOOL = 40
+      integer, parameter :: YOG_C_FLOAT_COMPLEX = 41
+      integer, parameter :: YOG_C_COMPLEX = 42
+      integer, parameter :: YOG_C_DOUBLE_COMPLEX = 43
+      integer, parameter :: YOG_C_LONG_DOUBLE_COMPLEX = 44
+
+! MPI 2.2 datatypes needed by MPI I/O
+      integer, parameter :: YOG_AINT = 45
+      integer, parameter :: YOG_OFFSET = 46
+
+! MPI 3 C++ data types
+      integer, parameter :: YOG_CXX_BOOL = 49
+      integer, parameter :: YOG_CXX_FLOAT_COMPLEX = 50
+      integer, parameter :: YOG_CXX_DOUBLE_COMPLEX = 51
+      integer, parameter :: YOG_CXX_LONG_DOUBLE_COMPLEX = 52
+
+! reserved communicators (C and Fortran)
+      integer, parameter :: YOG_COMM_WORLD = 1
+      integer, parameter :: YOG_COMM_SELF = 2
+
+! results of communicator and group comparisons
+      integer, parameter :: YOG_IDENT = 0
+      integer, parameter :: YOG_CONGRUENT = 1
+      integer, parameter :: YOG_SIMILAR = 2
+      integer, parameter :: YOG_UNEQUAL = 3
+
+! environmental inquiry keys (C and Fortran)
+      integer, parameter :: YOG_TAG_UB = -8
+      integer, parameter :: YOG_IO = -9
+      integer, parameter :: YOG_HOST = -10
+      integer, parameter :: YOG_WTIME_IS_GLOBAL = -11
+
+! Predefined MPI_Win attributes
+      integer, parameter :: YOG_WIN_BASE = -12
+      integer, parameter :: YOG_WIN_SIZE = -13
+      integer, parameter :: YOG_WIN_DISP_UNIT = -14
+
+! collective operations (C and Fortran)
+      integer, parameter :: YOG_MAX = 1
+      integer, parameter :: YOG_MIN = 2
+      integer, parameter :: YOG_SUM = 3
+      integer, parameter :: YOG_PROD = 4
+      integer, parameter :: YOG_MAXLOC = 5
+      integer, parameter :: YOG_MINLOC = 6
+      integer, parameter :: YOG_BAND = 7
+      integer, parameter :: YOG_BOR = 8
+      integer, parameter :: YOG_BXOR = 9
+      integer, parameter :: YOG_LAND = 10
+      integer, parameter :: YOG_LOR = 11
+      integer, parameter :: YOG_LXOR = 12
+      integer, parameter :: YOG_REPLACE = 13
+      integer, parameter :: YOG_NO_OP = 14
+      
+
+! Null handles
+
+      integer, parameter :: YOG_GROUP_NULL = 0
+      integer, parameter :: YOG_COMM_NULL = 0
+      integer, parameter :: YOG_DATATYPE_NULL = 0
+      integer, parameter :: YOG_REQUEST_NULL = 0
+      integer, parameter :: YOG_OP_NULL = 0
+      integer, parameter :: YOG_INFO_NULL = 0
+      integer, parameter :: YOG_FILE_NULL = 0
+      integer, parameter :: YOG_ERRHANDLER_NULL = 0
+      integer, parameter :: YOG_WIN_NULL = 0
+
+! Predefined error handlers
+      integer, parameter :: YOG_ERRORS_ARE_FATAL = 1
+      integer, parameter :: YOG_ERRORS_RETURN = 2
+
+! Empty group
+      integer, parameter :: YOG_GROUP_EMPTY = 1
+
+! For supported thread levels
+      integer, parameter :: YOG_THREAD_SINGLE = 0
+      integer, parameter :: YOG_THREAD_FUNNELED = 1
+      integer, parameter :: YOG_THREAD_SERIALIZED = 2
+      integer, parameter :: YOG_THREAD_MULTIPLE = 3
+
+! Lock type constants
+      integer, parameter :: YOG_LOCK_EXCLUSIVE = 234
+      integer, parameter :: YOG_LOCK_SHARED = 235
+
+! Topology test constants
+      integer, parameter :: YOG_GRAPH = 1
+      integer, parameter :: YOG_CART = 2
+      integer, parameter :: YOG_DIST_GRAPH = 3
+
+! MPI Combiner state constants
+      integer, parameter :: YOG_COMBINER_NAMED = 1
+      integer, parameter :: YOG_COMBINER_DUP = 2
+      integer, parameter :: YOG_COMBINER_CONTIGUOUS = 3
+      integer, parameter :: YOG_COMBINER_VECTOR = 4
+      integer, parameter :: YOG_COMBINER_HVECTOR_INTEGER = 5
+      integer, parameter :: YOG_COMBINER_HVECTOR = 6
+      integer, parameter :: YOG_COMBINER_INDEXED = 7
+      integer, parameter :: YOG_COMBINER_HINDEXED_INTEGER = 8
+      integer, parameter :: YOG_COMBINER_HINDEXED = 9
+      integer, parameter :: YOG_COMBINER_INDEXED_BLOCK = 10
+      integer, parameter :: YOG_COMBINER_STRUCT_INTEGER = 12
+      integer, parameter :: YOG_COMBINER_STRUCT = 13
+      integer, parameter :: YOG_COMBINER_SUBARRAY = 14
+      integer, parameter :: YOG_COMBINER_DARRAY = 15
+      integer, parameter :: YOG_COMBINER_F90_REAL = 16
+      integer, parameter :: YOG_COMBINER_F90_COMPLEX = 17
+      integer, parameter :: YOG_COMBINER_F90_INTEGER = 18
+      integer, parameter :: YOG_COMBINER_RESIZED = 19
+
+! Predefined type for MPI_Comm_split_type
+      integer, parameter :: YOG_COMM_TYPE_SHARED = 1
+
+! status size and reserved index values (Fortran)
+! MPI_STATUS_SIZE is 15.  This is so the first three integers may
+! be used to provide MPI_SOURCE, MPI_TAG, and MPI_ERROR to users.
+! The remaining 12 integer elements house the real MPI_Status object.
+! With the aligned layout (YALIGNSTATUS=1) it is 16, the fourth integer
+! being padding, as in the C YogiMPI_Status.
+      integer, parameter :: YOG_STATUS_SIZE = 15
+      
+      integer, parameter :: YOG_SOURCE = 1
+      integer, parameter :: YOG_TAG = 2
+      integer, parameter :: YOG_ERROR = 3
+      integer :: YOG_STATUS_IGNORE(YOG_STATUS_SIZE)
+      integer :: YOG_STATUSES_IGNORE(YOG_STATUS_SIZE,1)
+
+! MPI_IN_PLACE is a special constant that must go in a common block.
+      integer(YOG_INTEGER_KIND) :: YOG_IN_PLACE
+
+! Declare common blocks.
+
+      COMMON /ympi1/ YOG_STATUS_IGNORE, YOG_STATUSES_IGNORE
+      COMMON /ympi2/ YOG_IN_PLACE, YOG_BOTTOM
+      COMMON /ympi3/ YOG_UNWEIGHTED, YOG_WEIGHTS_EMPTY
+
+      real*8 :: YOG_WTIME
+      real*8 :: YOG_WTICK
+      external YOG_WTIME
+      external YOG_WTICK
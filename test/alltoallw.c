@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* MPI_Alltoallw and MPI_Neighbor_alltoallw take one datatype per peer.
+   YogiMPI sizes those arrays from its per-communicator cache and reuses
+   the converted datatypes when the same ones come again, so this test
+   repeats calls, changes the types between calls, frees and recreates
+   datatypes and communicators, and checks every result. */
+
+/* Every rank sends (rank * 100 + destination) to every destination, as a
+   contiguous type of `width` ints so derived types get exercised too. */
+int exchange(MPI_Comm comm, MPI_Datatype type, int width) {
+    int rank, size, i, j, errors = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    int *sendbuf = (int *) malloc(size * width * sizeof(int));
+    int *recvbuf = (int *) malloc(size * width * sizeof(int));
+    int *counts = (int *) malloc(size * sizeof(int));
+    int *displs = (int *) malloc(size * sizeof(int));
+    MPI_Datatype *types = (MPI_Datatype *) malloc(size * sizeof(MPI_Datatype));
+    for (i = 0; i < size; i++) {
+        counts[i] = 1;
+        displs[i] = i * width * sizeof(int);
+        types[i] = type;
+        for (j = 0; j < width; j++) {
+            sendbuf[i * width + j] = rank * 100 + i;
+            recvbuf[i * width + j] = -1;
+        }
+    }
+    MPI_Alltoallw(sendbuf, counts, displs, types, recvbuf, counts, displs,
+                  types, comm);
+    for (i = 0; i < size; i++) {
+        for (j = 0; j < width; j++) {
+            if (recvbuf[i * width + j] != i * 100 + rank) errors++;
+        }
+    }
+    free(sendbuf);
+    free(recvbuf);
+    free(counts);
+    free(displs);
+    free(types);
+    return errors;
+}
+
+/* On a periodic ring, send rank to both neighbors. */
+int neighborExchange(MPI_Comm ring) {
+    int rank, size, left, right, errors = 0;
+    int sendbuf[2], recvbuf[2] = { -1, -1 };
+    int counts[2] = { 1, 1 };
+    MPI_Aint displs[2] = { 0, sizeof(int) };
+    MPI_Datatype types[2] = { MPI_INT, MPI_INT };
+
+    MPI_Comm_rank(ring, &rank);
+    MPI_Comm_size(ring, &size);
+    MPI_Cart_shift(ring, 0, 1, &left, &right);
+    sendbuf[0] = sendbuf[1] = rank;
+    MPI_Neighbor_alltoallw(sendbuf, counts, displs, types, recvbuf, counts,
+                           displs, types, ring);
+    if (recvbuf[0] != left || recvbuf[1] != right) errors++;
+    return errors;
+}
+
+int main(int argc, char **argv) {
+    int rank, size, i, errors = 0, totalErrors = 0;
+    int periodic = 1;
+    MPI_Datatype pair, triple;
+    MPI_Comm dup, ring;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    /* Same types again and again, then different ones. */
+    for (i = 0; i < 3; i++) errors += exchange(MPI_COMM_WORLD, MPI_INT, 1);
+    MPI_Type_contiguous(2, MPI_INT, &pair);
+    MPI_Type_commit(&pair);
+    errors += exchange(MPI_COMM_WORLD, pair, 2);
+    errors += exchange(MPI_COMM_WORLD, pair, 2);
+
+    /* A freed datatype's handle may come back for a different type. */
+    MPI_Type_free(&pair);
+    MPI_Type_contiguous(3, MPI_INT, &triple);
+    MPI_Type_commit(&triple);
+    errors += exchange(MPI_COMM_WORLD, triple, 3);
+    MPI_Type_free(&triple);
+
+    /* Likewise a freed communicator's handle. */
+    MPI_Comm_dup(MPI_COMM_WORLD, &dup);
+    errors += exchange(dup, MPI_INT, 1);
+    MPI_Comm_free(&dup);
+    MPI_Comm_split(MPI_COMM_WORLD, rank % 2, rank, &dup);
+    errors += exchange(dup, MPI_INT, 1);
+    MPI_Comm_free(&dup);
+
+    MPI_Cart_create(MPI_COMM_WORLD, 1, &size, &periodic, 0, &ring);
+    for (i = 0; i < 2; i++) errors += neighborExchange(ring);
+    MPI_Comm_free(&ring);
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("alltoallw found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
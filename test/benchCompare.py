@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+Compares two microBench CSV files, one from the native MPI and one through
+YogiMPI, and writes the translation overhead of every measurement as CSV:
+
+    benchmark,bytes,native_ns,yogi_ns,overhead_ns,overhead_pct
+
+With --max-overhead, exits with status 1 if any measurement of at most
+--max-bytes bytes costs more than that many extra nanoseconds per
+operation, so a regression in the generated wrappers fails the run.
+
+Usage:
+    benchCompare.py bench.native.csv bench.yogi.csv
+    benchCompare.py --max-overhead 200 -o overhead.csv native.csv yogi.csv
+"""
+
+import argparse
+import csv
+import sys
+
+def readBench(fileName):
+    results = {}
+    with open(fileName) as benchFile:
+        for row in csv.DictReader(benchFile):
+            key = (row['benchmark'], int(row['bytes']))
+            results[key] = float(row['ns_per_op'])
+    return results
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Compare microBench runs.')
+    parser.add_argument('native', help='CSV from microBench_native')
+    parser.add_argument('yogi', help='CSV from microBench')
+    parser.add_argument('-o', '--output', help='Output file (default stdout)')
+    parser.add_argument('--max-overhead', type=float,
+                        help='Fail if any overhead exceeds this many ns/op')
+    parser.add_argument('--max-bytes', type=int, default=64,
+                        help='Only check messages up to this size '
+                             '(default 64)')
+    args = parser.parse_args()
+
+    native = readBench(args.native)
+    yogi = readBench(args.yogi)
+    out = sys.stdout
+    if args.output:
+        out = open(args.output, 'w')
+    writer = csv.writer(out, lineterminator='\n')
+    writer.writerow(['benchmark', 'bytes', 'native_ns', 'yogi_ns',
+                     'overhead_ns', 'overhead_pct'])
+    failures = []
+    # Keep the order of the native run, which is the order microBench ran.
+    for key in native:
+        if key not in yogi:
+            continue
+        overhead = yogi[key] - native[key]
+        percent = 100.0 * overhead / native[key] if native[key] > 0 else 0.0
+        writer.writerow([key[0], key[1], '%.1f' % native[key],
+                         '%.1f' % yogi[key], '%.1f' % overhead,
+                         '%.1f' % percent])
+        if args.max_overhead is not None and key[1] <= args.max_bytes and \
+           overhead > args.max_overhead:
+            failures.append('%s %d bytes: %.1f ns/op over native' %
+                            (key[0], key[1], overhead))
+    if out is not sys.stdout:
+        out.close()
+    for failure in failures:
+        sys.stderr.write(failure + '\n')
+    sys.exit(1 if failures else 0)
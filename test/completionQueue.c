@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Many receives and sends between every pair of ranks, handed to a
+   YogiMPI completion queue and polled until each has been reported once,
+   by its id, with the right data and status.  The queue must refuse a
+   persistent request, here under MPI_THREAD_MULTIPLE, where YogiMPI keeps
+   no cache of them. */
+
+#define PER_PEER 64
+#define BATCH 16
+
+int main(int argc, char **argv) {
+    int rank, size, peer, i, n, errors = 0, totalErrors = 0;
+    int total, reported = 0, outcount, pending, provided, persistentId = 0;
+    int *sendbuf, *recvbuf, *ids, *seen, doneIds[BATCH];
+    MPI_Request *requests, persistent;
+    MPI_Status statuses[BATCH];
+    YogiX_Cq cq;
+
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    /* Ids 0..total-1 are receives, total..2*total-1 sends. */
+    total = size * PER_PEER;
+    sendbuf = malloc(total * sizeof(int));
+    recvbuf = malloc(total * sizeof(int));
+    ids = malloc(2 * total * sizeof(int));
+    seen = calloc(2 * total, sizeof(int));
+    requests = malloc(2 * total * sizeof(MPI_Request));
+
+    YogiX_Cq_create(&cq);
+    MPI_Recv_init(recvbuf, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, &persistent);
+    if (YogiX_Cq_add(cq, 1, &persistent, &persistentId) != MPI_ERR_REQUEST ||
+        persistent == MPI_REQUEST_NULL) {
+        errors++;
+    }
+    MPI_Request_free(&persistent);
+    for (peer = 0; peer < size; peer++) {
+        for (i = 0; i < PER_PEER; i++) {
+            n = peer * PER_PEER + i;
+            recvbuf[n] = -1;
+            MPI_Irecv(&recvbuf[n], 1, MPI_INT, peer, i, MPI_COMM_WORLD,
+                      &requests[n]);
+            ids[n] = n;
+        }
+    }
+    /* Add the receives in two parts, polling in between. */
+    YogiX_Cq_add(cq, total / 2, requests, ids);
+    YogiX_Cq_poll(cq, BATCH, &outcount, doneIds, statuses);
+    if (outcount != 0) errors++;
+    YogiX_Cq_add(cq, total - total / 2, &requests[total / 2],
+                 &ids[total / 2]);
+    for (n = 0; n < total; n++) {
+        if (requests[n] != MPI_REQUEST_NULL) errors++;
+    }
+    /* No rank sends before every rank has seen its queue idle. */
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for (peer = 0; peer < size; peer++) {
+        for (i = 0; i < PER_PEER; i++) {
+            n = peer * PER_PEER + i;
+            sendbuf[n] = rank * 100000 + i;
+            MPI_Isend(&sendbuf[n], 1, MPI_INT, peer, i, MPI_COMM_WORLD,
+                      &requests[total + n]);
+            ids[total + n] = total + n;
+        }
+    }
+    YogiX_Cq_add(cq, total, &requests[total], &ids[total]);
+    YogiX_Cq_pending(cq, &pending);
+    if (pending != 2 * total) errors++;
+    if (YogiX_Cq_free(&cq) != MPI_ERR_PENDING) errors++;
+
+    while (1) {
+        if (reported % 3) {
+            YogiX_Cq_wait(cq, BATCH, &outcount, doneIds, statuses);
+        }
+        else {
+            YogiX_Cq_poll(cq, BATCH, &outcount, doneIds,
+                          (reported % 2) ? MPI_STATUSES_IGNORE : statuses);
+        }
+        if (outcount == MPI_UNDEFINED) break;
+        for (i = 0; i < outcount; i++) {
+            n = doneIds[i];
+            if (n < 0 || n >= 2 * total || seen[n]++) {
+                errors++;
+                continue;
+            }
+            if (n < total) {
+                if (recvbuf[n] != (n / PER_PEER) * 100000 + n % PER_PEER) {
+                    errors++;
+                }
+                if (reported % 3 && (statuses[i].MPI_SOURCE != n / PER_PEER ||
+                                     statuses[i].MPI_TAG != n % PER_PEER)) {
+                    errors++;
+                }
+            }
+        }
+        reported += outcount;
+    }
+    if (reported != 2 * total) errors++;
+    YogiX_Cq_pending(cq, &pending);
+    if (pending != 0) errors++;
+    if (YogiX_Cq_free(&cq) != MPI_SUCCESS || cq != YogiX_CQ_NULL) errors++;
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("completionQueue found %d errors.\n", totalErrors);
+    }
+    free(sendbuf);
+    free(recvbuf);
+    free(ids);
+    free(seen);
+    free(requests);
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
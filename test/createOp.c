@@ -12,6 +12,16 @@ void addem(int *invec, int *inoutvec, int *len, MPI_Datatype *dtype)
         inoutvec[i] += invec[i];
 }
 
+void maxem(int *invec, int *inoutvec, int *len, MPI_Datatype *dtype)
+{
+    int i;
+    for ( i=0; i<*len; i++ )
+        if (invec[i] > inoutvec[i]) inoutvec[i] = invec[i];
+}
+
+/* More ops than YogiMPI has trampolines, so some share the fallback. */
+#define MANY_OPS 80
+
 int main( int argc, char **argv )
 {
     int rank, size, i;
@@ -35,6 +45,44 @@ int main( int argc, char **argv )
         correct_result += i;
     if (result != correct_result) errors++;
 
+    /* Every op must call its own function, whichever trampoline it has. */
+    MPI_Op ops[MANY_OPS];
+    for (i = 0; i < MANY_OPS; i++) {
+        MPI_Op_create( (MPI_User_function *)(i % 2 ? maxem : addem), 1,
+                       &ops[i] );
+    }
+    for (i = MANY_OPS - 2; i < MANY_OPS; i++) {
+        MPI_Allreduce( &data, &result, 1, MPI_INT, ops[i], MPI_COMM_WORLD );
+        if (result != (i % 2 ? size - 1 : correct_result)) errors++;
+    }
+
+#if MPI_VERSION >= 3
+    /* Two nonblocking reductions with different ops in flight at once. */
+    int sums[2], maxes[2];
+    MPI_Request requests[2];
+    MPI_Iallreduce( &data, sums, 1, MPI_INT, ops[0], MPI_COMM_WORLD,
+                    &requests[0] );
+    MPI_Iallreduce( &data, maxes, 1, MPI_INT, ops[1], MPI_COMM_WORLD,
+                    &requests[1] );
+    MPI_Waitall( 2, requests, MPI_STATUSES_IGNORE );
+    if (sums[0] != correct_result || maxes[0] != size - 1) errors++;
+#endif
+    for (i = 0; i < MANY_OPS; i++) MPI_Op_free( &ops[i] );
+
+#if MPI_VERSION >= 3
+    /* An op freed while a reduction with it is pending still belongs to
+       that reduction, even once a new op has been created. */
+    MPI_Op early;
+    MPI_Op_create( (MPI_User_function *)addem, 1, &early );
+    MPI_Iallreduce( &data, sums, 1, MPI_INT, early, MPI_COMM_WORLD,
+                    &requests[0] );
+    MPI_Op_free( &early );
+    MPI_Op_create( (MPI_User_function *)maxem, 1, &early );
+    MPI_Wait( &requests[0], MPI_STATUS_IGNORE );
+    if (sums[0] != correct_result) errors++;
+    MPI_Op_free( &early );
+#endif
+
     if(errors) printf("FAIL - Errors occurred.\n");
 
     MPI_Finalize();
@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi.h"
+
+/* Nonblocking and neighbor collectives as YogiMPI's schedules run them.
+   Built against MPI 2.x they are always YogiMPI's; against MPI 3 the test
+   asks for them with YOGI_EMULATE_COLLECTIVES.  Several collectives are
+   kept in flight at once, mixed with point-to-point requests in one
+   Waitall, and driven by a Test loop, and every result is checked
+   against a known value. */
+
+int errors = 0;
+
+struct range {
+    int first;
+    int last;
+};
+
+/* Joins adjacent ranges of ranks.  The op associates but does not
+   commute, so any range out of order spoils the result. */
+void joinRanges(void *in, void *inout, int *len, MPI_Datatype *datatype) {
+    struct range *a = in, *b = inout;
+    int i;
+    for (i = 0; i < *len; i++) {
+        if (a[i].last + 1 != b[i].first) a[i].first = -1000;
+        b[i].first = a[i].first;
+    }
+}
+
+void checkReductions(MPI_Comm comm) {
+    int rank, size, i, root, flag;
+    int values[100], sums[100], maxima[100];
+    struct range mine[100], joined[100];
+    MPI_Request requests[4];
+    MPI_Op op, early;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Op_create(joinRanges, 0, &op);
+    for (i = 0; i < 100; i++) {
+        values[i] = rank + i;
+        mine[i].first = rank;
+        mine[i].last = rank;
+    }
+
+    /* Three allreduces in flight at once. */
+    MPI_Iallreduce(values, sums, 100, MPI_INT, MPI_SUM, comm, &requests[0]);
+    MPI_Iallreduce(values, maxima, 100, MPI_INT, MPI_MAX, comm, &requests[1]);
+    MPI_Iallreduce(mine, joined, 100, MPI_2INT, op, comm, &requests[2]);
+    MPI_Waitall(3, requests, MPI_STATUSES_IGNORE);
+    for (i = 0; i < 100; i++) {
+        if (sums[i] != size * (size - 1) / 2 + size * i) errors++;
+        if (maxima[i] != size - 1 + i) errors++;
+        if (joined[i].first != 0 || joined[i].last != size - 1) errors++;
+    }
+
+    /* An op freed while its reduction runs still does the reduction. */
+    MPI_Op_create(joinRanges, 0, &early);
+    MPI_Iallreduce(mine, joined, 100, MPI_2INT, early, comm, &requests[0]);
+    MPI_Op_free(&early);
+    MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+    for (i = 0; i < 100; i++) {
+        if (joined[i].first != 0 || joined[i].last != size - 1) errors++;
+    }
+
+    /* Reduce to every root, in place at the root, finished by Test. */
+    for (root = 0; root < size; root++) {
+        for (i = 0; i < 100; i++) sums[i] = values[i];
+        if (rank == root) {
+            MPI_Ireduce(MPI_IN_PLACE, sums, 100, MPI_INT, MPI_SUM, root, comm,
+                        &requests[0]);
+        }
+        else {
+            MPI_Ireduce(values, NULL, 100, MPI_INT, MPI_SUM, root, comm,
+                        &requests[0]);
+        }
+        flag = 0;
+        while (!flag) MPI_Test(&requests[0], &flag, MPI_STATUS_IGNORE);
+        if (requests[0] != MPI_REQUEST_NULL) errors++;
+        if (rank == root) {
+            for (i = 0; i < 100; i++) {
+                if (sums[i] != size * (size - 1) / 2 + size * i) errors++;
+            }
+        }
+    }
+
+    /* A negative root is refused rather than taken for an allreduce. */
+    MPI_Comm_set_errhandler(comm, MPI_ERRORS_RETURN);
+    if (MPI_Ireduce(values, sums, 100, MPI_INT, MPI_SUM, -1, comm,
+                    &requests[0]) == MPI_SUCCESS) {
+        errors++;
+        MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+    }
+    MPI_Comm_set_errhandler(comm, MPI_ERRORS_ARE_FATAL);
+    MPI_Op_free(&op);
+}
+
+void checkDataMovement(MPI_Comm comm) {
+    int rank, size, i, root, index, left, right, token = -1;
+    int *block, *all, *counts, *displs, *swapped;
+    MPI_Request requests[4];
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    block = malloc(size * sizeof(int));
+    all = malloc(size * size * sizeof(int));
+    counts = malloc(size * sizeof(int));
+    displs = malloc(size * sizeof(int));
+    swapped = malloc(size * sizeof(int));
+
+    for (root = 0; root < size; root++) {
+        int data[10];
+        for (i = 0; i < 10; i++) data[i] = rank == root ? root * 10 + i : -1;
+        MPI_Ibcast(data, 10, MPI_INT, root, comm, &requests[0]);
+        MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+        for (i = 0; i < 10; i++) if (data[i] != root * 10 + i) errors++;
+    }
+
+    /* A ring exchange in the same Waitall as a gather and a barrier. */
+    left = (rank + size - 1) % size;
+    right = (rank + 1) % size;
+    MPI_Irecv(&token, 1, MPI_INT, left, 5, comm, &requests[0]);
+    MPI_Isend(&rank, 1, MPI_INT, right, 5, comm, &requests[1]);
+    MPI_Igather(&rank, 1, MPI_INT, block, 1, MPI_INT, 0, comm, &requests[2]);
+    MPI_Ibarrier(comm, &requests[3]);
+    MPI_Waitall(4, requests, MPI_STATUSES_IGNORE);
+    if (token != left) errors++;
+    if (rank == 0) {
+        for (i = 0; i < size; i++) if (block[i] != i) errors++;
+    }
+
+    /* Variable blocks: rank i sends i + 1 values. */
+    for (i = 0; i < size; i++) {
+        counts[i] = i + 1;
+        displs[i] = i * size;
+    }
+    for (i = 0; i < size; i++) block[i] = rank * 100 + i;
+    for (i = 0; i < size * size; i++) all[i] = -1;
+    MPI_Iallgatherv(block, rank + 1, MPI_INT, all, counts, displs, MPI_INT,
+                    comm, &requests[0]);
+    MPI_Waitany(1, requests, &index, MPI_STATUS_IGNORE);
+    for (root = 0; root < size; root++) {
+        for (i = 0; i < size; i++) {
+            int want = i <= root ? root * 100 + i : -1;
+            if (all[root * size + i] != want) errors++;
+        }
+    }
+
+    /* Scatter from the last rank. */
+    if (rank == size - 1) {
+        for (i = 0; i < size; i++) block[i] = i * 7;
+    }
+    MPI_Iscatter(block, 1, MPI_INT, &token, 1, MPI_INT, size - 1, comm,
+                 &requests[0]);
+    MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+    if (token != rank * 7) errors++;
+
+    /* Alltoall, out of place and in place. */
+    for (i = 0; i < size; i++) block[i] = rank * size + i;
+    MPI_Ialltoall(block, 1, MPI_INT, swapped, 1, MPI_INT, comm,
+                  &requests[0]);
+    MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+    for (i = 0; i < size; i++) if (swapped[i] != i * size + rank) errors++;
+    MPI_Ialltoall(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, swapped, 1, MPI_INT,
+                  comm, &requests[0]);
+    MPI_Wait(&requests[0], MPI_STATUS_IGNORE);
+    for (i = 0; i < size; i++) if (swapped[i] != rank * size + i) errors++;
+
+    free(block);
+    free(all);
+    free(counts);
+    free(displs);
+    free(swapped);
+}
+
+/* A periodic ring, whose two neighbors are the same rank on two ranks,
+   and a graph of the same ring. */
+void checkNeighbors(MPI_Comm comm) {
+    int rank, size, i, left, right;
+    int dims[1], periods[1] = {1}, received[2], sent[2];
+    int *index, *edges;
+    MPI_Comm ring, graph;
+    MPI_Request request;
+    MPI_Comm_size(comm, &size);
+    dims[0] = size;
+    MPI_Cart_create(comm, 1, dims, periods, 0, &ring);
+    MPI_Comm_rank(ring, &rank);
+    left = (rank + size - 1) % size;
+    right = (rank + 1) % size;
+
+    MPI_Ineighbor_allgather(&rank, 1, MPI_INT, received, 1, MPI_INT, ring,
+                            &request);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    if (received[0] != left || received[1] != right) errors++;
+
+    /* Block 0 goes left and block 1 right. */
+    sent[0] = rank * 10;
+    sent[1] = rank * 10 + 1;
+    MPI_Neighbor_alltoall(sent, 1, MPI_INT, received, 1, MPI_INT, ring);
+    if (received[0] != left * 10 + 1 || received[1] != right * 10) errors++;
+
+    index = malloc(size * sizeof(int));
+    edges = malloc(2 * size * sizeof(int));
+    for (i = 0; i < size; i++) {
+        index[i] = 2 * (i + 1);
+        edges[2 * i] = (i + size - 1) % size;
+        edges[2 * i + 1] = (i + 1) % size;
+    }
+    MPI_Graph_create(comm, size, index, edges, 0, &graph);
+    MPI_Neighbor_allgather(&rank, 1, MPI_INT, received, 1, MPI_INT, graph);
+    /* On two ranks both neighbors are the same rank. */
+    if (received[0] != left || received[1] != right) errors++;
+
+    free(index);
+    free(edges);
+    MPI_Comm_free(&graph);
+    MPI_Comm_free(&ring);
+}
+
+/* Starting a collective must not wait for the other ranks, even on a
+   new communicator: rank 1 only gets to its Ibcast once rank 0, already
+   past its own, has received a synchronous send. */
+void checkLocalStart(MPI_Comm comm) {
+    int rank, size, value, token = 0;
+    MPI_Comm fresh;
+    MPI_Request request;
+    MPI_Comm_dup(comm, &fresh);
+    MPI_Comm_rank(fresh, &rank);
+    MPI_Comm_size(fresh, &size);
+    value = rank == 0 ? 42 : -1;
+    if (rank == 1) MPI_Ssend(&rank, 1, MPI_INT, 0, 9, fresh);
+    MPI_Ibcast(&value, 1, MPI_INT, 0, fresh, &request);
+    if (rank == 0 && size > 1) {
+        MPI_Recv(&token, 1, MPI_INT, 1, 9, fresh, MPI_STATUS_IGNORE);
+        if (token != 1) errors++;
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    if (value != 42) errors++;
+    MPI_Comm_free(&fresh);
+}
+
+int main(int argc, char **argv) {
+    int rank, round, totalErrors = 0;
+    MPI_Comm half;
+
+    setenv("YOGI_EMULATE_COLLECTIVES", "1", 0);
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    checkReductions(MPI_COMM_WORLD);
+    checkDataMovement(MPI_COMM_WORLD);
+    checkNeighbors(MPI_COMM_WORLD);
+    checkLocalStart(MPI_COMM_WORLD);
+    /* Communicators freed and split again reuse the same Yogi handles. */
+    for (round = 0; round < 3; round++) {
+        MPI_Comm_split(MPI_COMM_WORLD, (rank + round) % 2, rank, &half);
+        checkReductions(half);
+        checkDataMovement(half);
+        MPI_Comm_free(&half);
+    }
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("emulatedCollectives found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Allreduce and Bcast through YogiMPI's node-aware collectives.  The test
+   turns them on itself, for communicators of two ranks and up, and
+   treats every two ranks as a node so that the leaders' phase runs on a
+   single machine too.  Sizes on both sides of the engine's message limit,
+   every root, in-place reductions, a strided datatype, and communicators
+   that are split and freed are all checked against known results. */
+
+#define MAXCOUNT 20000
+
+int errors = 0;
+
+void checkAllreduce(MPI_Comm comm, int count, int inPlace) {
+    int rank, size, i, round;
+    int *ints = malloc(count * sizeof(int)), *sums = malloc(count * sizeof(int));
+    double *values = malloc(count * sizeof(double));
+    double *maxima = malloc(count * sizeof(double));
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    /* Several rounds, so both halves of the shared buffers are used. */
+    for (round = 0; round < 3; round++) {
+        for (i = 0; i < count; i++) {
+            ints[i] = rank + i + round;
+            values[i] = (double) ((rank + i) % size);
+        }
+        if (inPlace) {
+            for (i = 0; i < count; i++) sums[i] = ints[i];
+            MPI_Allreduce(MPI_IN_PLACE, sums, count, MPI_INT, MPI_SUM, comm);
+        }
+        else {
+            MPI_Allreduce(ints, sums, count, MPI_INT, MPI_SUM, comm);
+        }
+        MPI_Allreduce(values, maxima, count, MPI_DOUBLE, MPI_MAX, comm);
+        for (i = 0; i < count; i++) {
+            if (sums[i] != size * (size - 1) / 2 + size * (i + round)) {
+                errors++;
+            }
+            if (maxima[i] != (double) (size - 1)) errors++;
+        }
+    }
+    free(ints);
+    free(sums);
+    free(values);
+    free(maxima);
+}
+
+void checkBcast(MPI_Comm comm, int count) {
+    int rank, size, root, i;
+    int *data = malloc(2 * count * sizeof(int));
+    MPI_Datatype strided;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Type_vector(count, 1, 2, MPI_INT, &strided);
+    MPI_Type_commit(&strided);
+    for (root = 0; root < size; root++) {
+        for (i = 0; i < count; i++) data[i] = rank == root ? root * i : -1;
+        MPI_Bcast(data, count, MPI_INT, root, comm);
+        for (i = 0; i < count; i++) {
+            if (data[i] != root * i) errors++;
+        }
+        /* Every other int; the gaps must be left alone. */
+        for (i = 0; i < 2 * count; i++) {
+            data[i] = (rank == root || i % 2) ? root + i : -1;
+        }
+        MPI_Bcast(data, 1, strided, root, comm);
+        for (i = 0; i < 2 * count; i++) {
+            if (data[i] != root + i) errors++;
+        }
+    }
+    MPI_Type_free(&strided);
+    free(data);
+}
+
+int main(int argc, char **argv) {
+    int rank, round, totalErrors = 0;
+    int counts[] = {1, 7, 1000, 16384, MAXCOUNT};
+    int numCounts = sizeof(counts) / sizeof(counts[0]), i;
+    MPI_Comm half;
+
+    setenv("YOGI_HIERARCHICAL", "1", 0);
+    setenv("YOGI_HIERARCHICAL_MIN_RANKS", "2", 0);
+    setenv("YOGI_HIERARCHICAL_NODE_RANKS", "2", 0);
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    for (i = 0; i < numCounts; i++) {
+        checkAllreduce(MPI_COMM_WORLD, counts[i], i % 2);
+        checkBcast(MPI_COMM_WORLD, counts[i]);
+    }
+    /* Communicators freed and split again reuse the same Yogi handles. */
+    for (round = 0; round < 3; round++) {
+        MPI_Comm_split(MPI_COMM_WORLD, (rank + round) % 2, rank, &half);
+        checkAllreduce(half, 100, round % 2);
+        checkBcast(half, 100);
+        MPI_Comm_free(&half);
+    }
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("hierarchical found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
@@ -0,0 +1,285 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi.h"
+
+/* Point-to-point and collective microbenchmarks in the style of the OSU
+   suite.  Built twice by "make bench": once through YogiMPI and once
+   against the native MPI.  benchCompare.py then subtracts the two runs to
+   give the cost of the translation layer per call.
+
+   Rank 0 prints one CSV line per measurement:
+
+       benchmark,bytes,iterations,ns_per_op,mb_per_s
+
+   ns_per_op is the time of one operation as each benchmark defines it
+   (half a round trip, one message, one request, one collective call).
+   mb_per_s is 0 where bandwidth does not apply.  Run with two ranks; the
+   optional argument scales the iteration counts (default 1000). */
+
+#define WARMUP 100
+#define WINDOW 64
+#define MAX_BYTES (1 << 20)
+#define MAX_REQUESTS 4096
+
+static int rank, size;
+
+void report(const char *benchmark, int bytes, int iterations, double seconds,
+            double operations, double bytesMoved) {
+    if (rank != 0) return;
+    printf("%s,%d,%d,%.1f,%.1f\n", benchmark, bytes, iterations,
+           seconds * 1e9 / operations,
+           bytesMoved > 0.0 ? bytesMoved / seconds / 1e6 : 0.0);
+}
+
+/* Fewer iterations for large messages so every size takes similar time. */
+int iterationsFor(int base, int bytes) {
+    int iterations = base / (1 + bytes / 8192);
+    return iterations > 10 ? iterations : 10;
+}
+
+/* Half round-trip time between ranks 0 and 1. */
+void latency(int base, char *sendbuf, char *recvbuf) {
+    int bytes, i, iterations;
+    double start = 0.0;
+
+    for (bytes = 0; bytes <= MAX_BYTES; bytes = bytes ? bytes * 4 : 1) {
+        iterations = iterationsFor(base * 10, bytes);
+        for (i = -WARMUP; i < iterations; i++) {
+            if (i == 0) {
+                MPI_Barrier(MPI_COMM_WORLD);
+                start = MPI_Wtime();
+            }
+            if (rank == 0) {
+                MPI_Send(sendbuf, bytes, MPI_CHAR, 1, 1, MPI_COMM_WORLD);
+                MPI_Recv(recvbuf, bytes, MPI_CHAR, 1, 1, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+            }
+            else if (rank == 1) {
+                MPI_Recv(recvbuf, bytes, MPI_CHAR, 0, 1, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+                MPI_Send(sendbuf, bytes, MPI_CHAR, 0, 1, MPI_COMM_WORLD);
+            }
+        }
+        report("latency", bytes, iterations, MPI_Wtime() - start,
+               2.0 * iterations, 0.0);
+    }
+}
+
+/* Rank 0 streams a window of nonblocking sends to rank 1, which answers
+   each window with a zero-byte acknowledgement.  Reported once as
+   bandwidth for large messages and once as message rate for small ones;
+   ns_per_op is the time per message either way. */
+void stream(const char *benchmark, int minBytes, int maxBytes, int base,
+            char *sendbuf, char *recvbuf) {
+    MPI_Request requests[WINDOW];
+    int bytes, i, j, iterations;
+    double start = 0.0;
+
+    for (bytes = minBytes; bytes <= maxBytes; bytes *= 4) {
+        iterations = iterationsFor(base, bytes * 8);
+        for (i = -WARMUP / 10; i < iterations; i++) {
+            if (i == 0) {
+                MPI_Barrier(MPI_COMM_WORLD);
+                start = MPI_Wtime();
+            }
+            if (rank == 0) {
+                for (j = 0; j < WINDOW; j++) {
+                    MPI_Isend(sendbuf, bytes, MPI_CHAR, 1, 2, MPI_COMM_WORLD,
+                              &requests[j]);
+                }
+                MPI_Waitall(WINDOW, requests, MPI_STATUSES_IGNORE);
+                MPI_Recv(recvbuf, 0, MPI_CHAR, 1, 3, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+            }
+            else if (rank == 1) {
+                for (j = 0; j < WINDOW; j++) {
+                    MPI_Irecv(recvbuf, bytes, MPI_CHAR, 0, 2, MPI_COMM_WORLD,
+                              &requests[j]);
+                }
+                MPI_Waitall(WINDOW, requests, MPI_STATUSES_IGNORE);
+                MPI_Send(sendbuf, 0, MPI_CHAR, 0, 3, MPI_COMM_WORLD);
+            }
+        }
+        report(benchmark, bytes, iterations, MPI_Wtime() - start,
+               (double) iterations * WINDOW,
+               (double) iterations * WINDOW * bytes);
+    }
+}
+
+/* Both ranks post `count` zero-byte Irecvs and Isends to each other and
+   complete them with one Waitall, so every operation creates, translates
+   and frees a request.  ns_per_op is per request. */
+void requestChurn(int base, MPI_Request *requests) {
+    int count, i, j, iterations, peer = 1 - rank;
+    char buffer = 0;
+    double start = 0.0;
+
+    for (count = 1; count <= MAX_REQUESTS; count *= 4) {
+        iterations = iterationsFor(base * 4, count * 64);
+        for (i = -WARMUP / 10; i < iterations; i++) {
+            if (i == 0) {
+                MPI_Barrier(MPI_COMM_WORLD);
+                start = MPI_Wtime();
+            }
+            if (rank > 1) continue;
+            for (j = 0; j < count; j++) {
+                MPI_Irecv(&buffer, 0, MPI_CHAR, peer, 4, MPI_COMM_WORLD,
+                          &requests[j]);
+            }
+            for (j = 0; j < count; j++) {
+                MPI_Isend(&buffer, 0, MPI_CHAR, peer, 4, MPI_COMM_WORLD,
+                          &requests[count + j]);
+            }
+            MPI_Waitall(2 * count, requests, MPI_STATUSES_IGNORE);
+        }
+        /* The bytes column holds the number of requests in flight. */
+        report("request_churn", count, iterations, MPI_Wtime() - start,
+               2.0 * iterations * count, 0.0);
+    }
+}
+
+/* Ping-pong of a strided vector of doubles (every other element), so
+   both sides pack and unpack a derived datatype.  Also times creating,
+   committing and freeing that datatype. */
+void derivedDatatype(int base, char *sendbuf, char *recvbuf) {
+    MPI_Datatype vector;
+    int elements, i, iterations;
+    double start = 0.0;
+
+    for (elements = 1; elements * 2 * sizeof(double) <= MAX_BYTES;
+         elements *= 8) {
+        int bytes = elements * sizeof(double);
+        MPI_Type_vector(elements, 1, 2, MPI_DOUBLE, &vector);
+        MPI_Type_commit(&vector);
+        iterations = iterationsFor(base * 4, bytes);
+        for (i = -WARMUP; i < iterations; i++) {
+            if (i == 0) {
+                MPI_Barrier(MPI_COMM_WORLD);
+                start = MPI_Wtime();
+            }
+            if (rank == 0) {
+                MPI_Send(sendbuf, 1, vector, 1, 5, MPI_COMM_WORLD);
+                MPI_Recv(recvbuf, 1, vector, 1, 5, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+            }
+            else if (rank == 1) {
+                MPI_Recv(recvbuf, 1, vector, 0, 5, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+                MPI_Send(sendbuf, 1, vector, 0, 5, MPI_COMM_WORLD);
+            }
+        }
+        report("datatype_vector", bytes, iterations, MPI_Wtime() - start,
+               2.0 * iterations, 0.0);
+        MPI_Type_free(&vector);
+    }
+
+    iterations = base * 10;
+    MPI_Barrier(MPI_COMM_WORLD);
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Type_vector(16, 1, 2, MPI_DOUBLE, &vector);
+        MPI_Type_commit(&vector);
+        MPI_Type_free(&vector);
+    }
+    report("datatype_create_free", 16 * sizeof(double), iterations,
+           MPI_Wtime() - start, iterations, 0.0);
+}
+
+/* One collective call per operation, timed on every rank; rank 0 reports
+   the slowest rank's time. */
+double slowest(double seconds) {
+    double maxSeconds;
+    MPI_Reduce(&seconds, &maxSeconds, 1, MPI_DOUBLE, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    return maxSeconds;
+}
+
+void collectives(int base, char *sendbuf, char *recvbuf) {
+    int bytes, i, iterations;
+    double start;
+
+    iterations = base * 10;
+    for (i = 0; i < WARMUP; i++) MPI_Barrier(MPI_COMM_WORLD);
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) MPI_Barrier(MPI_COMM_WORLD);
+    report("barrier", 0, iterations, slowest(MPI_Wtime() - start),
+           iterations, 0.0);
+
+    for (bytes = 8; bytes * size <= MAX_BYTES; bytes *= 8) {
+        iterations = iterationsFor(base * 4, bytes * size);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        start = MPI_Wtime();
+        for (i = 0; i < iterations; i++) {
+            MPI_Bcast(sendbuf, bytes, MPI_CHAR, 0, MPI_COMM_WORLD);
+        }
+        report("bcast", bytes, iterations, slowest(MPI_Wtime() - start),
+               iterations, 0.0);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        start = MPI_Wtime();
+        for (i = 0; i < iterations; i++) {
+            MPI_Allreduce(sendbuf, recvbuf, bytes / sizeof(double),
+                          MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        }
+        report("allreduce", bytes, iterations, slowest(MPI_Wtime() - start),
+               iterations, 0.0);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        start = MPI_Wtime();
+        for (i = 0; i < iterations; i++) {
+            MPI_Allgather(sendbuf, bytes, MPI_CHAR, recvbuf, bytes, MPI_CHAR,
+                          MPI_COMM_WORLD);
+        }
+        report("allgather", bytes, iterations, slowest(MPI_Wtime() - start),
+               iterations, 0.0);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        start = MPI_Wtime();
+        for (i = 0; i < iterations; i++) {
+            MPI_Alltoall(sendbuf, bytes, MPI_CHAR, recvbuf, bytes, MPI_CHAR,
+                         MPI_COMM_WORLD);
+        }
+        report("alltoall", bytes, iterations, slowest(MPI_Wtime() - start),
+               iterations, 0.0);
+    }
+}
+
+int main(int argc, char **argv) {
+    int base = 1000;
+    char *sendbuf, *recvbuf;
+    MPI_Request *requests;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (argc > 1) base = atoi(argv[1]);
+    if (size < 2) {
+        if (rank == 0) printf("microBench needs two ranks.\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    /* Collectives need room for one block per rank; the datatype
+       benchmark needs twice its payload for the stride. */
+    sendbuf = (char *) malloc(2 * MAX_BYTES);
+    recvbuf = (char *) malloc(2 * MAX_BYTES);
+    requests = (MPI_Request *) malloc(2 * MAX_REQUESTS * sizeof(MPI_Request));
+    memset(sendbuf, 1, 2 * MAX_BYTES);
+    memset(recvbuf, 0, 2 * MAX_BYTES);
+
+    if (rank == 0) printf("benchmark,bytes,iterations,ns_per_op,mb_per_s\n");
+    latency(base, sendbuf, recvbuf);
+    stream("bandwidth", 4096, MAX_BYTES / 4, base, sendbuf, recvbuf);
+    stream("message_rate", 1, 64, base, sendbuf, recvbuf);
+    requestChurn(base, requests);
+    derivedDatatype(base, sendbuf, recvbuf);
+    collectives(base, sendbuf, recvbuf);
+
+    free(sendbuf);
+    free(recvbuf);
+    free(requests);
+    MPI_Finalize();
+    return 0;
+}
@@ -71,7 +71,13 @@ int main(int argc, char* argv[]) {
 
     /* Print out one line for each message we received */
     for (i=1; i<np; i++) {
+        int received;
         actualReduceSum += y[i];
+        /* Each status must describe its own message. */
+        assert(status[i].MPI_SOURCE == y[i]);
+        assert(status[i].MPI_TAG == tag);
+        MPI_Get_count(&status[i], MPI_INT, &received);
+        assert(received == 1);
     }
     assert(actualReduceSum == expectReduceSum);
 
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Per-call cost of individual MPI functions on one process, meant to run
+   on the loopback backend in nullMPI.cxx ("make runnullbench").  With no
+   network and no progress engine underneath, the difference between the
+   YogiMPI and native builds is the wrapper cost alone, and it stays the
+   same from run to run.  The output has the CSV columns of microBench, so
+   benchCompare.py reads it too.  Its repeated loops over single calls
+   also suit perf and cachegrind.
+
+   The optional argument sets the iteration count (default 1000000). */
+
+#define WIDTH 16
+
+static int iterations = 1000000;
+
+void report(const char *function, int bytes, double start, int calls) {
+    printf("%s,%d,%d,%.1f,0.0\n", function, bytes, iterations,
+           (MPI_Wtime() - start) * 1e9 / ((double) iterations * calls));
+}
+
+int main(int argc, char **argv) {
+    int i, j, rank, size, flag;
+    double start, value = 1.0, result;
+    double block[WIDTH], other[WIDTH];
+    MPI_Request requests[2 * WIDTH];
+    MPI_Status status;
+    MPI_Datatype contiguous;
+
+    MPI_Init(&argc, &argv);
+    if (argc > 1) iterations = atoi(argv[1]);
+    for (i = 0; i < WIDTH; i++) block[i] = i;
+    printf("benchmark,bytes,iterations,ns_per_op,mb_per_s\n");
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    report("MPI_Comm_rank", 0, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) MPI_Comm_size(MPI_COMM_WORLD, &size);
+    report("MPI_Comm_size", 0, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Send(&value, 1, MPI_DOUBLE, MPI_PROC_NULL, 0, MPI_COMM_WORLD);
+    }
+    report("MPI_Send_proc_null", 8, start, 1);
+
+    /* Self messages: each pair is one queued send and one receive. */
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Send(&value, 1, MPI_DOUBLE, 0, 1, MPI_COMM_WORLD);
+        MPI_Recv(&result, 1, MPI_DOUBLE, 0, 1, MPI_COMM_WORLD, &status);
+    }
+    report("MPI_Send+MPI_Recv", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Sendrecv(&value, 1, MPI_DOUBLE, 0, 2, &result, 1, MPI_DOUBLE, 0,
+                     2, MPI_COMM_WORLD, &status);
+    }
+    report("MPI_Sendrecv", 8, start, 1);
+
+    /* Isend/Irecv pairs completed by one Waitall; per request. */
+    start = MPI_Wtime();
+    for (i = 0; i < iterations / WIDTH; i++) {
+        for (j = 0; j < WIDTH; j++) {
+            MPI_Irecv(&other[j], 1, MPI_DOUBLE, 0, 3, MPI_COMM_WORLD,
+                      &requests[j]);
+        }
+        for (j = 0; j < WIDTH; j++) {
+            MPI_Isend(&block[j], 1, MPI_DOUBLE, 0, 3, MPI_COMM_WORLD,
+                      &requests[WIDTH + j]);
+        }
+        MPI_Waitall(2 * WIDTH, requests, MPI_STATUSES_IGNORE);
+    }
+    report("MPI_Isend/Irecv+Waitall", 8, start, 2);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Irecv(&result, 1, MPI_DOUBLE, 0, 4, MPI_COMM_WORLD, &requests[0]);
+        MPI_Send(&value, 1, MPI_DOUBLE, 0, 4, MPI_COMM_WORLD);
+        MPI_Test(&requests[0], &flag, &status);
+    }
+    report("MPI_Irecv+Send+Test", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) MPI_Barrier(MPI_COMM_WORLD);
+    report("MPI_Barrier", 0, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Bcast(&value, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    }
+    report("MPI_Bcast", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_SUM,
+                      MPI_COMM_WORLD);
+    }
+    report("MPI_Allreduce", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Reduce(&value, &result, 1, MPI_DOUBLE, MPI_SUM, 0,
+                   MPI_COMM_WORLD);
+    }
+    report("MPI_Reduce", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Allgather(&value, 1, MPI_DOUBLE, &result, 1, MPI_DOUBLE,
+                      MPI_COMM_WORLD);
+    }
+    report("MPI_Allgather", 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Alltoall(&value, 1, MPI_DOUBLE, &result, 1, MPI_DOUBLE,
+                     MPI_COMM_WORLD);
+    }
+    report("MPI_Alltoall", 8, start, 1);
+
+    /* Datatype handles are created and freed, so this churns a pool. */
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        MPI_Type_contiguous(WIDTH, MPI_DOUBLE, &contiguous);
+        MPI_Type_commit(&contiguous);
+        MPI_Type_free(&contiguous);
+    }
+    report("MPI_Type_contiguous+commit+free", WIDTH * 8, start, 1);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) result = MPI_Wtime();
+    report("MPI_Wtime", 0, start, 1);
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,469 @@
+#include "mpi.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <map>
+#include <vector>
+
+/* A loopback stand-in for the MPI library, for measuring what YogiMPI
+   itself costs without any network or progress-engine noise.
+
+   It is built against the mpi.h of the MPI YogiMPI was built with, so it
+   has the same ABI, and replaces that library's functions at run time:
+   either with LD_PRELOAD=libnullmpi.so, or, in a YDISPATCH build, with
+   YMPI_LOADLIBRARY=libnullmpi.so.  There is always exactly one process.
+   Every communicator has size 1, a send to rank 0 is queued locally until
+   a receive matches it, and every request completes as soon as it can be
+   matched.  Only the calls nullBench makes are implemented, and only
+   predefined and contiguous datatypes; anything else reaches the real MPI
+   (or, through the dispatch table, is reported as missing). */
+
+#if MPI_VERSION >= 3
+#define NULL_CONST const
+#else
+#define NULL_CONST
+#endif
+
+/* Handles this library creates look like the ones bench_YogiManager
+   makes up: distinct, non-null, and valid as either ints or pointers. */
+template <typename T>
+static T makeHandle(int index) {
+    return (T)(std::intptr_t)(0x10000 + index * 16);
+}
+
+template <typename T>
+static int handleIndex(T handle) {
+    return (int) (((std::intptr_t) handle - 0x10000) / 16);
+}
+
+struct NullMessage {
+    MPI_Comm comm;
+    int tag;
+    std::vector<char> data;
+};
+
+struct NullRequest {
+    bool active;
+    bool complete;
+    void *buffer;
+    int bytes;
+    int tag;
+    MPI_Comm comm;
+};
+
+static bool initialized = false;
+static bool finalized = false;
+static std::map<MPI_Datatype, int> typeSizes;
+static int nextType = 0;
+static std::deque<NullMessage> unexpected;
+static std::vector<std::vector<char> > spareBuffers;
+static std::vector<NullRequest> requests;
+static std::vector<int> freeRequests;
+// Receives not yet matched, oldest first.
+static std::deque<int> posted;
+
+static int typeSize(MPI_Datatype datatype) {
+    std::map<MPI_Datatype, int>::iterator found = typeSizes.find(datatype);
+    if (found == typeSizes.end()) {
+        std::fprintf(stderr, "nullMPI: unsupported datatype\n");
+        std::abort();
+    }
+    return found->second;
+}
+
+static void setStatus(MPI_Status *status, int tag) {
+    if (status == MPI_STATUS_IGNORE) return;
+    status->MPI_SOURCE = 0;
+    status->MPI_TAG = tag;
+    status->MPI_ERROR = MPI_SUCCESS;
+}
+
+static bool tagMatches(int wanted, int tag) {
+    return wanted == MPI_ANY_TAG || wanted == tag;
+}
+
+/* Take the oldest queued message matching comm and tag into buffer. */
+static bool receiveQueued(void *buffer, int bytes, int &tag, MPI_Comm comm) {
+    for (std::deque<NullMessage>::iterator message = unexpected.begin();
+         message != unexpected.end(); ++message) {
+        if (message->comm != comm || !tagMatches(tag, message->tag)) continue;
+        int length = (int) message->data.size();
+        std::memcpy(buffer, message->data.data(),
+                    length < bytes ? length : bytes);
+        tag = message->tag;
+        spareBuffers.push_back(std::vector<char>());
+        spareBuffers.back().swap(message->data);
+        unexpected.erase(message);
+        return true;
+    }
+    return false;
+}
+
+/* Deliver to the oldest matching posted receive, or queue the message.
+   Queued messages reuse the buffers of earlier ones. */
+static void deliver(NULL_CONST void *buffer, int bytes, int tag,
+                    MPI_Comm comm) {
+    for (std::deque<int>::iterator index = posted.begin();
+         index != posted.end(); ++index) {
+        NullRequest &request = requests[*index];
+        if (request.comm != comm || !tagMatches(request.tag, tag)) continue;
+        std::memcpy(request.buffer, buffer,
+                    bytes < request.bytes ? bytes : request.bytes);
+        request.tag = tag;
+        request.complete = true;
+        posted.erase(index);
+        return;
+    }
+    unexpected.push_back(NullMessage());
+    NullMessage &message = unexpected.back();
+    if (!spareBuffers.empty()) {
+        message.data.swap(spareBuffers.back());
+        spareBuffers.pop_back();
+    }
+    message.comm = comm;
+    message.tag = tag;
+    message.data.assign((const char *) buffer, (const char *) buffer + bytes);
+}
+
+static MPI_Request newRequest(bool isReceive, void *buffer, int bytes,
+                              int tag, MPI_Comm comm) {
+    int index;
+    if (freeRequests.empty()) {
+        index = (int) requests.size();
+        requests.push_back(NullRequest());
+    }
+    else {
+        index = freeRequests.back();
+        freeRequests.pop_back();
+    }
+    NullRequest &request = requests[index];
+    request.active = true;
+    request.complete = !isReceive;
+    request.buffer = buffer;
+    request.bytes = bytes;
+    request.tag = tag;
+    request.comm = comm;
+    if (isReceive) {
+        request.complete = receiveQueued(buffer, bytes, request.tag, comm);
+        if (!request.complete) posted.push_back(index);
+    }
+    return makeHandle<MPI_Request>(index);
+}
+
+static void releaseRequest(MPI_Request *request, MPI_Status *status) {
+    int index = handleIndex(*request);
+    if (!requests[index].complete) {
+        posted.erase(std::find(posted.begin(), posted.end(), index));
+    }
+    setStatus(status, requests[index].tag);
+    requests[index].active = false;
+    freeRequests.push_back(index);
+    *request = MPI_REQUEST_NULL;
+}
+
+static NullRequest * findRequest(MPI_Request request) {
+    int index = handleIndex(request);
+    if (index < 0 || index >= (int) requests.size() ||
+        !requests[index].active) {
+        std::fprintf(stderr, "nullMPI: unknown request\n");
+        std::abort();
+    }
+    return &requests[index];
+}
+
+/* The exported functions below only call these, never each other: in a
+   library opened through the dispatch table, a call to one of its own MPI
+   functions would bind to the real MPI instead. */
+static void sendLocal(NULL_CONST void *buf, int bytes, int dest, int tag,
+                      MPI_Comm comm) {
+    if (dest == MPI_PROC_NULL) return;
+    deliver(buf, bytes, tag, comm);
+}
+
+static void receiveLocal(void *buf, int bytes, int source, int tag,
+                         MPI_Comm comm, MPI_Status *status) {
+    if (source == MPI_PROC_NULL) {
+        if (status != MPI_STATUS_IGNORE) {
+            status->MPI_SOURCE = MPI_PROC_NULL;
+            status->MPI_TAG = MPI_ANY_TAG;
+            status->MPI_ERROR = MPI_SUCCESS;
+        }
+        return;
+    }
+    if (!receiveQueued(buf, bytes, tag, comm)) {
+        std::fprintf(stderr, "nullMPI: MPI_Recv with nothing sent would "
+                     "never return\n");
+        std::abort();
+    }
+    setStatus(status, tag);
+}
+
+static bool testRequest(MPI_Request *request, MPI_Status *status) {
+    if (*request == MPI_REQUEST_NULL) {
+        setStatus(status, MPI_ANY_TAG);
+        return true;
+    }
+    if (!findRequest(*request)->complete) return false;
+    releaseRequest(request, status);
+    return true;
+}
+
+static void waitRequest(MPI_Request *request, MPI_Status *status) {
+    if (!testRequest(request, status)) {
+        std::fprintf(stderr, "nullMPI: MPI_Wait on a receive with nothing "
+                     "sent would never return\n");
+        std::abort();
+    }
+}
+
+static void initLocal() {
+    const struct { MPI_Datatype type; int size; } predefined[] = {
+        { MPI_CHAR, 1 }, { MPI_UNSIGNED_CHAR, 1 }, { MPI_BYTE, 1 },
+        { MPI_PACKED, 1 }, { MPI_SHORT, sizeof(short) },
+        { MPI_UNSIGNED_SHORT, sizeof(short) }, { MPI_INT, sizeof(int) },
+        { MPI_UNSIGNED, sizeof(int) }, { MPI_LONG, sizeof(long) },
+        { MPI_UNSIGNED_LONG, sizeof(long) },
+        { MPI_LONG_LONG, sizeof(long long) },
+        { MPI_UNSIGNED_LONG_LONG, sizeof(long long) },
+        { MPI_FLOAT, sizeof(float) }, { MPI_DOUBLE, sizeof(double) },
+        { MPI_LONG_DOUBLE, sizeof(long double) }
+    };
+    for (std::size_t i = 0; i < sizeof(predefined) / sizeof(*predefined);
+         i++) {
+        typeSizes[predefined[i].type] = predefined[i].size;
+    }
+    initialized = true;
+}
+
+/* With one process, every collective is a copy from the send buffer, or
+   nothing at all. */
+static void copyLocal(NULL_CONST void *sendbuf, void *recvbuf, int count,
+                      MPI_Datatype datatype) {
+    if (sendbuf == MPI_IN_PLACE || sendbuf == recvbuf) return;
+    std::memcpy(recvbuf, sendbuf, count * typeSize(datatype));
+}
+
+extern "C" {
+
+int MPI_Init(int *, char ***) {
+    initLocal();
+    return MPI_SUCCESS;
+}
+
+int MPI_Init_thread(int *argc, char ***argv, int required, int *provided) {
+    // Nothing here is locked, so promise no more than funneled.
+    *provided = required < MPI_THREAD_FUNNELED ? required
+                                               : MPI_THREAD_FUNNELED;
+    initLocal();
+    return MPI_SUCCESS;
+}
+
+int MPI_Initialized(int *flag) {
+    *flag = initialized;
+    return MPI_SUCCESS;
+}
+
+int MPI_Finalized(int *flag) {
+    *flag = finalized;
+    return MPI_SUCCESS;
+}
+
+int MPI_Finalize() {
+    finalized = true;
+    return MPI_SUCCESS;
+}
+
+int MPI_Abort(MPI_Comm, int errorcode) {
+    std::exit(errorcode);
+}
+
+double MPI_Wtime() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+double MPI_Wtick() {
+    return 1e-9;
+}
+
+int MPI_Comm_rank(MPI_Comm, int *rank) {
+    *rank = 0;
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_size(MPI_Comm, int *size) {
+    *size = 1;
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_test_inter(MPI_Comm, int *flag) {
+    *flag = 0;
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_remote_size(MPI_Comm, int *size) {
+    *size = 0;
+    return MPI_SUCCESS;
+}
+
+int MPI_Topo_test(MPI_Comm, int *status) {
+    *status = MPI_UNDEFINED;
+    return MPI_SUCCESS;
+}
+
+int MPI_Type_size(MPI_Datatype datatype, int *size) {
+    *size = typeSize(datatype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Type_contiguous(int count, MPI_Datatype oldtype,
+                        MPI_Datatype *newtype) {
+    *newtype = makeHandle<MPI_Datatype>(nextType++);
+    typeSizes[*newtype] = count * typeSize(oldtype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Type_commit(MPI_Datatype *) {
+    return MPI_SUCCESS;
+}
+
+int MPI_Type_free(MPI_Datatype *datatype) {
+    typeSizes.erase(*datatype);
+    *datatype = MPI_DATATYPE_NULL;
+    return MPI_SUCCESS;
+}
+
+int MPI_Send(NULL_CONST void *buf, int count, MPI_Datatype datatype,
+             int dest, int tag, MPI_Comm comm) {
+    sendLocal(buf, count * typeSize(datatype), dest, tag, comm);
+    return MPI_SUCCESS;
+}
+
+int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source,
+             int tag, MPI_Comm comm, MPI_Status *status) {
+    receiveLocal(buf, count * typeSize(datatype), source, tag, comm, status);
+    return MPI_SUCCESS;
+}
+
+int MPI_Sendrecv(NULL_CONST void *sendbuf, int sendcount,
+                 MPI_Datatype sendtype, int dest, int sendtag, void *recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int source,
+                 int recvtag, MPI_Comm comm, MPI_Status *status) {
+    sendLocal(sendbuf, sendcount * typeSize(sendtype), dest, sendtag, comm);
+    receiveLocal(recvbuf, recvcount * typeSize(recvtype), source, recvtag,
+                 comm, status);
+    return MPI_SUCCESS;
+}
+
+int MPI_Isend(NULL_CONST void *buf, int count, MPI_Datatype datatype,
+              int dest, int tag, MPI_Comm comm, MPI_Request *request) {
+    sendLocal(buf, count * typeSize(datatype), dest, tag, comm);
+    *request = newRequest(false, NULL, 0, tag, comm);
+    return MPI_SUCCESS;
+}
+
+int MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source,
+              int tag, MPI_Comm comm, MPI_Request *request) {
+    // A receive from MPI_PROC_NULL is complete from the start.
+    *request = newRequest(source != MPI_PROC_NULL, buf,
+                          count * typeSize(datatype), tag, comm);
+    return MPI_SUCCESS;
+}
+
+int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status) {
+    *flag = testRequest(request, status);
+    return MPI_SUCCESS;
+}
+
+int MPI_Wait(MPI_Request *request, MPI_Status *status) {
+    waitRequest(request, status);
+    return MPI_SUCCESS;
+}
+
+int MPI_Testall(int count, MPI_Request *array_of_requests, int *flag,
+                MPI_Status *array_of_statuses) {
+    *flag = 1;
+    for (int i = 0; i < count; i++) {
+        if (array_of_requests[i] != MPI_REQUEST_NULL &&
+            !findRequest(array_of_requests[i])->complete) {
+            *flag = 0;
+            return MPI_SUCCESS;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        testRequest(&array_of_requests[i],
+                    array_of_statuses == MPI_STATUSES_IGNORE
+                        ? MPI_STATUS_IGNORE : &array_of_statuses[i]);
+    }
+    return MPI_SUCCESS;
+}
+
+int MPI_Waitall(int count, MPI_Request *array_of_requests,
+                MPI_Status *array_of_statuses) {
+    for (int i = 0; i < count; i++) {
+        waitRequest(&array_of_requests[i],
+                    array_of_statuses == MPI_STATUSES_IGNORE
+                        ? MPI_STATUS_IGNORE : &array_of_statuses[i]);
+    }
+    return MPI_SUCCESS;
+}
+
+int MPI_Request_free(MPI_Request *request) {
+    releaseRequest(request, MPI_STATUS_IGNORE);
+    return MPI_SUCCESS;
+}
+
+int MPI_Barrier(MPI_Comm) {
+    return MPI_SUCCESS;
+}
+
+int MPI_Bcast(void *, int, MPI_Datatype, int, MPI_Comm) {
+    return MPI_SUCCESS;
+}
+
+int MPI_Reduce(NULL_CONST void *sendbuf, void *recvbuf, int count,
+               MPI_Datatype datatype, MPI_Op, int, MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, count, datatype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Allreduce(NULL_CONST void *sendbuf, void *recvbuf, int count,
+                  MPI_Datatype datatype, MPI_Op, MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, count, datatype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Gather(NULL_CONST void *sendbuf, int sendcount,
+               MPI_Datatype sendtype, void *recvbuf, int, MPI_Datatype, int,
+               MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, sendcount, sendtype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Scatter(NULL_CONST void *sendbuf, int sendcount,
+                MPI_Datatype sendtype, void *recvbuf, int, MPI_Datatype, int,
+                MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, sendcount, sendtype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Allgather(NULL_CONST void *sendbuf, int sendcount,
+                  MPI_Datatype sendtype, void *recvbuf, int, MPI_Datatype,
+                  MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, sendcount, sendtype);
+    return MPI_SUCCESS;
+}
+
+int MPI_Alltoall(NULL_CONST void *sendbuf, int sendcount,
+                 MPI_Datatype sendtype, void *recvbuf, int, MPI_Datatype,
+                 MPI_Comm) {
+    copyLocal(sendbuf, recvbuf, sendcount, sendtype);
+    return MPI_SUCCESS;
+}
+
+}
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi.h"
+
+/* How much of a nonblocking operation hides behind computation.  For each
+   operation and size it times the operation alone (start, then wait),
+   computation alone, and the two overlapped (start, compute, wait), with
+   as much computation as the operation takes.  overlap_pct is the share
+   of the operation's time the overlapped run saved: 100 when it was fully
+   hidden, 0 when nothing was.  The computation makes no MPI calls, so on
+   MPIs that only progress inside them only a progress thread helps; run
+   it with and without YOGI_PROGRESS_THREAD=1 to compare.
+
+   Operations are Iallreduce of doubles over all ranks and an exchange of
+   bytes with a partner rank by Isend and Irecv.  The optional argument
+   scales the iterations per row (default 100). */
+
+double compute(double seconds) {
+    double end = MPI_Wtime() + seconds, x = 1.0;
+    while (MPI_Wtime() < end) {
+        int i;
+        for (i = 0; i < 1000; i++) x = x * 1.0000001 + 1e-9;
+    }
+    return x;
+}
+
+/* Starts one operation of bytes bytes; returns the number of requests. */
+int startOp(int op, char *sendbuf, char *recvbuf, int bytes, int partner,
+            MPI_Request *requests) {
+    if (op == 0) {
+        MPI_Iallreduce(sendbuf, recvbuf, bytes / (int) sizeof(double),
+                       MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &requests[0]);
+        return 1;
+    }
+    if (partner < 0) return 0;
+    MPI_Irecv(recvbuf, bytes, MPI_BYTE, partner, 0, MPI_COMM_WORLD,
+              &requests[0]);
+    MPI_Isend(sendbuf, bytes, MPI_BYTE, partner, 0, MPI_COMM_WORLD,
+              &requests[1]);
+    return 2;
+}
+
+/* Mean seconds per iteration of the operation, with computeSeconds of
+   computation between its start and its wait. */
+double timeOp(int op, char *sendbuf, char *recvbuf, int bytes, int partner,
+              int iterations, double computeSeconds) {
+    MPI_Request requests[2];
+    double start, elapsed, sink = 0, slowest;
+    int i, count;
+    MPI_Barrier(MPI_COMM_WORLD);
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        count = startOp(op, sendbuf, recvbuf, bytes, partner, requests);
+        if (computeSeconds > 0) sink += compute(computeSeconds);
+        MPI_Waitall(count, requests, MPI_STATUSES_IGNORE);
+    }
+    elapsed = (MPI_Wtime() - start) / iterations;
+    MPI_Allreduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    if (sink == 42.0) printf(" ");
+    return slowest;
+}
+
+int main(int argc, char **argv) {
+    int sizes[] = {8192, 65536, 1 << 20, 4 << 20};
+    int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    const char *names[] = {"iallreduce", "isend_irecv"};
+    int rank, size, provided, partner, op, s, iterations, scale = 100;
+    double commTime, computeTime, totalTime, overlap;
+    char *sendbuf, *recvbuf;
+
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (argc > 1) scale = atoi(argv[1]);
+    if (scale < 1) scale = 1;
+    /* Ranks pair up; an odd one out only times the reductions. */
+    partner = rank ^ 1;
+    if (partner >= size) partner = -1;
+
+    sendbuf = (char *) malloc(sizes[numSizes - 1]);
+    recvbuf = (char *) malloc(sizes[numSizes - 1]);
+    memset(sendbuf, 0, sizes[numSizes - 1]);
+
+    if (rank == 0) {
+        printf("benchmark,bytes,iterations,comm_us,compute_us,total_us,"
+               "overlap_pct\n");
+    }
+    for (op = 0; op < 2; op++) {
+        for (s = 0; s < numSizes; s++) {
+            iterations = scale * 65536 / sizes[s];
+            if (iterations < 10) iterations = 10;
+            timeOp(op, sendbuf, recvbuf, sizes[s], partner, 2, 0);
+            commTime = timeOp(op, sendbuf, recvbuf, sizes[s], partner,
+                              iterations, 0);
+            computeTime = commTime;
+            totalTime = timeOp(op, sendbuf, recvbuf, sizes[s], partner,
+                               iterations, computeTime);
+            overlap = 100.0 * (commTime + computeTime - totalTime) / commTime;
+            if (overlap < 0) overlap = 0;
+            if (overlap > 100) overlap = 100;
+            if (rank == 0) {
+                printf("%s,%d,%d,%.1f,%.1f,%.1f,%.1f\n", names[op], sizes[s],
+                       iterations, commTime * 1e6, computeTime * 1e6,
+                       totalTime * 1e6, overlap);
+            }
+        }
+    }
+
+    free(sendbuf);
+    free(recvbuf);
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Persistent sends and receives around a ring, started many times from
+   the same array.  YogiMPI keeps the converted request array between
+   MPI_Startall calls, so this also frees the requests and creates new
+   ones in the same array: the Yogi handles come back the same, but the
+   MPI requests behind them are new.  YogiX_Startall_waitall runs the same
+   exchange in one call. */
+
+#define STEPS 20
+
+/* Create the ring's two persistent requests into requests[0..1]. */
+void createRing(int *sendval, int *recvval, int tag, MPI_Request *requests) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Recv_init(recvval, 1, MPI_INT, (rank + size - 1) % size, tag,
+                  MPI_COMM_WORLD, &requests[0]);
+    MPI_Send_init(sendval, 1, MPI_INT, (rank + 1) % size, tag,
+                  MPI_COMM_WORLD, &requests[1]);
+}
+
+int main(int argc, char **argv) {
+    int rank, size, round, step, errors = 0, totalErrors = 0;
+    int sendval, recvval, left;
+    MPI_Request requests[2];
+    MPI_Status statuses[2];
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    left = (rank + size - 1) % size;
+
+    for (round = 0; round < 3; round++) {
+        int tag = 10 + round;
+        createRing(&sendval, &recvval, tag, requests);
+        for (step = 0; step < STEPS; step++) {
+            sendval = rank * 1000 + round * 100 + step;
+            recvval = -1;
+            MPI_Startall(2, requests);
+            MPI_Waitall(2, requests, statuses);
+            if (recvval != left * 1000 + round * 100 + step) errors++;
+            if (statuses[0].MPI_SOURCE != left) errors++;
+            if (statuses[0].MPI_TAG != tag) errors++;
+            if (requests[0] == MPI_REQUEST_NULL) errors++;
+        }
+        for (step = 0; step < STEPS; step++) {
+            sendval = -(rank * 1000 + round * 100 + step);
+            recvval = 1;
+            if (step % 2) {
+                YogiX_Startall_waitall(2, requests, statuses);
+                if (statuses[0].MPI_SOURCE != left) errors++;
+            }
+            else {
+                YogiX_Startall_waitall(2, requests, MPI_STATUSES_IGNORE);
+            }
+            if (recvval != -(left * 1000 + round * 100 + step)) errors++;
+        }
+        MPI_Request_free(&requests[0]);
+        MPI_Request_free(&requests[1]);
+    }
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("persistent found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
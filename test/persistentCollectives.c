@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Allreduce and Alltoallv plans made once and started many times with
+   YogiX_Start.  Each plan is made twice: as MPI's persistent collective
+   where the MPI has them, and replayed, by the yogimpi_persistent info
+   key.  The buffers change between starts, so every start must read
+   them again, and the results are checked each time. */
+
+int errors = 0;
+
+struct range {
+    int first;
+    int last;
+};
+
+/* Joins adjacent ranges of ranks; associates but does not commute. */
+void joinRanges(void *in, void *inout, int *len, MPI_Datatype *datatype) {
+    struct range *a = in, *b = inout;
+    int i;
+    for (i = 0; i < *len; i++) {
+        if (a[i].last + 1 != b[i].first) a[i].first = -1000;
+        b[i].first = a[i].first;
+    }
+}
+
+void checkAllreduce(MPI_Comm comm, MPI_Info info) {
+    int rank, size, i, round;
+    int values[100], sums[100], inPlace[100];
+    struct range mine[10], joined[10];
+    YogiX_Plan sumPlan, inPlacePlan, joinPlan;
+    MPI_Request requests[2];
+    MPI_Op op;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Op_create(joinRanges, 0, &op);
+    YogiX_Allreduce_init(values, sums, 100, MPI_INT, MPI_SUM, comm, info,
+                         &sumPlan);
+    YogiX_Allreduce_init(MPI_IN_PLACE, inPlace, 100, MPI_INT, MPI_MAX, comm,
+                         info, &inPlacePlan);
+    YogiX_Allreduce_init(mine, joined, 10, MPI_2INT, op, comm, info,
+                         &joinPlan);
+
+    for (round = 0; round < 5; round++) {
+        for (i = 0; i < 100; i++) {
+            values[i] = rank + i + round;
+            inPlace[i] = rank * round - i;
+        }
+        YogiX_Start(sumPlan, &requests[0]);
+        YogiX_Start(inPlacePlan, &requests[1]);
+        MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+        for (i = 0; i < 100; i++) {
+            if (sums[i] != size * (size - 1) / 2 + size * (i + round)) {
+                errors++;
+            }
+            if (inPlace[i] != (size - 1) * round - i) errors++;
+        }
+        for (i = 0; i < 10; i++) {
+            mine[i].first = rank;
+            mine[i].last = rank;
+        }
+        /* Blocking starts, on the plan with a user op. */
+        YogiX_Start(joinPlan, NULL);
+        for (i = 0; i < 10; i++) {
+            if (joined[i].first != 0 || joined[i].last != size - 1) errors++;
+        }
+    }
+    YogiX_Plan_free(&sumPlan);
+    YogiX_Plan_free(&inPlacePlan);
+    YogiX_Plan_free(&joinPlan);
+    if (sumPlan != YogiX_PLAN_NULL) errors++;
+    MPI_Op_free(&op);
+}
+
+/* Rank r sends r + j + 1 values to rank j. */
+void checkAlltoallv(MPI_Comm comm, MPI_Info info) {
+    int rank, size, i, j, round, flag, total = 0;
+    int *sendcounts, *sdispls, *recvcounts, *rdispls, *sent, *received;
+    YogiX_Plan plan;
+    MPI_Request request;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    sendcounts = malloc(size * sizeof(int));
+    sdispls = malloc(size * sizeof(int));
+    recvcounts = malloc(size * sizeof(int));
+    rdispls = malloc(size * sizeof(int));
+    for (j = 0; j < size; j++) {
+        sendcounts[j] = rank + j + 1;
+        sdispls[j] = total;
+        total += sendcounts[j];
+    }
+    sent = malloc(total * sizeof(int));
+    total = 0;
+    for (j = 0; j < size; j++) {
+        recvcounts[j] = j + rank + 1;
+        rdispls[j] = total;
+        total += recvcounts[j];
+    }
+    received = malloc(total * sizeof(int));
+    YogiX_Alltoallv_init(sent, sendcounts, sdispls, MPI_INT, received,
+                         recvcounts, rdispls, MPI_INT, comm, info, &plan);
+    /* The plan keeps its own copies of the arrays. */
+    for (j = 0; j < size; j++) sendcounts[j] = recvcounts[j] = -1;
+
+    for (round = 0; round < 5; round++) {
+        for (j = 0; j < size; j++) {
+            for (i = 0; i < rank + j + 1; i++) {
+                sent[sdispls[j] + i] = rank * 1000 + j * 100 + i + round;
+            }
+        }
+        YogiX_Start(plan, &request);
+        flag = 0;
+        while (!flag) MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+        for (j = 0; j < size; j++) {
+            for (i = 0; i < j + rank + 1; i++) {
+                if (received[rdispls[j] + i] !=
+                    j * 1000 + rank * 100 + i + round) {
+                    errors++;
+                }
+            }
+        }
+    }
+    YogiX_Plan_free(&plan);
+    free(sendcounts);
+    free(sdispls);
+    free(recvcounts);
+    free(rdispls);
+    free(sent);
+    free(received);
+}
+
+int main(int argc, char **argv) {
+    int rank, pass, round, bad, totalErrors = 0;
+    int value = 1, counts[1] = {-1}, displs[1] = {0};
+    YogiX_Plan plan;
+    MPI_Info replay;
+    MPI_Comm half;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Info_create(&replay);
+    MPI_Info_set(replay, "yogimpi_persistent", "false");
+
+    for (pass = 0; pass < 2; pass++) {
+        MPI_Info info = pass == 0 ? MPI_INFO_NULL : replay;
+        checkAllreduce(MPI_COMM_WORLD, info);
+        checkAlltoallv(MPI_COMM_WORLD, info);
+        /* Freed plans and communicators reuse the same handles. */
+        for (round = 0; round < 3; round++) {
+            MPI_Comm_split(MPI_COMM_WORLD, (rank + round) % 2, rank, &half);
+            checkAllreduce(half, info);
+            checkAlltoallv(half, info);
+            MPI_Comm_free(&half);
+        }
+    }
+
+    /* Bad arguments are refused before anything is made. */
+    bad = YogiX_Allreduce_init(&value, &value, -1, MPI_INT, MPI_SUM,
+                               MPI_COMM_WORLD, MPI_INFO_NULL, &plan);
+    if (bad != MPI_ERR_COUNT) errors++;
+    bad = YogiX_Allreduce_init(&value, &value, 1, MPI_INT, MPI_OP_NULL,
+                               MPI_COMM_WORLD, MPI_INFO_NULL, &plan);
+    if (bad != MPI_ERR_OP) errors++;
+    bad = YogiX_Alltoallv_init(&value, counts, displs, MPI_INT, &value,
+                               counts, displs, MPI_INT, MPI_COMM_SELF,
+                               MPI_INFO_NULL, &plan);
+    if (bad != MPI_ERR_COUNT) errors++;
+    if (YogiX_Start(YogiX_PLAN_NULL, NULL) != MPI_ERR_ARG) errors++;
+
+    MPI_Info_free(&replay);
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("persistentCollectives found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Half round-trip latency of a small-message ping-pong between ranks 0 and
+   1.  Built through YogiMPI and natively by "make bench", like
+   sendOverhead.  Run with two ranks. */
+
+#define WARMUP 1000
+
+double pingPong(int bytes, int iterations, int rank, char *buffer) {
+    int i;
+    double start = 0.0;
+
+    for (i = -WARMUP; i < iterations; i++) {
+        if (i == 0) {
+            MPI_Barrier(MPI_COMM_WORLD);
+            start = MPI_Wtime();
+        }
+        if (rank == 0) {
+            MPI_Send(buffer, bytes, MPI_CHAR, 1, 0, MPI_COMM_WORLD);
+            MPI_Recv(buffer, bytes, MPI_CHAR, 1, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+        }
+        else if (rank == 1) {
+            MPI_Recv(buffer, bytes, MPI_CHAR, 0, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            MPI_Send(buffer, bytes, MPI_CHAR, 0, 0, MPI_COMM_WORLD);
+        }
+    }
+    return (MPI_Wtime() - start) * 1e6 / (2.0 * iterations);
+}
+
+int main(int argc, char **argv) {
+    int rank, size, bytes;
+    int iterations = 100000;
+    char *buffer;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (argc > 1) iterations = atoi(argv[1]);
+    if (size < 2) {
+        if (rank == 0) printf("pingPong needs two ranks.\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    buffer = (char *) calloc(1024, 1);
+    if (rank == 0) printf("%10s %14s\n", "bytes", "latency (us)");
+    for (bytes = 0; bytes <= 1024; bytes = bytes ? bytes * 4 : 1) {
+        double latency = pingPong(bytes, iterations, rank, buffer);
+        if (rank == 0) printf("%10d %14.3f\n", bytes, latency);
+    }
+    free(buffer);
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "mpi.h"
+
+/* YogiMPI's progress thread finishing collectives while the application
+   makes no MPI calls.  The test turns on the thread and YogiMPI's own
+   nonblocking collectives, which otherwise only move on inside MPI calls.
+   After a pause long enough for the thread, a single MPI_Test must find
+   each collective done, and plain MPI_Init must give the thread too. */
+
+int errors = 0;
+
+void checkOverlap(MPI_Comm comm, int round) {
+    int rank, size, i, flag = 0;
+    int values[1000], sums[1000];
+    MPI_Request request;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    for (i = 0; i < 1000; i++) values[i] = rank + i + round;
+    MPI_Iallreduce(values, sums, 1000, MPI_INT, MPI_SUM, comm, &request);
+    usleep(300000);
+    MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+    if (!flag) {
+        errors++;
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+    }
+    for (i = 0; i < 1000; i++) {
+        if (sums[i] != size * (size - 1) / 2 + size * (i + round)) errors++;
+    }
+}
+
+int main(int argc, char **argv) {
+    int rank, round, totalErrors = 0;
+    MPI_Request request;
+
+    setenv("YOGI_PROGRESS_THREAD", "1", 0);
+    setenv("YOGI_EMULATE_COLLECTIVES", "1", 0);
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    for (round = 0; round < 3; round++) checkOverlap(MPI_COMM_WORLD, round);
+    /* Waiting blocks in MPI while the thread does the work. */
+    MPI_Ibarrier(MPI_COMM_WORLD, &request);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("progressThread found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
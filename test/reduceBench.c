@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi.h"
+
+/* Throughput of MPI_Reduce_local for common ops and datatypes, from
+   cache-resident to memory-bound sizes, on one process.  Built natively it
+   times the MPI library's own loops; through YogiMPI it times YogiMPI's
+   kernels, whose instruction set YOGI_REDUCE_KERNELS caps.  The output has
+   the CSV columns of microBench, so benchCompare.py reads it too.
+
+   The optional argument scales the amount of data combined per row
+   (default 256 MB). */
+
+struct doubleInt {
+    double value;
+    int index;
+};
+
+struct reduction {
+    const char *name;
+    MPI_Op op;
+    MPI_Datatype datatype;
+    int size;
+};
+
+int main(int argc, char **argv) {
+    long long volume = 256LL << 20;
+    int sizes[] = {256, 4096, 65536, 1 << 20, 16 << 20};
+    int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    int r, s, i, iterations;
+    double start, seconds;
+    char *in, *inout;
+    struct reduction reductions[8];
+
+    MPI_Init(&argc, &argv);
+    if (argc > 1) volume = atoll(argv[1]) << 20;
+    reductions[0].name = "sum_double";
+    reductions[0].op = MPI_SUM;
+    reductions[0].datatype = MPI_DOUBLE;
+    reductions[0].size = sizeof(double);
+    reductions[1].name = "sum_float";
+    reductions[1].op = MPI_SUM;
+    reductions[1].datatype = MPI_FLOAT;
+    reductions[1].size = sizeof(float);
+    reductions[2].name = "sum_int";
+    reductions[2].op = MPI_SUM;
+    reductions[2].datatype = MPI_INT;
+    reductions[2].size = sizeof(int);
+    reductions[3].name = "max_double";
+    reductions[3].op = MPI_MAX;
+    reductions[3].datatype = MPI_DOUBLE;
+    reductions[3].size = sizeof(double);
+    reductions[4].name = "min_int64";
+    reductions[4].op = MPI_MIN;
+    reductions[4].datatype = MPI_INT64_T;
+    reductions[4].size = 8;
+    reductions[5].name = "prod_double";
+    reductions[5].op = MPI_PROD;
+    reductions[5].datatype = MPI_DOUBLE;
+    reductions[5].size = sizeof(double);
+    reductions[6].name = "bxor_uint8";
+    reductions[6].op = MPI_BXOR;
+    reductions[6].datatype = MPI_UINT8_T;
+    reductions[6].size = 1;
+    reductions[7].name = "maxloc_double_int";
+    reductions[7].op = MPI_MAXLOC;
+    reductions[7].datatype = MPI_DOUBLE_INT;
+    reductions[7].size = sizeof(struct doubleInt);
+
+    in = (char *) malloc(sizes[numSizes - 1]);
+    inout = (char *) malloc(sizes[numSizes - 1]);
+    /* Values that stay finite under repeated products. */
+    for (i = 0; i < sizes[numSizes - 1] / (int) sizeof(double); i++) {
+        ((double *) in)[i] = 1.0;
+        ((double *) inout)[i] = 1.0;
+    }
+
+    printf("benchmark,bytes,iterations,ns_per_op,mb_per_s\n");
+    for (r = 0; r < 8; r++) {
+        for (s = 0; s < numSizes; s++) {
+            int count = sizes[s] / reductions[r].size;
+            int bytes = count * reductions[r].size;
+            iterations = (int) (volume / bytes);
+            if (iterations < 4) iterations = 4;
+            MPI_Reduce_local(in, inout, count, reductions[r].datatype,
+                             reductions[r].op);
+            start = MPI_Wtime();
+            for (i = 0; i < iterations; i++) {
+                MPI_Reduce_local(in, inout, count, reductions[r].datatype,
+                                 reductions[r].op);
+            }
+            seconds = MPI_Wtime() - start;
+            printf("reduce_local_%s,%d,%d,%.1f,%.1f\n", reductions[r].name,
+                   bytes, iterations, seconds * 1e9 / iterations,
+                   (double) bytes * iterations / seconds / 1e6);
+        }
+    }
+
+    free(in);
+    free(inout);
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+
+/* Per-call cost of zero-byte MPI_Send.  Built twice by "make bench": once
+   through YogiMPI and once against the native MPI, so the difference
+   between the two runs is the cost of the translation layer.
+
+   Sends to MPI_PROC_NULL return without communicating and show the pure
+   wrapper cost.  Sends from rank 0 to rank 1 add the library's own eager
+   path.  Run with two ranks. */
+
+#define WARMUP 1000
+
+double timeSends(int dest, int iterations, int rank) {
+    int i;
+    double start;
+    char buffer = 0;
+
+    for (i = 0; i < WARMUP; i++) {
+        if (rank == 0) {
+            MPI_Send(&buffer, 0, MPI_CHAR, dest, 0, MPI_COMM_WORLD);
+        }
+        else if (rank == dest) {
+            MPI_Recv(&buffer, 0, MPI_CHAR, 0, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+        }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    start = MPI_Wtime();
+    for (i = 0; i < iterations; i++) {
+        if (rank == 0) {
+            MPI_Send(&buffer, 0, MPI_CHAR, dest, 0, MPI_COMM_WORLD);
+        }
+        else if (rank == dest) {
+            MPI_Recv(&buffer, 0, MPI_CHAR, 0, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+        }
+    }
+    return (MPI_Wtime() - start) * 1e9 / iterations;
+}
+
+int main(int argc, char **argv) {
+    int rank, size;
+    int iterations = 1000000;
+    double nullCost, peerCost;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (argc > 1) iterations = atoi(argv[1]);
+    if (size < 2) {
+        if (rank == 0) printf("sendOverhead needs two ranks.\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    nullCost = timeSends(MPI_PROC_NULL, iterations, rank);
+    peerCost = timeSends(1, iterations / 10, rank);
+    if (rank == 0) {
+        printf("%-28s %10.1f ns/call\n", "MPI_Send to MPI_PROC_NULL",
+               nullCost);
+        printf("%-28s %10.1f ns/call\n", "MPI_Send 0 bytes to rank 1",
+               peerCost);
+    }
+    MPI_Finalize();
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include "mpi.h"
 #include <stdio.h>
 #include <time.h>
+#include <assert.h>
 
 int main(int argc, char *argv[])
 {
@@ -25,15 +26,19 @@ int main(int argc, char *argv[])
             MPI_Irecv(&buffer[i], 1, MPI_INT, i, 123, MPI_COMM_WORLD, &r[i-1]);
         }
         flag = 0;
+        for (i=0; i<size-1; i++) status[i].MPI_TAG = -7;
         MPI_Testall(size-1, r, &flag, status);
         while (!flag)
         {
             struct timespec sleepTime, remaining;
+            /* No status is touched until all are done. */
+            for (i=0; i<size-1; i++) assert(status[i].MPI_TAG == -7);
             sleepTime.tv_sec = 0;
             sleepTime.tv_nsec = 10000;
             nanosleep(&sleepTime, &remaining);
             MPI_Testall(size-1, r, &flag, status);
         }
+        for (i=0; i<size-1; i++) assert(status[i].MPI_TAG == 123);
     }
     else
     {
@@ -5,7 +5,7 @@
 int main(int argc, char* argv[])
 {
     MPI_Comm dup_comm_world, world_comm;
-    MPI_Group world_group;
+    MPI_Group world_group, first_group, second_group;
     int world_rank, world_size, rank, size;
 
     MPI_Init(&argc, &argv);
@@ -18,6 +18,15 @@ int main(int argc, char* argv[])
     MPI_Comm_create(dup_comm_world, world_group, &world_comm);
     MPI_Comm_rank(world_comm, &rank);
     assert(rank == world_rank);
+    /* MPI may return the same group object twice; each handle is still
+       freed on its own. */
+    MPI_Comm_group(dup_comm_world, &first_group);
+    MPI_Comm_group(dup_comm_world, &second_group);
+    assert(MPI_Group_free(&first_group) == MPI_SUCCESS);
+    MPI_Group_size(second_group, &size);
+    assert(size == world_size);
+    assert(MPI_Group_free(&second_group) == MPI_SUCCESS);
+    assert(MPI_Group_free(&world_group) == MPI_SUCCESS);
     MPI_Finalize();
     return 0;
 }
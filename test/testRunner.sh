@@ -0,0 +1,4 @@
+#!/bin/bash
+
+export LD_LIBRARY_PATH=/tmp/yinstall/lib:$LD_LIBRARY_PATH
+mpirun -np ${1} ${2}
@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <pthread.h>
+#include "mpi.h"
+
+/* Stress test for MPI_THREAD_MULTIPLE: every thread on every rank posts and
+   completes its own nonblocking requests at the same time, so the request
+   handles are created and released concurrently.  Run with an even number
+   of ranks; each rank pairs up with rank ^ 1. */
+
+#define NUM_THREADS 32
+#define ITERATIONS 200
+#define BATCH 4
+
+typedef struct {
+    int thread;
+    int rank;
+    int partner;
+    int errors;
+} ThreadArgs;
+
+void *exchange(void *arg) {
+    ThreadArgs *args = (ThreadArgs *) arg;
+    MPI_Request requests[2 * BATCH];
+    int sendValues[BATCH], recvValues[BATCH];
+    int i, j, done;
+
+    for (i = 0; i < ITERATIONS; i++) {
+        for (j = 0; j < BATCH; j++) {
+            sendValues[j] = (args->rank * NUM_THREADS + args->thread) *
+                            ITERATIONS * BATCH + i * BATCH + j;
+            recvValues[j] = -1;
+            MPI_Irecv(&recvValues[j], 1, MPI_INT, args->partner,
+                      args->thread, MPI_COMM_WORLD, &requests[j]);
+        }
+        for (j = 0; j < BATCH; j++) {
+            MPI_Isend(&sendValues[j], 1, MPI_INT, args->partner,
+                      args->thread, MPI_COMM_WORLD, &requests[BATCH + j]);
+        }
+
+        /* Alternate between blocking and polled completion. */
+        if (i % 2 == 0) {
+            MPI_Waitall(2 * BATCH, requests, MPI_STATUSES_IGNORE);
+        }
+        else {
+            done = 0;
+            while (!done) {
+                MPI_Testall(2 * BATCH, requests, &done,
+                            MPI_STATUSES_IGNORE);
+            }
+        }
+
+        for (j = 0; j < 2 * BATCH; j++) {
+            if (requests[j] != MPI_REQUEST_NULL) args->errors++;
+        }
+        for (j = 0; j < BATCH; j++) {
+            int expected = (args->partner * NUM_THREADS + args->thread) *
+                           ITERATIONS * BATCH + i * BATCH + j;
+            if (recvValues[j] != expected) args->errors++;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int provided, rank, size, t;
+    int errors = 0, totalErrors = 0;
+    pthread_t threads[NUM_THREADS];
+    ThreadArgs args[NUM_THREADS];
+
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (provided < MPI_THREAD_MULTIPLE) {
+        if (rank == 0) {
+            printf("MPI_THREAD_MULTIPLE not available, skipping.\n");
+        }
+        MPI_Finalize();
+        return 0;
+    }
+    if (size % 2 != 0) {
+        if (rank == 0) printf("threadRequests needs an even rank count.\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    for (t = 0; t < NUM_THREADS; t++) {
+        args[t].thread = t;
+        args[t].rank = rank;
+        args[t].partner = rank ^ 1;
+        args[t].errors = 0;
+        pthread_create(&threads[t], NULL, exchange, &args[t]);
+    }
+    for (t = 0; t < NUM_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        errors += args[t].errors;
+    }
+
+    MPI_Allreduce(&errors, &totalErrors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (rank == 0 && totalErrors > 0) {
+        printf("threadRequests found %d errors.\n", totalErrors);
+    }
+    MPI_Finalize();
+    return totalErrors > 0 ? 1 : 0;
+}
@@ -37,8 +37,11 @@ int main(int argc, char *argv[])
         remaining = size-1;
         while (remaining > 0)
         {
+            for (i=0; i<size-1; i++) status[i].MPI_TAG = -7;
             MPI_Waitsome(size-1, request, &count, index, status);
             assert(count != MPI_UNDEFINED);
+            /* Only the statuses MPI wrote are touched. */
+            for (i=count; i<size-1; i++) assert(status[i].MPI_TAG == -7);
             if (count > 0)
             {
                 remaining = remaining - count;